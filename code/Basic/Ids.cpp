@@ -1,11 +1,52 @@
 #include "Basic/Ids.h"
 
+#include <cassert>
+
 namespace rust_compiler::basic {
 
+namespace {
+
+NodeIdAllocator processAllocator;
+
+NodeIdAllocator *currentAllocator = &processAllocator;
+
+thread_local NodeIdRange *currentRange = nullptr;
+
+} // namespace
+
+void NodeIdAllocator::install() {
+  outer = currentAllocator;
+  currentAllocator = this;
+}
+
+void NodeIdAllocator::uninstall() {
+  assert(currentAllocator == this && "allocators are uninstalled in LIFO");
+  currentAllocator = outer;
+  outer = nullptr;
+}
+
+NodeIdAllocator &getNodeIdAllocator() { return *currentAllocator; }
+
 NodeId getNextNodeId() {
-  static NodeId iter = 7;
-  ++iter;
-  return iter;
+  if (NodeIdRange *range = currentRange) {
+    if (range->next == range->end) {
+      range->exhausted = true;
+      return UNKNOWN_NODEID;
+    }
+    return range->next++;
+  }
+  return currentAllocator->allocate();
+}
+
+NodeId reserveNodeIds(uint32_t count) {
+  return currentAllocator->reserve(count);
+}
+
+NodeIdRange::NodeIdRange(NodeId begin, NodeId end)
+    : next(begin), end(end), outer(currentRange) {
+  currentRange = this;
 }
 
+NodeIdRange::~NodeIdRange() { currentRange = outer; }
+
 } // namespace rust_compiler::basic
@@ -0,0 +1,34 @@
+#include "Location.h"
+
+#include "Basic/SourceManager.h"
+
+#include <llvm/Support/FormatVariadic.h>
+
+namespace rust_compiler {
+
+using basic::getSourceManager;
+
+Location::Location(std::string_view fileName, unsigned lineNumber,
+                   unsigned columnNumber)
+    : Location(getSourceManager().getExplicitLocation(fileName, lineNumber,
+                                                      columnNumber)) {}
+
+std::string_view Location::getFileName() const {
+  return getSourceManager().getFileName(*this);
+}
+
+unsigned Location::getLineNumber() const {
+  return getSourceManager().getLineNumber(*this);
+}
+
+unsigned Location::getColumnNumber() const {
+  return getSourceManager().getColumnNumber(*this);
+}
+
+std::string Location::toString() const {
+  return llvm::formatv("{2} {0}:{1}", getLineNumber(), getColumnNumber(),
+                       getFileName())
+      .str();
+}
+
+} // namespace rust_compiler
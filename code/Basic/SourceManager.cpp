@@ -0,0 +1,257 @@
+#include "Basic/SourceManager.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <llvm/Support/raw_ostream.h>
+
+namespace rust_compiler::basic {
+
+SourceManager::SourceManager() {
+  // the default, builtin, and empty Locations
+  getExplicitLocation("default.constructor.rs",
+                      std::numeric_limits<unsigned>::max(),
+                      std::numeric_limits<unsigned>::max());
+  getExplicitLocation("builtins.cpp", std::numeric_limits<unsigned>::max(),
+                      std::numeric_limits<unsigned>::max());
+  getExplicitLocation("empty.cpp", std::numeric_limits<unsigned>::max(),
+                      std::numeric_limits<unsigned>::max());
+}
+
+FileId SourceManager::addEntry(std::string_view fileName, uint32_t size,
+                               std::unique_ptr<llvm::MemoryBuffer> buffer,
+                               unsigned lineNumber, unsigned columnNumber) {
+  std::optional<FileId> file = tryAddEntry(fileName, size, std::move(buffer),
+                                           lineNumber, columnNumber);
+  if (!file) {
+    llvm::errs() << fileName << ": ran out of source locations"
+                 << "\n";
+    exit(EXIT_FAILURE);
+  }
+  return *file;
+}
+
+std::optional<FileId>
+SourceManager::tryAddEntry(std::string_view fileName, uint32_t size,
+                           std::unique_ptr<llvm::MemoryBuffer> buffer,
+                           unsigned lineNumber, unsigned columnNumber) {
+  std::unique_lock<std::shared_mutex> lock(mutex);
+
+  if (std::numeric_limits<uint32_t>::max() - nextOffset < size)
+    return std::nullopt;
+
+  Entry &entry = entries.emplace_back(nextOffset, size, fileName);
+  entry.buffer = std::move(buffer);
+  entry.lineNumber = lineNumber;
+  entry.columnNumber = columnNumber;
+  nextOffset += size;
+  return entries.size() - 1;
+}
+
+FileId SourceManager::loadFile(std::string_view path) {
+  return loadFile(path, path);
+}
+
+FileId SourceManager::loadFile(std::string_view path,
+                               std::string_view fileName) {
+  llvm::Expected<FileId> file = tryLoadFile(path, fileName);
+  if (!file) {
+    llvm::errs() << llvm::toString(file.takeError()) << "\n";
+    exit(EXIT_FAILURE);
+  }
+  return *file;
+}
+
+llvm::Expected<FileId> SourceManager::tryLoadFile(std::string_view path,
+                                                  std::string_view fileName) {
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer =
+      llvm::MemoryBuffer::getFile(path, /*IsText=*/false,
+                                  /*RequiresNullTerminator=*/false);
+  if (!buffer)
+    return llvm::createStringError(buffer.getError(), "could not load: %s: %s",
+                                   std::string(path).c_str(),
+                                   buffer.getError().message().c_str());
+
+  // one more offset for the end of the file
+  size_t size = (*buffer)->getBufferSize() + 1;
+  if (size > std::numeric_limits<uint32_t>::max())
+    return llvm::createStringError(std::errc::file_too_large,
+                                   "%s: file is too large",
+                                   std::string(path).c_str());
+
+  std::optional<FileId> file =
+      tryAddEntry(fileName, size, std::move(*buffer), 0, 0);
+  if (!file)
+    return llvm::createStringError(std::errc::value_too_large,
+                                   "%s: ran out of source locations",
+                                   std::string(fileName).c_str());
+  return *file;
+}
+
+FileId SourceManager::addBuffer(std::string_view fileName,
+                                std::string_view code) {
+  if (code.size() >= std::numeric_limits<uint32_t>::max()) {
+    llvm::errs() << fileName << ": file is too large"
+                 << "\n";
+    exit(EXIT_FAILURE);
+  }
+
+  return addEntry(fileName, code.size() + 1,
+                  llvm::MemoryBuffer::getMemBufferCopy(
+                      llvm::StringRef(code.data(), code.size()), fileName));
+}
+
+FileId SourceManager::replaceBuffer(FileId file, std::string_view code) {
+  if (code.size() >= std::numeric_limits<uint32_t>::max()) {
+    llvm::errs() << getFileName(file) << ": file is too large"
+                 << "\n";
+    exit(EXIT_FAILURE);
+  }
+
+  // entries never move, and neither do their file names
+  std::string_view fileName = getFileName(file);
+  std::unique_ptr<llvm::MemoryBuffer> buffer =
+      llvm::MemoryBuffer::getMemBufferCopy(
+          llvm::StringRef(code.data(), code.size()), fileName);
+
+  uint64_t size;
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    Entry &entry = entries[file];
+    assert(entry.buffer && "not a loaded file");
+    if (code.size() < entry.size) {
+      entry.buffer = std::move(buffer);
+      entry.lineStarts.clear();
+      entry.lineStartsFlag = std::make_unique<std::once_flag>();
+      return file;
+    }
+    entry.buffer.reset();
+    entry.lineStarts.clear();
+    size = entry.size;
+  }
+
+  uint64_t newSize = std::min<uint64_t>(
+      std::max<uint64_t>(size * 2, code.size() + 1),
+      std::numeric_limits<uint32_t>::max());
+  return addEntry(fileName, newSize, std::move(buffer));
+}
+
+Location SourceManager::getExplicitLocation(std::string_view fileName,
+                                            unsigned lineNumber,
+                                            unsigned columnNumber) {
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = explicitLocations.find(
+        std::make_tuple(fileName, lineNumber, columnNumber));
+    if (it != explicitLocations.end())
+      return it->second;
+  }
+
+  FileId file = addEntry(fileName, 1, nullptr, lineNumber, columnNumber);
+  Location loc = getLocation(file, 0);
+
+  std::unique_lock<std::shared_mutex> lock(mutex);
+  // another thread may have added the same location in the meantime
+  return explicitLocations
+      .try_emplace(std::make_tuple(std::string(fileName), lineNumber,
+                                   columnNumber),
+                   loc)
+      .first->second;
+}
+
+std::string_view SourceManager::getBuffer(FileId file) const {
+  const llvm::MemoryBuffer *buffer = getMemoryBuffer(file);
+  return std::string_view(buffer->getBufferStart(), buffer->getBufferSize());
+}
+
+const llvm::MemoryBuffer *SourceManager::getMemoryBuffer(FileId file) const {
+  std::shared_lock<std::shared_mutex> lock(mutex);
+  assert(file < entries.size() && entries[file].buffer);
+  return entries[file].buffer.get();
+}
+
+std::string_view SourceManager::getFileName(FileId file) const {
+  std::shared_lock<std::shared_mutex> lock(mutex);
+  assert(file < entries.size());
+  return entries[file].fileName;
+}
+
+Location SourceManager::getLocation(FileId file, uint32_t offset) const {
+  std::shared_lock<std::shared_mutex> lock(mutex);
+  assert(file < entries.size() && offset < entries[file].size);
+  return Location::fromRawEncoding(entries[file].base + offset);
+}
+
+FileId SourceManager::getFileId(Location loc) const {
+  uint32_t id = loc.getRawEncoding();
+  std::shared_lock<std::shared_mutex> lock(mutex);
+  assert(id < nextOffset && "unknown location");
+  auto it = std::upper_bound(
+      entries.begin(), entries.end(), id,
+      [](uint32_t id, const Entry &entry) { return id < entry.base; });
+  return it - entries.begin() - 1;
+}
+
+/// Entries are only modified by replaceBuffer, which invalidates the
+/// Locations into the old buffer, and by building the line table, which is
+/// guarded by its once_flag.
+const SourceManager::Entry &SourceManager::getEntry(Location loc) const {
+  FileId file = getFileId(loc);
+  std::shared_lock<std::shared_mutex> lock(mutex);
+  return entries[file];
+}
+
+uint32_t SourceManager::getFileOffset(Location loc) const {
+  return loc.getRawEncoding() - getEntry(loc).base;
+}
+
+const std::vector<uint32_t> &
+SourceManager::getLineStarts(const Entry &entry) const {
+  std::call_once(*entry.lineStartsFlag, [&]() {
+    const char *start = entry.buffer->getBufferStart();
+    const char *begin = start;
+    const char *end = entry.buffer->getBufferEnd();
+    entry.lineStarts.push_back(0);
+    while (const char *newLine =
+               static_cast<const char *>(memchr(begin, '\n', end - begin))) {
+      begin = newLine + 1;
+      entry.lineStarts.push_back(begin - start);
+    }
+  });
+  return entry.lineStarts;
+}
+
+std::string_view SourceManager::getFileName(Location loc) const {
+  return getEntry(loc).fileName;
+}
+
+unsigned SourceManager::getLineNumber(Location loc) const {
+  const Entry &entry = getEntry(loc);
+  if (!entry.buffer)
+    return entry.lineNumber;
+
+  const std::vector<uint32_t> &lineStarts = getLineStarts(entry);
+  uint32_t offset = loc.getRawEncoding() - entry.base;
+  return std::upper_bound(lineStarts.begin(), lineStarts.end(), offset) -
+         lineStarts.begin();
+}
+
+unsigned SourceManager::getColumnNumber(Location loc) const {
+  const Entry &entry = getEntry(loc);
+  if (!entry.buffer)
+    return entry.columnNumber;
+
+  const std::vector<uint32_t> &lineStarts = getLineStarts(entry);
+  uint32_t offset = loc.getRawEncoding() - entry.base;
+  return offset -
+         *(std::upper_bound(lineStarts.begin(), lineStarts.end(), offset) - 1);
+}
+
+SourceManager &getSourceManager() {
+  static SourceManager sourceManager;
+  return sourceManager;
+}
+
+} // namespace rust_compiler::basic
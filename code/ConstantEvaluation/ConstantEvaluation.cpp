@@ -8,10 +8,12 @@
 #include "AST/OperatorExpression.h"
 #include "AST/PathExpression.h"
 #include "AST/VisItem.h"
+#include "Lexer/Literal.h"
 
 #include <cstdlib>
-#include <llvm/ADT/APInt.h>
+#include <limits>
 #include <llvm/Support/raw_ostream.h>
+#include <optional>
 
 using namespace rust_compiler::ast;
 
@@ -133,15 +135,11 @@ uint64_t ConstantEvaluation::foldAsUsize(const ast::LiteralExpression *lit) {
     exit(EXIT_FAILURE);
   }
 
-  llvm::APInt result;
+  std::optional<lexer::uint128_t> value =
+      lexer::parseIntegerLiteral(lit->getValue());
 
-  std::string storage = lit->getValue();
-  llvm::StringRef(storage).getAsInteger(10, result);
-
-  unsigned bitWidth = result.getBitWidth();
-
-  if (bitWidth <= 64)
-    return result.getLimitedValue();
+  if (value && *value <= std::numeric_limits<uint64_t>::max())
+    return static_cast<uint64_t>(*value);
 
   llvm::errs() << "failed to fold literal"
                << "\n";
@@ -181,7 +179,8 @@ uint64_t ConstantEvaluation::foldAsUsize(const ast::Item *item) {
   case ItemKind::VisItem: {
     return foldAsUsize(static_cast<const ast::VisItem *>(item));
   }
-  case ItemKind::MacroItem: {
+  case ItemKind::MacroItem:
+  case ItemKind::ErrorItem: {
     assert(false);
   }
   }
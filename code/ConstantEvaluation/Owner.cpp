@@ -53,6 +53,9 @@ std::optional<Owner> ConstantEvaluation::getOwner(basic::NodeId id,
   case ItemKind::MacroItem: {
     assert(false);
   }
+  case ItemKind::ErrorItem: {
+    break;
+  }
   }
 
   llvm::errs() << "item failed"
@@ -244,6 +247,9 @@ std::optional<Owner> ConstantEvaluation::getOwner(basic::NodeId id,
   case StatementKind::MacroInvocationSemi: {
     assert(false);
   }
+  case StatementKind::ErrorStatement: {
+    return std::nullopt;
+  }
   }
 }
 
@@ -1,5 +1,6 @@
 #include "CrateLoader/CrateLoader.h"
 
+#include "CrateLoader/ModuleLexer.h"
 #include "LoadModule.h"
 #include "TyCtx/TyCtx.h"
 
@@ -16,21 +17,25 @@ namespace rust_compiler::crate_loader {
 
 std::shared_ptr<ast::Crate> loadCrate(std::string_view path,
                                       std::string_view crateName,
-                                      basic::CrateNum crateNum, LoadMode mode) {
+                                      basic::CrateNum crateNum, LoadMode mode,
+                                      llvm::ThreadPoolStrategy strategy) {
   llvm::SmallVector<char, 128> libFile{path.begin(), path.end()};
 
   llvm::outs() << "loadCrate: " << path << ":" << crateName << "\n";
 
   tyctx::TyCtx* ctx = rust_compiler::session::session->getTypeContext();
 
+  ModuleLexer lexer(strategy);
+
   if (mode == LoadMode::File) {
     if (not llvm::sys::fs::exists(libFile)) {
       llvm::errs() << "could not find file: " << libFile << "\n";
       exit(EXIT_FAILURE);
     }
 
-    std::shared_ptr<ast::Crate> crate = loadRootModule(
-        libFile, llvm::sys::path::filename(path), crateName, crateNum);
+    std::shared_ptr<ast::Crate> crate =
+        loadRootModule(libFile, llvm::sys::path::filename(path), crateName,
+                       crateNum, lexer);
 
     ctx->insertASTCrate(crate.get(), crateNum);
 
@@ -46,9 +51,7 @@ std::shared_ptr<ast::Crate> loadCrate(std::string_view path,
     }
 
     std::shared_ptr<ast::Crate> crate =
-        loadRootModule(libFile, "lib.rs", crateName, crateNum);
-
-    // FIXME load and merge tree
+        loadRootModule(libFile, "lib.rs", crateName, crateNum, lexer);
 
     ctx->insertASTCrate(crate.get(), crateNum);
 
@@ -1,10 +1,11 @@
 #include "LoadModule.h"
 
-#include "Lexer/Lexer.h"
+#include "AST/VisItem.h"
 #include "Parser/Parser.h"
 
+#include <llvm/ADT/SmallString.h>
 #include <llvm/Support/FileSystem.h>
-#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/raw_ostream.h>
 // #include <mlir/IR/Location.h>
 // #include <mlir/Support/LogicalResult.h>
@@ -15,10 +16,22 @@ using namespace llvm;
 
 namespace rust_compiler::crate_loader {
 
+namespace {
+
+/// prints the syntax errors the parser recovered from; returns their number
+size_t reportErrors(std::string_view file, const Parser &parser) {
+  for (const adt::Error &error : parser.getErrors())
+    llvm::errs() << "syntax error in " << file << ": " << error << "\n";
+  return parser.getErrors().size();
+}
+
+} // namespace
+
 std::shared_ptr<ast::Crate> loadRootModule(llvm::SmallVectorImpl<char> &libPath,
                                            std::string_view fileName,
                                            std::string_view crateName,
-                                           basic::CrateNum crateNum) {
+                                           basic::CrateNum crateNum,
+                                           ModuleLexer &lexer) {
 
   if (not llvm::sys::fs::exists(libPath)) {
     llvm::outs() << "file: " << libPath << "does not exits"
@@ -26,32 +39,107 @@ std::shared_ptr<ast::Crate> loadRootModule(llvm::SmallVectorImpl<char> &libPath,
     exit(EXIT_FAILURE);
   }
 
-  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> outputBuffer =
-      llvm::MemoryBuffer::getFile(libPath, true);
-  if (!outputBuffer) {
-    llvm::outs() << "could not load: " << libPath << "\n";
+  std::string_view path = {libPath.data(), libPath.size()};
+  lexer.lexRootModule(path, fileName);
+
+  llvm::Expected<const lexer::TokenStream &> ts =
+      lexer.getTokenStream(path);
+  if (!ts) {
+    llvm::errs() << llvm::toString(ts.takeError()) << "\n";
     exit(EXIT_FAILURE);
   }
 
-  std::string str((*outputBuffer)->getBufferStart(),
-                  (*outputBuffer)->getBufferEnd());
-
-  lexer::TokenStream ts = lexer::lex(str, fileName);
-
-  Parser parser = {ts};
+  // the arena of the whole crate, the module Parsers share it
+  Parser parser = {*ts, std::make_shared<ast::ASTContext>()};
+  // report all syntax errors of the crate in one run
+  parser.setRecoverFromErrors(true);
 
   StringResult<std::shared_ptr<ast::Crate>> crate =
       parser.parseCrateModule(crateName, crateNum);
   if (!crate) {
     llvm::errs() << "failed to parse crate module in load root module: "
                  << crate.getError() << "\n";
-    // printFunctionStack();
+    parser.printFunctionStack();
     exit(EXIT_FAILURE);
   }
+  size_t errors = reportErrors(path, parser);
+
+  std::shared_ptr<ast::Crate> root = crate.getValue();
+  std::vector<std::shared_ptr<ast::Item>> items = root->getItems();
+  errors += loadModules(items,
+                        ModuleLexer::getModuleDirectory(path, /*isRoot=*/true),
+                        lexer, root->getASTContext());
 
-  // todo
+  if (errors > 0) {
+    llvm::errs() << "aborting due to " << errors << " syntax errors\n";
+    exit(EXIT_FAILURE);
+  }
 
-  return crate.getValue();
+  return root;
+}
+
+size_t loadModules(std::span<std::shared_ptr<ast::Item>> items,
+                   std::string_view directory, ModuleLexer &lexer,
+                   std::shared_ptr<ast::ASTContext> context) {
+  size_t errors = 0;
+  for (std::shared_ptr<ast::Item> &item : items) {
+    if (item->getItemKind() != ast::ItemKind::VisItem)
+      continue;
+    std::shared_ptr<ast::VisItem> visItem =
+        std::static_pointer_cast<ast::VisItem>(item);
+    if (visItem->getKind() != ast::VisItemKind::Module)
+      continue;
+    std::shared_ptr<ast::Module> module =
+        std::static_pointer_cast<ast::Module>(visItem);
+    std::string name = module->getModuleName().toString();
+
+    if (module->getModuleKind() == ast::ModuleKind::ModuleTree) {
+      // mod foo { .. }
+      llvm::SmallString<128> inlineDirectory(directory);
+      llvm::sys::path::append(inlineDirectory, name);
+      errors += loadModules(module->getItems(), inlineDirectory.str(), lexer,
+                            context);
+      continue;
+    }
+
+    // mod foo;
+    std::string file = ModuleLexer::getModuleFile(directory, name);
+    llvm::Expected<const lexer::TokenStream &> ts =
+        lexer.getTokenStream(file);
+    if (!ts) {
+      llvm::errs() << "failed to load module " << name << ": "
+                   << llvm::toString(ts.takeError()) << "\n";
+      ++errors;
+      continue;
+    }
+
+    Parser parser = {*ts, context};
+    parser.setRecoverFromErrors(true);
+
+    StringResult<std::shared_ptr<ast::Crate>> content =
+        parser.parseCrateModule(name, basic::UNKNOWN_CREATENUM);
+    if (!content) {
+      llvm::errs() << "failed to parse module " << name << " in " << file
+                   << ": " << content.getError() << "\n";
+      parser.printFunctionStack();
+      ++errors;
+      continue;
+    }
+    errors += reportErrors(file, parser);
+
+    std::vector<ast::InnerAttribute> inner =
+        content.getValue()->getInnerAttributes();
+    std::vector<std::shared_ptr<ast::Item>> moduleItems =
+        content.getValue()->getItems();
+    module->setInnerAttributes(inner);
+    module->setItem(moduleItems);
+
+    errors += loadModules(
+        module->getItems(),
+        ModuleLexer::getModuleDirectory(file, /*isRoot=*/false), lexer,
+        context);
+  }
+  return errors;
 }
 
 } // namespace rust_compiler::crate_loader
@@ -1,10 +1,13 @@
 #pragma once
 
-#include "ADT/CanonicalPath.h"
+#include "AST/ASTContext.h"
 #include "AST/Crate.h"
 #include "AST/Module.h"
+#include "CrateLoader/ModuleLexer.h"
 
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
 
 namespace rust_compiler::crate_loader {
@@ -12,11 +15,15 @@ namespace rust_compiler::crate_loader {
 std::shared_ptr<ast::Crate> loadRootModule(llvm::SmallVectorImpl<char> &libPath,
                                            std::string_view fileName,
                                            std::string_view crateName,
-                                           basic::CrateNum crateNum);
+                                           basic::CrateNum crateNum,
+                                           ModuleLexer &lexer);
 
-std::shared_ptr<ast::Module> loadModule(llvm::SmallVectorImpl<char> &libPath,
-                                        std::string_view fileName,
-                                        std::string_view crateName,
-                                        adt::CanonicalPath canonicalPath);
+/// Parses the files of the `mod foo;` declarations in items and in their
+/// inline modules. directory holds the files of the modules. The nodes are
+/// allocated in context, the arena of the crate. Syntax errors are reported
+/// and recovered from; returns their number.
+size_t loadModules(std::span<std::shared_ptr<ast::Item>> items,
+                   std::string_view directory, ModuleLexer &lexer,
+                   std::shared_ptr<ast::ASTContext> context);
 
 } // namespace rust_compiler::crate_loader
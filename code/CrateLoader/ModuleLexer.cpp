@@ -0,0 +1,154 @@
+#include "CrateLoader/ModuleLexer.h"
+
+#include "Basic/SourceManager.h"
+#include "Lexer/Lexer.h"
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <utility>
+#include <vector>
+
+using namespace rust_compiler::lexer;
+
+namespace rust_compiler::crate_loader {
+
+ModuleLexer::ModuleLexer(llvm::ThreadPoolStrategy strategy)
+    : pool(strategy) {}
+
+ModuleLexer::~ModuleLexer() { pool.wait(); }
+
+void ModuleLexer::lexRootModule(std::string_view path,
+                                std::string_view fileName) {
+  schedule(path, fileName, /*isRoot=*/true);
+}
+
+llvm::Expected<const TokenStream &>
+ModuleLexer::getTokenStream(std::string_view path) {
+  if (!llvm::sys::fs::exists(path))
+    return llvm::createStringError(std::errc::no_such_file_or_directory,
+                                   "file: %s does not exist",
+                                   std::string(path).c_str());
+
+  schedule(path, path, /*isRoot=*/false);
+
+  LexedFile *file;
+  std::shared_future<void> done;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    file = &files.find(path)->second;
+    done = file->done;
+  }
+  done.wait();
+  if (file->error) {
+    // the caller may exit: no worker may be live then
+    pool.wait();
+    return llvm::createStringError(std::errc::invalid_argument,
+                                   file->error->c_str());
+  }
+  return file->tokens;
+}
+
+std::string ModuleLexer::getModuleDirectory(std::string_view path,
+                                            bool isRoot) {
+  llvm::SmallString<128> directory = llvm::sys::path::parent_path(path);
+  if (!isRoot && llvm::sys::path::filename(path) != "mod.rs")
+    llvm::sys::path::append(directory, llvm::sys::path::stem(path));
+  return std::string(directory.str());
+}
+
+std::string ModuleLexer::getModuleFile(std::string_view directory,
+                                       std::string_view name) {
+  llvm::SmallString<128> file(directory);
+  llvm::sys::path::append(file, llvm::Twine(name) + ".rs");
+  if (llvm::sys::fs::exists(file))
+    return std::string(file.str());
+
+  llvm::SmallString<128> modFile(directory);
+  llvm::sys::path::append(modFile, name, "mod.rs");
+  if (llvm::sys::fs::exists(modFile))
+    return std::string(modFile.str());
+
+  return std::string(file.str());
+}
+
+void ModuleLexer::schedule(std::string_view path, std::string_view fileName,
+                           bool isRoot) {
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto [it, inserted] = files.try_emplace(path);
+  if (!inserted)
+    return;
+
+  LexedFile &file = it->second;
+  file.done = pool.async(
+      [this, &file, p = std::string(path), f = std::string(fileName),
+       isRoot]() { lexFile(file, p, f, isRoot); });
+}
+
+void ModuleLexer::lexFile(LexedFile &file, std::string path,
+                          std::string fileName, bool isRoot) {
+  llvm::Expected<basic::FileId> id =
+      basic::getSourceManager().tryLoadFile(path, fileName);
+  if (!id) {
+    file.error = llvm::toString(id.takeError());
+    return;
+  }
+
+  llvm::Expected<TokenStream> tokens = tryLex(*id);
+  if (!tokens) {
+    file.error = llvm::toString(tokens.takeError());
+    return;
+  }
+  file.tokens = std::move(*tokens);
+
+  discoverModules(file.tokens, getModuleDirectory(path, isRoot));
+}
+
+void ModuleLexer::discoverModules(const TokenStream &tokens,
+                                  std::string_view directory) {
+  // the inline modules around the current token and the brace depth at
+  // which they were opened
+  std::vector<std::pair<std::string, unsigned>> inlineModules;
+  unsigned depth = 0;
+
+  auto getDirectory = [&]() {
+    llvm::SmallString<128> dir(directory);
+    for (auto &[name, _] : inlineModules)
+      llvm::sys::path::append(dir, name);
+    return std::string(dir.str());
+  };
+
+  size_t length = tokens.getLength();
+  for (size_t i = 0; i < length; ++i) {
+    const Token &tok = tokens.getAt(i);
+    if (tok.getKind() == TokenKind::BraceOpen) {
+      ++depth;
+    } else if (tok.getKind() == TokenKind::BraceClose) {
+      // an unbalanced } is a syntax error for the parser to report
+      if (depth == 0)
+        continue;
+      --depth;
+      if (!inlineModules.empty() && inlineModules.back().second == depth)
+        inlineModules.pop_back();
+    } else if (tok.isKeyWord() &&
+               tok.getKeyWordKind() == KeyWordKind::KW_MOD && i + 2 < length &&
+               tokens.getAt(i + 1).getKind() == TokenKind::Identifier) {
+      std::string name = std::string(tokens.getAt(i + 1).getSpelling());
+      TokenKind next = tokens.getAt(i + 2).getKind();
+      if (next == TokenKind::Semi) {
+        // mod foo;
+        std::string file = getModuleFile(getDirectory(), name);
+        if (llvm::sys::fs::exists(file))
+          schedule(file, file, /*isRoot=*/false);
+      } else if (next == TokenKind::BraceOpen) {
+        // mod foo { .. }
+        inlineModules.push_back({name, depth});
+      }
+    }
+  }
+}
+
+} // namespace rust_compiler::crate_loader
@@ -21,12 +21,12 @@ bool FrontendAction::runParse() {
   switch (currentInput.getKind()) {
   case InputKind::File: {
     crate = loadCrate(currentInput.getInputFile(), currentInput.getCrateName(),
-                      crateNum, LoadMode::File);
+                      crateNum, LoadMode::File, strategy);
     break;
   }
   case InputKind::CargoTomlDir: {
     crate = loadCrate(currentInput.getInputFile(), currentInput.getCrateName(),
-                      crateNum, LoadMode::CargoTomlDir);
+                      crateNum, LoadMode::CargoTomlDir, strategy);
     break;
   }
   }
@@ -43,6 +43,10 @@ bool FrontendAction::runSemanticChecks() {
 
 void FrontendAction::setEdition(basic::Edition _edition) { edition = _edition; }
 
+void FrontendAction::setThreadPoolStrategy(llvm::ThreadPoolStrategy _strategy) {
+  strategy = _strategy;
+}
+
 ast::Crate *FrontendAction::getCrate() { return crate.get(); }
 
 void FrontendAction::setCurrentInput(FrontendInput _currentIntput) {
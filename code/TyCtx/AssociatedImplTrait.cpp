@@ -145,6 +145,13 @@ TyTy::BaseType *AssociatedImplTrait::setupAssociatedTypes(
   TyTy::SubstitutionArgumentMappings associatedTypeArgs = {
       std::move(associatedArguments), {}, loc};
 
+  // the projections are memoized with the impl of the trait for self
+  std::vector<const TyTy::BaseType *> queryArgs(hrtbBoundArguments.begin(),
+                                                hrtbBoundArguments.end());
+  std::optional<NodeId> queried = context->lookupAssociatedImplMappingForSelf(
+      trait->getNodeId(), self, queryArgs);
+  bool memoize = queried && *queried == impl->getNodeId();
+
   for (auto &asso : impl->getAssociatedItems()) {
     switch (asso.getKind()) {
     case AssociatedItemKind::MacroInvocationSemi: {
@@ -157,14 +164,24 @@ TyTy::BaseType *AssociatedImplTrait::setupAssociatedTypes(
           trait->lookupTraitItem(alias->getIdentifier());
       if (!resolvedTraitItem)
         continue;
-      std::optional<TyTy::BaseType *> lookup =
-          context->lookupType(alias->getNodeId());
-      if (!lookup)
-        continue;
-
-      InternalSubstitutionsMapper intern;
-      TyTy::BaseType *substitued = intern.resolve(*lookup, associatedTypeArgs);
-      (*resolvedTraitItem)->associatedTypeSet(substitued);
+      NodeId itemId = (*resolvedTraitItem)->getNodeId();
+      std::optional<TyTy::BaseType *> projection;
+      if (memoize)
+        projection = context->lookupTraitProjection(trait->getNodeId(), self,
+                                                    queryArgs, itemId);
+      if (!projection) {
+        std::optional<TyTy::BaseType *> lookup =
+            context->lookupType(alias->getNodeId());
+        if (!lookup)
+          continue;
+
+        InternalSubstitutionsMapper intern;
+        projection = intern.resolve(*lookup, associatedTypeArgs);
+        if (memoize)
+          context->insertTraitProjection(trait->getNodeId(), self, queryArgs,
+                                         itemId, *projection);
+      }
+      (*resolvedTraitItem)->associatedTypeSet(*projection);
       break;
     }
     case AssociatedItemKind::ConstantItem: {
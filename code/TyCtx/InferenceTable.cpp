@@ -0,0 +1,123 @@
+#include "TyCtx/InferenceTable.h"
+
+#include <cassert>
+#include <utility>
+
+namespace rust_compiler::tyctx::TyTy {
+
+InferenceTable::Entry &InferenceTable::getEntry(basic::NodeId var) {
+  auto it = entries.find(var);
+  if (it != entries.end())
+    return it->second;
+  if (openSnapshots > 0)
+    undoLog.push_back(EntryUndo{var, std::nullopt});
+  return entries.try_emplace(var, Entry{var, 0, nullptr}).first->second;
+}
+
+void InferenceTable::update(basic::NodeId var, Entry entry) {
+  Entry &old = getEntry(var);
+  if (openSnapshots > 0)
+    undoLog.push_back(EntryUndo{var, old});
+  old = entry;
+}
+
+basic::NodeId InferenceTable::find(basic::NodeId var) {
+  auto it = entries.find(var);
+  if (it == entries.end())
+    return var;
+
+  basic::NodeId root = var;
+  while (entries.at(root).parent != root)
+    root = entries.at(root).parent;
+
+  // path compression
+  while (var != root) {
+    Entry entry = entries.at(var);
+    basic::NodeId next = entry.parent;
+    if (next != root) {
+      entry.parent = root;
+      update(var, entry);
+    }
+    var = next;
+  }
+  return root;
+}
+
+void InferenceTable::unite(basic::NodeId a, basic::NodeId b) {
+  basic::NodeId rootA = find(a);
+  basic::NodeId rootB = find(b);
+  if (rootA == rootB)
+    return;
+
+  Entry entryA = getEntry(rootA);
+  Entry entryB = getEntry(rootB);
+  // union by rank
+  if (entryA.rank < entryB.rank) {
+    std::swap(rootA, rootB);
+    std::swap(entryA, entryB);
+  }
+
+  Entry merged = entryA;
+  if (entryA.rank == entryB.rank)
+    ++merged.rank;
+  if (!merged.value)
+    merged.value = entryB.value;
+  update(rootA, merged);
+
+  entryB.parent = rootA;
+  update(rootB, entryB);
+}
+
+void InferenceTable::bind(basic::NodeId var, BaseType *type) {
+  basic::NodeId root = find(var);
+  Entry entry = getEntry(root);
+  entry.value = type;
+  update(root, entry);
+}
+
+std::optional<BaseType *> InferenceTable::probe(basic::NodeId var) {
+  if (!entries.contains(var))
+    return std::nullopt;
+  BaseType *value = entries.at(find(var)).value;
+  if (!value)
+    return std::nullopt;
+  return value;
+}
+
+InferenceTable::Snapshot InferenceTable::snapshot() {
+  ++openSnapshots;
+  return Snapshot(undoLog.size());
+}
+
+void InferenceTable::rollbackTo(Snapshot snapshot) {
+  assert(openSnapshots > 0 && snapshot.logLength <= undoLog.size());
+  while (undoLog.size() > snapshot.logLength) {
+    std::variant<EntryUndo, HintUndo> &undo = undoLog.back();
+    if (EntryUndo *entry = std::get_if<EntryUndo>(&undo)) {
+      if (entry->old)
+        entries.at(entry->var) = *entry->old;
+      else
+        entries.erase(entry->var);
+    } else {
+      HintUndo &hint = std::get<HintUndo>(undo);
+      hint.infer->inferKind = hint.kind;
+      hint.infer->defaultHint = hint.hint;
+    }
+    undoLog.pop_back();
+  }
+  --openSnapshots;
+}
+
+void InferenceTable::commit(Snapshot snapshot) {
+  assert(openSnapshots > 0 && snapshot.logLength <= undoLog.size());
+  // the outermost snapshot cannot be rolled back anymore
+  if (--openSnapshots == 0)
+    undoLog.clear();
+}
+
+void InferenceTable::recordHint(InferType *infer) {
+  if (openSnapshots > 0)
+    undoLog.push_back(HintUndo{infer, infer->inferKind, infer->defaultHint});
+}
+
+} // namespace rust_compiler::tyctx::TyTy
@@ -0,0 +1,58 @@
+#include "TyCtx/SimplifiedType.h"
+
+namespace rust_compiler::tyctx::TyTy {
+
+std::optional<SimplifiedType> SimplifiedType::get(const BaseType *type) {
+  switch (type->getKind()) {
+  case TypeKind::Bool:
+  case TypeKind::Char:
+  case TypeKind::USize:
+  case TypeKind::ISize:
+  case TypeKind::Str:
+  case TypeKind::Never:
+  case TypeKind::Closure:
+  case TypeKind::Array:
+  case TypeKind::Slice:
+  case TypeKind::Dynamic:
+  case TypeKind::Error:
+    return SimplifiedType(type->getKind());
+  case TypeKind::Int:
+    return SimplifiedType(TypeKind::Int,
+                          static_cast<const IntType *>(type)->getIntKind());
+  case TypeKind::Uint:
+    return SimplifiedType(TypeKind::Uint,
+                          static_cast<const UintType *>(type)->getUintKind());
+  case TypeKind::Float:
+    return SimplifiedType(TypeKind::Float,
+                          static_cast<const FloatType *>(type)->getFloatKind());
+  case TypeKind::Tuple:
+    return SimplifiedType(
+        TypeKind::Tuple,
+        static_cast<const TupleType *>(type)->getNumberOfFields());
+  case TypeKind::Reference:
+    return SimplifiedType(
+        TypeKind::Reference,
+        static_cast<const ReferenceType *>(type)->isMutable());
+  case TypeKind::RawPointer:
+    return SimplifiedType(
+        TypeKind::RawPointer,
+        static_cast<const RawPointerType *>(type)->isMutable());
+  case TypeKind::ADT: {
+    const ADTType *adt = static_cast<const ADTType *>(type);
+    return SimplifiedType(TypeKind::ADT, adt->getKind(),
+                          adt->getIdentifier());
+  }
+  // a function pointer equals functions
+  case TypeKind::Function:
+  case TypeKind::FunctionPointer:
+    return SimplifiedType(TypeKind::FunctionPointer);
+  case TypeKind::Inferred:
+  case TypeKind::Parameter:
+  case TypeKind::Projection:
+  case TypeKind::PlaceHolder:
+    return std::nullopt;
+  }
+  return std::nullopt;
+}
+
+} // namespace rust_compiler::tyctx::TyTy
@@ -3,6 +3,8 @@
 #include "AST/GenericArg.h"
 #include "AST/GenericArgsBinding.h"
 #include "Lexer/Identifier.h"
+#include "Session/Session.h"
+#include "TyCtx/TyCtx.h"
 #include "TyCtx/TyTy.h"
 #include "TyCtx/TypeIdentity.h"
 
@@ -113,6 +115,8 @@ bool SubstitutionParamMapping::fillParamType(
       bound.handleSubstitions(mappings);
 
     param->setTypeReference(type->getReference());
+    // the types that share param resolve differently now
+    rust_compiler::session::session->getTypeContext()->onSubstitution();
     mappings.onParamSubst(*param, *arg);
   }
 
@@ -0,0 +1,192 @@
+#include "TyCtx/TraitQueryCache.h"
+
+#include "TyCtx/TyTy.h"
+#include "TyCtx/TypeInterner.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace rust_compiler::tyctx {
+
+using namespace rust_compiler::tyctx::TyTy;
+
+namespace {
+enum class KeyKind { Trait, Structure, Identity };
+} // namespace
+
+TraitQueryKey TraitQueryKey::get(basic::NodeId trait, const BaseType *self,
+                                 llvm::ArrayRef<const BaseType *> args,
+                                 TypeInterner &interner) {
+  TraitQueryKey key = {trait};
+  key.id.AddInteger(trait);
+  key.id.AddInteger(static_cast<unsigned>(KeyKind::Structure));
+  key.id.AddInteger(args.size());
+  key.cacheable = key.profile(self, interner);
+  for (const BaseType *arg : args)
+    key.cacheable = key.cacheable && key.profile(arg, interner);
+  if (key.cacheable)
+    return key;
+
+  // in progress by identity
+  TraitQueryKey identity = {trait};
+  identity.id.AddInteger(trait);
+  identity.id.AddInteger(static_cast<unsigned>(KeyKind::Identity));
+  identity.id.AddPointer(self);
+  for (const BaseType *arg : args)
+    identity.id.AddPointer(arg);
+  identity.cacheable = false;
+  identity.stable = false;
+  return identity;
+}
+
+TraitQueryKey TraitQueryKey::getTrait(basic::NodeId trait) {
+  TraitQueryKey key = {trait};
+  key.id.AddInteger(trait);
+  key.id.AddInteger(static_cast<unsigned>(KeyKind::Trait));
+  // memoized as the TraitReference
+  key.cacheable = false;
+  return key;
+}
+
+bool TraitQueryKey::profile(const BaseType *type, TypeInterner &interner) {
+  // a resolved parameter by its resolution
+  const BaseType *resolved = type->destructure();
+  if (resolved != type)
+    stable = false;
+  type = resolved;
+
+  if (const BaseType *representative = interner.intern(type)) {
+    id.AddPointer(representative);
+    return true;
+  }
+
+  id.AddInteger(static_cast<unsigned>(type->getKind()));
+  switch (type->getKind()) {
+  case TypeKind::Tuple: {
+    const TupleType *tuple = static_cast<const TupleType *>(type);
+    id.AddInteger(tuple->getNumberOfFields());
+    for (size_t i = 0; i < tuple->getNumberOfFields(); ++i)
+      if (!profile(tuple->getField(i), interner))
+        return false;
+    return true;
+  }
+  case TypeKind::Reference: {
+    const ReferenceType *ref = static_cast<const ReferenceType *>(type);
+    id.AddBoolean(ref->isMutable());
+    return profile(ref->getBase(), interner);
+  }
+  case TypeKind::RawPointer: {
+    const RawPointerType *ptr = static_cast<const RawPointerType *>(type);
+    id.AddBoolean(ptr->isMutable());
+    return profile(ptr->getBase(), interner);
+  }
+  case TypeKind::Slice:
+    return profile(static_cast<const SliceType *>(type)->getElementType(),
+                   interner);
+  // by the definition and the generic arguments, which are only unstable
+  // if they reach a parameter
+  case TypeKind::ADT: {
+    const ADTType *adt = static_cast<const ADTType *>(type);
+    id.AddInteger(static_cast<unsigned>(adt->getKind()));
+    id.AddInteger(adt->getTypeReference());
+    const SubstitutionArgumentMappings &arguments =
+        adt->getSubstitutionArguments();
+    // without arguments, by the parameters of a generic ADT
+    if (arguments.getMappings().empty()) {
+      id.AddInteger(adt->getNumberOfSubstitutions());
+      for (const SubstitutionParamMapping &param : adt->getSubstitutions())
+        if (!profile(param.getParamType(), interner))
+          return false;
+      return true;
+    }
+    id.AddInteger(arguments.getMappings().size());
+    for (const SubstitutionArg &arg : arguments.getMappings())
+      if (!arg.getType() || !profile(arg.getType(), interner))
+        return false;
+    return true;
+  }
+  // an unresolved generic parameter
+  case TypeKind::Parameter:
+    stable = false;
+    id.AddInteger(type->getReference());
+    return true;
+  case TypeKind::Bool:
+  case TypeKind::Char:
+  case TypeKind::Int:
+  case TypeKind::Uint:
+  case TypeKind::Float:
+  case TypeKind::USize:
+  case TypeKind::ISize:
+  case TypeKind::Str:
+  case TypeKind::Never:
+  case TypeKind::Array:
+  case TypeKind::Inferred:
+  case TypeKind::Projection:
+  case TypeKind::PlaceHolder:
+  case TypeKind::Function:
+  case TypeKind::Closure:
+  case TypeKind::FunctionPointer:
+  case TypeKind::Dynamic:
+  case TypeKind::Error:
+    return false;
+  }
+  return false;
+}
+
+std::optional<TraitQueryResult *>
+TraitQueryCache::lookup(const TraitQueryKey &key) {
+  if (!key.isCacheable())
+    return std::nullopt;
+  auto trait = answers.find(key.getTrait());
+  if (trait == answers.end())
+    return std::nullopt;
+  auto it = trait->second.find(key);
+  if (it == trait->second.end())
+    return std::nullopt;
+  if (!it->second.stable && it->second.generation != generation) {
+    trait->second.erase(it);
+    return std::nullopt;
+  }
+  return &it->second.result;
+}
+
+bool TraitQueryCache::start(const TraitQueryKey &key) {
+  auto cycle =
+      std::find_if(inProgress.begin(), inProgress.end(),
+                   [&](const Frame &frame) { return frame.key == key; });
+  if (cycle == inProgress.end()) {
+    inProgress.push_back({key, false, generation});
+    return true;
+  }
+  for (auto it = std::next(cycle); it != inProgress.end(); ++it)
+    it->provisional = true;
+  return false;
+}
+
+void TraitQueryCache::complete(const TraitQueryKey &key,
+                               TraitQueryResult result) {
+  Frame frame = pop(key);
+  if (frame.provisional || !key.isCacheable())
+    return;
+  answers[key.getTrait()].insert_or_assign(
+      key, Entry{std::move(result), key.isStable(), frame.generation});
+}
+
+void TraitQueryCache::abandon(const TraitQueryKey &key) { pop(key); }
+
+TraitQueryCache::Frame TraitQueryCache::pop(const TraitQueryKey &key) {
+  assert(!inProgress.empty() && inProgress.back().key == key &&
+         "trait queries must complete in LIFO order");
+  Frame frame = std::move(inProgress.back());
+  inProgress.pop_back();
+  return frame;
+}
+
+bool TraitQueryCache::isInProgress(const TraitQueryKey &key) const {
+  return std::any_of(inProgress.begin(), inProgress.end(),
+                     [&](const Frame &frame) { return frame.key == key; });
+}
+
+void TraitQueryCache::invalidate(basic::NodeId trait) { answers.erase(trait); }
+
+} // namespace rust_compiler::tyctx
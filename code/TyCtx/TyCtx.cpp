@@ -14,6 +14,7 @@
 
 // #include "../sema/TypeChecking/TypeChecking.h"
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 
@@ -150,7 +151,7 @@ void TyCtx::insertASTCrate(ast::Crate *crate, CrateNum crateNum) {
 void TyCtx::insertBuiltin(NodeId id, NodeId ref, TyTy::BaseType *type) {
   nodeIdRefs[ref] = id;
   resolved[id] = type;
-  builtinsList.push_back(std::unique_ptr<TyTy::BaseType>(type));
+  builtinsList.push_back(type);
 }
 
 void TyCtx::insertType(const NodeIdentity &id, TyTy::BaseType *type) {
@@ -158,9 +159,9 @@ void TyCtx::insertType(const NodeIdentity &id, TyTy::BaseType *type) {
 }
 
 TyTy::BaseType *TyCtx::lookupBuiltin(std::string_view name) {
-  for (auto &built : builtinsList) {
+  for (TyTy::BaseType *built : builtinsList) {
     if (built->toString() == name) {
-      return built.get();
+      return built;
     }
   }
 
@@ -169,9 +170,22 @@ TyTy::BaseType *TyCtx::lookupBuiltin(std::string_view name) {
 
 std::optional<TyTy::BaseType *> TyCtx::lookupType(basic::NodeId id) {
   auto it = resolved.find(id);
-  if (it != resolved.end())
-    return it->second;
-  return std::nullopt;
+  if (it == resolved.end())
+    return std::nullopt;
+  if (it->second->getKind() == TyTy::TypeKind::Inferred) {
+    TyTy::InferType *infer = static_cast<TyTy::InferType *>(it->second);
+    if (std::optional<TyTy::BaseType *> bound =
+            inferenceTable.probe(infer->getVariable()))
+      return *bound;
+  }
+  return it->second;
+}
+
+std::optional<TyTy::BaseType *> TyCtx::lookupInsertedType(basic::NodeId id) {
+  auto it = resolved.find(id);
+  if (it == resolved.end())
+    return std::nullopt;
+  return it->second;
 }
 
 void TyCtx::insertItem(ast::Item *it) { itemMappings[it->getNodeId()] = it; }
@@ -304,68 +318,66 @@ void TyCtx::insertOperatorOverLoad(basic::NodeId id,
 
 void TyCtx::generateBuiltins() {
   // unsigned integer
-  u8 = std::make_unique<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U8);
-  setupBuiltin("u8", u8.get());
+  u8 = create<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U8);
+  setupBuiltin("u8", u8);
 
-  u16 = std::make_unique<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U16);
-  setupBuiltin("u16", u16.get());
+  u16 = create<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U16);
+  setupBuiltin("u16", u16);
 
-  u32 = std::make_unique<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U32);
-  setupBuiltin("u32", u32.get());
+  u32 = create<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U32);
+  setupBuiltin("u32", u32);
 
-  u64 = std::make_unique<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U64);
-  setupBuiltin("u64", u64.get());
+  u64 = create<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U64);
+  setupBuiltin("u64", u64);
 
-  u128 =
-      std::make_unique<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U128);
-  setupBuiltin("u128", u128.get());
+  u128 = create<TyTy::UintType>(getNextNodeId(), TyTy::UintKind::U128);
+  setupBuiltin("u128", u128);
 
   // signed integer
-  i8 = std::make_unique<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I8);
-  setupBuiltin("i8", i8.get());
+  i8 = create<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I8);
+  setupBuiltin("i8", i8);
 
-  i16 = std::make_unique<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I16);
-  setupBuiltin("i16", i16.get());
+  i16 = create<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I16);
+  setupBuiltin("i16", i16);
 
-  i32 = std::make_unique<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I32);
-  setupBuiltin("i32", i32.get());
+  i32 = create<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I32);
+  setupBuiltin("i32", i32);
 
-  i64 = std::make_unique<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I64);
-  setupBuiltin("i64", i64.get());
+  i64 = create<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I64);
+  setupBuiltin("i64", i64);
 
-  i128 = std::make_unique<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I128);
-  setupBuiltin("i128", i128.get());
+  i128 = create<TyTy::IntType>(getNextNodeId(), TyTy::IntKind::I128);
+  setupBuiltin("i128", i128);
 
   // float
-  f32 =
-      std::make_unique<TyTy::FloatType>(getNextNodeId(), TyTy::FloatKind::F32);
-  setupBuiltin("f32", f32.get());
+  f32 = create<TyTy::FloatType>(getNextNodeId(), TyTy::FloatKind::F32);
+  setupBuiltin("f32", f32);
 
-  f64 =
-      std::make_unique<TyTy::FloatType>(getNextNodeId(), TyTy::FloatKind::F64);
-  setupBuiltin("f64", f64.get());
+  f64 = create<TyTy::FloatType>(getNextNodeId(), TyTy::FloatKind::F64);
+  setupBuiltin("f64", f64);
 
   // bool
-  rbool = std::make_unique<TyTy::BoolType>(getNextNodeId());
-  setupBuiltin("bool", rbool.get());
+  rbool = create<TyTy::BoolType>(getNextNodeId());
+  setupBuiltin("bool", rbool);
 
   // usize and isize
-  usize = std::make_unique<TyTy::USizeType>(getNextNodeId());
-  setupBuiltin("usize", usize.get());
+  usize = create<TyTy::USizeType>(getNextNodeId());
+  setupBuiltin("usize", usize);
 
-  isize = std::make_unique<TyTy::ISizeType>(getNextNodeId());
-  setupBuiltin("isize", isize.get());
+  isize = create<TyTy::ISizeType>(getNextNodeId());
+  setupBuiltin("isize", isize);
 
   // char and str
-  charType = std::make_unique<TyTy::CharType>(getNextNodeId());
-  setupBuiltin("char", charType.get());
-  strType = std::make_unique<TyTy::StrType>(getNextNodeId());
-  setupBuiltin("str", strType.get());
+  charType = create<TyTy::CharType>(getNextNodeId());
+  setupBuiltin("char", charType);
+  strType = create<TyTy::StrType>(getNextNodeId());
+  setupBuiltin("str", strType);
 
-  never = std::make_unique<TyTy::NeverType>(getNextNodeId());
-  setupBuiltin("!", never.get());
+  never = create<TyTy::NeverType>(getNextNodeId());
+  setupBuiltin("!", never);
 
-  TyTy::TupleType *unitType = TyTy::TupleType::getUnitType(getNextNodeId());
+  TyTy::TupleType *unitType = create<TyTy::TupleType>(
+      getNextNodeId(), Location::getBuiltinLocation());
 
   emptyTupleType = new ast::types::TupleType(Location::getBuiltinLocation());
   builtins.push_back({"()", emptyTupleType});
@@ -393,7 +405,7 @@ void TyCtx::setupBuiltin(std::string_view name, TyTy::BaseType *tyty) {
 }
 
 bool TyCtx::isTraitQueryInProgress(basic::NodeId id) const {
-  return traitQueriesInProgress.find(id) != traitQueriesInProgress.end();
+  return traitQueries.isInProgress(TraitQueryKey::getTrait(id));
 }
 
 std::optional<TyTy::TraitReference *>
@@ -405,12 +417,12 @@ TyCtx::lookupTraitReference(basic::NodeId id) {
   return &it->second;
 }
 
-void TyCtx::insertTraitQuery(basic::NodeId id) {
-  traitQueriesInProgress.insert(id);
+bool TyCtx::insertTraitQuery(basic::NodeId id) {
+  return traitQueries.start(TraitQueryKey::getTrait(id));
 }
 
 void TyCtx::traitQueryCompleted(basic::NodeId id) {
-  traitQueriesInProgress.erase(id);
+  traitQueries.complete(TraitQueryKey::getTrait(id), {});
 }
 
 void TyCtx::insertTraitReference(basic::NodeId id, TyTy::TraitReference &&ref) {
@@ -432,7 +444,7 @@ TyTy::BaseType *TyCtx::popLoopContext() {
 TyTy::BaseType *TyCtx::peekLoopContext() const { return loopTypeStack.back(); }
 
 void TyCtx::pushNewIteratorLoopContext(basic::NodeId id, Location loc) {
-  TyTy::BaseType *inferVar = new TyTy::InferType(
+  TyTy::BaseType *inferVar = create<TyTy::InferType>(
       id, TyTy::InferKind::General, TyTy::TypeHint::unknown(), loc);
   loopTypeStack.push_back(inferVar);
 }
@@ -445,6 +457,89 @@ TyCtx::lookupAssociatedTraitImpl(NodeId id) {
   return &it->second;
 }
 
+void TyCtx::insertAssociatedTraitImpl(NodeId id,
+                                      AssociatedImplTrait &&associated) {
+  associatedImplTraits.emplace(id, std::move(associated));
+}
+
+void TyCtx::insertAssociatedImplMapping(NodeId traitId,
+                                        const TyTy::BaseType *implType,
+                                        NodeId implId) {
+  associatedImplMappings[traitId].push_back({implType, implId});
+  // the negative answers are stale
+  traitQueries.invalidate(traitId);
+}
+
+std::optional<NodeId> TyCtx::lookupAssociatedImplMappingForSelf(
+    NodeId traitId, const TyTy::BaseType *self,
+    llvm::ArrayRef<const TyTy::BaseType *> args) {
+  TraitQueryKey key = TraitQueryKey::get(traitId, self, args, types);
+  if (std::optional<TraitQueryResult *> result = traitQueries.lookup(key))
+    return (*result)->implementation;
+  if (!traitQueries.start(key))
+    return std::nullopt;
+
+  auto matches = [&](const TyTy::BaseType *implType, NodeId implId) {
+    if (!self->canEqual(implType, false))
+      return false;
+    if (args.empty())
+      return true;
+    std::optional<AssociatedImplTrait *> associated =
+        lookupAssociatedTraitImpl(implId);
+    if (!associated)
+      return false;
+    // the generic params of the trait without the implicit Self
+    std::vector<const TyTy::BaseType *> implArgs;
+    for (const TyTy::SubstitutionParamMapping &param :
+         (*associated)->getPredicate().getSubstitutions())
+      if (!param.getParamType()->isImplicitSelfTrait())
+        implArgs.push_back(param.getParamType()->resolve());
+    if (implArgs.size() != args.size())
+      return false;
+    for (size_t i = 0; i < args.size(); ++i)
+      if (!args[i]->canEqual(implArgs[i], false))
+        return false;
+    return true;
+  };
+
+  TraitQueryResult result;
+  auto it = associatedImplMappings.find(traitId);
+  if (it != associatedImplMappings.end()) {
+    for (auto &[implType, implId] : it->second) {
+      if (matches(implType, implId)) {
+        result.implementation = implId;
+        break;
+      }
+    }
+  }
+  std::optional<NodeId> implementation = result.implementation;
+  traitQueries.complete(key, std::move(result));
+  return implementation;
+}
+
+void TyCtx::insertTraitProjection(NodeId traitId, const TyTy::BaseType *self,
+                                  llvm::ArrayRef<const TyTy::BaseType *> args,
+                                  NodeId associatedType,
+                                  TyTy::BaseType *type) {
+  TraitQueryKey key = TraitQueryKey::get(traitId, self, args, types);
+  if (std::optional<TraitQueryResult *> result = traitQueries.lookup(key))
+    (*result)->projections[associatedType] = type;
+}
+
+std::optional<TyTy::BaseType *>
+TyCtx::lookupTraitProjection(NodeId traitId, const TyTy::BaseType *self,
+                             llvm::ArrayRef<const TyTy::BaseType *> args,
+                             NodeId associatedType) {
+  TraitQueryKey key = TraitQueryKey::get(traitId, self, args, types);
+  std::optional<TraitQueryResult *> result = traitQueries.lookup(key);
+  if (!result)
+    return std::nullopt;
+  auto it = (*result)->projections.find(associatedType);
+  if (it == (*result)->projections.end())
+    return std::nullopt;
+  return it->second;
+}
+
 void TyCtx::iterateImplementations(
     llvm::function_ref<bool(NodeId, ast::Implementation *)> cb) {
   for (auto it = implementationMappings.begin();
@@ -458,6 +553,8 @@ void TyCtx::insertAssociatedItem(basic::NodeId implementationId,
                                  ast::AssociatedItem *item) {
   NodeId id = item->getNodeId();
 
+  if (!associatedItemMappings.contains(id))
+    implementationItems[implementationId].push_back(id);
   associatedItemMappings[id] =
       std::pair<NodeId, ast::AssociatedItem *>(implementationId, item);
 }
@@ -482,6 +579,85 @@ void TyCtx::iterateAssociatedItems(
   }
 }
 
+std::vector<NodeId>
+TyCtx::collectImplementationsFor(const TyTy::BaseType *receiver,
+                                 ImplSelfTypeFn selfType) {
+  // only the fallbacks visit all implementations
+  auto getAll = [&]() {
+    std::vector<NodeId> all;
+    all.reserve(implementationMappings.size());
+    for (auto &impl : implementationMappings)
+      all.push_back(impl.first);
+    return all;
+  };
+
+  // selfType may type check and probe again; that probe takes all
+  if (indexingImplementations)
+    return getAll();
+
+  indexingImplementations = true;
+  std::vector<NodeId> unindexed;
+  for (NodeId id : unindexedImplementations) {
+    std::optional<TyTy::BaseType *> self = selfType(implementationMappings[id]);
+    if (!self) {
+      unindexed.push_back(id);
+      continue;
+    }
+    if (std::optional<TyTy::SimplifiedType> head =
+            TyTy::SimplifiedType::get(*self))
+      implementationsByHead[*head].push_back(id);
+    else
+      blanketImplementations.push_back(id);
+  }
+  unindexedImplementations = std::move(unindexed);
+  indexingImplementations = false;
+
+  std::optional<TyTy::SimplifiedType> head =
+      TyTy::SimplifiedType::get(receiver);
+  if (!head)
+    return getAll();
+
+  std::vector<NodeId> candidates = blanketImplementations;
+  // the callbacks skip them as before
+  candidates.insert(candidates.end(), unindexedImplementations.begin(),
+                    unindexedImplementations.end());
+  auto it = implementationsByHead.find(*head);
+  if (it != implementationsByHead.end())
+    candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+void TyCtx::iterateImplementationsFor(
+    const TyTy::BaseType *receiver, ImplSelfTypeFn selfType,
+    llvm::function_ref<bool(NodeId, ast::Implementation *)> cb) {
+  for (NodeId id : collectImplementationsFor(receiver, selfType))
+    if (!cb(id, implementationMappings[id]))
+      return;
+}
+
+void TyCtx::iterateAssociatedItemsFor(
+    const TyTy::BaseType *receiver, ImplSelfTypeFn selfType,
+    llvm::function_ref<bool(NodeId, ast::Implementation *,
+                            ast::AssociatedItem *)>
+        cb) {
+  std::vector<NodeId> items;
+  for (NodeId implementationId :
+       collectImplementationsFor(receiver, selfType)) {
+    auto it = implementationItems.find(implementationId);
+    if (it != implementationItems.end())
+      items.insert(items.end(), it->second.begin(), it->second.end());
+  }
+  // in the order of iterateAssociatedItems
+  std::sort(items.begin(), items.end());
+
+  for (NodeId assoId : items) {
+    auto [implementationId, assoItem] = associatedItemMappings[assoId];
+    if (!cb(assoId, implementationMappings[implementationId], assoItem))
+      return;
+  }
+}
+
 void TyCtx::insertEnumeration(NodeId enu, ast::Enumeration *enuM) {
   // llvm::errs() << "TyCtx::insertEnumeration " << enu << "\n";
 
@@ -489,6 +665,8 @@ void TyCtx::insertEnumeration(NodeId enu, ast::Enumeration *enuM) {
 }
 
 void TyCtx::insertImplementation(NodeId id, ast::Implementation *impl) {
+  if (!implementationMappings.contains(id))
+    unindexedImplementations.push_back(id);
   implementationMappings[id] = impl;
 }
 
@@ -17,6 +17,7 @@
 #include "TyCtx/TraitReference.h"
 #include "TyCtx/TyCtx.h"
 #include "TyCtx/TypeIdentity.h"
+#include "TyCtx/TypeInterner.h"
 
 #include <functional>
 #include <llvm/Support/ErrorHandling.h>
@@ -35,6 +36,12 @@ namespace rust_compiler::tyctx::TyTy {
 
 static constexpr uint32_t MAX_RECURSION_DEPTH = 1024 * 16;
 
+/// in the arena of the type context
+template <typename T, typename... Args> static T *createType(Args &&...args) {
+  return rust_compiler::session::session->getTypeContext()->create<T>(
+      std::forward<Args>(args)...);
+}
+
 static bool checkSubstitutions(SubstitutionArgumentMappings &mappings,
                                StructFieldType *field) {
   TyTy::BaseType *fieldType = field->getFieldType();
@@ -127,6 +134,14 @@ TyTy::BaseType *TypeVariable::getType() const {
   assert(false);
 }
 
+std::optional<TyTy::BaseType *> TypeVariable::getResolvedType() const {
+  tyctx::TyCtx *context = rust_compiler::session::session->getTypeContext();
+  std::optional<TyTy::BaseType *> type = context->lookupInsertedType(id);
+  if (!type || (*type)->getKind() == TypeKind::Inferred)
+    return std::nullopt;
+  return type;
+}
+
 BaseType::BaseType(basic::NodeId ref, basic::NodeId ty_ref, TypeKind kind,
                    TypeIdentity ident, std::set<basic::NodeId> refs)
     : TypeBoundsMappings({}), reference(ref), typeReference(ty_ref), kind(kind),
@@ -289,7 +304,7 @@ TupleType::TupleType(basic::NodeId id, basic::NodeId type, Location loc,
       fields(parameterTyps) {}
 
 TupleType *TupleType::getUnitType(basic::NodeId id) {
-  return new TupleType(id, Location::getBuiltinLocation());
+  return createType<TupleType>(id, Location::getBuiltinLocation());
 }
 
 std::string TupleType::toString() const {
@@ -360,11 +375,11 @@ unsigned InferType::getNumberOfSpecifiedBounds() const { return 0; }
 InferType::InferType(basic::NodeId ref, InferKind kind, TypeHint hint,
                      Location loc, std::set<basic::NodeId> refs)
     : BaseType(ref, ref, TypeKind::Inferred, TypeIdentity::from(loc), refs),
-      inferKind(kind), defaultHint(hint), loc(loc) {}
+      inferKind(kind), defaultHint(hint), loc(loc), variable(ref) {}
 InferType::InferType(basic::NodeId ref, basic::NodeId type, InferKind kind,
                      TypeHint hint, Location loc, std::set<basic::NodeId> refs)
     : BaseType(ref, type, TypeKind::Inferred, TypeIdentity::from(loc), refs),
-      inferKind(kind), defaultHint(hint), loc(loc) {}
+      inferKind(kind), defaultHint(hint), loc(loc), variable(ref) {}
 
 std::string InferType::toString() const {
   switch (inferKind) {
@@ -613,6 +628,9 @@ bool BaseType::isConcrete() const {
 }
 
 void InferType::applyScalarTypeHint(const BaseType &hint) {
+  rust_compiler::session::session->getTypeContext()
+      ->getInferenceTable()
+      .recordHint(this);
   switch (hint.getKind()) {
   case TypeKind::USize:
   case TypeKind::ISize:
@@ -694,7 +712,7 @@ const BaseType *BaseType::destructure() const {
   while (true) {
     if (steps++ >= MAX_RECURSION_DEPTH) {
       // report error
-      return new ErrorType(getReference());
+      return createType<ErrorType>(getReference());
     }
     switch (x->getKind()) {
     case TypeKind::Parameter: {
@@ -731,7 +749,7 @@ BaseType *BaseType::destructure() {
   while (true) {
     if (steps++ >= MAX_RECURSION_DEPTH) {
       // report error
-      return new ErrorType(getReference());
+      return createType<ErrorType>(getReference());
     }
     switch (x->getKind()) {
     case TypeKind::Parameter: {
@@ -810,48 +828,48 @@ void TypeBoundsMappings::addBound(const TypeBoundPredicate &predicate) {
 }
 
 BaseType *BoolType::clone() const {
-  return new BoolType(getReference(), getTypeReference(),
-                      getCombinedReferences());
+  return createType<BoolType>(getReference(), getTypeReference(),
+                              getCombinedReferences());
 }
 
 BaseType *IntType::clone() const {
-  return new IntType(getReference(), getTypeReference(), getIntKind(),
-                     getCombinedReferences());
+  return createType<IntType>(getReference(), getTypeReference(), getIntKind(),
+                             getCombinedReferences());
 }
 
 BaseType *UintType::clone() const {
-  return new UintType(getReference(), getTypeReference(), getUintKind(),
-                      getCombinedReferences());
+  return createType<UintType>(getReference(), getTypeReference(), getUintKind(),
+                              getCombinedReferences());
 }
 
 BaseType *FloatType::clone() const {
-  return new FloatType(getReference(), getTypeReference(), getFloatKind(),
-                       getCombinedReferences());
+  return createType<FloatType>(getReference(), getTypeReference(),
+                               getFloatKind(), getCombinedReferences());
 }
 
 BaseType *USizeType::clone() const {
-  return new USizeType(getReference(), getTypeReference(),
-                       getCombinedReferences());
+  return createType<USizeType>(getReference(), getTypeReference(),
+                               getCombinedReferences());
 }
 
 BaseType *ISizeType::clone() const {
-  return new ISizeType(getReference(), getTypeReference(),
-                       getCombinedReferences());
+  return createType<ISizeType>(getReference(), getTypeReference(),
+                               getCombinedReferences());
 }
 
 BaseType *CharType::clone() const {
-  return new CharType(getReference(), getTypeReference(),
-                      getCombinedReferences());
+  return createType<CharType>(getReference(), getTypeReference(),
+                              getCombinedReferences());
 }
 
 BaseType *StrType::clone() const {
-  return new StrType(getReference(), getTypeReference(),
-                     getCombinedReferences());
+  return createType<StrType>(getReference(), getTypeReference(),
+                             getCombinedReferences());
 }
 
 BaseType *NeverType::clone() const {
-  return new NeverType(getReference(), getTypeReference(),
-                       getCombinedReferences());
+  return createType<NeverType>(getReference(), getTypeReference(),
+                               getCombinedReferences());
 }
 
 BaseType *TupleType::clone() const {
@@ -859,9 +877,9 @@ BaseType *TupleType::clone() const {
   for (const auto &f : fields)
     clonedFields.push_back(f.clone());
 
-  return new TupleType(getReference(), getTypeReference(),
-                       Location::getEmptyLocation(), clonedFields,
-                       getCombinedReferences());
+  return createType<TupleType>(getReference(), getTypeReference(),
+                               Location::getEmptyLocation(), clonedFields,
+                               getCombinedReferences());
 }
 
 BaseType *FunctionType::clone() const {
@@ -873,17 +891,18 @@ BaseType *FunctionType::clone() const {
   for (auto &p : parameters)
     clonedParams.push_back({p.first, p.second->clone()});
 
-  return new FunctionType(getReference(), getTypeReference(), getIdentifier(),
-                          getTypeIdentity(), flags, clonedParams,
-                          getReturnType()->clone(), cloneSubsts(),
-                          getCombinedReferences());
+  return createType<FunctionType>(getReference(), getTypeReference(),
+                                  getIdentifier(), getTypeIdentity(), flags,
+                                  clonedParams, getReturnType()->clone(),
+                                  cloneSubsts(), getCombinedReferences());
 }
 
 BaseType *ClosureType::clone() const {
-  return new ClosureType(getReference(), getTypeReference(), getTypeIdentity(),
-                         (TyTy::TupleType *)parameters->clone(), resultType,
-                         cloneSubsts(), captures, getCombinedReferences(),
-                         getSpecifiedBounds());
+  return createType<ClosureType>(getReference(), getTypeReference(),
+                                 getTypeIdentity(),
+                                 (TyTy::TupleType *)parameters->clone(),
+                                 resultType, cloneSubsts(), captures,
+                                 getCombinedReferences(), getSpecifiedBounds());
 }
 
 BaseType *ADTType::clone() const {
@@ -891,24 +910,26 @@ BaseType *ADTType::clone() const {
   for (auto &variant : variants)
     clonedVariants.push_back(variant->clone());
 
-  return new ADTType(getReference(), getTypeReference(), identifier,
-                     getTypeIdentity(), kind, clonedVariants, cloneSubsts(),
-                     usedArguments, getCombinedReferences());
+  return createType<ADTType>(getReference(), getTypeReference(), identifier,
+                             getTypeIdentity(), kind, clonedVariants,
+                             cloneSubsts(), usedArguments,
+                             getCombinedReferences());
 }
 
 BaseType *ArrayType::clone() const {
-  return new ArrayType(getReference(), getTypeReference(), loc, expr, type,
-                       getCombinedReferences());
+  return createType<ArrayType>(getReference(), getTypeReference(), loc, expr,
+                               type, getCombinedReferences());
 }
 
 BaseType *ParamType::clone() const {
-  return new ParamType(identifier, loc, getReference(), getTypeReference(),
-                       type, bounds, getCombinedReferences());
+  return createType<ParamType>(identifier, loc, getReference(),
+                               getTypeReference(), type, bounds,
+                               getCombinedReferences());
 }
 
 BaseType *ErrorType::clone() const {
-  return new ErrorType(getReference(), getTypeReference(),
-                       getCombinedReferences());
+  return createType<ErrorType>(getReference(), getTypeReference(),
+                               getCombinedReferences());
 }
 
 TypeVariable TypeVariable::clone() const {
@@ -932,8 +953,9 @@ BaseType *InferType::clone() const {
   tyctx::TyCtx *context = rust_compiler::session::session->getTypeContext();
 
   InferType *cloned =
-      new InferType(rust_compiler::basic::getNextNodeId(), inferKind,
-                    defaultHint, loc, getCombinedReferences());
+      createType<InferType>(rust_compiler::basic::getNextNodeId(), inferKind,
+                            defaultHint, loc, getCombinedReferences());
+  cloned->variable = variable;
 
   context->insertType(
       NodeIdentity(cloned->getReference(),
@@ -1170,9 +1192,9 @@ std::string TypeBoundPredicate::toString() const {
 unsigned DynamicObjectType::getNumberOfSpecifiedBounds() const { return 0; }
 
 BaseType *DynamicObjectType::clone() const {
-  return new DynamicObjectType(getReference(), getTypeReference(),
-                               getTypeIdentity(), getSpecifiedBounds(),
-                               getCombinedReferences());
+  return createType<DynamicObjectType>(getReference(), getTypeReference(),
+                                       getTypeIdentity(), getSpecifiedBounds(),
+                                       getCombinedReferences());
 }
 
 ADTType *ADTType::handleSubstitions(SubstitutionArgumentMappings &mappings) {
@@ -1209,8 +1231,8 @@ std::string RawPointerType::toString() const {
 unsigned RawPointerType::getNumberOfSpecifiedBounds() const { return 0; }
 
 BaseType *RawPointerType::clone() const {
-  return new RawPointerType(getReference(), getTypeReference(), base, mut,
-                            getCombinedReferences());
+  return createType<RawPointerType>(getReference(), getTypeReference(), base,
+                                    mut, getCombinedReferences());
 }
 
 bool TypeBoundPredicate::requiresGenericArgs() const {
@@ -1276,8 +1298,8 @@ void PlaceholderType::setAssociatedType(basic::NodeId id) {
 
 TypeVariable TypeVariable::getImplicitInferVariable(Location loc) {
   InferType *infer =
-      new InferType(rust_compiler::basic::getNextNodeId(), InferKind::General,
-                    TypeHint::unknown(), loc);
+      createType<InferType>(rust_compiler::basic::getNextNodeId(),
+                            InferKind::General, TypeHint::unknown(), loc);
 
   tyctx::TyCtx *ctx = rust_compiler::session::session->getTypeContext();
   ctx->insertType(
@@ -1305,125 +1327,139 @@ std::string ReferenceType::toString() const {
 }
 
 BaseType *ReferenceType::clone() const {
-  return new ReferenceType(getReference(), getTypeReference(), base, mut,
-                           getCombinedReferences());
+  return createType<ReferenceType>(getReference(), getTypeReference(), base,
+                                   mut, getCombinedReferences());
+}
+
+bool BaseType::canEqual(const BaseType *other, bool emitErrors) const {
+  TypeInterner &interner =
+      rust_compiler::session::session->getTypeContext()->getTypeInterner();
+  const BaseType *representative = interner.intern(this);
+  if (representative && representative == interner.intern(other))
+    return true;
+  return canEqualImpl(other, emitErrors);
 }
 
-bool ErrorType::canEqual(const TyTy::BaseType *other, bool emitErrors) const {
+bool ErrorType::canEqualImpl(const TyTy::BaseType *other,
+                             bool emitErrors) const {
   return getKind() == other->getKind();
 }
 
-bool ADTType::canEqual(const BaseType *other, bool emitErrors) const {
+bool ADTType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   ADTCmp r(this);
   return r.canEqual(other);
 }
 
-bool TupleType::canEqual(const BaseType *other, bool emitErrors) const {
+bool TupleType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   TupleCmp r(this, emitErrors);
   return r.canEqual(other);
 }
 
-bool FunctionType::canEqual(const BaseType *other, bool emitErrors) const {
+bool FunctionType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   FunctionCmp r(this, emitErrors);
   return r.canEqual(other);
 }
 
-bool FunctionPointerType::canEqual(const BaseType *other,
-                                   bool emitErrors) const {
+bool FunctionPointerType::canEqualImpl(const BaseType *other,
+                                       bool emitErrors) const {
   FunctionPointerCmp r(this, emitErrors);
   return r.canEqual(other);
 }
 
-bool ClosureType::canEqual(const BaseType *other, bool emitErrors) const {
+bool ClosureType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   ClosureCmp r(this, emitErrors);
   return r.canEqual(other);
 }
 
-bool ArrayType::canEqual(const BaseType *other, bool emitErrors) const {
+bool ArrayType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   ArrayCmp r(this, emitErrors);
   return r.canEqual(other);
 }
 
-bool SliceType::canEqual(const BaseType *other, bool emitErrors) const {
+bool SliceType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   SliceCmp r(this, emitErrors);
   return r.canEqual(other);
 }
 
-bool BoolType::canEqual(const BaseType *other, bool emitErrors) const {
+bool BoolType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   BoolCmp r;
   return r.canEqual(other);
 }
 
-bool IntType::canEqual(const BaseType *other, bool emitErrors) const {
+bool IntType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   IntCmp r(this);
   return r.canEqual(other);
 }
 
-bool UintType::canEqual(const BaseType *other, bool emitErrors) const {
+bool UintType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   UintCmp r(this);
   return r.canEqual(other);
 }
 
-bool FloatType::canEqual(const BaseType *other, bool emitErrors) const {
+bool FloatType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   FloatCmp r(this);
   return r.canEqual(other);
 }
 
-bool USizeType::canEqual(const BaseType *other, bool emitErrors) const {
+bool USizeType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   USizeCmp r;
   return r.canEqual(other);
 }
 
-bool ISizeType::canEqual(const BaseType *other, bool emitErrors) const {
+bool ISizeType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   ISizeCmp r;
   return r.canEqual(other);
 }
 
-bool CharType::canEqual(const BaseType *other, bool emitErrors) const {
+bool CharType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   CharCmp r;
   return r.canEqual(other);
 }
 
-bool ReferenceType::canEqual(const BaseType *other, bool emitErrors) const {
+bool ReferenceType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   ReferenceCmp r(this, emitErrors);
   return r.canEqual(other);
 }
 
-bool RawPointerType::canEqual(const BaseType *other, bool emitErrors) const {
+bool RawPointerType::canEqualImpl(const BaseType *other,
+                                  bool emitErrors) const {
   RawPointerCmp r(this, emitErrors);
   return r.canEqual(other);
 }
 
-bool ParamType::canEqual(const BaseType *other, bool emitErrors) const {
+bool ParamType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   ParamCmp r(this);
   return r.canEqual(other);
 }
 
-bool StrType::canEqual(const BaseType *other, bool emitErrors) const {
+bool StrType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   StrCmp r;
   return r.canEqual(other);
 }
 
-bool NeverType::canEqual(const BaseType *other, bool emitErrors) const {
+bool NeverType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   NeverCmp r;
   return r.canEqual(other);
 }
 
-bool PlaceholderType::canEqual(const BaseType *other, bool emitErrors) const {
+bool PlaceholderType::canEqualImpl(const BaseType *other,
+                                   bool emitErrors) const {
   PlaceholderCmp r;
   return r.canEqual(other);
 }
 
-bool ProjectionType::canEqual(const BaseType *other, bool emitErrors) const {
+bool ProjectionType::canEqualImpl(const BaseType *other,
+                                  bool emitErrors) const {
   return base->canEqual(other, emitErrors);
 }
 
-bool DynamicObjectType::canEqual(const BaseType *other, bool emitErrors) const {
+bool DynamicObjectType::canEqualImpl(const BaseType *other,
+                                     bool emitErrors) const {
   DynamicCmp r(this);
   return r.canEqual(other);
 }
 
-bool InferType::canEqual(const BaseType *other, bool emitErrors) const {
+bool InferType::canEqualImpl(const BaseType *other, bool emitErrors) const {
   InferCmp r(this);
   return r.canEqual(other);
 }
@@ -1450,8 +1486,9 @@ std::string SliceType::toString() const {
 }
 
 TyTy::BaseType *SliceType::clone() const {
-  return new SliceType(getReference(), getTypeReference(), getLocation(),
-                       elementType.clone(), getCombinedReferences());
+  return createType<SliceType>(getReference(), getTypeReference(),
+                               getLocation(), elementType.clone(),
+                               getCombinedReferences());
 }
 
 bool VariantDef::lookupField(lexer::Identifier ident,
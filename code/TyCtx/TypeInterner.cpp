@@ -0,0 +1,107 @@
+#include "TyCtx/TypeInterner.h"
+
+#include "TyCtx/TyTy.h"
+
+namespace rust_compiler::tyctx::TyTy {
+
+TypeInterner::~TypeInterner() {
+  for (BaseType *type : types)
+    type->~BaseType();
+}
+
+const BaseType *TypeInterner::intern(const BaseType *type) {
+  if (type->representative)
+    return type->representative;
+  if (type->notGround)
+    return nullptr;
+
+  llvm::FoldingSetNodeID id;
+  if (!profile(type, id)) {
+    type->notGround = true;
+    return nullptr;
+  }
+
+  auto [it, inserted] = representatives.try_emplace(id, nullptr);
+  if (inserted) {
+    // the representative is a private copy: type may change its references
+    BaseType *representative = type->clone();
+    representative->representative = representative;
+    it->second = representative;
+  }
+  type->representative = it->second;
+  return it->second;
+}
+
+bool TypeInterner::profile(const BaseType *type, llvm::FoldingSetNodeID &id) {
+  id.AddInteger(static_cast<unsigned>(type->getKind()));
+
+  // a component by the pointer of its representative; a component that is
+  // only known through the binding of an inference variable may change
+  auto addComponent = [&](const TypeVariable &variable) {
+    std::optional<BaseType *> component = variable.getResolvedType();
+    if (!component)
+      return false;
+    const BaseType *representative = intern(*component);
+    id.AddPointer(representative);
+    return representative != nullptr;
+  };
+
+  switch (type->getKind()) {
+  case TypeKind::Bool:
+  case TypeKind::Char:
+  case TypeKind::USize:
+  case TypeKind::ISize:
+  case TypeKind::Str:
+  case TypeKind::Never:
+    return true;
+  case TypeKind::Int:
+    id.AddInteger(static_cast<unsigned>(
+        static_cast<const IntType *>(type)->getIntKind()));
+    return true;
+  case TypeKind::Uint:
+    id.AddInteger(static_cast<unsigned>(
+        static_cast<const UintType *>(type)->getUintKind()));
+    return true;
+  case TypeKind::Float:
+    id.AddInteger(static_cast<unsigned>(
+        static_cast<const FloatType *>(type)->getFloatKind()));
+    return true;
+  case TypeKind::Tuple: {
+    const TupleType *tuple = static_cast<const TupleType *>(type);
+    id.AddInteger(tuple->getNumberOfFields());
+    for (size_t i = 0; i < tuple->getNumberOfFields(); ++i)
+      if (!addComponent(tuple->fields[i]))
+        return false;
+    return true;
+  }
+  case TypeKind::Reference: {
+    const ReferenceType *ref = static_cast<const ReferenceType *>(type);
+    id.AddBoolean(ref->isMutable());
+    return addComponent(ref->base);
+  }
+  case TypeKind::RawPointer: {
+    const RawPointerType *ptr = static_cast<const RawPointerType *>(type);
+    id.AddBoolean(ptr->isMutable());
+    return addComponent(ptr->base);
+  }
+  case TypeKind::Slice:
+    return addComponent(static_cast<const SliceType *>(type)->elementType);
+  // The length of an array is an unevaluated expression. An ADT shares its
+  // fields with its clones, and substitutions change them in place.
+  case TypeKind::Array:
+  case TypeKind::ADT:
+  case TypeKind::Inferred:
+  case TypeKind::Parameter:
+  case TypeKind::Projection:
+  case TypeKind::PlaceHolder:
+  case TypeKind::Function:
+  case TypeKind::Closure:
+  case TypeKind::FunctionPointer:
+  case TypeKind::Dynamic:
+  case TypeKind::Error:
+    return false;
+  }
+  return false;
+}
+
+} // namespace rust_compiler::tyctx::TyTy
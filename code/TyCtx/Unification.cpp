@@ -1,13 +1,13 @@
 #include "TyCtx/Unification.h"
 
-#include "Session/Session.h"
-#include "TyCtx/NodeIdentity.h"
+#include "TyCtx/InferenceTable.h"
 #include "TyCtx/Substitutions.h"
 #include "TyCtx/TyTy.h"
 
 #include <ios>
 #include <llvm/Support/ErrorHandling.h>
 #include <llvm/Support/raw_ostream.h>
+#include <optional>
 #include <vector>
 
 using namespace rust_compiler::tyctx;
@@ -18,25 +18,17 @@ namespace rust_compiler::tyctx {
 
 using namespace rust_compiler::tyctx;
 
-TyTy::BaseType *Unification::unify(bool forceCommit_, bool errors, bool infer) {
+TyTy::BaseType *Unification::unify(bool forceCommit_, bool errors) {
 
   TyTy::BaseType *leftType = lhs.getType();
   TyTy::BaseType *rightType = rhs.getType();
-  inference = infer;
   emitErrors = errors;
   forceCommit = forceCommit_;
 
   assert(leftType->getNumberOfSpecifiedBounds() == 0);
 
-  assert(inference == false);
-
-  if (inference)
-    handleInference();
-
   TyTy::BaseType *result = expect(leftType, rightType);
 
-  commits.push_back(CommitSite{leftType, rightType, result});
-
   if (forceCommit)
     commit(leftType, rightType, result);
 
@@ -46,9 +38,11 @@ TyTy::BaseType *Unification::unify(bool forceCommit_, bool errors, bool infer) {
   return result;
 }
 
-void Unification::handleInference() {
-  assert(false);
-  infers;
+TyTy::BaseType *Unification::unifyComponents(TyTy::BaseType *left,
+                                             TyTy::BaseType *right) {
+  Unification uni = {location, TyTy::WithLocation(left),
+                     TyTy::WithLocation(right), context};
+  return uni.unify(forceCommit, emitErrors);
 }
 
 void Unification::emitFailedUnification() {
@@ -62,23 +56,26 @@ void Unification::emitFailedUnification() {
 
 void Unification::commit(TyTy::BaseType *leftType, TyTy::BaseType *rightType,
                          TyTy::BaseType *result) {
+  if (result->getKind() == TypeKind::Error)
+    return;
 
   BaseType *b = leftType->destructure();
   BaseType *o = rightType->destructure();
 
-  result->appendReference(b->getReference());
-  result->appendReference(o->getReference());
-
-  for (auto ref : b->getCombinedReferences())
-    result->appendReference(ref);
-
-  for (auto ref : o->getCombinedReferences())
-    result->appendReference(ref);
-
-  o->appendReference(result->getReference());
-  o->appendReference(b->getReference());
-  b->appendReference(result->getReference());
-  b->appendReference(o->getReference());
+  // the inference variables among b, o, and result become one class
+  InferenceTable &table = context->getInferenceTable();
+  std::optional<NodeId> root;
+  for (BaseType *type : {b, o, result}) {
+    if (type->getKind() != TypeKind::Inferred)
+      continue;
+    NodeId variable = static_cast<InferType *>(type)->getVariable();
+    if (root)
+      table.unite(*root, variable);
+    else
+      root = variable;
+  }
+  if (!root)
+    return;
 
   bool isResolved = result->getKind() != TypeKind::Inferred;
   bool isInfererenceVariable = result->getKind() == TypeKind::Inferred;
@@ -87,21 +84,8 @@ void Unification::commit(TyTy::BaseType *leftType, TyTy::BaseType *rightType,
       (static_cast<InferType *>(result)->getInferredKind() !=
        InferKind::General);
 
-  if (isResolved || isScalarInferenceVariable) {
-
-    for (NodeId ref : result->getCombinedReferences()) {
-      std::optional<BaseType *> referenceType = context->lookupType(ref);
-      if (!referenceType)
-        continue;
-
-      if ((*referenceType)->getKind() == TypeKind::Inferred)
-        context->insertType(
-            NodeIdentity(ref,
-                         rust_compiler::session::session->getCurrentCrateNum(),
-                         location),
-            result->clone());
-    }
-  }
+  if (isResolved || isScalarInferenceVariable)
+    table.bind(*root, result);
 }
 
 TyTy::BaseType *Unification::expect(TyTy::BaseType *leftType,
@@ -191,10 +175,10 @@ TyTy::BaseType *Unification::expectIntType(TyTy::IntType *left,
   case TyTy::TypeKind::Int: {
     TyTy::IntType *rightInt = static_cast<TyTy::IntType *>(right);
     if (rightInt->getIntKind() == left->getIntKind())
-      return new TyTy::IntType(rightInt->getReference(),
-                               rightInt->getTypeReference(),
-                               rightInt->getIntKind());
-    return new ErrorType(0);
+      return context->create<TyTy::IntType>(rightInt->getReference(),
+                                            rightInt->getTypeReference(),
+                                            rightInt->getIntKind());
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::Inferred: {
     TyTy::InferType *infer = static_cast<TyTy::InferType *>(right);
@@ -203,7 +187,7 @@ TyTy::BaseType *Unification::expectIntType(TyTy::IntType *left,
       infer->applyScalarTypeHint(*left);
       return left->clone();
     }
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::Bool:
   case TyTy::TypeKind::Char:
@@ -227,7 +211,7 @@ TyTy::BaseType *Unification::expectIntType(TyTy::IntType *left,
   case TyTy::TypeKind::RawPointer:
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   llvm_unreachable("all cases covered");
 }
@@ -268,10 +252,10 @@ TyTy::BaseType *Unification::expectUSizeType(TyTy::USizeType *left,
   case TyTy::TypeKind::RawPointer:
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   }
-  return new ErrorType(0);
+  return context->create<TyTy::ErrorType>(0);
 }
 
 TyTy::BaseType *Unification::expectISizeType(TyTy::ISizeType *left,
@@ -309,9 +293,9 @@ TyTy::BaseType *Unification::expectISizeType(TyTy::ISizeType *left,
   case TyTy::TypeKind::RawPointer:
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
-  return new ErrorType(0);
+  return context->create<TyTy::ErrorType>(0);
 }
 
 TyTy::BaseType *Unification::expectTuple(TyTy::TupleType *left,
@@ -339,35 +323,35 @@ TyTy::BaseType *Unification::expectTuple(TyTy::TupleType *left,
   case TyTy::TypeKind::RawPointer:
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Error:
-    return new TyTy::ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   case TyTy::TypeKind::Inferred: {
     TyTy::InferType *r = static_cast<TyTy::InferType *>(right);
     if (r->getInferredKind() == InferKind::General)
       return left->clone();
-    return new TyTy::ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::Tuple: {
     TyTy::TupleType *tuple = static_cast<TyTy::TupleType *>(right);
     if (left->getNumberOfFields() != tuple->getNumberOfFields())
-      return new TyTy::ErrorType(0);
+      return context->create<TyTy::ErrorType>(0);
 
     std::vector<TyTy::TypeVariable> fields;
     for (size_t i = 0; i < left->getNumberOfFields(); ++i) {
       TyTy::BaseType *bo = left->getField(i);
       TyTy::BaseType *fo = tuple->getField(i);
 
-      TyTy::BaseType *unifiedType = Unification::unifyWithSite(
-          TyTy::WithLocation(bo), TyTy::WithLocation(fo), location, context);
+      TyTy::BaseType *unifiedType = unifyComponents(bo, fo);
 
-      // FIXME: commits, infers
       if (unifiedType->getKind() == TypeKind::Error)
-        return new TyTy::ErrorType(0);
+        return context->create<TyTy::ErrorType>(0);
 
       fields.push_back(TypeVariable(unifiedType->getReference()));
     }
 
-    return new TupleType(tuple->getReference(), tuple->getTypeReference(),
-                         Location::getEmptyLocation(), fields);
+    return context->create<TyTy::TupleType>(tuple->getReference(),
+                                            tuple->getTypeReference(),
+                                            Location::getEmptyLocation(),
+                                            fields);
   }
   }
 }
@@ -383,19 +367,19 @@ Unification::expectInferenceVariable(TyTy::InferType *left,
       if (r->getInferredKind() == InferKind::Integral ||
           r->getInferredKind() == InferKind::General)
         return rightType->clone();
-      return new TyTy::ErrorType(0);
+      return context->create<TyTy::ErrorType>(0);
     }
     case InferKind::Float: {
       if (r->getInferredKind() == InferKind::Float ||
           r->getInferredKind() == InferKind::General)
         return rightType->clone();
-      return new TyTy::ErrorType(0);
+      return context->create<TyTy::ErrorType>(0);
     }
     case InferKind::General: {
       return rightType->clone();
     }
     }
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TypeKind::Int:
   case TypeKind::Uint:
@@ -406,7 +390,7 @@ Unification::expectInferenceVariable(TyTy::InferType *left,
       left->applyScalarTypeHint(*rightType);
       return rightType->clone();
     }
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TypeKind::Float: {
     if (left->getInferredKind() == InferKind::General ||
@@ -414,7 +398,7 @@ Unification::expectInferenceVariable(TyTy::InferType *left,
       left->applyScalarTypeHint(*rightType);
       return rightType->clone();
     }
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TypeKind::ADT:
   case TypeKind::Str:
@@ -435,10 +419,10 @@ Unification::expectInferenceVariable(TyTy::InferType *left,
   case TypeKind::Closure: {
     if (left->getInferredKind() == InferKind::General)
       return rightType->clone();
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   llvm::llvm_unreachable_internal("all cases covered");
 }
@@ -446,13 +430,25 @@ Unification::expectInferenceVariable(TyTy::InferType *left,
 TyTy::BaseType *Unification::unifyWithSite(TyTy::WithLocation lhs,
                                            TyTy::WithLocation rhs,
                                            Location unify, TyCtx *context) {
+  Unification uni = {unify, lhs, rhs, context};
 
-  std::vector<CommitSite> commits;
-  std::vector<InferenceSite> infers;
+  return uni.unify(true /*commit*/, true /*emitError*/);
+}
+
+TyTy::BaseType *Unification::tryUnifyWithSite(TyTy::WithLocation lhs,
+                                              TyTy::WithLocation rhs,
+                                              Location unify, TyCtx *context) {
+  InferenceTable &table = context->getInferenceTable();
+  InferenceTable::Snapshot snapshot = table.snapshot();
 
-  Unification uni = {commits, infers, unify, lhs, rhs, context};
+  Unification uni = {unify, lhs, rhs, context};
+  TyTy::BaseType *result = uni.unify(true /*commit*/, false /*emitError*/);
 
-  return uni.unify(true /*commit*/, true /*emitError*/, false /*infer*/);
+  if (result->getKind() == TypeKind::Error)
+    table.rollbackTo(snapshot);
+  else
+    table.commit(snapshot);
+  return result;
 }
 
 TyTy::BaseType *Unification::expectRawPointer(TyTy::RawPointerType *pointer,
@@ -464,7 +460,7 @@ TyTy::BaseType *Unification::expectRawPointer(TyTy::RawPointerType *pointer,
     if (infer->getInferredKind() == TyTy::InferKind::General) {
       return pointer->clone();
     }
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::RawPointer: {
     TyTy::RawPointerType *type = static_cast<TyTy::RawPointerType *>(rightType);
@@ -472,14 +468,12 @@ TyTy::BaseType *Unification::expectRawPointer(TyTy::RawPointerType *pointer,
     TyTy::BaseType *baseType = pointer->getBase();
     TyTy::BaseType *otherBaseType = type->getBase();
 
-    TyTy::BaseType *resolved = Unification::unifyWithSite(
-        TyTy::WithLocation(baseType), TyTy::WithLocation(otherBaseType),
-        location, context);
+    TyTy::BaseType *resolved = unifyComponents(baseType, otherBaseType);
 
     if (resolved->getKind() == TypeKind::Error)
-      return new ErrorType(0);
+      return context->create<TyTy::ErrorType>(0);
 
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::USize:
   case TyTy::TypeKind::Bool:
@@ -503,7 +497,7 @@ TyTy::BaseType *Unification::expectRawPointer(TyTy::RawPointerType *pointer,
   case TyTy::TypeKind::FunctionPointer:
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
 }
 
@@ -515,7 +509,7 @@ TyTy::BaseType *Unification::expectSlice(TyTy::SliceType *leftType,
     if (infer->getInferredKind() == TyTy::InferKind::General) {
       return leftType->clone();
     }
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::USize:
   case TyTy::TypeKind::Bool:
@@ -539,21 +533,20 @@ TyTy::BaseType *Unification::expectSlice(TyTy::SliceType *leftType,
   case TyTy::TypeKind::RawPointer:
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   case TyTy::TypeKind::Slice: {
     TyTy::SliceType *type = static_cast<TyTy::SliceType *>(rightType);
-    TyTy::BaseType *elementUnify = Unification::unifyWithSite(
-        TyTy::WithLocation(leftType->getElementType()),
-        TyTy::WithLocation(type->getElementType()), location, context);
+    TyTy::BaseType *elementUnify =
+        unifyComponents(leftType->getElementType(), type->getElementType());
     if (elementUnify->getKind() == TypeKind::Error)
-      return new ErrorType(0);
-    return new TyTy::SliceType(
+      return context->create<TyTy::ErrorType>(0);
+    return context->create<TyTy::SliceType>(
         type->getReference(), type->getTypeReference(),
         type->getTypeIdentity().getLocation(),
         TyTy::TypeVariable(elementUnify->getReference()));
   }
   }
-  return new ErrorType(0);
+  return context->create<TyTy::ErrorType>(0);
 }
 
 TyTy::BaseType *Unification::expectArray(TyTy::ArrayType *array,
@@ -564,7 +557,7 @@ TyTy::BaseType *Unification::expectArray(TyTy::ArrayType *array,
     if (infer->getInferredKind() == TyTy::InferKind::General) {
       return array->clone();
     }
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::USize:
   case TyTy::TypeKind::Bool:
@@ -588,21 +581,20 @@ TyTy::BaseType *Unification::expectArray(TyTy::ArrayType *array,
   case TyTy::TypeKind::RawPointer:
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   case TyTy::TypeKind::Array: {
     TyTy::ArrayType *type = static_cast<TyTy::ArrayType *>(rightType);
-    TyTy::BaseType *elementUnify = Unification::unifyWithSite(
-        TyTy::WithLocation(array->getElementType()),
-        TyTy::WithLocation(type->getElementType()), location, context);
+    TyTy::BaseType *elementUnify =
+        unifyComponents(array->getElementType(), type->getElementType());
     if (elementUnify->getKind() == TypeKind::Error)
-      return new ErrorType(0);
-    return new TyTy::ArrayType(
+      return context->create<TyTy::ErrorType>(0);
+    return context->create<TyTy::ArrayType>(
         type->getReference(), type->getTypeIdentity().getLocation(),
         type->getCapacityExpression(),
         TyTy::TypeVariable(elementUnify->getReference()));
   }
   }
-  return new ErrorType(0);
+  return context->create<TyTy::ErrorType>(0);
 }
 
 TyTy::BaseType *Unification::expectUint(TyTy::UintType *leftType,
@@ -615,7 +607,7 @@ TyTy::BaseType *Unification::expectUint(TyTy::UintType *leftType,
       infer->applyScalarTypeHint(*leftType);
       return leftType->clone();
     }
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::USize:
   case TyTy::TypeKind::Bool:
@@ -639,15 +631,16 @@ TyTy::BaseType *Unification::expectUint(TyTy::UintType *leftType,
   case TyTy::TypeKind::RawPointer:
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   case TyTy::TypeKind::Uint:
     TyTy::UintType *type = static_cast<TyTy::UintType *>(rightType);
     if (leftType->getUintKind() == type->getUintKind())
-      return new TyTy::UintType(type->getReference(), type->getTypeReference(),
-                                type->getUintKind());
-    return new ErrorType(0);
+      return context->create<TyTy::UintType>(type->getReference(),
+                                             type->getTypeReference(),
+                                             type->getUintKind());
+    return context->create<TyTy::ErrorType>(0);
   }
-  return new ErrorType(0);
+  return context->create<TyTy::ErrorType>(0);
 }
 
 TyTy::BaseType *Unification::expectReference(TyTy::ReferenceType *leftType,
@@ -657,7 +650,7 @@ TyTy::BaseType *Unification::expectReference(TyTy::ReferenceType *leftType,
     TyTy::InferType *infer = static_cast<TyTy::InferType *>(rightType);
     if (infer->getInferredKind() == TyTy::InferKind::General)
       return leftType->clone();
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::USize:
   case TyTy::TypeKind::Bool:
@@ -681,23 +674,22 @@ TyTy::BaseType *Unification::expectReference(TyTy::ReferenceType *leftType,
   case TyTy::TypeKind::RawPointer:
   case TyTy::TypeKind::Uint:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   case TyTy::TypeKind::Reference:
     TyTy::ReferenceType *ref = static_cast<TyTy::ReferenceType *>(rightType);
-    TyTy::BaseType *resolvedType = Unification::unifyWithSite(
-        TyTy::WithLocation(leftType->getBase()),
-        TyTy::WithLocation(ref->getBase()), location, context);
+    TyTy::BaseType *resolvedType =
+        unifyComponents(leftType->getBase(), ref->getBase());
     if (resolvedType->getKind() == TypeKind::Error)
-      return new ErrorType(0);
+      return context->create<TyTy::ErrorType>(0);
     bool acceptableMutability = leftType->isMutable() ? ref->isMutable() : true;
     if (!acceptableMutability)
-      return new ErrorType(0);
+      return context->create<TyTy::ErrorType>(0);
 
-    return new ReferenceType(
+    return context->create<TyTy::ReferenceType>(
         leftType->getReference(), leftType->getTypeReference(),
         TyTy::TypeVariable(resolvedType->getReference()), leftType->getMut());
   }
-  return new ErrorType(0);
+  return context->create<TyTy::ErrorType>(0);
 }
 
 TyTy::BaseType *Unification::expectStr(TyTy::StrType *leftType,
@@ -707,7 +699,7 @@ TyTy::BaseType *Unification::expectStr(TyTy::StrType *leftType,
     TyTy::InferType *infer = static_cast<TyTy::InferType *>(rightType);
     if (infer->getInferredKind() == TyTy::InferKind::General)
       return leftType->clone();
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::USize:
   case TyTy::TypeKind::Bool:
@@ -731,11 +723,11 @@ TyTy::BaseType *Unification::expectStr(TyTy::StrType *leftType,
   case TyTy::TypeKind::Uint:
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   case TyTy::TypeKind::Str:
     return rightType->clone();
   }
-  return new ErrorType(0);
+  return context->create<TyTy::ErrorType>(0);
 }
 
 TyTy::BaseType *Unification::expectADT(TyTy::ADTType *left,
@@ -745,22 +737,22 @@ TyTy::BaseType *Unification::expectADT(TyTy::ADTType *left,
     TyTy::InferType *infer = static_cast<TyTy::InferType *>(rightType);
     if (infer->getInferredKind() == TyTy::InferKind::General)
       return left->clone();
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::ADT: {
     TyTy::ADTType *right = static_cast<TyTy::ADTType *>(rightType);
     if (left->getKind() != right->getKind())
-      return new ErrorType(0);
+      return context->create<TyTy::ErrorType>(0);
     if (left->getIdentifier() != right->getIdentifier())
-      return new ErrorType(0);
+      return context->create<TyTy::ErrorType>(0);
     if (left->getNumberOfVariants() != right->getNumberOfVariants())
-      return new ErrorType(0);
+      return context->create<TyTy::ErrorType>(0);
     for (size_t i = 0; i < left->getNumberOfVariants(); ++i) {
       TyTy::VariantDef *a = left->getVariant(i);
       TyTy::VariantDef *b = right->getVariant(i);
 
       if (a->getNumberOfFields() != b->getNumberOfFields())
-        return new ErrorType(0);
+        return context->create<TyTy::ErrorType>(0);
 
       for (size_t j = 0; j < a->getNumberOfFields(); ++j) {
         TyTy::StructFieldType *baseField = a->getFieldAt(j);
@@ -769,18 +761,17 @@ TyTy::BaseType *Unification::expectADT(TyTy::ADTType *left,
         TyTy::BaseType *baseFieldType = baseField->getFieldType();
         TyTy::BaseType *otherFieldType = otherField->getFieldType();
 
-        TyTy::BaseType *unifiedType = Unification::unifyWithSite(
-            TyTy::WithLocation(baseFieldType),
-            TyTy::WithLocation(otherFieldType), location, context);
+        TyTy::BaseType *unifiedType =
+            unifyComponents(baseFieldType, otherFieldType);
 
         if (unifiedType->getKind() == TypeKind::Error)
-          return new ErrorType(0);
+          return context->create<TyTy::ErrorType>(0);
       }
     }
 
     if (right->isUnit() && left->isUnit()) {
       if (right->getNumberOfSubstitutions() != left->getNumberOfSubstitutions())
-        return new ErrorType(0);
+        return context->create<TyTy::ErrorType>(0);
 
       for (size_t i = 0; i < right->getNumberOfSubstitutions(); ++i) {
         SubstitutionParamMapping &a = left->getSubstitutions()[i];
@@ -789,11 +780,10 @@ TyTy::BaseType *Unification::expectADT(TyTy::ADTType *left,
         ParamType *pa = a.getParamType();
         ParamType *pb = b.getParamType();
 
-        TyTy::BaseType *result = Unification::unifyWithSite(
-            TyTy::WithLocation(pa), TyTy::WithLocation(pb), location, context);
+        TyTy::BaseType *result = unifyComponents(pa, pb);
 
         if (result->getKind() == TypeKind::Error)
-          return new TyTy::ErrorType(0);
+          return context->create<TyTy::ErrorType>(0);
       }
     }
 
@@ -821,7 +811,7 @@ TyTy::BaseType *Unification::expectADT(TyTy::ADTType *left,
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Str:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   llvm_unreachable("all cases covered");
 }
@@ -833,7 +823,7 @@ TyTy::BaseType *Unification::expectNever(TyTy::NeverType *leftType,
     TyTy::InferType *infer = static_cast<TyTy::InferType *>(rightType);
     if (infer->getInferredKind() == TyTy::InferKind::General)
       return leftType->clone();
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   case TyTy::TypeKind::USize:
   case TyTy::TypeKind::ADT:
@@ -859,7 +849,7 @@ TyTy::BaseType *Unification::expectNever(TyTy::NeverType *leftType,
   case TyTy::TypeKind::Reference:
   case TyTy::TypeKind::Str:
   case TyTy::TypeKind::Error:
-    return new ErrorType(0);
+    return context->create<TyTy::ErrorType>(0);
   }
   llvm_unreachable("all cases covered");
 }
@@ -1,5 +1,7 @@
 #include "AST/Function.h"
 
+#include <utility>
+
 namespace rust_compiler::ast {
 
 void Function::setParameters(FunctionParameters _functionParameters) {
@@ -14,7 +16,14 @@ void Function::setGenericParams(GenericParams _genericParams) {
   genericParams = _genericParams;
 }
 
-void Function::setBody(std::shared_ptr<Expression> _body) { body = _body; }
+void Function::setBody(std::shared_ptr<Expression> _body) {
+  body = _body;
+  deferredBody.reset();
+}
+
+void Function::setDeferredBody(lexer::TokenStream tokens) {
+  deferredBody = std::make_shared<const lexer::TokenStream>(std::move(tokens));
+}
 
 void Function::setWhereClasue(WhereClause _whereClause) {
   whereClause = _whereClause;
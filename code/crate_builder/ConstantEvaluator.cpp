@@ -5,9 +5,12 @@
 #include "AST/PathExpression.h"
 #include "AST/VisItem.h"
 #include "CrateBuilder/CrateBuilder.h"
+#include "Lexer/Literal.h"
 
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
+#include <optional>
 
 using namespace rust_compiler::ast;
 
@@ -131,7 +134,8 @@ uint64_t CrateBuilder::foldAsUsizeItem(ast::Item *item) {
   case ItemKind::VisItem: {
     return foldAsUsizeVisItem(static_cast<ast::VisItem *>(item));
   }
-  case ItemKind::MacroItem: {
+  case ItemKind::MacroItem:
+  case ItemKind::ErrorItem: {
     assert(false);
   }
   }
@@ -199,15 +203,11 @@ CrateBuilder::foldAsUsizeLiteralExpression(ast::LiteralExpression *lit) {
     exit(EXIT_FAILURE);
   }
 
-  llvm::APInt result;
+  std::optional<lexer::uint128_t> value =
+      lexer::parseIntegerLiteral(lit->getValue());
 
-  std::string storage = lit->getValue();
-  llvm::StringRef(storage).getAsInteger(10, result);
-
-  unsigned bitWidth = result.getBitWidth();
-
-  if (bitWidth <= 64)
-    return result.getLimitedValue();
+  if (value && *value <= std::numeric_limits<uint64_t>::max())
+    return static_cast<uint64_t>(*value);
 
   llvm::errs() << "failed to fold literal"
                << "\n";
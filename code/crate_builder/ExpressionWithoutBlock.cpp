@@ -9,10 +9,12 @@
 #include "AST/StructExpression.h"
 #include "CrateBuilder/CrateBuilder.h"
 #include "Hir/HirOps.h"
+#include "Lexer/Literal.h"
 #include "TyCtx/TyTy.h"
 
 #include <cassert>
 #include <memory>
+#include <optional>
 #include <mlir/Dialect/Arith/IR/Arith.h>
 #include <mlir/Dialect/Vector/IR/VectorOps.h>
 #include <mlir/IR/Attributes.h>
@@ -145,11 +147,9 @@ mlir::Value CrateBuilder::emitLiteralExpression(ast::LiteralExpression *lit) {
   case LiteralExpressionKind::IntegerLiteral: {
     if (maybeType) {
 
-      llvm::APInt result;
-      std::string storage = lit->getValue();
-      llvm::StringRef(storage).getAsInteger(10, result);
-
-      uint64_t value = result.getLimitedValue();
+      std::optional<lexer::uint128_t> literal =
+          lexer::parseIntegerLiteral(lit->getValue());
+      uint64_t value = literal ? static_cast<uint64_t>(*literal) : 0;
       mlir::Type type = convertTyTyToMLIR(*maybeType);
       llvm::errs() << (*maybeType)->toString() << "\n";
       llvm::errs() << value << "\n";
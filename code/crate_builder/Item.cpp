@@ -20,6 +20,9 @@ void CrateBuilder::emitItem(Item *item) {
   case ItemKind::MacroItem: {
     assert(false && "to be implemented");
   }
+  case ItemKind::ErrorItem: {
+    break;
+  }
   }
 }
 
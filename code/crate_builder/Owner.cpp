@@ -59,6 +59,9 @@ std::optional<CrateBuilder::Owner> CrateBuilder::getOwnerItem(basic::NodeId id,
   case ItemKind::MacroItem: {
     assert(false);
   }
+  case ItemKind::ErrorItem: {
+    break;
+  }
   }
 
   llvm::errs() << "item failed"
@@ -251,6 +254,9 @@ CrateBuilder::getOwnerStatement(basic::NodeId id, ast::Statement *stmt) {
   case StatementKind::MacroInvocationSemi: {
     assert(false);
   }
+  case StatementKind::ErrorStatement: {
+    return std::nullopt;
+  }
   }
 }
 
@@ -32,6 +32,9 @@ void CrateBuilder::emitStatement(ast::Statement *stmt) {
   case ast::StatementKind::MacroInvocationSemi: {
     break;
   }
+  case ast::StatementKind::ErrorStatement: {
+    break;
+  }
   }
 }
 
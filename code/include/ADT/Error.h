@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Location.h"
+
+#include <llvm/Support/raw_ostream.h>
+
+#include <string>
+
+namespace rust_compiler::adt {
+
+/// The error of a StringResult. It is three words and never allocates: the
+/// descriptions are string literals, and the message is only rendered when
+/// the error is printed. A speculative parse that fails and recovers costs
+/// no more than returning the error.
+///
+/// An error keeps the innermost failure and its location, and the
+/// outermost description of what was being parsed:
+///
+///   file.rs 3:7: failed to parse block expression: expected `}`
+class Error {
+  /// the outermost description; nullptr if the error was not wrapped
+  const char *context = nullptr;
+  /// the innermost description
+  const char *cause;
+  /// the location of the innermost failure; 0 if unknown
+  Location location;
+
+public:
+  Error(const char *cause) : cause(cause) {}
+  Error(const char *cause, Location location)
+      : cause(cause), location(location) {}
+  /// wraps inner into a description of what was being parsed
+  Error(const char *context, const Error &inner)
+      : context(context), cause(inner.cause), location(inner.location) {}
+
+  const char *getCause() const { return cause; }
+  Location getLocation() const { return location; }
+
+  void print(llvm::raw_ostream &os) const {
+    if (location.getRawEncoding() != 0)
+      os << location.toString() << ": ";
+    if (context)
+      os << context << ": ";
+    os << cause;
+  }
+
+  std::string toString() const {
+    std::string s;
+    llvm::raw_string_ostream os(s);
+    print(os);
+    return os.str();
+  }
+};
+
+inline llvm::raw_ostream &operator<<(llvm::raw_ostream &os,
+                                     const Error &error) {
+  error.print(os);
+  return os;
+}
+
+} // namespace rust_compiler::adt
@@ -0,0 +1,273 @@
+#pragma once
+
+#include "Basic/Ids.h"
+
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rust_compiler::adt {
+
+/// A map from NodeIds to T with the interface of std::map.
+///
+/// NodeIds are handed out densely, so the entries live in a vector of pages
+/// indexed by the NodeId, each with a bitmap of its occupied slots: a
+/// lookup is a shift, an index, and a bit test. The pages are allocated on
+/// the first insert into them and never move, hence references to the
+/// entries stay valid until they are erased; inserts may invalidate
+/// iterators. NodeIds at and above MaxDenseId, e.g., UNKNOWN_NODEID, go to a
+/// std::map instead. Iteration is in the order of the NodeIds.
+///
+/// A page holds its values inline and costs PageSize slots as soon as one
+/// of them is used. That pays off for tables with an entry for a good part
+/// of the NodeIds and small values, e.g., the type of every node. Sparse
+/// tables, e.g., of the items or the impls, and tables of large values stay
+/// std::maps: SemaBench measures the bytes per entry of both maps.
+template <typename T> class NodeIdMap {
+public:
+  using key_type = basic::NodeId;
+  using mapped_type = T;
+  using value_type = std::pair<const basic::NodeId, T>;
+  using size_type = size_t;
+
+private:
+  static constexpr unsigned PageBits = 9;
+  static constexpr size_t PageSize = size_t(1) << PageBits;
+  static constexpr basic::NodeId MaxDenseId = basic::NodeId(1) << 24;
+
+  struct Page {
+    std::bitset<PageSize> occupied;
+    alignas(value_type) std::byte storage[PageSize * sizeof(value_type)];
+
+    value_type *at(size_t slot) {
+      return std::launder(reinterpret_cast<value_type *>(storage) + slot);
+    }
+
+    ~Page() {
+      for (size_t slot = 0; slot < PageSize; ++slot)
+        if (occupied[slot])
+          at(slot)->~value_type();
+    }
+  };
+
+  std::vector<std::unique_ptr<Page>> pages;
+  std::map<basic::NodeId, T> sparse;
+  size_t denseSize = 0;
+
+  template <bool IsConst> class Iterator {
+    using Map = std::conditional_t<IsConst, const NodeIdMap, NodeIdMap>;
+    using SparseIterator =
+        std::conditional_t<IsConst, typename std::map<basic::NodeId,
+                                                      T>::const_iterator,
+                           typename std::map<basic::NodeId, T>::iterator>;
+
+    Map *map = nullptr;
+    /// the index into the dense pages; past them in the sparse map
+    size_t index = 0;
+    SparseIterator sparse;
+
+    friend class NodeIdMap;
+    template <bool> friend class Iterator;
+
+    Iterator(Map *map, size_t index, SparseIterator sparse)
+        : map(map), index(index), sparse(sparse) {
+      skipEmpty();
+    }
+
+    size_t getDenseEnd() const { return map->pages.size() * PageSize; }
+
+    void skipEmpty() {
+      while (index < getDenseEnd()) {
+        Page *page = map->pages[index >> PageBits].get();
+        if (page && page->occupied[index & (PageSize - 1)])
+          return;
+        index = page ? index + 1 : ((index >> PageBits) + 1) << PageBits;
+      }
+    }
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::conditional_t<IsConst, const NodeIdMap::value_type,
+                                          NodeIdMap::value_type>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type *;
+    using reference = value_type &;
+
+    Iterator() = default;
+    /// iterator to const_iterator
+    template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+    Iterator(const Iterator<WasConst> &other)
+        : map(other.map), index(other.index), sparse(other.sparse) {}
+
+    reference operator*() const {
+      if (index < getDenseEnd())
+        return *map->pages[index >> PageBits]->at(index & (PageSize - 1));
+      return *sparse;
+    }
+    pointer operator->() const { return &**this; }
+
+    Iterator &operator++() {
+      if (index < getDenseEnd()) {
+        ++index;
+        skipEmpty();
+      } else {
+        ++sparse;
+      }
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const Iterator &other) const {
+      return index == other.index && sparse == other.sparse;
+    }
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+  };
+
+  /// the page of a dense id; nullptr if it has none yet
+  Page *getPage(basic::NodeId id) const {
+    size_t page = id >> PageBits;
+    return page < pages.size() ? pages[page].get() : nullptr;
+  }
+
+public:
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  NodeIdMap() = default;
+  NodeIdMap(NodeIdMap &&) = default;
+  NodeIdMap &operator=(NodeIdMap &&) = default;
+  NodeIdMap(const NodeIdMap &other) {
+    for (const value_type &entry : other)
+      insert(entry);
+  }
+  NodeIdMap &operator=(const NodeIdMap &other) {
+    if (this != &other) {
+      clear();
+      for (const value_type &entry : other)
+        insert(entry);
+    }
+    return *this;
+  }
+
+  iterator begin() { return iterator(this, 0, sparse.begin()); }
+  iterator end() {
+    return iterator(this, pages.size() * PageSize, sparse.end());
+  }
+  const_iterator begin() const {
+    return const_iterator(this, 0, sparse.begin());
+  }
+  const_iterator end() const {
+    return const_iterator(this, pages.size() * PageSize, sparse.end());
+  }
+
+  size_t size() const { return denseSize + sparse.size(); }
+  bool empty() const { return size() == 0; }
+
+  iterator find(basic::NodeId id) {
+    if (id >= MaxDenseId) {
+      auto it = sparse.find(id);
+      return it == sparse.end() ? end()
+                                : iterator(this, pages.size() * PageSize, it);
+    }
+    Page *page = getPage(id);
+    if (!page || !page->occupied[id & (PageSize - 1)])
+      return end();
+    return iterator(this, id, sparse.begin());
+  }
+  const_iterator find(basic::NodeId id) const {
+    return const_cast<NodeIdMap *>(this)->find(id);
+  }
+
+  size_t count(basic::NodeId id) const { return contains(id) ? 1 : 0; }
+  bool contains(basic::NodeId id) const {
+    if (id >= MaxDenseId)
+      return sparse.count(id) == 1;
+    Page *page = getPage(id);
+    return page && page->occupied[id & (PageSize - 1)];
+  }
+
+  /// Inserts T(args...) unless id is present, as std::map::try_emplace.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(basic::NodeId id, Args &&...args) {
+    if (id >= MaxDenseId) {
+      auto [it, inserted] =
+          sparse.try_emplace(id, std::forward<Args>(args)...);
+      return {iterator(this, pages.size() * PageSize, it), inserted};
+    }
+    size_t pageIndex = id >> PageBits;
+    if (pageIndex >= pages.size())
+      pages.resize(pageIndex + 1);
+    if (!pages[pageIndex])
+      pages[pageIndex] = std::make_unique<Page>();
+    Page *page = pages[pageIndex].get();
+    size_t slot = id & (PageSize - 1);
+    if (page->occupied[slot])
+      return {iterator(this, id, sparse.begin()), false};
+    new (page->at(slot)) value_type(std::piecewise_construct,
+                                    std::forward_as_tuple(id),
+                                    std::forward_as_tuple(
+                                        std::forward<Args>(args)...));
+    page->occupied[slot] = true;
+    ++denseSize;
+    return {iterator(this, id, sparse.begin()), true};
+  }
+
+  template <typename V>
+  std::pair<iterator, bool> emplace(basic::NodeId id, V &&value) {
+    return try_emplace(id, std::forward<V>(value));
+  }
+
+  std::pair<iterator, bool> insert(const value_type &entry) {
+    return try_emplace(entry.first, entry.second);
+  }
+  std::pair<iterator, bool> insert(value_type &&entry) {
+    return try_emplace(entry.first, std::move(entry.second));
+  }
+
+  T &operator[](basic::NodeId id) { return try_emplace(id).first->second; }
+
+  T &at(basic::NodeId id) {
+    iterator it = find(id);
+    assert(it != end() && "NodeId is not in the map");
+    return it->second;
+  }
+  const T &at(basic::NodeId id) const {
+    const_iterator it = find(id);
+    assert(it != end() && "NodeId is not in the map");
+    return it->second;
+  }
+
+  size_t erase(basic::NodeId id) {
+    if (id >= MaxDenseId)
+      return sparse.erase(id);
+    Page *page = getPage(id);
+    size_t slot = id & (PageSize - 1);
+    if (!page || !page->occupied[slot])
+      return 0;
+    page->at(slot)->~value_type();
+    page->occupied[slot] = false;
+    --denseSize;
+    return 1;
+  }
+  void erase(iterator it) { erase(it->first); }
+
+  void clear() {
+    pages.clear();
+    sparse.clear();
+    denseSize = 0;
+  }
+};
+
+} // namespace rust_compiler::adt
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ADT/Error.h"
+
 #include <cassert>
 #include <optional>
 #include <variant>
@@ -49,6 +51,6 @@ public:
   }
 };
 
-template <class T> using StringResult = Result<T, std::string>;
+template <class T> using StringResult = Result<T, Error>;
 
 } // namespace rust_compiler::adt
@@ -23,6 +23,8 @@ public:
 
   size_t getLength() const { return storage.size(); }
 
+  const std::vector<UChar32> &getCodePoints() const { return storage; }
+
   bool isEqualASCII(std::string_view ascii) const {
     if (storage.size() != ascii.size())
       return false;
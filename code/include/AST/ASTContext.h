@@ -0,0 +1,68 @@
+#pragma once
+
+#include <llvm/Support/Allocator.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rust_compiler::ast {
+
+/// The arena of the AST nodes of a crate. It owns the nodes: they are
+/// bump-allocated, and destroyed and released in one shot with the arena.
+///
+/// The edges between the nodes are non-owning. create returns a
+/// std::shared_ptr without a control block, hence copying an edge does no
+/// reference counting and the nodes stay valid as long as the arena, and
+/// no longer: whoever holds a node holds its arena or its ast::Crate too,
+/// which keeps the arena alive. Hence the Parser takes its arena from the
+/// caller. The edges keep the std::shared_ptr type, so that sema, the
+/// crate builder and the visitors are unchanged.
+///
+/// An arena is used from one thread at a time. The tasks of a thread pool
+/// allocate from arenas of their own, see fork.
+class ASTContext {
+  llvm::BumpPtrAllocator allocator;
+  /// the nodes with a destructor, in the order of creation
+  std::vector<std::pair<void *, void (*)(void *)>> destructors;
+
+  std::mutex forkMutex;
+  std::vector<std::shared_ptr<ASTContext>> forks;
+
+public:
+  ASTContext() = default;
+  ASTContext(const ASTContext &) = delete;
+  ASTContext &operator=(const ASTContext &) = delete;
+
+  ~ASTContext() {
+    for (auto it = destructors.rbegin(); it != destructors.rend(); ++it)
+      it->second(it->first);
+  }
+
+  /// the arena counterpart of std::make_shared
+  template <typename T, typename... Args>
+  std::shared_ptr<T> create(Args &&...args) {
+    T *node = new (allocator.Allocate(sizeof(T), llvm::Align(alignof(T))))
+        T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>)
+      destructors.emplace_back(
+          node, [](void *p) { static_cast<T *>(p)->~T(); });
+    // aliases an empty std::shared_ptr: no control block and no owner
+    return std::shared_ptr<T>(std::shared_ptr<T>(), node);
+  }
+
+  /// A new arena that this one owns, for another thread. It may be called
+  /// concurrently; the nodes of the fork live as long as this arena.
+  std::shared_ptr<ASTContext> fork() {
+    std::lock_guard<std::mutex> lock(forkMutex);
+    return forks.emplace_back(std::make_shared<ASTContext>());
+  }
+
+  size_t getBytesAllocated() const { return allocator.getBytesAllocated(); }
+};
+
+} // namespace rust_compiler::ast
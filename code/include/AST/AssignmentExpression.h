@@ -2,6 +2,8 @@
 
 #include "AST/OperatorExpression.h"
 
+#include <memory>
+
 namespace rust_compiler::ast {
 
 class AssignmentExpression final : public OperatorExpression {
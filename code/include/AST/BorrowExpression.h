@@ -3,6 +3,8 @@
 #include "AST/OperatorExpression.h"
 #include "Basic/Mutability.h"
 
+#include <memory>
+
 namespace rust_compiler::ast {
 
 class BorrowExpression final : public OperatorExpression {
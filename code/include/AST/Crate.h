@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ADT/CanonicalPath.h"
+#include "AST/ASTContext.h"
 #include "AST/InnerAttribute.h"
 #include "AST/Item.h"
 #include "AST/Module.h"
@@ -25,6 +26,9 @@ class Crate {
 
   basic::NodeId nodeId;
 
+  /// the arena of the nodes of the crate
+  std::shared_ptr<ASTContext> context;
+
 public:
   Crate(std::string_view crateName, basic::CrateNum crateNum);
 
@@ -49,6 +53,10 @@ public:
     return innerAttributes;
   }
 
+  /// The nodes of the crate live as long as the crate keeps context.
+  void setASTContext(std::shared_ptr<ASTContext> ctx) { context = ctx; }
+  std::shared_ptr<ASTContext> getASTContext() const { return context; }
+
   std::optional<basic::NodeId> getOwnerItem(basic::NodeId, ast::Item *);
 };
 
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "AST/Item.h"
+#include "Location.h"
+
+namespace rust_compiler::ast {
+
+/// An item that failed to parse in recovery mode. The Parser reported the
+/// error; later passes skip the item.
+class ErrorItem final : public Item {
+
+public:
+  ErrorItem(Location loc) : Item(loc, ItemKind::ErrorItem) {}
+};
+
+} // namespace rust_compiler::ast
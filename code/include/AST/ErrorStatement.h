@@ -0,0 +1,16 @@
+#pragma once
+
+#include "AST/Statement.h"
+
+namespace rust_compiler::ast {
+
+/// A statement that failed to parse in recovery mode. The Parser reported
+/// the error; later passes skip the statement.
+class ErrorStatement final : public Statement {
+
+public:
+  ErrorStatement(Location loc)
+      : Statement(loc, StatementKind::ErrorStatement) {}
+};
+
+} // namespace rust_compiler::ast
@@ -8,7 +8,9 @@
 #include "AST/GenericParams.h"
 #include "AST/VisItem.h"
 #include "AST/WhereClause.h"
+#include "Lexer/TokenStream.h"
 
+#include <cassert>
 #include <memory>
 #include <optional>
 #include <string>
@@ -19,6 +21,8 @@ class BlockExpression;
 
 class Function : public VisItem {
   std::optional<std::shared_ptr<Expression>> body;
+  /// the tokens of a body that is not parsed yet, from `{` to `}` and Eof
+  std::shared_ptr<const lexer::TokenStream> deferredBody;
   FunctionQualifiers qualifiers;
   std::optional<FunctionParameters> functionParameters;
   std::optional<GenericParams> genericParams;
@@ -32,9 +36,17 @@ public:
       : VisItem(loc, VisItemKind::Function, vis), qualifiers(loc),
         functionParameters(loc), genericParams(loc), whereClause(loc) {}
 
-  bool hasBody() const { return body.has_value(); }
+  bool hasBody() const { return body.has_value() || deferredBody; }
 
-  std::shared_ptr<Expression> getBody() const { return *body; }
+  std::shared_ptr<Expression> getBody() const {
+    assert(!deferredBody && "the body was not parsed");
+    return *body;
+  }
+
+  /// whether the Parser skipped the body, see Parser::setDeferFunctionBodies
+  bool hasDeferredBody() const { return deferredBody != nullptr; }
+  const lexer::TokenStream &getDeferredBody() const { return *deferredBody; }
+  void setDeferredBody(lexer::TokenStream tokens);
 
   void setQualifiers(FunctionQualifiers qualifiers);
 
@@ -3,6 +3,8 @@
 #include "AST/Expression.h"
 #include "Location.h"
 
+#include <memory>
+
 namespace rust_compiler::ast {
 
 class IfExpression final : public ExpressionWithBlock {
@@ -12,7 +12,7 @@ namespace rust_compiler::ast {
 
 class VisItem;
 
-enum class ItemKind { VisItem, MacroItem };
+enum class ItemKind { VisItem, MacroItem, ErrorItem };
 
 class Item : public Node {
   std::vector<OuterAttribute> outerAttributes;
@@ -2,6 +2,8 @@
 
 #include "AST/Expression.h"
 
+#include <memory>
+
 namespace rust_compiler::ast {
 
 class ReturnExpression final : public ExpressionWithoutBlock {
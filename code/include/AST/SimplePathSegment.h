@@ -4,6 +4,7 @@
 #include "Lexer/Identifier.h"
 #include "Lexer/KeyWords.h"
 
+#include <cassert>
 #include <cstddef>
 #include <optional>
 #include <string>
@@ -10,7 +10,8 @@ enum class StatementKind {
   ItemDeclaration,
   LetStatement,
   ExpressionStatement,
-  MacroInvocationSemi
+  MacroInvocationSemi,
+  ErrorStatement
 };
 
 class Statement : public Node {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 
@@ -23,6 +24,65 @@ struct DefId {
   CrateNum krate;
 };
 
+/// Hands out the NodeIds of a crate. The Session of the crate owns one and
+/// installs it for its lifetime; without a Session, a process-wide
+/// allocator is used. Allocation is thread-safe, but the ids drawn by
+/// concurrent threads depend on the schedule: workers that need
+/// deterministic ids reserve a block up front and draw from it with a
+/// NodeIdRange.
+class NodeIdAllocator {
+  std::atomic<NodeId> next;
+  NodeIdAllocator *outer = nullptr;
+
+public:
+  explicit NodeIdAllocator(NodeId first = 8) : next(first) {}
+
+  NodeIdAllocator(const NodeIdAllocator &) = delete;
+  NodeIdAllocator &operator=(const NodeIdAllocator &) = delete;
+
+  NodeId allocate() { return next.fetch_add(1, std::memory_order_relaxed); }
+
+  /// Reserves count consecutive NodeIds and returns the first one.
+  NodeId reserve(uint32_t count) {
+    return next.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  /// Makes this allocator the one of getNextNodeId() until uninstall().
+  /// Installs nest, and must happen before threads are spawned.
+  void install();
+  void uninstall();
+};
+
+/// the allocator installed last, or the process-wide one
+NodeIdAllocator &getNodeIdAllocator();
+
 NodeId getNextNodeId();
 
+/// Reserves count consecutive NodeIds and returns the first one.
+NodeId reserveNodeIds(uint32_t count);
+
+/// While alive, getNextNodeId() on the current thread draws from the
+/// reserved ids [begin, end) instead of the NodeIdAllocator. Parsers on
+/// worker threads thereby assign the same ids regardless of the number of
+/// threads and the schedule. If the range runs out, getNextNodeId() returns
+/// UNKNOWN_NODEID.
+class NodeIdRange {
+  NodeId next;
+  NodeId end;
+  bool exhausted = false;
+  NodeIdRange *outer;
+
+  friend NodeId getNextNodeId();
+
+public:
+  NodeIdRange(NodeId begin, NodeId end);
+  ~NodeIdRange();
+
+  NodeIdRange(const NodeIdRange &) = delete;
+  NodeIdRange &operator=(const NodeIdRange &) = delete;
+
+  /// whether more ids were requested than reserved
+  bool isExhausted() const { return exhausted; }
+};
+
 } // namespace rust_compiler::basic
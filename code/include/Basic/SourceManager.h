@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Location.h"
+
+#include <llvm/Support/Error.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace rust_compiler::basic {
+
+/// refers to a file or an explicit location in the SourceManager
+using FileId = uint32_t;
+
+/// Owns the loaded source files and hands out 32-bit Locations. Each file
+/// occupies a contiguous range of offsets; a Location is an offset into
+/// that address space. Line and column are only computed when they are
+/// requested, e.g., for a diagnostic, from a line table that is built on
+/// first use. Locations that do not point into a file, e.g., of
+/// synthesized tokens, occupy a single offset and store their line and
+/// column explicitly. The SourceManager is shared by all Lexers and is
+/// thread-safe. Edited buffers are replaced in their range of offsets, so
+/// that editing a file does not exhaust the address space.
+class SourceManager {
+  struct Entry {
+    /// the first offset of the entry
+    uint32_t base;
+    /// the number of offsets of the entry; more than the size of the buffer
+    uint32_t size;
+    std::string fileName;
+    /// nullptr for explicit locations and replaced buffers
+    std::unique_ptr<llvm::MemoryBuffer> buffer;
+    unsigned lineNumber = 0;
+    unsigned columnNumber = 0;
+
+    /// byte offsets of the first character of each line
+    mutable std::vector<uint32_t> lineStarts;
+    mutable std::unique_ptr<std::once_flag> lineStartsFlag;
+
+    Entry(uint32_t base, uint32_t size, std::string_view fileName)
+        : base(base), size(size), fileName(fileName),
+          lineStartsFlag(std::make_unique<std::once_flag>()) {}
+  };
+
+  mutable std::shared_mutex mutex;
+  std::deque<Entry> entries;
+  uint32_t nextOffset = 0;
+  /// explicit locations are shared by equal file names, lines, and columns
+  std::map<std::tuple<std::string, unsigned, unsigned>, Location, std::less<>>
+      explicitLocations;
+
+  FileId addEntry(std::string_view fileName, uint32_t size,
+                  std::unique_ptr<llvm::MemoryBuffer> buffer,
+                  unsigned lineNumber = 0, unsigned columnNumber = 0);
+  /// nullopt if the offsets ran out
+  std::optional<FileId> tryAddEntry(std::string_view fileName, uint32_t size,
+                                    std::unique_ptr<llvm::MemoryBuffer> buffer,
+                                    unsigned lineNumber, unsigned columnNumber);
+  const Entry &getEntry(Location loc) const;
+  const std::vector<uint32_t> &getLineStarts(const Entry &entry) const;
+
+public:
+  SourceManager();
+
+  /// Loads the file at path. Reports an error and exits on failure.
+  FileId loadFile(std::string_view path);
+  /// Loads the file at path under the name fileName.
+  FileId loadFile(std::string_view path, std::string_view fileName);
+  /// Like loadFile, but returns the failure instead of exiting, e.g., on a
+  /// worker thread.
+  llvm::Expected<FileId> tryLoadFile(std::string_view path,
+                                     std::string_view fileName);
+
+  /// Copies code into a new buffer.
+  FileId addBuffer(std::string_view fileName, std::string_view code);
+
+  /// Replaces the buffer of file by a copy of code, e.g., after an edit.
+  /// If code fits into the offsets of file, file keeps them and is
+  /// returned. Otherwise, the old buffer is released and code moves to a
+  /// new file with twice as many offsets, so that repeated edits use
+  /// amortized constant address space. Either way, Locations into and
+  /// views of the old buffer are no longer valid.
+  FileId replaceBuffer(FileId file, std::string_view code);
+
+  std::string_view getBuffer(FileId file) const;
+  const llvm::MemoryBuffer *getMemoryBuffer(FileId file) const;
+  std::string_view getFileName(FileId file) const;
+
+  /// the Location of the byte at offset in file
+  Location getLocation(FileId file, uint32_t offset) const;
+
+  /// Equal explicit locations share one offset.
+  Location getExplicitLocation(std::string_view fileName, unsigned lineNumber,
+                               unsigned columnNumber);
+
+  FileId getFileId(Location loc) const;
+  /// the byte offset of loc in its file
+  uint32_t getFileOffset(Location loc) const;
+
+  std::string_view getFileName(Location loc) const;
+  unsigned getLineNumber(Location loc) const;
+  unsigned getColumnNumber(Location loc) const;
+};
+
+SourceManager &getSourceManager();
+
+} // namespace rust_compiler::basic
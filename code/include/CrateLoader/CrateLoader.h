@@ -2,6 +2,8 @@
 
 #include "AST/Crate.h"
 
+#include <llvm/Support/Threading.h>
+
 #include <memory>
 #include <string_view>
 
@@ -9,8 +11,11 @@ namespace rust_compiler::crate_loader {
 
 enum class LoadMode { File, CargoTomlDir };
 
-std::shared_ptr<ast::Crate> loadCrate(std::string_view path,
-                                      std::string_view crateName,
-                                      basic::CrateNum crateNum, LoadMode mode);
+/// Lexes the files of the crate's module tree in parallel with the given
+/// strategy and parses them.
+std::shared_ptr<ast::Crate>
+loadCrate(std::string_view path, std::string_view crateName,
+          basic::CrateNum crateNum, LoadMode mode,
+          llvm::ThreadPoolStrategy strategy = llvm::hardware_concurrency());
 
 } // namespace rust_compiler::crate_loader
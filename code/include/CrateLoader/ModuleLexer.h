@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Lexer/TokenStream.h"
+
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/ThreadPool.h>
+#include <llvm/Support/Threading.h>
+
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace rust_compiler::crate_loader {
+
+/// Lexes the files of a crate's module tree in parallel. Each lexed file is
+/// scanned for `mod foo;` declarations, and the files of those modules are
+/// speculatively scheduled before the parser asks for them. The parser
+/// consumes the token streams in any order; getTokenStream blocks until the
+/// file is lexed.
+///
+/// https://doc.rust-lang.org/reference/items/modules.html#module-source-filenames
+class ModuleLexer {
+  struct LexedFile {
+    std::shared_future<void> done;
+    lexer::TokenStream tokens;
+    /// why loading or lexing failed; the workers never exit
+    std::optional<std::string> error;
+  };
+
+  llvm::ThreadPool pool;
+
+  std::mutex mutex;
+  llvm::StringMap<LexedFile> files;
+
+public:
+  /// The strategy follows the conventions of llvm::ThreadPool, e.g.,
+  /// llvm::get_threadpool_strategy for a --threads option.
+  explicit ModuleLexer(
+      llvm::ThreadPoolStrategy strategy = llvm::hardware_concurrency());
+
+  /// Waits for the speculative work that the parser did not ask for.
+  ~ModuleLexer();
+
+  /// Schedules the root file of the crate and, transitively, the files of
+  /// its modules.
+  void lexRootModule(std::string_view path, std::string_view fileName);
+
+  /// Returns the token stream of the file at path, which the ModuleLexer
+  /// owns: it is not copied and lives as long as the ModuleLexer. Schedules
+  /// the file if it was not discovered. If the file could not be loaded or
+  /// lexed, waits for the remaining work and returns the error.
+  llvm::Expected<const lexer::TokenStream &>
+  getTokenStream(std::string_view path);
+
+  /// The directory of the files of the modules declared in the file at
+  /// path. The crate root and mod.rs files own their directory.
+  static std::string getModuleDirectory(std::string_view path, bool isRoot);
+
+  /// The file of `mod name;` declared in directory: name.rs or name/mod.rs.
+  /// Returns name.rs if neither exists.
+  static std::string getModuleFile(std::string_view directory,
+                                   std::string_view name);
+
+private:
+  void schedule(std::string_view path, std::string_view fileName,
+                bool isRoot);
+  void lexFile(LexedFile &file, std::string path, std::string fileName,
+               bool isRoot);
+  void discoverModules(const lexer::TokenStream &tokens,
+                       std::string_view directory);
+};
+
+} // namespace rust_compiler::crate_loader
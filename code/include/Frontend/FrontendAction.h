@@ -6,6 +6,7 @@
 #include "Frontend/FrontendOptions.h"
 
 #include <llvm/Support/Error.h>
+#include <llvm/Support/Threading.h>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -16,6 +17,7 @@ class FrontendAction {
   FrontendInput currentInput;
   CompilerInstance *instance;
   basic::Edition edition;
+  llvm::ThreadPoolStrategy strategy = llvm::hardware_concurrency();
   std::shared_ptr<ast::Crate> crate;
 
 protected:
@@ -48,6 +50,9 @@ public:
 
   void setEdition(basic::Edition edition);
 
+  /// The threads for lexing the files of the crate, see --threads.
+  void setThreadPoolStrategy(llvm::ThreadPoolStrategy strategy);
+
   /// Run the action.
   llvm::Error execute();
 
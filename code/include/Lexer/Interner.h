@@ -0,0 +1,77 @@
+#pragma once
+
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Support/Allocator.h>
+#include <llvm/Support/MathExtras.h>
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+
+namespace rust_compiler::lexer {
+
+class LiteralCache;
+
+/// Interns the spellings of identifiers, keywords, and literals. A Token
+/// stores a 32-bit id instead of a std::string. The spelling is only
+/// materialized on demand. The id 0 is the empty string.
+///
+/// The Session of a crate owns one and installs it for its lifetime;
+/// without a Session, a process-wide Interner is used. The spellings and
+/// the ids of an Interner are freed with it. intern is thread-safe. lookup
+/// takes no lock: the spellings live in append-only chunks that never
+/// move, and an id is only handed out after its entry is written.
+class Interner {
+  /// chunk k holds FirstChunkSize << k spellings
+  static constexpr unsigned FirstChunkBits = 10;
+  static constexpr uint32_t FirstChunkSize = 1u << FirstChunkBits;
+  static constexpr unsigned MaxChunks = 32 - FirstChunkBits;
+
+  std::shared_mutex mutex;
+  llvm::StringMap<uint32_t, llvm::BumpPtrAllocator> ids;
+  /// indexed by id; the views point into the keys of ids
+  std::array<std::atomic<std::string_view *>, MaxChunks> chunks = {};
+  std::atomic<uint32_t> size = 0;
+
+  /// the values decoded from the literals interned here (Literal.h)
+  std::unique_ptr<LiteralCache> literals;
+
+  Interner *outer = nullptr;
+
+  void append(std::string_view spelling);
+
+public:
+  Interner();
+  ~Interner();
+
+  Interner(const Interner &) = delete;
+  Interner &operator=(const Interner &) = delete;
+
+  uint32_t intern(std::string_view spelling);
+
+  std::string_view lookup(uint32_t id) const {
+    assert(id < size.load(std::memory_order_acquire));
+    uint32_t index = id + FirstChunkSize;
+    unsigned chunk = llvm::Log2_32(index) - FirstChunkBits;
+    return chunks[chunk].load(
+        std::memory_order_acquire)[index - (FirstChunkSize << chunk)];
+  }
+
+  size_t getSize() const { return size.load(std::memory_order_acquire); }
+
+  LiteralCache &getLiteralCache() { return *literals; }
+
+  /// Makes this Interner the one of getInterner() until uninstall().
+  /// Installs nest, and must happen before threads are spawned.
+  void install();
+  void uninstall();
+};
+
+/// the Interner installed last, or the process-wide one
+Interner &getInterner();
+
+} // namespace rust_compiler::lexer
@@ -2,13 +2,14 @@
 
 #include "Basic/Edition.h"
 
+#include <cstdint>
 #include <optional>
 #include <string>
 
 namespace rust_compiler::lexer {
 
 /// https://doc.rust-lang.org/reference/keywords.html
-enum class KeyWordKind {
+enum class KeyWordKind : uint8_t {
   KW_AS,
   KW_BREAK,
   KW_CONST,
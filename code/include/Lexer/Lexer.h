@@ -1,8 +1,15 @@
 #pragma once
 
 #include "ADT/Utf8String.h"
+#include "Basic/SourceManager.h"
+#include "Lexer/KeyWords.h"
+#include "Lexer/TokenSource.h"
 #include "Lexer/TokenStream.h"
 
+#include <llvm/Support/Error.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include <optional>
 #include <string_view>
 #include <unicode/uchar.h>
 
@@ -10,8 +17,35 @@
 /// UTF-8.
 namespace rust_compiler::lexer {
 
+/// Lexes a copy of code, for one-shot callers, e.g., a test. Every call adds
+/// a buffer to the SourceManager, whose offsets are never reclaimed. Callers
+/// that lex the same file again add it once and use
+/// SourceManager::replaceBuffer with lex(FileId) or relex.
 TokenStream lex(std::string_view code, std::string_view fileName);
 
+/// lexes a file that is owned by the SourceManager
+TokenStream lex(basic::FileId file);
+/// Like lex, but returns an unknown token as an error instead of exiting,
+/// e.g., on a worker thread.
+llvm::Expected<TokenStream> tryLex(basic::FileId file);
+
+/// An edit of a buffer: the removed bytes at offset were replaced by the
+/// inserted bytes.
+struct TextEdit {
+  uint32_t offset;
+  uint32_t removed;
+  uint32_t inserted;
+};
+
+/// Relexes file, which is the buffer of previous after edit. Only the
+/// tokens around the edit are lexed again: lexing resumes at a token before
+/// the edit and stops at the first token past the edit that starts where a
+/// token of previous started. The remaining tokens of previous are shifted.
+/// file is usually the FileId that SourceManager::replaceBuffer returned
+/// for the file of previous, so that edits do not accumulate buffers.
+TokenStream relex(const TokenStream &previous, const TextEdit &edit,
+                  basic::FileId file);
+
 class CheckPoint {
   uint32_t offset;
   uint32_t lineNumber;
@@ -26,23 +60,75 @@ public:
   uint32_t getColumnNumber() const { return columnNumber; }
 };
 
+/// How the Lexer holds the source file.
+enum class LexerMode {
+  /// Decode the whole file with ICU into UTF-32 code points.
+  Utf32,
+  /// Work in-place on the memory-mapped UTF-8 bytes of the file. ASCII is
+  /// read directly, multi-byte sequences are only decoded on demand.
+  MemoryMappedUtf8
+};
+
 /// https://doc.rust-lang.org/reference/tokens.html
-class Lexer {
+class Lexer : public TokenSource {
   // std::string chars;
   std::string fileName;
   uint32_t remaining;
-  TokenStream tokenStream;
+  /// index into tokens (Utf32) or byte offset into buffer (MemoryMappedUtf8)
   uint32_t offset;
 
+  LexerMode mode = LexerMode::MemoryMappedUtf8;
+
   std::vector<UChar32> tokens;
+  /// the byte offset in the file of each code point in tokens (Utf32)
+  std::vector<uint32_t> byteOffsets;
+  /// the UTF-8 encoding of the last getSourceText (Utf32)
+  std::string utf32Text;
+
+  /// owned by the SourceManager
+  const llvm::MemoryBuffer *buffer = nullptr;
+  basic::FileId file = 0;
+  /// the Location of the first byte of file; the Location of a byte is
+  /// this plus its offset, without asking the SourceManager
+  uint32_t fileStart = 0;
 
 public:
-  void lex(std::string_view fileName);
+  /// lexes the file up to and including the Eof token
+  TokenStream lex(std::string_view fileName,
+                  LexerMode mode = LexerMode::MemoryMappedUtf8);
+
+  /// Prepares lexing the file on demand, one token per call of next.
+  void open(std::string_view fileName,
+            LexerMode mode = LexerMode::MemoryMappedUtf8);
+
+  /// the next token of the opened file
+  Token next() override;
 
 private:
+  void loadUtf32(std::string_view fileName);
+  void loadMemoryMappedUtf8(std::string_view fileName);
+
+  /// decodes the code point at byte offset pos of the buffer
+  UChar32 decodeUtf8(uint32_t pos) const;
+  /// byte offset of the code point after the one at pos; pos at the end
+  /// of the buffer
+  uint32_t nextUtf8(uint32_t pos) const;
+  uint32_t getBufferSize() const { return buffer->getBufferSize(); }
+  const char *getCurrentByte() const {
+    return buffer->getBufferStart() + offset;
+  }
+  /// skips count bytes that end at a code point boundary (MemoryMappedUtf8)
+  void skipASCII(uint32_t count);
+  /// the source text from start to offset: a view into the buffer
+  /// (MemoryMappedUtf8) or into utf32Text (Utf32)
+  std::string_view getSourceText(uint32_t start);
+
+  /// moves to the next code point and returns it; nullopt once the end of
+  /// the file is reached, in both modes
   std::optional<UChar32> bump();
 
   Token advanceToken();
+  std::optional<Token> lexPunctuation();
 
   Token lexChar();
   // Token lexString();
@@ -53,7 +139,6 @@ private:
   Token lexRawByteString();
   Token lexStringLiteral();
   Token lexRawDoubleQuotedString();
-  adt::Utf8String getRawByteStringContent();
   Token lexRawIdentifier();
 
   Token lexIntegerLiteral();
@@ -72,6 +157,7 @@ private:
   Token lexDecimalLiteral();
 
   Token lexIdentifierOrKeyWord();
+  void lexIdentifierContinue();
   Token lexIdentifierOrUnknownPrefix();
   Token lexFakeIdentifierOrUnknownPrefix();
   adt::Utf8String getIdentifierOrKeyWord();
@@ -98,6 +184,8 @@ private:
   bool checkIntegerTypeHint();
   bool checkFloatTypeHint();
   TypeHint getTypeHint();
+  /// lexes the type hint of a literal, if any
+  std::optional<TypeHint> lexTypeHint();
 
   bool isASCIIForString(UChar32, UChar32);
   bool isIsolatedCR();
@@ -106,12 +194,6 @@ private:
   bool isQuoteEscape();
   bool isASCIIEscape();
   bool isUnicodeEscape();
-  adt::Utf8String getUnicodeEscape();
-  unsigned char getASCIIEscape();
-  adt::Utf8String getQuoteEscape();
-
-  bool isNotALineBreak();
-  adt::Utf8String getNotALineBreak();
 
   bool checkSuffix();
   adt::Utf8String lexSuffixToUtf8();
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Lexer/Token.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/// Decoding of literal tokens. The Lexer only interns the source text of a
+/// literal, including quotes, prefixes, and escapes. The value is decoded
+/// when the type checker or the constant evaluator asks for it.
+///
+/// https://doc.rust-lang.org/reference/tokens.html#literals
+namespace rust_compiler::lexer {
+
+/// Parses the digits of a decimal, binary, octal, or hexadecimal integer
+/// literal, e.g., 1_000 or 0xff, without the type hint. Returns nullopt if
+/// the value does not fit into 128 bits.
+std::optional<uint128_t> parseIntegerLiteral(std::string_view spelling);
+
+/// Returns parseIntegerLiteral of the interned spelling id. The value is
+/// parsed once and cached.
+std::optional<uint128_t> getDecodedIntegerLiteral(uint32_t id);
+
+/// Parses a float literal without the type hint, e.g., 1_000.5e-3.
+std::optional<double> parseFloatLiteral(std::string_view spelling);
+
+/// Decodes a char, byte, string, byte string, or raw string literal: strips
+/// the prefix, the quotes, and the suffix, and expands the escapes. Returns
+/// nullopt for a malformed escape.
+std::optional<std::string> decodeStringLiteral(std::string_view spelling);
+
+/// Returns decodeStringLiteral of the interned spelling id. Literals without
+/// escapes are returned in place, the others are decoded once and cached.
+/// The result is valid for the lifetime of the Interner.
+std::optional<std::string_view> getDecodedStringLiteral(uint32_t id);
+
+} // namespace rust_compiler::lexer
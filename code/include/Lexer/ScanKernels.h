@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string_view>
+
+/// Scanning kernels over UTF-8 bytes for the hot loops of the Lexer. Each
+/// kernel returns a pointer to the first byte in [begin, end) that stops the
+/// scan, or end. Bytes >= 0x80 always stop the scan: the Lexer only decodes
+/// non-ASCII input with ICU.
+namespace rust_compiler::lexer {
+
+enum class ScanKernelISA { Scalar, SSE2, AVX2 };
+
+/// stops at the first byte that is not one of ' ', \t, \n, \v, \f, \r
+const char *scanWhiteSpace(const char *begin, const char *end);
+
+/// stops at \n
+const char *scanLineComment(const char *begin, const char *end);
+
+/// stops at '*' or '/'
+const char *scanBlockComment(const char *begin, const char *end);
+
+/// stops at the first byte that is not [A-Za-z0-9_]
+const char *scanIdentifierContinue(const char *begin, const char *end);
+
+/// the instruction set that was selected at startup
+ScanKernelISA getScanKernelISA();
+
+/// Overrides the runtime selection, e.g., for testing and benchmarking.
+/// Returns false if the CPU does not support the instruction set.
+bool setScanKernelISA(ScanKernelISA isa);
+
+std::string_view ScanKernelISA2String(ScanKernelISA isa);
+
+} // namespace rust_compiler::lexer
@@ -1,11 +1,18 @@
 #pragma once
 
 #include "ADT/Utf8String.h"
+#include "Basic/SourceManager.h"
 #include "Lexer/Identifier.h"
+#include "Lexer/Interner.h"
 #include "Lexer/KeyWords.h"
 #include "Location.h"
 
+#include <cassert>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 // https://doc.rust-lang.org/reference/tokens.html
 // https://doc.rust-lang.org/nightly/nightly-rustc/rustc_ast/token/enum.TokenKind.html
@@ -15,7 +22,7 @@ namespace rust_compiler::lexer {
 using uint128_t = unsigned __int128;
 using int128_t = __int128;
 
-enum class TypeHint {
+enum class TypeHint : uint8_t {
   u8,
   i8,
   u16,
@@ -49,7 +56,7 @@ enum class IntegerKind {
 
 enum class FloatKind { F32, F64 };
 
-enum class TokenKind {
+enum class TokenKind : uint8_t {
   Colon,
   RArrow,
   // LessThan,
@@ -135,16 +142,18 @@ enum class TokenKind {
   Tilde
 };
 
+/// A compact, trivially copyable token: the kind, a span in the source
+/// file, and the interned spelling. The spelling is only materialized on
+/// demand.
 class Token {
   rust_compiler::Location loc;
+  /// in bytes
+  uint32_t length;
+  /// Interner id of the spelling
+  uint32_t value;
   TokenKind kind;
-  std::string storage;
-  //  IntegerKind ik;
-  //  FloatKind fk;
-  KeyWordKind kw;
-  Identifier ident;
-  adt::Utf8String utf8Storage;
-  std::optional<TypeHint> hint;
+  /// KeyWordKind for keywords, TypeHint + 1 for literals with a hint
+  uint8_t extra = 0;
 
   //  std::variant<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t,
   //  int64_t,
@@ -152,19 +161,31 @@ class Token {
   //      content;
 
 public:
-  Token(rust_compiler::Location loc, TokenKind tk) : loc(loc), kind(tk){};
+  Token(rust_compiler::Location loc, uint32_t length, TokenKind tk)
+      : loc(loc), length(length), value(0), kind(tk){};
+  Token(rust_compiler::Location loc, uint32_t length, TokenKind tk,
+        std::string_view id)
+      : loc(loc), length(length), value(getInterner().intern(id)),
+        kind(tk){};
+  Token(rust_compiler::Location loc, uint32_t length, KeyWordKind kw,
+        std::string_view id)
+      : loc(loc), length(length), value(getInterner().intern(id)),
+        kind(TokenKind::Keyword), extra(static_cast<uint8_t>(kw)){};
+
+  Token(rust_compiler::Location loc, TokenKind tk) : Token(loc, 0, tk){};
   Token(rust_compiler::Location loc, TokenKind tk, std::string_view id)
-      : loc(loc), kind(tk), storage(id){};
+      : Token(loc, id.size(), tk, id){};
 
   Token(rust_compiler::Location loc, TokenKind tk, std::string_view id,
         TypeHint hint)
-    : loc(loc), kind(tk), storage(id), hint(hint){};
+      : Token(loc, tk, id) {
+    extra = static_cast<uint8_t>(hint) + 1;
+  };
 
   Token(rust_compiler::Location loc, KeyWordKind kw, std::string_view id)
-      : loc(loc), kind(TokenKind::Keyword), storage(id), kw(kw){};
+      : Token(loc, id.size(), kw, id){};
 
-  Token(rust_compiler::Location loc, TokenKind tk, adt::Utf8String id)
-      : loc(loc), kind(tk), utf8Storage(id){};
+  Token(rust_compiler::Location loc, TokenKind tk, const adt::Utf8String &id);
 
   //  Token(rust_compiler::Location loc, IntegerKind ik)
   //      : loc(loc), kind(TokenKind::Integer), ik(ik){};
@@ -175,7 +196,15 @@ public:
   TokenKind getKind() const { return kind; }
   //  IntegerKind getIntegerKind() const { return ik; }
   // FloatKind getFloatKind() const { return fk; }
-  KeyWordKind getKeyWordKind() const { return kw; }
+  KeyWordKind getKeyWordKind() const {
+    return static_cast<KeyWordKind>(extra);
+  }
+
+  std::optional<TypeHint> getTypeHint() const {
+    if (isKeyWord() || extra == 0)
+      return std::nullopt;
+    return static_cast<TypeHint>(extra - 1);
+  }
 
   bool isKeyWord() const { return kind == TokenKind::Keyword; }
 
@@ -189,14 +218,34 @@ public:
   bool isAs() const;
 
   /// FIXME: change with Lexer2
-  Identifier getIdentifier() const { return Identifier(storage); }
+  Identifier getIdentifier() const { return Identifier(getSpelling()); }
 
   rust_compiler::Location getLocation() const { return loc; }
+  void setLocation(rust_compiler::Location _loc) { loc = _loc; }
+
+  /// the byte offset in the source file
+  uint32_t getOffset() const {
+    return basic::getSourceManager().getFileOffset(loc);
+  }
+  uint32_t getLength() const { return length; }
 
-  std::string getLiteral() const { return storage; }
+  std::string getLiteral() const { return std::string(getSpelling()); }
 
-  std::string getStorage() const { return storage; }
-  adt::Utf8String getUtf8Storage() const { return utf8Storage; }
+  std::string getStorage() const { return std::string(getSpelling()); }
+  adt::Utf8String getUtf8Storage() const;
+
+  /// the interned spelling; valid for the lifetime of the Interner
+  std::string_view getSpelling() const {
+    return getInterner().lookup(value);
+  }
+
+  /// The values of literals are decoded on demand from the spelling; see
+  /// Lexer/Literal.h.
+  std::optional<uint128_t> getIntegerValue() const;
+  std::optional<double> getFloatValue() const;
+  /// the contents of a char, byte, or string literal with the escapes
+  /// expanded
+  std::optional<std::string_view> getStringValue() const;
 
   // std::string toString();
 
@@ -206,6 +255,9 @@ private:
   std::string LifetimeTokenToString() const;
 };
 
+static_assert(sizeof(Token) == 16, "Token should stay compact");
+static_assert(std::is_trivially_copyable_v<Token>);
+
 std::string Token2String(TokenKind kind);
 
 } // namespace rust_compiler::lexer
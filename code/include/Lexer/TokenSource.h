@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Lexer/Token.h"
+#include "Lexer/TokenStream.h"
+
+namespace rust_compiler::lexer {
+
+/// A pull-based producer of tokens. The consumer, e.g., the lookahead buffer
+/// of the Parser, asks for one token at a time, so that lexing and parsing
+/// can be interleaved.
+class TokenSource {
+public:
+  virtual ~TokenSource() = default;
+
+  /// Returns the next token. Returns Eof again after the Eof token.
+  virtual Token next() = 0;
+
+  /// Skips count tokens.
+  virtual void skip(size_t count) {
+    for (size_t i = 0; i < count; ++i)
+      (void)next();
+  }
+
+  /// The TokenStream that next() hands out from its first token, if the
+  /// tokens were lexed ahead, e.g., for its matching-delimiter table.
+  virtual const TokenStream *getTokenStream() const { return nullptr; }
+};
+
+/// Hands out the tokens of a lexed TokenStream without copying it. The
+/// TokenStream must outlive the TokenStreamSource.
+class TokenStreamSource : public TokenSource {
+  const TokenStream &ts;
+  size_t offset = 0;
+
+public:
+  explicit TokenStreamSource(const TokenStream &ts) : ts(ts) {}
+
+  Token next() override;
+  void skip(size_t count) override;
+  const TokenStream *getTokenStream() const override { return &ts; }
+};
+
+} // namespace rust_compiler::lexer
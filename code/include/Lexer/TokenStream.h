@@ -2,26 +2,58 @@
 
 #include "Lexer/Token.h"
 
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <optional>
 #include <span>
 #include <vector>
 
 namespace rust_compiler::lexer {
 
+/// A flat array of compact tokens. It is cheap to copy, slice, and cache.
+///
+/// Next to the tokens, it keeps the matching-delimiter table: for every
+/// (, [, and {, the offset of the closing token, and vice versa. It is
+/// filled while appending, so the Parser can skip a token tree in O(1).
 class TokenStream {
   std::vector<Token> tokens;
+  /// parallel to tokens: the offset of the matching delimiter or NoMatch
+  std::vector<uint32_t> matches;
+  /// the offsets of the opening delimiters that are not closed yet
+  std::vector<uint32_t> open;
+  /// the number of (, [, and { in open
+  std::array<uint32_t, 3> openCounts = {};
+
+  static constexpr uint32_t NoMatch = UINT32_MAX;
+
+  void matchDelimiter(uint32_t close);
 
 public:
   void append(Token tk);
   std::span<Token> getAsView();
+  std::span<const Token> getAsView() const;
 
   void print(unsigned limit);
 
   size_t getLength() const { return tokens.size(); }
 
-  Token getAt(size_t at) const {
+  const Token &getAt(size_t at) const {
     assert(at < tokens.size());
     return tokens[at];
   }
+
+  /// The offset of the delimiter that matches the one at offset at, e.g.,
+  /// of the } of a {. Nullopt for other tokens and unbalanced delimiters.
+  std::optional<size_t> getMatchingDelimiter(size_t at) const {
+    assert(at < matches.size());
+    if (matches[at] == NoMatch)
+      return std::nullopt;
+    return matches[at];
+  }
+
+  /// the tokens in [begin, end)
+  TokenStream slice(size_t begin, size_t end) const;
 };
 
 } // namespace rust_compiler::lexer
@@ -1,49 +1,49 @@
 #pragma once
 
-#include <limits>
-#include <llvm/Support/FormatVariadic.h>
+#include <cassert>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace rust_compiler {
 
+/// A 32-bit offset into the address space of the basic::SourceManager. The
+/// file name, line, and column are looked up on demand.
 class Location {
-  std::string fileName;
-  unsigned lineNumber;
-  unsigned columnNumber;
+  uint32_t id;
+
+  explicit Location(uint32_t id) : id(id) {}
 
 public:
   // FIXME: hack for std::map
-  Location() {
-    fileName = "default.constructor.rs";
-    lineNumber = std::numeric_limits<unsigned>::max();
-    columnNumber = std::numeric_limits<unsigned>::max();
-  }
+  Location() : id(0) {}
 
+  /// an explicit location that does not point into a loaded file
   Location(std::string_view fileName, unsigned lineNumber,
-           unsigned columnNumber)
-      : fileName(fileName), lineNumber(lineNumber), columnNumber(columnNumber) {
-  }
-
-  std::string_view getFileName() const { return fileName; }
-  unsigned getLineNumber() const { return lineNumber; }
-  unsigned getColumnNumber() const { return columnNumber; }
-
-  static Location getBuiltinLocation() {
-    return Location("builtins.cpp", std::numeric_limits<unsigned>::max(),
-                    std::numeric_limits<unsigned>::max());
-  }
-
-  static Location getEmptyLocation() {
-    return Location("empty.cpp", std::numeric_limits<unsigned>::max(),
-                    std::numeric_limits<unsigned>::max());
-  }
-
-  std::string toString() const {
-    return llvm::formatv("{2} {0}:{1}", lineNumber, columnNumber, fileName)
-        .str();
-  };
+           unsigned columnNumber);
+
+  std::string_view getFileName() const;
+  unsigned getLineNumber() const;
+  unsigned getColumnNumber() const;
+
+  static Location getBuiltinLocation() { return Location(1); }
+
+  static Location getEmptyLocation() { return Location(2); }
+
+  static Location fromRawEncoding(uint32_t id) { return Location(id); }
+  uint32_t getRawEncoding() const { return id; }
+
+  bool operator==(const Location &other) const { return id == other.id; }
+  bool operator!=(const Location &other) const { return id != other.id; }
+  bool operator<(const Location &other) const { return id < other.id; }
+
+  std::string toString() const;
 };
 
+static_assert(sizeof(Location) == 4);
+static_assert(std::is_trivially_copyable_v<Location>);
+
 } // namespace rust_compiler
 
 // /// Helper conversion for a Toy AST location to an MLIR location.
@@ -1,17 +1,38 @@
 #pragma once
 
-#include <string_view>
+#include "Parser/Profile.h"
 
 namespace rust_compiler::parser {
 
 class Parser;
 
+/// Pushes the name of a grammar rule onto the breadcrumb trail of the Parser
+/// for the lifetime of the rule. The name is a static string, e.g.,
+/// __PRETTY_FUNCTION__, and is never copied.
+///
+/// The trail is kept in debug builds and with --trace-parser. If the Parser
+/// has a ParserProfile, the rule is also counted and timed. Otherwise a
+/// ParserErrorStack does nothing.
 class ParserErrorStack {
-  Parser *parser;
-  std::string functionName;
+  static bool tracing;
+
+  /// nullptr if the name was not pushed
+  Parser *parser = nullptr;
+  const char *functionName;
+
+  /// nullptr if the Parser is not profiled
+  ParserProfile *profile = nullptr;
+  ParserProfile::Frame frame;
+
 public:
-  ParserErrorStack(Parser *parser, std::string_view functionName);
+  ParserErrorStack(Parser *parser, const char *functionName);
   ~ParserErrorStack();
+
+  ParserErrorStack(const ParserErrorStack &) = delete;
+  ParserErrorStack &operator=(const ParserErrorStack &) = delete;
+
+  static void setTracing(bool enabled) { tracing = enabled; }
+  static bool isTracing() { return tracing; }
 };
 
-}; // namespace rust_compiler::parser
+} // namespace rust_compiler::parser
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ADT/Result.h"
+#include "AST/ASTContext.h"
 #include "AST/Abi.h"
 #include "AST/ArrayElements.h"
 #include "AST/AssociatedItem.h"
@@ -64,273 +65,331 @@
 #include "AST/WhereClauseItem.h"
 #include "Lexer/KeyWords.h"
 #include "Lexer/Token.h"
+#include "Lexer/TokenSource.h"
 #include "Lexer/TokenStream.h"
 #include "Location.h"
 #include "Parser/ErrorStack.h"
 #include "Parser/ExpressionOrStatement.h"
 #include "Parser/Precedence.h"
 #include "Parser/Restrictions.h"
+#include "Parser/TokenBuffer.h"
 
+#include <cassert>
+#include <llvm/Support/Threading.h>
+#include <memory>
+#include <source_location>
 #include <span>
-#include <stack>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 /// https://doc.rust-lang.org/nightly/nightly-rustc/rustc_parse/parser/struct.Parser.html#method.new
 namespace rust_compiler::parser {
 
 using namespace rust_compiler::ast;
 
-/// a checkpoint in a stream of tokens
-class CheckPoint {
-  size_t offset = 0;
-
-public:
-  CheckPoint(size_t offset) : offset(offset) {}
-  size_t readOffset() const { return offset; }
-};
-
 enum PathKind { TypePath, SimplePath, Unknown };
 
 /// Parses a stream of tokens into an abstract syntax tree: a crate
 class Parser {
-  lexer::TokenStream ts;
-
-  size_t offset = 0;
+  /// set if the Parser was created from a TokenStream
+  std::unique_ptr<lexer::TokenStreamSource> streamSource;
+  TokenBuffer tokens;
+  /// the arena of the nodes
+  std::shared_ptr<ast::ASTContext> context;
 
   rust_compiler::Location getLocation();
 
 public:
-  Parser(lexer::TokenStream &ts) : ts(ts){};
+  /// The TokenStream must outlive the Parser; it is not copied. The nodes
+  /// are allocated in context, and the edges between them do not own
+  /// them: the caller keeps context alive as long as it uses a node. The
+  /// parsed ast::Crate keeps its context alive. The Parsers of the
+  /// modules of a crate share one ASTContext.
+  Parser(const lexer::TokenStream &ts,
+         std::shared_ptr<ast::ASTContext> context)
+      : streamSource(std::make_unique<lexer::TokenStreamSource>(ts)),
+        tokens(*streamSource), context(std::move(context)){};
+  Parser(const lexer::TokenStream &&ts,
+         std::shared_ptr<ast::ASTContext> context) = delete;
+  /// Pulls the tokens from source on demand, e.g., from a Lexer.
+  Parser(lexer::TokenSource &source, std::shared_ptr<ast::ASTContext> context)
+      : tokens(source), context(std::move(context)){};
+
+  std::shared_ptr<ast::ASTContext> getASTContext() const { return context; }
+
+  /// Skips the bodies of functions by brace matching instead of parsing
+  /// them. The ast::Function keeps the tokens of its body for
+  /// parseDeferredBody. For passes that only need the item signatures.
+  void setDeferFunctionBodies(bool defer) { deferFunctionBodies = defer; }
+
+  /// the functions with a skipped body, in parse order
+  std::vector<std::shared_ptr<ast::Function>> takeDeferredFunctions() {
+    return std::exchange(deferredFunctions, {});
+  }
+
+  /// Parses the skipped body of fun on the current thread into context.
+  static adt::StringResult<std::shared_ptr<ast::Expression>>
+  parseDeferredBody(const ast::Function &fun,
+                    std::shared_ptr<ast::ASTContext> context);
+
+  /// Parses the skipped bodies of functions on a thread pool and sets them.
+  /// Each body draws its node ids from a range reserved in the order of
+  /// functions, hence the ids do not depend on the schedule. Returns the
+  /// number of bodies or the first error in the order of functions. The
+  /// bodies are allocated in forks of context, the arena of the functions.
+  static adt::StringResult<size_t> parseDeferredBodies(
+      ast::ASTContext &context,
+      std::span<const std::shared_ptr<ast::Function>> functions,
+      llvm::ThreadPoolStrategy strategy = llvm::hardware_concurrency());
+
+  /// On a syntax error in an item or a statement, records the error, skips
+  /// to the next item or statement, and puts an ast::ErrorItem or
+  /// ast::ErrorStatement in its place. One run thereby reports all syntax
+  /// errors of a file, and the other items remain intact.
+  void setRecoverFromErrors(bool recover) { recoverFromErrors = recover; }
+
+  /// the errors recovered from, in the order they were found
+  std::span<const adt::Error> getErrors() const { return errors; }
+
+  /// Prints the breadcrumb trail of grammar rules at the farthest token the
+  /// Parser reached, where a parse error usually is, if tracing is enabled.
+  void printFunctionStack();
 
-  adt::Result<ast::Visibility, std::string> parseVisibility();
-  adt::Result<ast::use_tree::UseTree, std::string> parseUseTree();
+  /// Counts and times the grammar rules into profile, which must outlive
+  /// the parse; nullptr disables profiling.
+  void setProfile(ParserProfile *profile) { this->profile = profile; }
+  ParserProfile *getProfile() const { return profile; }
 
-  adt::Result<std::shared_ptr<ast::Item>, std::string> parseItem();
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<ast::Visibility> parseVisibility();
+  adt::StringResult<ast::use_tree::UseTree> parseUseTree();
+
+  adt::StringResult<std::shared_ptr<ast::Item>> parseItem();
+  adt::StringResult<std::shared_ptr<ast::Item>>
       parseMacroItem(std::span<ast::OuterAttribute>);
 
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
       parseVisItem(std::span<ast::OuterAttribute>);
 
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseRangeOrIdentifierOrStructOrTupleStructOrMacroInvocationPattern();
 
   /// VisItems
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseMod(std::span<OuterAttribute> outer, std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseUseDeclaration(std::span<OuterAttribute> outer,
                       std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseTypeAlias(std::span<OuterAttribute> outer,
                  std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseEnumeration(std::span<OuterAttribute> outer,
                    std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseUnion(std::span<OuterAttribute> outer,
              std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseStaticItem(std::span<OuterAttribute> outer,
                   std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseTrait(std::span<OuterAttribute> outer,
              std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseFunction(std::span<OuterAttribute> outer,
                 std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseConstantItem(std::span<OuterAttribute> outer,
                     std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseExternBlock(std::span<OuterAttribute> outer,
                    std::optional<ast::Visibility> vis);
 
-  adt::Result<ast::ExternalItem, std::string>
+  adt::StringResult<ast::ExternalItem>
   parseExternalItem(std::span<OuterAttribute> outer);
 
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseStruct(std::span<OuterAttribute> outer,
               std::optional<ast::Visibility> vis);
-  adt::Result<ast::StructFields, std::string> parseStructFields();
-  adt::Result<ast::StructField, std::string> parseStructField();
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<ast::StructFields> parseStructFields();
+  adt::StringResult<ast::StructField> parseStructField();
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseStructStruct(std::span<OuterAttribute> outer,
                     std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseTupleStruct(std::span<OuterAttribute> outer,
                    std::optional<ast::Visibility> vis);
 
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseImplementation(std::span<OuterAttribute> outer,
                       std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseInherentImpl(std::optional<ast::Visibility> vis);
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseTraitImpl(std::optional<ast::Visibility> vis);
 
-  adt::Result<std::vector<ast::OuterAttribute>, std::string>
+  adt::StringResult<std::vector<ast::OuterAttribute>>
   parseOuterAttributes();
-  adt::Result<std::vector<ast::InnerAttribute>, std::string>
+  adt::StringResult<std::vector<ast::InnerAttribute>>
   parseInnerAttributes();
 
-  adt::Result<ast::OuterAttribute, std::string> parseOuterAttribute();
-  adt::Result<ast::InnerAttribute, std::string> parseInnerAttribute();
+  adt::StringResult<ast::OuterAttribute> parseOuterAttribute();
+  adt::StringResult<ast::InnerAttribute> parseInnerAttribute();
 
-  adt::Result<ast::ConstParam, std::string> parseConstParam();
-  adt::Result<ast::LifetimeParam, std::string> parseLifetimeParam();
-  adt::Result<ast::TypeParam, std::string> parseTypeParam();
+  adt::StringResult<ast::ConstParam> parseConstParam();
+  adt::StringResult<ast::LifetimeParam> parseLifetimeParam();
+  adt::StringResult<ast::TypeParam> parseTypeParam();
 
   // Function
-  adt::Result<ast::FunctionQualifiers, std::string> parseFunctionQualifiers();
+  adt::StringResult<ast::FunctionQualifiers> parseFunctionQualifiers();
   // llvm::Expected<ast::FunctionSignature> parseFunctionsignature();
-  adt::Result<ast::FunctionParam, std::string> parseFunctionParam();
-  adt::Result<ast::FunctionParameters, std::string> parseFunctionParameters();
-  adt::Result<ast::FunctionParamPattern, std::string>
+  adt::StringResult<ast::FunctionParam> parseFunctionParam();
+  adt::StringResult<ast::FunctionParameters> parseFunctionParameters();
+  adt::StringResult<ast::FunctionParamPattern>
   parseFunctionParamPattern();
-  adt::Result<ast::FunctionReturnType, std::string> parseFunctionReturnType();
-  adt::Result<ast::SelfParam, std::string> parseSelfParam();
+  adt::StringResult<ast::FunctionReturnType> parseFunctionReturnType();
+  adt::StringResult<ast::SelfParam> parseSelfParam();
 
-  // adt::Result<ast::Statements, std::string> parseStatements();
-  adt::Result<std::shared_ptr<ast::Statement>, std::string>
+  // adt::StringResult<ast::Statements> parseStatements();
+  adt::StringResult<std::shared_ptr<ast::Statement>>
   parseStatement(Restrictions restriction);
 
   // Types
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseSliceType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseArrayType();
 
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseTypeNoBounds();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseTypePath();
 
-  adt::Result<ast::types::TypePathSegment, std::string> parseTypePathSegment();
-  adt::Result<ast::PathIdentSegment, std::string> parsePathIdentSegment();
+  adt::StringResult<ast::types::TypePathSegment> parseTypePathSegment();
+  adt::StringResult<ast::PathIdentSegment> parsePathIdentSegment();
 
-  adt::Result<ast::PathExprSegment, std::string> parsePathExprSegment();
+  adt::StringResult<ast::PathExprSegment> parsePathExprSegment();
 
-  adt::Result<ast::types::TypePathFn, std::string> parseTypePathFn();
-  adt::Result<ast::types::TypePathFnInputs, std::string>
+  adt::StringResult<ast::types::TypePathFn> parseTypePathFn();
+  adt::StringResult<ast::types::TypePathFnInputs>
   parseTypePathFnInputs();
 
   adt::StringResult<std::shared_ptr<ast::types::TypeParamBound>>
   parseTraitBound();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseBareFunctionType();
-  adt::Result<ast::types::FunctionTypeQualifiers, std::string>
+  adt::StringResult<ast::types::FunctionTypeQualifiers>
   parseFunctionTypeQualifiers();
-  adt::Result<ast::types::BareFunctionReturnType, std::string>
+  adt::StringResult<ast::types::BareFunctionReturnType>
   parseBareFunctionReturnType();
 
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseTraitObjectTypeOneBound();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseImplTraitTypeOneBound();
 
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseImplTraitType();
 
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseRawPointerType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseNeverType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseReferenceType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseInferredType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseTraitObjectType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseImplType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseArrayOrSliceType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseTupleOrParensType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseTupleType();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseTupleOrParensTypeOrTypePathOrMacroInvocationOrTraitObjectTypeOrBareFunctionType();
   // only for types !!!
 
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseQualifiedPathInType();
-  adt::Result<ast::types::QualifiedPathType, std::string>
+  adt::StringResult<ast::types::QualifiedPathType>
   parseQualifiedPathType();
 
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseParenthesizedType();
 
   PathKind testTypePathOrSimplePath();
 
-  adt::Result<std::shared_ptr<ast::Crate>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Crate>>
   parseCrateModule(std::string_view crateName, basic::CrateNum crateNum);
 
   // Patterns
-  adt::Result<std::shared_ptr<ast::patterns::Pattern>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::Pattern>>
   parsePattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parsePatternNoTopAlt();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseReferencePattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseRestPattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseWildCardPattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseTupleOrGroupedPattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseSlicePattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseLiteralPattern();
-  adt::Result<ast::patterns::SlicePatternItems, std::string>
+  adt::StringResult<ast::patterns::SlicePatternItems>
   parseSlicePatternItems();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parsePatternWithoutRange();
 
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseRangePattern();
   adt::StringResult<ast::patterns::RangePatternBound> parseRangePatternBound();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseStructPattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseTupleStructPattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseIdentifierPattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parsePathOrStructOrTupleStructPattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseMacroInvocationPattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parsePathPattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseIdentifierOrPathPattern();
 
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseTupleOrTupleStructPattern();
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parsePathInExpressionOrStructExprStructOrStructExprTupleOrStructExprUnitOrMacroInvocationOrExpressionWithPostfix();
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseTupleOrParensTypeOrTypePathOrMacroInvocationOrTraitObjectType();
 
   // Expressions
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseMacroInvocationExpression();
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseStructExpression();
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parsePathInExpressionOrStructExprStructOrStructTupleUnitOrMacroInvocationExpression();
 
-  adt::Result<ast::TupleElements, std::string> parseTupleElements(Restrictions);
+  adt::StringResult<ast::TupleElements> parseTupleElements(Restrictions);
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parsePathInExpressionOrStructOrExpressionWithPostfix();
 
   adt::StringResult<std::shared_ptr<ast::Expression>>
@@ -341,281 +400,291 @@ public:
                   std::span<ast::OuterAttribute> outer,
                   rust_compiler::parser::Restrictions restrictions);
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseTupleExpression(Restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseGroupedExpression(Restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseBlockExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseExpressionWithoutBlock(std::span<ast::OuterAttribute>, Restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseExpressionWithBlock(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseClosureExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseReturnExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseBreakExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseContinueExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseNegationExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseDereferenceExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseBorrowExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseAsyncBlockExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseMatchExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseIfExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseIfLetExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseUnsafeBlockExpression(std::span<ast::OuterAttribute>);
-  adt::Result<ast::Scrutinee, std::string> parseScrutinee();
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<ast::Scrutinee> parseScrutinee();
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseAwaitExpression(std::shared_ptr<ast::Expression>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseAwaitExpression(std::shared_ptr<ast::Expression>,
                            std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseIndexExpression(std::shared_ptr<ast::Expression>,
                            std::span<ast::OuterAttribute>, Restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseFieldExpression(std::shared_ptr<ast::Expression>,
                        std::span<ast::OuterAttribute>,
                        Restrictions restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseRangeExpression(std::shared_ptr<ast::Expression>,
+                           Precedence rightBindingPower,
                            std::span<ast::OuterAttribute>, Restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseRangeExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseUnderScoreExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseGroupedOrTupleExpression(Restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseCallExpression(std::shared_ptr<ast::Expression>,
                           std::span<ast::OuterAttribute>, Restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseErrorPropagationExpression(std::shared_ptr<ast::Expression>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseAssignmentExpression(std::shared_ptr<ast::Expression>,
+                            Precedence rightBindingPower,
                             std::span<ast::OuterAttribute>,
                             Restrictions restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseTypeCastExpression(std::shared_ptr<ast::Expression>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseMethodCallExpression(std::shared_ptr<ast::Expression>,
                             std::span<ast::OuterAttribute>,
                             Restrictions restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseTupleIndexingExpression(
       std::shared_ptr<ast::Expression>, std::span<ast::OuterAttribute>,
       rust_compiler::parser::Restrictions restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseArrayExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseArithmeticOrLogicalExpression(
-      std::shared_ptr<ast::Expression>,
+      std::shared_ptr<ast::Expression>, Precedence rightBindingPower,
       rust_compiler::parser::Restrictions restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseComparisonExpression(std::shared_ptr<ast::Expression>,
+                            Precedence rightBindingPower,
                             rust_compiler::parser::Restrictions restrictions =
                                 rust_compiler::parser::Restrictions());
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseLazyBooleanExpression(std::shared_ptr<ast::Expression>,
+                             Precedence rightBindingPower,
                              rust_compiler::parser::Restrictions restrictions =
                                  rust_compiler::parser::Restrictions());
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseCompoundAssignmentExpression(
-      std::shared_ptr<ast::Expression>,
+      std::shared_ptr<ast::Expression>, Precedence rightBindingPower,
       rust_compiler::parser::Restrictions restrictions);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseQualifiedPathInExpression();
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseLiteralExpression(std::span<ast::OuterAttribute>);
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parsePathExpression();
 
-  adt::Result<std::shared_ptr<ast::types::TypeParamBound>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeParamBound>>
   parseTypePathOrTraitObjectType();
 
-  adt::Result<ast::CallParams, std::string> parseCallParams(Restrictions);
+  adt::StringResult<ast::CallParams> parseCallParams(Restrictions);
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseLoopExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseIteratorLoopExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parsePredicatePatternLoopExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parsePredicateLoopExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseInfiniteLoopExpression(std::span<ast::OuterAttribute>);
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
       parseLabelBlockExpression(std::span<ast::OuterAttribute>);
   // llvm::Expected<std::shared_ptr<ast::Expression>>
   // parsePatternLoopExpression();
 
-  adt::Result<ast::MatchArms, std::string> parseMatchArms();
-  adt::Result<ast::MatchArm, std::string> parseMatchArm();
-  adt::Result<ast::MatchArmGuard, std::string> parseMatchArmGuard();
-  adt::Result<ast::GenericParam, std::string> parseGenericParam();
+  adt::StringResult<ast::MatchArms> parseMatchArms();
+  adt::StringResult<ast::MatchArm> parseMatchArm();
+  adt::StringResult<ast::MatchArmGuard> parseMatchArmGuard();
+  adt::StringResult<ast::GenericParam> parseGenericParam();
 
-  adt::Result<ast::GenericArgs, std::string> parseGenericArgs();
-  adt::Result<ast::GenericArg, std::string>
+  adt::StringResult<ast::GenericArgs> parseGenericArgs();
+  adt::StringResult<ast::GenericArg>
   parseGenericArg(std::optional<ast::GenericArgKind> last);
-  adt::Result<ast::GenericParams, std::string> parseGenericParams();
-  adt::Result<ast::GenericArgsConst, std::string> parseGenericArgsConst();
-  adt::Result<ast::GenericArgsBinding, std::string> parseGenericArgsBinding();
-  adt::Result<ast::WhereClause, std::string> parseWhereClause();
-  adt::Result<std::shared_ptr<ast::WhereClauseItem>, std::string>
+  adt::StringResult<ast::GenericParams> parseGenericParams();
+  adt::StringResult<ast::GenericArgsConst> parseGenericArgsConst();
+  adt::StringResult<ast::GenericArgsBinding> parseGenericArgsBinding();
+  adt::StringResult<ast::WhereClause> parseWhereClause();
+  adt::StringResult<std::shared_ptr<ast::WhereClauseItem>>
   parseWhereClauseItem();
-  adt::Result<ast::types::ForLifetimes, std::string> parseForLifetimes();
+  adt::StringResult<ast::types::ForLifetimes> parseForLifetimes();
 
-  adt::Result<std::shared_ptr<ast::types::TypeParamBound>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeParamBound>>
   parseLifetimeAsTypeParamBound();
-  adt::Result<ast::Lifetime, std::string> parseLifetimeAsLifetime();
-  adt::Result<ast::LifetimeBounds, std::string> parseLifetimeBounds();
-  adt::Result<std::shared_ptr<ast::WhereClauseItem>, std::string>
+  adt::StringResult<ast::Lifetime> parseLifetimeAsLifetime();
+  adt::StringResult<ast::LifetimeBounds> parseLifetimeBounds();
+  adt::StringResult<std::shared_ptr<ast::WhereClauseItem>>
   parseLifetimeWhereClauseItem();
-  adt::Result<std::shared_ptr<ast::WhereClauseItem>, std::string>
+  adt::StringResult<std::shared_ptr<ast::WhereClauseItem>>
   parseTypeBoundWhereClauseItem();
 
-  adt::Result<ast::EnumItems, std::string> parseEnumItems();
-  adt::Result<ast::EnumItem, std::string> parseEnumItem();
-  adt::Result<ast::EnumItemTuple, std::string> parseEnumItemTuple();
-  adt::Result<ast::EnumItemStruct, std::string> parseEnumItemStruct();
-  adt::Result<ast::EnumItemDiscriminant, std::string>
+  adt::StringResult<ast::EnumItems> parseEnumItems();
+  adt::StringResult<ast::EnumItem> parseEnumItem();
+  adt::StringResult<ast::EnumItemTuple> parseEnumItemTuple();
+  adt::StringResult<ast::EnumItemStruct> parseEnumItemStruct();
+  adt::StringResult<ast::EnumItemDiscriminant>
   parseEnumItemDiscriminant();
 
   // statements
-  adt::Result<std::shared_ptr<ast::Statement>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Statement>>
       parseLetStatement(std::span<ast::OuterAttribute>, Restrictions);
-  adt::Result<std::shared_ptr<ast::Statement>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Statement>>
   parseItemDeclaration();
-  adt::Result<std::shared_ptr<ast::Statement>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Statement>>
       parseExpressionStatement(std::span<ast::OuterAttribute>, Restrictions);
-  adt::Result<std::shared_ptr<ast::Statement>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Statement>>
   parseMacroInvocationSemiStatement();
 
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseMacroInvocationSemiItem();
 
-  adt::Result<std::shared_ptr<ast::Item>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Item>>
   parseMacroRulesDefinition();
-  adt::Result<std::shared_ptr<ast::SelfParam>, std::string>
+  adt::StringResult<std::shared_ptr<ast::SelfParam>>
   parseShorthandSelf();
-  adt::Result<std::shared_ptr<ast::SelfParam>, std::string> parseTypedSelf();
+  adt::StringResult<std::shared_ptr<ast::SelfParam>> parseTypedSelf();
 
-  adt::Result<ast::types::TypeParamBounds, std::string> parseTypeParamBounds();
-  adt::Result<std::shared_ptr<ast::types::TypeParamBound>, std::string>
+  adt::StringResult<ast::types::TypeParamBounds> parseTypeParamBounds();
+  adt::StringResult<std::shared_ptr<ast::types::TypeParamBound>>
   parseTypeParamBound();
 
-  adt::Result<ast::SimplePath, std::string> parseSimplePath();
-  adt::Result<ast::SimplePathSegment, std::string> parseSimplePathSegment();
+  adt::StringResult<ast::SimplePath> parseSimplePath();
+  adt::StringResult<ast::SimplePathSegment> parseSimplePathSegment();
 
-  adt::Result<ast::AttrInput, std::string> parseAttrInput();
+  adt::StringResult<ast::AttrInput> parseAttrInput();
 
-  adt::Result<std::shared_ptr<ast::DelimTokenTree>, std::string>
+  adt::StringResult<std::shared_ptr<ast::DelimTokenTree>>
   parseDelimTokenTree();
-  adt::Result<ast::TokenTree, std::string> parseTokenTree();
+  adt::StringResult<ast::TokenTree> parseTokenTree();
 
-  adt::Result<ast::AssociatedItem, std::string> parseAssociatedItem();
+  adt::StringResult<ast::AssociatedItem> parseAssociatedItem();
 
-  adt::Result<ast::Abi, std::string> parseAbi();
-  adt::Result<ast::Attr, std::string> parseAttr();
+  adt::StringResult<ast::Abi> parseAbi();
+  adt::StringResult<ast::Attr> parseAttr();
 
-  adt::Result<ast::TupleFields, std::string> parseTupleFields();
-  adt::Result<ast::TupleField, std::string> parseTupleField();
+  adt::StringResult<ast::TupleFields> parseTupleFields();
+  adt::StringResult<ast::TupleField> parseTupleField();
 
-  adt::Result<ast::ClosureParameters, std::string> parseClosureParameters();
-  adt::Result<ast::ClosureParam, std::string> parseClosureParam();
+  adt::StringResult<ast::ClosureParameters> parseClosureParameters();
+  adt::StringResult<ast::ClosureParam> parseClosureParam();
 
-  adt::Result<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>,
-              std::string>
+  adt::StringResult<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>
   parseFunctionParametersMaybeNamedVariadic();
 
-  adt::Result<ast::types::MaybeNamedParam, std::string> parseMaybeNamedParam();
-  adt::Result<ast::StructExprFields, std::string> parseStructExprFields();
+  adt::StringResult<ast::types::MaybeNamedParam> parseMaybeNamedParam();
+  adt::StringResult<ast::StructExprFields> parseStructExprFields();
 
-  adt::Result<ast::StructExprField, std::string> parseStructExprField();
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<ast::StructExprField> parseStructExprField();
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseStructExprStruct();
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseStructExprTuple();
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseStructExprUnit();
-  adt::Result<ast::StructBase, std::string> parseStructBase();
+  adt::StringResult<ast::StructBase> parseStructBase();
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parsePathInExpression();
 
-  adt::Result<ast::patterns::StructPatternElements, std::string>
+  adt::StringResult<ast::patterns::StructPatternElements>
   parseStructPatternElements();
-  adt::Result<ast::patterns::StructPatternFields, std::string>
+  adt::StringResult<ast::patterns::StructPatternFields>
   parseStructPatternFields();
-  adt::Result<ast::patterns::StructPatternField, std::string>
+  adt::StringResult<ast::patterns::StructPatternField>
   parseStructPatternField();
 
-  adt::Result<ast::patterns::TupleStructItems, std::string>
+  adt::StringResult<ast::patterns::TupleStructItems>
   parseTupleStructItems();
 
-  adt::Result<ast::patterns::StructPatternEtCetera, std::string>
+  adt::StringResult<ast::patterns::StructPatternEtCetera>
   parseStructPatternEtCetera();
 
-  adt::Result<ast::ArrayElements, std::string>
+  adt::StringResult<ast::ArrayElements>
   parseArrayElements(std::span<ast::OuterAttribute>, Restrictions restrictions);
 
-  adt::Result<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>,
-              std::string>
+  adt::StringResult<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>
   parseMaybeNamedFunctionParameters();
-  adt::Result<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>,
-              std::string>
+  adt::StringResult<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>
   parseMaybeNamedFunctionParametersVariadic();
 
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseMacroInvocationType();
 
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseGroupedOrTuplePattern();
 
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseMacroInvocationOrPathOrStructOrTupleStructPattern();
 
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseTuplePattern();
-  adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+  adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
   parseGroupedPattern();
 
-  adt::Result<ast::patterns::TuplePatternItems, std::string>
+  adt::StringResult<ast::patterns::TuplePatternItems>
   parseTuplePatternItems();
 
-  adt::Result<ast::MacroRulesDef, std::string> parseMacroRulesDef();
-  adt::Result<ast::MacroRules, std::string> parseMacroRules();
-  adt::Result<ast::MacroRule, std::string> parseMacroRule();
-  adt::Result<ast::MacroMatcher, std::string> parseMacroMatcher();
-  adt::Result<ast::MacroMatch, std::string> parseMacroMatch();
-  adt::Result<ast::MacroTranscriber, std::string> parseMacroTranscriber();
-  adt::Result<ast::MacroFragSpec, std::string> parseMacroFragSpec();
-  adt::Result<ast::MacroRepSep, std::string> parseMacroRepSep();
-  adt::Result<ast::MacroRepOp, std::string> parseMacroRepOp();
-
-  adt::Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+  adt::StringResult<ast::MacroRulesDef> parseMacroRulesDef();
+  adt::StringResult<ast::MacroRules> parseMacroRules();
+  adt::StringResult<ast::MacroRule> parseMacroRule();
+  adt::StringResult<ast::MacroMatcher> parseMacroMatcher();
+  adt::StringResult<ast::MacroMatch> parseMacroMatch();
+  adt::StringResult<ast::MacroTranscriber> parseMacroTranscriber();
+  adt::StringResult<ast::MacroFragSpec> parseMacroFragSpec();
+  adt::StringResult<ast::MacroRepSep> parseMacroRepSep();
+  adt::StringResult<ast::MacroRepOp> parseMacroRepOp();
+
+  adt::StringResult<std::shared_ptr<ast::types::TypeExpression>>
   parseTraitObjectTypeOrTypePathOrMacroInvocation();
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parsePathInExpressionOrMacroInvocationExpression();
 
-  adt::Result<ast::LoopLabel, std::string> parseLoopLabel();
+  adt::StringResult<ast::LoopLabel> parseLoopLabel();
 
-  void pushFunction(std::string_view);
-  void popFunction(std::string_view);
+  void pushFunction(const char *f) {
+    functionStack.push_back(f);
+    if (farthestStack.empty() || tokens.getOffset() > farthestOffset) {
+      farthestStack = functionStack;
+      farthestOffset = tokens.getOffset();
+    }
+  }
+  void popFunction(const char *f) {
+    assert(functionStack.back() == f);
+    functionStack.pop_back();
+  }
 
   // pratt parsing
 
@@ -641,10 +710,15 @@ public:
       parseStatementOrExpressionWithBlock(std::span<ast::OuterAttribute>);
 
 private:
-  bool check(lexer::TokenKind token);
-  bool check(lexer::TokenKind token, size_t off);
-  bool checkKeyWord(lexer::KeyWordKind keyword);
-  bool checkKeyWord(lexer::KeyWordKind keyword, size_t off);
+  // the lookahead does not copy tokens
+  bool check(lexer::TokenKind token, size_t off = 0) {
+    return tokens.peek(off).getKind() == token;
+  }
+  bool checkKeyWord(lexer::KeyWordKind keyword, size_t off = 0) {
+    const lexer::Token &tok = tokens.peek(off);
+    return tok.getKind() == lexer::TokenKind::Keyword &&
+           tok.getKeyWordKind() == keyword;
+  }
   bool checkInKeyWords(std::span<lexer::KeyWordKind> keywords);
 
   bool checkOuterAttribute(uint8_t off = 0);
@@ -671,10 +745,13 @@ private:
   bool eat(lexer::TokenKind token);
   bool eatKeyWord(lexer::KeyWordKind keyword);
 
-  lexer::Token getToken(uint8_t off = 0) const;
+  /// The reference is invalidated by the next lookahead; copy the token to
+  /// keep it.
+  const lexer::Token &getToken(uint8_t off = 0) { return tokens.peek(off); }
 
   CheckPoint getCheckPoint();
-  void recover(const CheckPoint &cp);
+  void recover(const CheckPoint &cp, const std::source_location &site =
+                                         std::source_location::current());
 
   // bool checkWhereClauseItem();
   // bool checkLifetime();
@@ -685,6 +762,7 @@ private:
   bool checkStatement();
   bool checkStaticOrUnderscore();
   bool checkVisItem();
+  bool checkVisItemWithoutVisibility();
   bool checkLifetimeToken(std::string_view);
 
   // precision could be improved
@@ -701,30 +779,95 @@ private:
 
   bool checkPathOrStructOrMacro();
   bool checkPathExprSegment(uint8_t off = 0);
+  /// whether a postfix operator follows, e.g., `?` or `.field`
   bool checkPostFix();
-  bool checkIsKeyword(uint8_t off = 0) const {
+  bool checkIsKeyword(uint8_t off = 0) {
     return getToken(off).getKind() == lexer::TokenKind::Keyword;
   }
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseBinaryExpression(bool allowBlocks);
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string>
+  adt::StringResult<std::shared_ptr<ast::Expression>>
   parseUnaryExpression(std::span<ast::OuterAttribute> outer,
                        Restrictions restrictions);
 
-  void printFunctionStack();
-  std::stack<std::string> functionStack;
-
-  adt::StringResult<std::shared_ptr<ast::Expression>>
-  parseInfixExpression(std::shared_ptr<ast::Expression> left,
-                       std::span<ast::OuterAttribute>, Restrictions);
+  std::vector<const char *> functionStack;
+  /// the trail of the first rule that reached the farthest token
+  std::vector<const char *> farthestStack;
+  size_t farthestOffset = 0;
+
+  bool deferFunctionBodies = false;
+  std::vector<std::shared_ptr<ast::Function>> deferredFunctions;
+
+  /// the tokens from `{` to the matching `}`, followed by Eof
+  adt::StringResult<lexer::TokenStream> skipBlockExpression();
+
+  /// Skips the delimited token tree at the current token in O(1) with the
+  /// matching-delimiter table of the TokenStream. False, without skipping,
+  /// if the Parser pulls from a Lexer or the delimiter is unbalanced.
+  bool skipTokenTree();
+
+  bool recoverFromErrors = false;
+  std::vector<adt::Error> errors;
+
+  ParserProfile *profile = nullptr;
+
+  /// parseItem, or an ErrorItem after a recovered error
+  adt::StringResult<std::shared_ptr<ast::Item>> parseItemOrRecover();
+  /// parseStatementOrExpressionWithoutBlock, or an ErrorStatement after a
+  /// recovered error
+  adt::StringResult<ExpressionOrStatement> parseStatementOrRecover();
+  /// Skip the item or statement at the current token: through its `;` or
+  /// its closing `}`, or up to the `}` of the enclosing block or Eof. An
+  /// item also ends before the keyword of the next item, or after an
+  /// unmatched `)` or `]`. skipItem returns whether it skipped any token.
+  bool skipItem();
+  void skipStatement();
+
+  /// Parses the operator at the current token and its right operand, if
+  /// any, after the operand left.
+  using InfixParselet =
+      adt::StringResult<std::shared_ptr<ast::Expression>> (*)(
+          Parser &, std::shared_ptr<ast::Expression> left,
+          Precedence rightBindingPower, std::span<ast::OuterAttribute>,
+          Restrictions);
+
+  /// A binary or postfix operator, an entry of the operator table.
+  struct InfixOperator {
+    Precedence leftBindingPower = Precedence::Lowest;
+    /// of the right operand; Lowest for postfix operators
+    Precedence rightBindingPower = Precedence::Lowest;
+    bool isPostfix = false;
+    /// nullptr if the token is not an operator
+    InfixParselet parselet = nullptr;
+  };
+
+  /// Looks up the operator at the current token in a table indexed by
+  /// TokenKind; nullptr if the token does not continue an expression.
+  const InfixOperator *getInfixOperator();
 
   bool canTokenStartType(const lexer::Token &tok);
-
-  Precedence getLeftBindingPower();
 };
 
+inline ParserErrorStack::ParserErrorStack(Parser *parser,
+                                          const char *functionName)
+    : functionName(functionName), profile(parser->getProfile()) {
+  if (profile)
+    profile->enter(frame, functionName);
+  if (!tracing)
+    return;
+  this->parser = parser;
+  parser->pushFunction(functionName);
+}
+
+inline ParserErrorStack::~ParserErrorStack() {
+  if (parser)
+    parser->popFunction(functionName);
+  if (profile)
+    profile->exit(frame);
+}
+
 } // namespace rust_compiler::parser
 
 /*
@@ -23,13 +23,19 @@ enum class Precedence {
   As = 65,
 
   Mul = 60,
+  Div = 60,
+  Rem = 60,
 
   Plus = 55,
   Minus = 55,
 
   LShift = 50,
   RShift = 50,
-  
+
+  BitAnd = 45,
+  BitXor = 40,
+  BitOr = 35,
+
   Equal = 30,
   NotEqual = 30,
   GreaterThan = 30,
@@ -37,6 +43,9 @@ enum class Precedence {
   GreaterThanOrEqualTo = 30,
   LessThanOrEqualTo = 30,
 
+  LazyAnd = 25,
+  LazyOr = 20,
+
   DotDot = 15,
   DotDotEq = 15,
 
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <chrono>
+#include <cstdint>
+#include <source_location>
+#include <unordered_map>
+#include <utility>
+
+namespace rust_compiler::parser {
+
+/// Per-rule counters of the Parser, for finding the grammar rules that
+/// dominate parse time. A rule is a function with a ParserErrorStack. The
+/// profile is opt-in with Parser::setProfile; Parsers may share one.
+///
+/// If the LLVM time-trace profiler is enabled, every rule invocation is
+/// also a time-trace event, which Chrome tracing can load.
+class ParserProfile {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct RuleStats {
+    /// the method name, e.g., parseBlockExpression
+    llvm::StringRef name;
+    uint64_t invocations = 0;
+    /// the recover() calls in the rule itself
+    uint64_t backtracks = 0;
+    /// including the nested rules; of a recursive rule, only the outermost
+    /// invocation counts, so that nested ones are not counted twice
+    Clock::duration inclusive = Clock::duration::zero();
+    /// excluding the nested rules
+    Clock::duration self = Clock::duration::zero();
+    /// the invocations on the stack of Frames
+    uint32_t active = 0;
+  };
+
+  /// an active rule invocation; lives in its ParserErrorStack
+  struct Frame {
+    RuleStats *rule;
+    Frame *outer;
+    Clock::time_point start;
+    Clock::duration nested;
+  };
+
+  void enter(Frame &frame, const char *functionName);
+  void exit(Frame &frame);
+
+  /// a recover() call at site, attributed to the innermost rule
+  void recordBacktrack(const std::source_location &site);
+
+  /// Prints the rules by descending self time and the backtracking call
+  /// sites by descending count.
+  void printJSON(llvm::raw_ostream &os) const;
+
+private:
+  /// keyed by the __PRETTY_FUNCTION__ of the rule; the Frames point into
+  /// the nodes
+  std::unordered_map<const char *, RuleStats> rules;
+
+  struct BacktrackSite {
+    llvm::StringRef rule;
+    uint64_t count = 0;
+  };
+  /// keyed by file name and line
+  llvm::DenseMap<std::pair<const char *, unsigned>, BacktrackSite> sites;
+
+  Frame *current = nullptr;
+};
+
+} // namespace rust_compiler::parser
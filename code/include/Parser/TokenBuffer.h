@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Lexer/Token.h"
+#include "Lexer/TokenSource.h"
+
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace rust_compiler::parser {
+
+class TokenBuffer;
+
+/// A position in the token buffer to which the Parser can backtrack. The
+/// buffer retains the tokens after the oldest live CheckPoint.
+class CheckPoint {
+  TokenBuffer *buffer;
+  size_t offset;
+
+public:
+  CheckPoint(TokenBuffer *buffer, size_t offset);
+  CheckPoint(const CheckPoint &other);
+  CheckPoint &operator=(const CheckPoint &other);
+  ~CheckPoint();
+
+  size_t readOffset() const { return offset; }
+};
+
+/// The lookahead of the Parser: a ring buffer over a lexer::TokenSource
+/// that is refilled on demand. The tokens before the current offset and
+/// before the oldest live CheckPoint are overwritten. The memory is bounded
+/// by how far the Parser looks ahead and backtracks, and not by the size of
+/// the file.
+class TokenBuffer {
+  lexer::TokenSource &source;
+
+  /// the size is a power of two
+  std::vector<lexer::Token> ring;
+  /// the oldest retained token
+  size_t begin = 0;
+  /// one past the newest token
+  size_t end = 0;
+  /// the current token
+  size_t offset = 0;
+
+  /// the offsets of the live CheckPoints
+  std::vector<size_t> pins;
+
+public:
+  explicit TokenBuffer(lexer::TokenSource &source, size_t capacity = 64);
+
+  TokenBuffer(const TokenBuffer &) = delete;
+  TokenBuffer &operator=(const TokenBuffer &) = delete;
+
+  /// The token off tokens after the current one. The reference is
+  /// invalidated by the next peek that has to refill the ring.
+  const lexer::Token &peek(size_t off = 0) {
+    size_t at = offset + off;
+    assert(at >= begin && "token was discarded");
+    if (at >= end)
+      fill(at);
+    return ring[at & (ring.size() - 1)];
+  }
+  void advance() { ++offset; }
+
+  /// The offset of the delimiter that matches the current token, from the
+  /// table of the TokenStream of the source. Nullopt if the source has no
+  /// TokenStream, e.g., a Lexer, or the token is no balanced delimiter.
+  std::optional<size_t> getMatchingDelimiter() const {
+    const lexer::TokenStream *ts = getTokenStream();
+    if (!ts || offset >= ts->getLength())
+      return std::nullopt;
+    return ts->getMatchingDelimiter(offset);
+  }
+
+  /// the TokenStream of the source, whose offsets are the ones of the buffer
+  const lexer::TokenStream *getTokenStream() const {
+    return source.getTokenStream();
+  }
+
+  /// Advances to the token at offset at. Without a live CheckPoint, the
+  /// tokens in between are not pulled into the ring.
+  void skipTo(size_t at);
+
+  size_t getOffset() const { return offset; }
+  CheckPoint getCheckPoint() { return CheckPoint(this, offset); }
+  void recover(const CheckPoint &cp);
+
+  /// the number of tokens the ring holds before it grows
+  size_t getCapacity() const { return ring.size(); }
+
+private:
+  friend class CheckPoint;
+  void pin(size_t at) { pins.push_back(at); }
+  void unpin(size_t at);
+
+  void fill(size_t at);
+};
+
+} // namespace rust_compiler::parser
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Basic/Ids.h"
+#include "Lexer/Interner.h"
 
 namespace rust_compiler::tyctx {
 class TyCtx;
@@ -8,17 +9,34 @@ class TyCtx;
 
 namespace rust_compiler::session {
 
+/// The state of the compilation of one crate. It owns the NodeIds and the
+/// token spellings of the crate: while alive, getNextNodeId() allocates
+/// from its NodeIdAllocator and tokens intern into its Interner.
 class Session {
   basic::CrateNum currenteCrate;
   tyctx::TyCtx *ctx;
+  basic::NodeIdAllocator nodeIds;
+  lexer::Interner spellings;
 
 public:
   Session(basic::CrateNum currenteCrate, tyctx::TyCtx *ctx)
-      : currenteCrate(currenteCrate), ctx(ctx) {}
+      : currenteCrate(currenteCrate), ctx(ctx) {
+    nodeIds.install();
+    spellings.install();
+  }
+  ~Session() {
+    spellings.uninstall();
+    nodeIds.uninstall();
+  }
+
+  Session(const Session &) = delete;
+  Session &operator=(const Session &) = delete;
 
   void setTypeContext(tyctx::TyCtx *_ctx) { ctx = _ctx; }
   basic::CrateNum getCurrentCrateNum() const;
   tyctx::TyCtx *getTypeContext() const;
+  basic::NodeIdAllocator &getNodeIdAllocator() { return nodeIds; }
+  lexer::Interner &getInterner() { return spellings; }
 };
 
 extern Session *session;
@@ -29,6 +29,8 @@ public:
 
   TyTy::BaseType *getSelf() const { return self; }
 
+  const TyTy::TypeBoundPredicate &getPredicate() const { return predicate; }
+
   ast::TraitImpl *getTraitImplementation() const { return impl; }
 
 private:
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ADT/NodeIdMap.h"
+#include "Basic/Ids.h"
+#include "TyCtx/TyTy.h"
+
+#include <cstddef>
+#include <optional>
+#include <variant>
+#include <vector>
+
+namespace rust_compiler::tyctx::TyTy {
+
+/// The inference variables of a TyCtx as a union-find forest.
+///
+/// Unifying two variables merges their classes, and unifying a variable
+/// with a type binds its class, in near constant time; TyCtx::lookupType
+/// resolves an InferType through the binding of its class. Inside a
+/// snapshot, every change, including the hints of the InferTypes, is
+/// logged, hence a speculative unification, e.g., a coercion, is undone by
+/// replaying the log instead of cloning the types up front.
+class InferenceTable {
+public:
+  class Snapshot {
+    size_t logLength;
+
+    Snapshot(size_t logLength) : logLength(logLength) {}
+    friend class InferenceTable;
+  };
+
+  /// the representative of the class of var
+  basic::NodeId find(basic::NodeId var);
+  /// Merges the classes of a and b. The merged class keeps the binding of
+  /// either.
+  void unite(basic::NodeId a, basic::NodeId b);
+  /// binds the class of var to type
+  void bind(basic::NodeId var, BaseType *type);
+  /// the type bound to the class of var; nullopt if it is unbound
+  std::optional<BaseType *> probe(basic::NodeId var);
+
+  Snapshot snapshot();
+  /// undoes the changes since snapshot
+  void rollbackTo(Snapshot snapshot);
+  /// keeps the changes since snapshot
+  void commit(Snapshot snapshot);
+
+  /// logs the hint of infer before it is changed in place
+  void recordHint(InferType *infer);
+
+  size_t getNumberOfVariables() const { return entries.size(); }
+
+private:
+  struct Entry {
+    basic::NodeId parent;
+    unsigned rank;
+    BaseType *value;
+  };
+  /// the entry of var before a change; nullopt if it had none
+  struct EntryUndo {
+    basic::NodeId var;
+    std::optional<Entry> old;
+  };
+  struct HintUndo {
+    InferType *infer;
+    InferKind kind;
+    TypeHint hint;
+  };
+
+  /// the entry of var; a singleton class if it had none
+  Entry &getEntry(basic::NodeId var);
+  void update(basic::NodeId var, Entry entry);
+
+  adt::NodeIdMap<Entry> entries;
+  std::vector<std::variant<EntryUndo, HintUndo>> undoLog;
+  unsigned openSnapshots = 0;
+};
+
+} // namespace rust_compiler::tyctx::TyTy
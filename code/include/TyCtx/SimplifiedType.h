@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Lexer/Identifier.h"
+#include "TyCtx/TyTy.h"
+
+#include <optional>
+#include <tuple>
+
+namespace rust_compiler::tyctx::TyTy {
+
+/// The head of a type, e.g., the ADT of Vec<T> or the arity of a tuple. Two
+/// types whose heads differ never satisfy canEqual in either direction, hence
+/// the impls are indexed by the heads of their self types.
+class SimplifiedType {
+  TypeKind kind;
+  /// the int, uint, float, or ADT kind, the mutability, or the arity
+  unsigned detail;
+  /// of an ADT
+  lexer::Identifier identifier;
+
+  SimplifiedType(TypeKind kind, unsigned detail = 0,
+                 lexer::Identifier identifier = lexer::Identifier())
+      : kind(kind), detail(detail), identifier(identifier) {}
+  /// for the int, uint, float, and ADT kinds
+  template <typename Enum>
+  SimplifiedType(TypeKind kind, Enum detail,
+                 lexer::Identifier identifier = lexer::Identifier())
+      : SimplifiedType(kind, static_cast<unsigned>(detail), identifier) {}
+
+public:
+  /// nullopt if type may equal types of other heads, e.g., parameters,
+  /// inference variables, projections, and placeholders
+  static std::optional<SimplifiedType> get(const BaseType *type);
+
+  bool operator<(const SimplifiedType &other) const {
+    return std::tie(kind, detail, identifier) <
+           std::tie(other.kind, other.detail, other.identifier);
+  }
+};
+
+} // namespace rust_compiler::tyctx::TyTy
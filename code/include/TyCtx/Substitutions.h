@@ -5,6 +5,7 @@
 #include "Bounds.h"
 #include "Lexer/Identifier.h"
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Basic/Ids.h"
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/FoldingSet.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace rust_compiler::tyctx::TyTy {
+class BaseType;
+class TypeInterner;
+} // namespace rust_compiler::tyctx::TyTy
+
+namespace rust_compiler::tyctx {
+
+/// A trait query: whether self implements the trait with the generic args,
+/// or the resolution of the trait itself.
+class TraitQueryKey {
+public:
+  static TraitQueryKey get(basic::NodeId trait, const TyTy::BaseType *self,
+                           llvm::ArrayRef<const TyTy::BaseType *> args,
+                           TyTy::TypeInterner &interner);
+  /// the resolution of the trait reference
+  static TraitQueryKey getTrait(basic::NodeId trait);
+
+  basic::NodeId getTrait() const { return trait; }
+
+  /// Whether the result may be memoized. Queries on, e.g., inference
+  /// variables and projections are keyed by the pointers of their types
+  /// and only tracked while in progress, as are trait resolutions.
+  bool isCacheable() const { return cacheable; }
+  /// Whether the key is independent of the types that substitutions change
+  /// in place, i.e., it reaches no parameter, resolved or not.
+  bool isStable() const { return stable; }
+
+  bool operator==(const TraitQueryKey &other) const { return id == other.id; }
+
+  struct Hash {
+    size_t operator()(const TraitQueryKey &key) const {
+      return key.id.ComputeHash();
+    }
+  };
+
+private:
+  TraitQueryKey(basic::NodeId trait) : trait(trait) {}
+
+  /// Adds the structure of type to id. Ground types are added by their
+  /// representatives in the interner. False if type is not cacheable.
+  bool profile(const TyTy::BaseType *type, TyTy::TypeInterner &interner);
+
+  basic::NodeId trait;
+  llvm::FoldingSetNodeID id;
+  bool cacheable = true;
+  bool stable = true;
+};
+
+/// The answer to a trait query.
+struct TraitQueryResult {
+  /// the impl; nullopt if self does not implement the trait
+  std::optional<basic::NodeId> implementation;
+  /// associated type of the trait -> its type for self
+  std::map<basic::NodeId, TyTy::BaseType *> projections;
+};
+
+/// Memoizes the answers to trait queries and detects cyclic queries.
+///
+/// The queries in progress form a stack. A query that reaches a query in
+/// progress is cyclic: it gets no answer, and the answers of the queries
+/// above the reached one depend on that guess, hence they are provisional
+/// and not memoized. Answers are forgotten when an impl of their trait is
+/// inserted, and, unless their key is stable, on the next substitution.
+class TraitQueryCache {
+public:
+  /// the memoized answer; nullopt if there is none or it is stale
+  std::optional<TraitQueryResult *> lookup(const TraitQueryKey &key);
+
+  /// Pushes key onto the queries in progress. False, without a push, if key
+  /// is already in progress, i.e., the query is cyclic.
+  bool start(const TraitQueryKey &key);
+  /// Pops key and memoizes result unless it is provisional or key is not
+  /// cacheable.
+  void complete(const TraitQueryKey &key, TraitQueryResult result);
+  /// Pops key without an answer, e.g., on an error.
+  void abandon(const TraitQueryKey &key);
+
+  bool isInProgress(const TraitQueryKey &key) const;
+
+  /// forgets the answers for trait, e.g., on a new impl of it
+  void invalidate(basic::NodeId trait);
+  /// forgets the answers with unstable keys
+  void onSubstitution() { ++generation; }
+
+private:
+  struct Entry {
+    TraitQueryResult result;
+    bool stable;
+    uint64_t generation;
+  };
+  struct Frame {
+    TraitQueryKey key;
+    /// whether the answer depends on a guess for a cyclic query
+    bool provisional;
+    /// the substitutions before the query
+    uint64_t generation;
+  };
+
+  Frame pop(const TraitQueryKey &key);
+
+  std::map<basic::NodeId,
+           std::unordered_map<TraitQueryKey, Entry, TraitQueryKey::Hash>>
+      answers;
+  std::vector<Frame> inProgress;
+  uint64_t generation = 0;
+};
+
+} // namespace rust_compiler::tyctx
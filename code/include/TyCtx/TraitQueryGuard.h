@@ -7,15 +7,21 @@ namespace rust_compiler::tyctx {
 
 class TraitQueryGuard {
 public:
-  TraitQueryGuard(basic::NodeId id, TyCtx *ctx) : id(id), ctx(ctx) {
-    ctx->insertTraitQuery(id);
+  TraitQueryGuard(basic::NodeId id, TyCtx *ctx)
+      : id(id), ctx(ctx), started(ctx->insertTraitQuery(id)) {}
+
+  ~TraitQueryGuard() {
+    if (started)
+      ctx->traitQueryCompleted(id);
   }
 
-  ~TraitQueryGuard() { ctx->traitQueryCompleted(id); }
+  /// false if the query was in progress already, i.e., it is cyclic
+  bool isStarted() const { return started; }
 
 private:
   basic::NodeId id;
   TyCtx *ctx;
+  bool started;
 };
 
 } // namespace rust_compiler::tyctx
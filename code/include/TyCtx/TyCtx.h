@@ -1,16 +1,22 @@
 #pragma once
 
 #include "ADT/CanonicalPath.h"
+#include "ADT/NodeIdMap.h"
 #include "ADT/ScopedHashTable.h"
 #include "AST/AssociatedItem.h"
 #include "AST/Types/TupleType.h"
 #include "Basic/Ids.h"
 #include "Sema/Autoderef.h"
 #include "TyCtx/AssociatedImplTrait.h"
+#include "TyCtx/InferenceTable.h"
 #include "TyCtx/NodeIdentity.h"
+#include "TyCtx/SimplifiedType.h"
+#include "TyCtx/TraitQueryCache.h"
 #include "TyCtx/TraitReference.h"
 #include "TyCtx/TyTy.h"
+#include "TyCtx/TypeInterner.h"
 
+#include <llvm/ADT/ArrayRef.h>
 #include <llvm/ADT/STLFunctionalExtras.h>
 #include <map>
 #include <optional>
@@ -46,6 +52,24 @@ public:
   iterateAssociatedItems(llvm::function_ref<bool(NodeId, ast::Implementation *,
                                                  ast::AssociatedItem *)>
                              cb);
+
+  /// resolves the self type of an implementation
+  using ImplSelfTypeFn = llvm::function_ref<std::optional<TyTy::BaseType *>(
+      ast::Implementation *)>;
+
+  /// As iterateImplementations, but only over the implementations whose
+  /// self type may equal receiver. An implementation is indexed by the head
+  /// of its self type the first time selfType resolves it.
+  void iterateImplementationsFor(
+      const TyTy::BaseType *receiver, ImplSelfTypeFn selfType,
+      llvm::function_ref<bool(NodeId, ast::Implementation *)> cb);
+  /// As iterateAssociatedItems, but only over the items of the
+  /// implementations whose self type may equal receiver.
+  void iterateAssociatedItemsFor(
+      const TyTy::BaseType *receiver, ImplSelfTypeFn selfType,
+      llvm::function_ref<bool(NodeId, ast::Implementation *,
+                              ast::AssociatedItem *)>
+          cb);
   void insertModule(ast::Module *);
   void insertItem(ast::Item *);
   void insertEnumeration(NodeId, ast::Enumeration *);
@@ -130,6 +154,9 @@ public:
   void insertAutoderefMapping(NodeId, std::vector<sema::Adjustment>);
 
   std::optional<TyTy::BaseType *> lookupType(basic::NodeId);
+  /// the type of id as inserted, i.e., an inference variable instead of
+  /// its binding
+  std::optional<TyTy::BaseType *> lookupInsertedType(basic::NodeId);
   std::optional<ast::Item *> lookupItem(basic::NodeId);
   std::optional<ast::ExternalItem *> lookupExternalItem(basic::NodeId);
   std::optional<ast::Implementation *> lookupImplementation(basic::NodeId);
@@ -166,7 +193,8 @@ public:
   void insertOperatorOverLoad(basic::NodeId id, TyTy::FunctionType *callSite);
 
   // traits
-  void insertTraitQuery(basic::NodeId id);
+  /// False if the query of id is in progress already, i.e., it is cyclic.
+  bool insertTraitQuery(basic::NodeId id);
   void traitQueryCompleted(basic::NodeId id);
   std::optional<TyTy::TraitReference *> lookupTraitReference(basic::NodeId id);
   bool isTraitQueryInProgress(basic::NodeId id) const;
@@ -184,20 +212,51 @@ public:
   void insertAssociatedImplMapping(NodeId traitId,
                                    const TyTy::BaseType *impl_Type,
                                    NodeId implId);
-  std::optional<NodeId>
-  lookupAssociatedImplMappingForSelf(NodeId traitId,
-                                     const TyTy::BaseType *self);
+  /// The impl of the trait for self and the generic args of the trait;
+  /// memoized. Nullopt if there is none or the query is cyclic.
+  std::optional<NodeId> lookupAssociatedImplMappingForSelf(
+      NodeId traitId, const TyTy::BaseType *self,
+      llvm::ArrayRef<const TyTy::BaseType *> args = {});
+
+  /// Memoizes the type of an associated type of the trait for self and args
+  /// with the answer of lookupAssociatedImplMappingForSelf; a no-op without
+  /// one.
+  void insertTraitProjection(NodeId traitId, const TyTy::BaseType *self,
+                             llvm::ArrayRef<const TyTy::BaseType *> args,
+                             NodeId associatedType, TyTy::BaseType *type);
+  std::optional<TyTy::BaseType *>
+  lookupTraitProjection(NodeId traitId, const TyTy::BaseType *self,
+                        llvm::ArrayRef<const TyTy::BaseType *> args,
+                        NodeId associatedType);
+
+  /// Substitutions changed types in place: forgets the trait queries that
+  /// depend on them.
+  void onSubstitution() { traitQueries.onSubstitution(); }
 
   bool haveCheckedForUnconstrained(NodeId id, bool *result);
   void insertUnconstrainedCheckMarker(NodeId id, bool status);
 
+  template <typename T, typename... Args> T *create(Args &&...args) {
+    return types.create<T>(std::forward<Args>(args)...);
+  }
+  TyTy::TypeInterner &getTypeInterner() { return types; }
+  TyTy::InferenceTable &getInferenceTable() { return inferenceTable; }
+
 private:
+  /// owns the types; declared first to be destroyed last
+  TyTy::TypeInterner types;
+
   void generateBuiltins();
 
+  /// the candidates of iterateImplementationsFor, in the order of their
+  /// NodeIds
+  std::vector<NodeId> collectImplementationsFor(const TyTy::BaseType *receiver,
+                                                ImplSelfTypeFn selfType);
+
   void setupBuiltin(std::string_view name, TyTy::BaseType *tyty);
   void setUnitTypeNodeId(basic::NodeId id) { unitTyNodeId = id; }
 
-  std::map<NodeId, bool> unconstrained;
+  std::map<basic::NodeId, bool> unconstrained;
 
   // basic::CrateNum crateNumIter = 7;
   // basic::NodeId nodeIdIter = 7;
@@ -217,55 +276,67 @@ private:
 
   std::map<basic::CrateNum, ast::Crate *> astCrateMappings;
 
-  std::map<basic::NodeId, basic::NodeId> nodeIdRefs;
-  std::map<basic::NodeId, TyTy::BaseType *> resolved;
-  std::vector<std::unique_ptr<TyTy::BaseType>> builtinsList;
+  adt::NodeIdMap<basic::NodeId> nodeIdRefs;
+  adt::NodeIdMap<TyTy::BaseType *> resolved;
+  /// the bindings of the InferTypes in resolved
+  TyTy::InferenceTable inferenceTable;
+  std::vector<TyTy::BaseType *> builtinsList;
 
-  std::map<basic::NodeId, basic::NodeId> resolvedNames;
-  std::map<basic::NodeId, basic::NodeId> resolvedTypes;
+  adt::NodeIdMap<basic::NodeId> resolvedNames;
+  adt::NodeIdMap<basic::NodeId> resolvedTypes;
 
-  std::map<NodeId, std::pair<ast::Enumeration *, ast::EnumItem *>>
+  std::map<basic::NodeId, std::pair<ast::Enumeration *, ast::EnumItem *>>
       enumItemsMappings;
-  std::map<NodeId, ast::Enumeration *> enumMappings;
+  std::map<basic::NodeId, ast::Enumeration *> enumMappings;
 
-  std::map<NodeId, ast::Item *> itemMappings;
-  std::map<NodeId, ast::Implementation *> implementationMappings;
+  std::map<basic::NodeId, ast::Item *> itemMappings;
+  std::map<basic::NodeId, ast::Implementation *> implementationMappings;
   // associatedItem id -> {implementationId, AssociatedItem}
-  std::map<NodeId, std::pair<NodeId, ast::AssociatedItem *>>
+  std::map<basic::NodeId, std::pair<NodeId, ast::AssociatedItem *>>
       associatedItemMappings;
   std::map<NodeId, std::pair<ast::ExternalItem *, NodeId>> externItemMappings;
   std::map<NodeId, std::pair<NodeId, ast::Implementation *>>
       hirImplItemMappings;
 
-  std::map<NodeId, std::vector<sema::Adjustment>> autoderefMappings;
+  std::map<basic::NodeId, std::vector<sema::Adjustment>> autoderefMappings;
+
+  // implementations by the head of their self type
+  std::map<TyTy::SimplifiedType, std::vector<NodeId>> implementationsByHead;
+  // e.g., impl<T> Foo for T
+  std::vector<NodeId> blanketImplementations;
+  // whose self type was not resolved yet
+  std::vector<NodeId> unindexedImplementations;
+  bool indexingImplementations = false;
+  // implementationId -> associated items
+  std::map<basic::NodeId, std::vector<NodeId>> implementationItems;
 
   // std::map<NodeId, std::vector<NodeId>> moduleChildMap;
 
   // TyTy
 
-  std::unique_ptr<TyTy::UintType> u8;
-  std::unique_ptr<TyTy::UintType> u16;
-  std::unique_ptr<TyTy::UintType> u32;
-  std::unique_ptr<TyTy::UintType> u64;
-  std::unique_ptr<TyTy::UintType> u128;
+  TyTy::UintType *u8;
+  TyTy::UintType *u16;
+  TyTy::UintType *u32;
+  TyTy::UintType *u64;
+  TyTy::UintType *u128;
 
-  std::unique_ptr<TyTy::IntType> i8;
-  std::unique_ptr<TyTy::IntType> i16;
-  std::unique_ptr<TyTy::IntType> i32;
-  std::unique_ptr<TyTy::IntType> i64;
-  std::unique_ptr<TyTy::IntType> i128;
+  TyTy::IntType *i8;
+  TyTy::IntType *i16;
+  TyTy::IntType *i32;
+  TyTy::IntType *i64;
+  TyTy::IntType *i128;
 
-  std::unique_ptr<TyTy::FloatType> f32;
-  std::unique_ptr<TyTy::FloatType> f64;
+  TyTy::FloatType *f32;
+  TyTy::FloatType *f64;
 
-  std::unique_ptr<TyTy::BoolType> rbool;
+  TyTy::BoolType *rbool;
 
-  std::unique_ptr<TyTy::USizeType> usize;
-  std::unique_ptr<TyTy::ISizeType> isize;
+  TyTy::USizeType *usize;
+  TyTy::ISizeType *isize;
 
-  std::unique_ptr<TyTy::CharType> charType;
-  std::unique_ptr<TyTy::StrType> strType;
-  std::unique_ptr<TyTy::NeverType> never;
+  TyTy::CharType *charType;
+  TyTy::StrType *strType;
+  TyTy::NeverType *never;
 
   std::vector<std::pair<std::string, ast::types::TypeExpression *>> builtins;
 
@@ -274,16 +345,19 @@ private:
   // closure captures
   std::map<basic::NodeId, std::set<basic::NodeId>> closureCaptureMappings;
 
-  std::map<NodeId, NodeId> associatedTypeMappings;
-  std::map<NodeId, AssociatedImplTrait> associatedImplTraits;
+  std::map<basic::NodeId, NodeId> associatedTypeMappings;
+  std::map<basic::NodeId, AssociatedImplTrait> associatedImplTraits;
 
-  std::map<NodeId, Location> locations;
+  adt::NodeIdMap<Location> locations;
   std::map<basic::NodeId, basic::NodeId> variants;
   std::map<basic::NodeId, TyTy::BaseType *> receiverContext;
   std::map<basic::NodeId, TyTy::FunctionType *> operatorOverloads;
 
-  std::set<basic::NodeId> traitQueriesInProgress;
+  TraitQueryCache traitQueries;
   std::map<basic::NodeId, TyTy::TraitReference> traitContext;
+  // traitId -> {self type of the impl, implId}
+  std::map<NodeId, std::vector<std::pair<const TyTy::BaseType *, NodeId>>>
+      associatedImplMappings;
 
   std::map<basic::NodeId, TyTy::TypeBoundPredicate> predicates;
 
@@ -142,6 +142,9 @@ class TypeVariable {
 public:
   TypeVariable(basic::NodeId id);
   TyTy::BaseType *getType() const;
+  /// the type unless it is only known through the binding of an inference
+  /// variable, which a rollback may undo
+  std::optional<TyTy::BaseType *> getResolvedType() const;
 
   static TypeVariable getImplicitInferVariable(Location);
 
@@ -194,7 +197,9 @@ public:
 
   Location getLocation() const { return identity.getLocation(); }
 
-  virtual bool canEqual(const BaseType *other, bool emitErrors) const = 0;
+  /// Whether the types can be unified. Ground types with the same
+  /// representative in the TypeInterner are equal without a walk.
+  bool canEqual(const BaseType *other, bool emitErrors) const;
 
   bool boundsCompatible(const BaseType *other, Location loc,
                         bool emitError) const;
@@ -212,11 +217,19 @@ protected:
            std::set<basic::NodeId> refs = std::set<basic::NodeId>());
 
 private:
+  virtual bool canEqualImpl(const BaseType *other, bool emitErrors) const = 0;
+
   basic::NodeId reference;
   basic::NodeId typeReference;
   TypeKind kind;
   TypeIdentity identity;
   std::set<basic::NodeId> combined;
+
+  friend class TypeInterner;
+  /// memoized by TypeInterner::intern; a ground type keeps its structure
+  mutable const BaseType *representative = nullptr;
+  /// memoized by TypeInterner::intern: the type was not ground
+  mutable bool notGround = false;
 };
 
 class IntType : public BaseType {
@@ -233,7 +246,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
   IntKind kind;
@@ -253,7 +266,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
   UintKind kind;
@@ -271,7 +284,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 };
 
 class ISizeType : public BaseType {
@@ -286,7 +299,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 };
 
 /// F32 or F64
@@ -304,7 +317,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
   FloatKind kind;
@@ -324,7 +337,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 };
 
 class CharType : public BaseType {
@@ -340,7 +353,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 };
 
 class StrType : public BaseType {
@@ -356,7 +369,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 };
 
 /// !
@@ -373,7 +386,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 };
 
 /// (.., .., ..)
@@ -398,9 +411,10 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
+  friend class TypeInterner;
   std::vector<TypeVariable> fields;
 };
 
@@ -479,7 +493,7 @@ public:
   FunctionType *
   handleSubstitions(SubstitutionArgumentMappings &mappings) override final;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
   lexer::Identifier name;
@@ -534,7 +548,7 @@ public:
   ClosureType *
   handleSubstitions(SubstitutionArgumentMappings &mappings) override final;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
   TyTy::TupleType *parameters;
@@ -552,6 +566,8 @@ public:
             std::set<basic::NodeId> refs = std::set<basic::NodeId>());
 
   InferKind getInferredKind() const { return inferKind; }
+  /// the variable in the InferenceTable; clones share it
+  basic::NodeId getVariable() const { return variable; }
 
   bool needsSubstitution() const;
   std::string toString() const override;
@@ -561,12 +577,15 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
   InferKind inferKind;
   TypeHint defaultHint;
   Location loc;
+  basic::NodeId variable;
+
+  friend class InferenceTable;
 };
 
 class ErrorType : public BaseType {
@@ -581,7 +600,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 };
 
 class WithLocation {
@@ -736,7 +755,7 @@ public:
   ADTType *
   handleSubstitions(SubstitutionArgumentMappings &mappings) override final;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
   Identifier getIdentifier() const { return identifier; }
 
@@ -774,7 +793,7 @@ public:
 
   bool isImplicitSelfTrait() const;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
   Identifier identifier;
@@ -803,7 +822,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
   std::shared_ptr<ast::Expression> getCapacityExpression() const {
     return expr;
@@ -837,9 +856,10 @@ public:
 
   bool isMutable() const { return mut == Mutability::Mut; }
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
+  friend class TypeInterner;
   TypeVariable base;
   Mutability mut;
 };
@@ -864,7 +884,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
   size_t getNumberOfArguments() const { return parameters.size(); }
 
@@ -891,13 +911,14 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
   std::string toString() const override;
 
   unsigned getNumberOfSpecifiedBounds() const override { return 0; }
 
 private:
+  friend class TypeInterner;
   TypeVariable elementType;
 };
 
@@ -926,11 +947,12 @@ public:
 
   unsigned getNumberOfSpecifiedBounds() const override { return 0; }
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
   Mutability getMut() const { return mut; }
 
 private:
+  friend class TypeInterner;
   TypeVariable base;
   Mutability mut;
 };
@@ -957,7 +979,7 @@ public:
 
   void setAssociatedType(basic::NodeId);
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
   Identifier id;
@@ -970,7 +992,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 
 private:
   BaseType *base;
@@ -993,7 +1015,7 @@ public:
 
   BaseType *clone() const final override;
 
-  bool canEqual(const BaseType *other, bool emitErrors) const override;
+  bool canEqualImpl(const BaseType *other, bool emitErrors) const override;
 };
 
 std::string TypeKind2String(TypeKind kind);
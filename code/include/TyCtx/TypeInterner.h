@@ -0,0 +1,66 @@
+#pragma once
+
+#include <llvm/ADT/FoldingSet.h>
+#include <llvm/Support/Allocator.h>
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rust_compiler::tyctx::TyTy {
+
+class BaseType;
+
+/// The arena and the hash-consing table of the types of a TyCtx.
+///
+/// Every type that the type checker creates, clones, and unifies is
+/// bump-allocated here and destroyed with the TyCtx.
+///
+/// Types carry their references and are mutated in place, e.g., by
+/// appendReference, hence they cannot be shared. intern() maps a ground
+/// type, i.e., a scalar, str, !, or a tuple, reference, raw pointer, or
+/// slice of ground types, to one immutable representative per structure.
+/// The components must be resolved, not only bound by unification.
+/// Two ground types are equal iff their representatives are the same
+/// pointer.
+class TypeInterner {
+public:
+  TypeInterner() = default;
+  TypeInterner(const TypeInterner &) = delete;
+  TypeInterner &operator=(const TypeInterner &) = delete;
+  ~TypeInterner();
+
+  template <typename T, typename... Args> T *create(Args &&...args) {
+    T *type = new (allocator.Allocate<T>()) T(std::forward<Args>(args)...);
+    types.push_back(type);
+    return type;
+  }
+
+  /// The representative of the structure of type; nullptr if type is not
+  /// ground. Memoized in the type, both ways: a type whose components were
+  /// not resolved yet is not interned later.
+  const BaseType *intern(const BaseType *type);
+
+  size_t getNumberOfTypes() const { return types.size(); }
+  size_t getNumberOfInternedTypes() const { return representatives.size(); }
+
+private:
+  /// Adds the structure of type to id, with the representatives of its
+  /// components. False if type is not ground.
+  bool profile(const BaseType *type, llvm::FoldingSetNodeID &id);
+
+  struct ProfileHash {
+    size_t operator()(const llvm::FoldingSetNodeID &id) const {
+      return id.ComputeHash();
+    }
+  };
+
+  llvm::BumpPtrAllocator allocator;
+  /// for the destructors
+  std::vector<BaseType *> types;
+  std::unordered_map<llvm::FoldingSetNodeID, const BaseType *, ProfileHash>
+      representatives;
+};
+
+} // namespace rust_compiler::tyctx::TyTy
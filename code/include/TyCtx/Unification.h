@@ -4,39 +4,29 @@
 #include "TyCtx/TyCtx.h"
 #include "TyCtx/TyTy.h"
 
-#include <vector>
-
 namespace rust_compiler::tyctx {
 
 using namespace rust_compiler::tyctx;
 
-class CommitSite {
-public:
-  CommitSite(TyTy::BaseType *lhs, TyTy::BaseType *rhs, TyTy::BaseType *resolved)
-      : lhs(lhs), rhs(rhs), resolved(resolved) {}
-
-private:
-  [[maybe_unused]] TyTy::BaseType *lhs;
-  [[maybe_unused]] TyTy::BaseType *rhs;
-  [[maybe_unused]] TyTy::BaseType *resolved;
-};
-
-class InferenceSite {};
-
+/// Unifies two types. The inference variables unified with each other or
+/// with a type are merged or bound in the InferenceTable of the context.
 class Unification {
 public:
-  Unification(std::vector<CommitSite> &commits,
-              std::vector<InferenceSite> &infers, Location loc,
-              TyTy::WithLocation lhs, TyTy::WithLocation rhs, TyCtx *context)
-      : commits(commits), infers(infers), location(loc), lhs(lhs), rhs(rhs),
-        context(context) {}
+  Unification(Location loc, TyTy::WithLocation lhs, TyTy::WithLocation rhs,
+              TyCtx *context)
+      : location(loc), lhs(lhs), rhs(rhs), context(context) {}
 
   static TyTy::BaseType *unifyWithSite(TyTy::WithLocation lhs,
                                        TyTy::WithLocation rhs, Location unify,
                                        TyCtx *);
+  /// Speculative unifyWithSite: on an error, the changes to the inference
+  /// variables are rolled back and no error is emitted.
+  static TyTy::BaseType *tryUnifyWithSite(TyTy::WithLocation lhs,
+                                          TyTy::WithLocation rhs,
+                                          Location unify, TyCtx *);
 
   // @private
-  TyTy::BaseType *unify(bool commit, bool emitErrors, bool inference);
+  TyTy::BaseType *unify(bool commit, bool emitErrors);
 
 private:
   TyTy::BaseType *expectIntType(TyTy::IntType *left, TyTy::BaseType *right);
@@ -64,14 +54,12 @@ private:
   void commit(TyTy::BaseType *leftType, TyTy::BaseType *rightType,
               TyTy::BaseType *result);
 
-  void emitFailedUnification();
+  /// unifies the components of compound types with the same flags
+  TyTy::BaseType *unifyComponents(TyTy::BaseType *left, TyTy::BaseType *right);
 
-  void handleInference();
+  void emitFailedUnification();
 
-  std::vector<CommitSite> &commits;
-  std::vector<InferenceSite> &infers;
   Location location;
-  bool inference;
   bool emitErrors;
   bool forceCommit;
 
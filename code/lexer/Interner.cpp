@@ -0,0 +1,81 @@
+#include "Lexer/Interner.h"
+
+#include "LiteralCache.h"
+
+#include <cassert>
+#include <mutex>
+
+namespace rust_compiler::lexer {
+
+namespace {
+
+/// nullptr: the process-wide Interner
+Interner *currentInterner = nullptr;
+
+} // namespace
+
+Interner::Interner() : literals(std::make_unique<LiteralCache>()) {
+  append(std::string_view());
+}
+
+Interner::~Interner() {
+  for (std::atomic<std::string_view *> &chunk : chunks)
+    delete[] chunk.load(std::memory_order_relaxed);
+}
+
+/// called with the mutex held, or from the constructor
+void Interner::append(std::string_view spelling) {
+  uint32_t id = size.load(std::memory_order_relaxed);
+  uint32_t index = id + FirstChunkSize;
+  unsigned chunk = llvm::Log2_32(index) - FirstChunkBits;
+  assert(chunk < MaxChunks && "too many spellings");
+
+  std::string_view *entries = chunks[chunk].load(std::memory_order_relaxed);
+  if (entries == nullptr) {
+    entries = new std::string_view[FirstChunkSize << chunk];
+    chunks[chunk].store(entries, std::memory_order_release);
+  }
+  entries[index - (FirstChunkSize << chunk)] = spelling;
+
+  // publishes the entry to lookup
+  size.store(id + 1, std::memory_order_release);
+}
+
+uint32_t Interner::intern(std::string_view spelling) {
+  if (spelling.empty())
+    return 0;
+
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(spelling);
+    if (it != ids.end())
+      return it->second;
+  }
+
+  std::unique_lock<std::shared_mutex> lock(mutex);
+  auto [it, inserted] =
+      ids.try_emplace(spelling, size.load(std::memory_order_relaxed));
+  if (inserted)
+    append(it->first());
+  return it->second;
+}
+
+void Interner::install() {
+  outer = currentInterner;
+  currentInterner = this;
+}
+
+void Interner::uninstall() {
+  assert(currentInterner == this && "interners are uninstalled in LIFO");
+  currentInterner = outer;
+  outer = nullptr;
+}
+
+Interner &getInterner() {
+  if (currentInterner != nullptr)
+    return *currentInterner;
+  static Interner processInterner;
+  return processInterner;
+}
+
+} // namespace rust_compiler::lexer
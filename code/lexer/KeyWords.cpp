@@ -1,11 +1,13 @@
 #include "Lexer/KeyWords.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <optional>
+#include <string_view>
 
 namespace rust_compiler::lexer {
 
-// FIXME: slow
-
 //std::optional<std::string> KeyWord2String(KeyWordKind kind) {
 //  switch (kind) {
 //    case KeyWordKind::KW_AS : return "as";
@@ -17,7 +19,7 @@ namespace rust_compiler::lexer {
 //  return std::nullopt;
 //}
 
-static const std::pair<KeyWordKind, std::string> KW[] = {
+static constexpr std::pair<KeyWordKind, std::string_view> KW[] = {
     {KeyWordKind::KW_AS, "as"},
     {KeyWordKind::KW_BREAK, "break"},
     {KeyWordKind::KW_CONST, "const"},
@@ -72,22 +74,87 @@ static const std::pair<KeyWordKind, std::string> KW[] = {
     {KeyWordKind::KW_UNION, "union"},
     {KeyWordKind::KW_STATICLIFETIME, "'static"}};
 
+namespace {
+
+/// Perfect hash over the keywords: the length, the first, and the last two
+/// characters select a unique slot in HashTable. The factors were searched
+/// offline; isPerfectHash checks at compile time that there are no
+/// collisions.
+constexpr size_t HashTableSize = 128;
+
+constexpr size_t hashKeyWord(std::string_view kw) {
+  size_t length = kw.size();
+  return (length * 60 + static_cast<unsigned char>(kw[0]) * 17 +
+          static_cast<unsigned char>(kw[length - 2]) * 5 +
+          static_cast<unsigned char>(kw[length - 1])) %
+         HashTableSize;
+}
+
+constexpr size_t getMinKeyWordLength() {
+  size_t min = KW[0].second.size();
+  for (auto &kw : KW)
+    min = std::min(min, kw.second.size());
+  return min;
+}
+
+constexpr size_t getMaxKeyWordLength() {
+  size_t max = 0;
+  for (auto &kw : KW)
+    max = std::max(max, kw.second.size());
+  return max;
+}
+
+constexpr size_t MinKeyWordLength = getMinKeyWordLength();
+constexpr size_t MaxKeyWordLength = getMaxKeyWordLength();
+
+static_assert(MinKeyWordLength >= 2, "hashKeyWord reads two characters");
+
+/// maps a hash to an index into KW, or -1
+using HashTableTy = std::array<int8_t, HashTableSize>;
+
+constexpr HashTableTy buildHashTable() {
+  HashTableTy table = {};
+  for (auto &slot : table)
+    slot = -1;
+  for (size_t i = 0; i < std::size(KW); ++i)
+    table[hashKeyWord(KW[i].second)] = i;
+  return table;
+}
+
+constexpr bool isPerfectHash() {
+  HashTableTy table = buildHashTable();
+  for (size_t i = 0; i < std::size(KW); ++i)
+    if (table[hashKeyWord(KW[i].second)] != static_cast<int8_t>(i))
+      return false;
+  return true;
+}
+
+static_assert(std::size(KW) < 128, "indices must fit into int8_t");
+static_assert(isPerfectHash(), "keyword hash has collisions");
+
+constexpr HashTableTy HashTable = buildHashTable();
+
+} // namespace
+
 std::optional<std::string> KeyWord2String(KeyWordKind kind) {
-  for (auto kw : KW) {
-    if (std::get<0>(kw) == kind)
-      return std::get<1>(kw);
+  for (auto &kw : KW) {
+    if (kw.first == kind)
+      return std::string(kw.second);
   }
 
   return std::nullopt;
 }
 
 std::optional<KeyWordKind> isKeyWord(std::string_view identifier) {
-  for (auto &p : KW) {
-    if (std::get<1>(p) == identifier) {
-      return std::get<0>(p);
-    }
-  }
-  return std::nullopt;
+  if (identifier.size() < MinKeyWordLength ||
+      identifier.size() > MaxKeyWordLength)
+    return std::nullopt;
+
+  int8_t index = HashTable[hashKeyWord(identifier)];
+  if (index < 0 || KW[index].second != identifier)
+    return std::nullopt;
+
+  return KW[index].first;
 }
 
 } // namespace rust_compiler::lexer
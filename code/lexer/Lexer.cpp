@@ -1,11 +1,15 @@
 #include "Lexer/Lexer.h"
 
+#include "Basic/SourceManager.h"
 #include "Lexer/KeyWords.h"
 #include "Lexer/Token.h"
 #include "Lexer/TokenStream.h"
 #include "Location.h"
 
+#include <algorithm>
+#include <cassert>
 #include <cstdlib>
+#include <llvm/ADT/STLFunctionalExtras.h>
 #include <llvm/Support/raw_ostream.h>
 #include <optional>
 
@@ -223,8 +227,9 @@ std::string tryLexComment(std::string_view code) {
       return ws;
     }
     if (ws.size() == wsSize) {
-      llvm::errs() << "no progress in tryLexComment:" << ws << "\n";
-      exit(EXIT_FAILURE);
+      // any other character up to the end of the line
+      ws.push_back(view[0]);
+      view.remove_prefix(1);
     }
   }
 
@@ -347,7 +352,7 @@ std::optional<std::string> tryLexString(std::string_view code) {
       else
         return std::nullopt;
     } else {
-      printf("unknown string token: x%s\n", code.data());
+      // lexFrom reports the unknown token
       return std::nullopt;
     }
   }
@@ -396,7 +401,7 @@ std::optional<std::string> tryLexChar(std::string_view code) {
       else
         return std::nullopt;
     } else {
-      printf("unknown char token: x%s\n", code.data());
+      // lexFrom reports the unknown token
       return std::nullopt;
     }
   }
@@ -404,20 +409,50 @@ std::optional<std::string> tryLexChar(std::string_view code) {
   return std::nullopt;
 }
 
-TokenStream lex(std::string_view _code, std::string_view fileName) {
-  TokenStream ts;
-  std::string_view code = _code;
-  unsigned lineNumber = 1;
-  unsigned columnNumber = 0;
+TokenStream lex(std::string_view code, std::string_view fileName) {
+  return lex(basic::getSourceManager().addBuffer(fileName, code));
+}
+
+/// the kind of the unknown token at the start of code, for diagnostics
+static const char *getUnknownTokenKind(std::string_view code) {
+  if (code.starts_with("\""))
+    return "unknown string token";
+  if (code.starts_with("\'"))
+    return "unknown char token";
+  return "unknown token";
+}
 
+/// Lexes file from the token at offset begin. Stops with the last token
+/// for which isResynchronized returns true. On an unknown token, it stores
+/// the message in error and returns the tokens so far; without error, it
+/// reports the token and exits.
+static TokenStream
+lexFrom(basic::FileId file, uint32_t begin,
+        llvm::function_ref<bool(const Token &)> isResynchronized,
+        std::string *error = nullptr) {
+  TokenStream ts;
+  basic::SourceManager &sm = basic::getSourceManager();
+  std::string_view _code = sm.getBuffer(file);
+  std::string_view code = _code.substr(begin);
+  // the Locations of a file are contiguous: no lookup per token
+  uint32_t fileStart = sm.getLocation(file, 0).getRawEncoding();
+  auto getLocation = [&]() {
+    return Location::fromRawEncoding(fileStart + _code.size() - code.size());
+  };
+
+  size_t checked = 0;
   while (code.size() > 0) {
+    if (ts.getLength() > checked) {
+      checked = ts.getLength();
+      if (isResynchronized(ts.getAt(checked - 1)))
+        return ts;
+    }
 
     // printf("code.size(): %lu\n", code.size());
     // printf("code.size(): %s\n", code.data());
 
     std::string ws = tryLexWhiteSpace(code);
     code.remove_prefix(ws.size());
-    columnNumber += ws.size();
 
     //    for (auto &ik : IK) {
     //      if (code.starts_with(std::get<1>(ik))) {
@@ -441,37 +476,32 @@ TokenStream lex(std::string_view _code, std::string_view fileName) {
 
     ws = tryLexWhiteSpace(code);
     code.remove_prefix(ws.size());
-    columnNumber += ws.size();
 
     if (code.starts_with("//")) {
       std::string comment = tryLexComment(code);
       code.remove_prefix(comment.size());
-      columnNumber += comment.size();
       continue;
     }
 
     if (code.starts_with("//*")) {
       std::string comment = tryLexInlineComment(code);
       code.remove_prefix(comment.size());
-      columnNumber += comment.size();
       continue;
     }
 
     std::optional<std::string> decInt = tryLexDecLiteral(code);
     if (decInt) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::INTEGER_LITERAL, *decInt));
+      ts.append(Token(getLocation(), decInt->size(), TokenKind::INTEGER_LITERAL,
+                      *decInt));
       code.remove_prefix(decInt->size());
-      columnNumber += decInt->size();
       continue;
     }
 
     std::optional<std::string> str = tryLexString(code);
     if (str) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::STRING_LITERAL, *str));
+      ts.append(Token(getLocation(), str->size(), TokenKind::STRING_LITERAL,
+                      *str));
       code.remove_prefix(str->size());
-      columnNumber += str->size();
       continue;
     }
 
@@ -486,277 +516,270 @@ TokenStream lex(std::string_view _code, std::string_view fileName) {
 
     std::optional<std::string> id = tryLexIdentifier(code);
     if (id) {
-      if (isKeyWord(*id)) {
-        ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                        *isKeyWord(*id), *id));
+      if (std::optional<KeyWordKind> keyWord = isKeyWord(*id)) {
+        ts.append(Token(getLocation(), id->size(), *keyWord, *id));
         code.remove_prefix(id->size());
-        columnNumber += id->size();
         continue;
       } else {
-        ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                        TokenKind::Identifier, *id));
+        ts.append(Token(getLocation(), id->size(), TokenKind::Identifier, *id));
         code.remove_prefix(id->size());
-        columnNumber += id->size();
         continue;
       }
     }
 
     if (code.starts_with("!")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Not));
+      ts.append(Token(getLocation(), 1, TokenKind::Not));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("$crate")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::Identifier, "$crate"));
+      ts.append(Token(getLocation(), 6, TokenKind::Identifier, "$crate"));
       code.remove_prefix(6);
-      columnNumber += 6;
     } else if (code.starts_with("@")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::At));
+      ts.append(Token(getLocation(), 1, TokenKind::At));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("->")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::RArrow));
+      ts.append(Token(getLocation(), 2, TokenKind::RArrow));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("+=")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::PlusEq));
+      ts.append(Token(getLocation(), 2, TokenKind::PlusEq));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("+")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Plus));
+      ts.append(Token(getLocation(), 1, TokenKind::Plus));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("..=")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::DotDotEq));
+      ts.append(Token(getLocation(), 3, TokenKind::DotDotEq));
       code.remove_prefix(3);
-      columnNumber += 3;
     } else if (code.starts_with("...")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::DotDotDot));
+      ts.append(Token(getLocation(), 3, TokenKind::DotDotDot));
       code.remove_prefix(3);
-      columnNumber += 3;
     } else if (code.starts_with("..")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::DotDot));
+      ts.append(Token(getLocation(), 2, TokenKind::DotDot));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with(".")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Dot));
+      ts.append(Token(getLocation(), 1, TokenKind::Dot));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("_")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::Underscore));
+      ts.append(Token(getLocation(), 1, TokenKind::Underscore));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("?")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::QMark));
+      ts.append(Token(getLocation(), 1, TokenKind::QMark));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("*")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Star));
+      ts.append(Token(getLocation(), 1, TokenKind::Star));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("==")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::EqEq));
+      ts.append(Token(getLocation(), 2, TokenKind::EqEq));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("!=")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Ne));
+      ts.append(Token(getLocation(), 2, TokenKind::Ne));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("=>")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::FatArrow));
+      ts.append(Token(getLocation(), 2, TokenKind::FatArrow));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("=")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Eq));
+      ts.append(Token(getLocation(), 1, TokenKind::Eq));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("-")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::Minus));
+      ts.append(Token(getLocation(), 1, TokenKind::Minus));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with(">>")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Shr));
+      ts.append(Token(getLocation(), 2, TokenKind::Shr));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with(">")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Gt));
+      ts.append(Token(getLocation(), 1, TokenKind::Gt));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("<<")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Shl));
+      ts.append(Token(getLocation(), 2, TokenKind::Shl));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("<=")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Le));
+      ts.append(Token(getLocation(), 1, TokenKind::Le));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("::")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::PathSep));
+      ts.append(Token(getLocation(), 2, TokenKind::PathSep));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with(":")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::Colon));
+      ts.append(Token(getLocation(), 1, TokenKind::Colon));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("&&")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::AndAnd));
+      ts.append(Token(getLocation(), 2, TokenKind::AndAnd));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("&")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::And));
+      ts.append(Token(getLocation(), 1, TokenKind::And));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("#")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Hash));
+      ts.append(Token(getLocation(), 1, TokenKind::Hash));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("{")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::BraceOpen));
+      ts.append(Token(getLocation(), 1, TokenKind::BraceOpen));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("}")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::BraceClose));
+      ts.append(Token(getLocation(), 1, TokenKind::BraceClose));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("[")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::SquareOpen));
+      ts.append(Token(getLocation(), 1, TokenKind::SquareOpen));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("]")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::SquareClose));
+      ts.append(Token(getLocation(), 1, TokenKind::SquareClose));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with(",")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::Comma));
+      ts.append(Token(getLocation(), 1, TokenKind::Comma));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("(")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::ParenOpen));
+      ts.append(Token(getLocation(), 1, TokenKind::ParenOpen));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with(")")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::ParenClose));
+      ts.append(Token(getLocation(), 1, TokenKind::ParenClose));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("!")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Not));
+      ts.append(Token(getLocation(), 1, TokenKind::Not));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with(";")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Semi));
+      ts.append(Token(getLocation(), 1, TokenKind::Semi));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("|")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Or));
+      ts.append(Token(getLocation(), 1, TokenKind::Or));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("!")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Not));
+      ts.append(Token(getLocation(), 1, TokenKind::Not));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("^")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::Caret));
+      ts.append(Token(getLocation(), 1, TokenKind::Caret));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("%")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::Percent));
+      ts.append(Token(getLocation(), 1, TokenKind::Percent));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("/")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::Slash));
+      ts.append(Token(getLocation(), 1, TokenKind::Slash));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with(">=")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Ge));
+      ts.append(Token(getLocation(), 2, TokenKind::Ge));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("<=")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Le));
+      ts.append(Token(getLocation(), 2, TokenKind::Le));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("<")) {
-      ts.append(
-          Token(Location(fileName, lineNumber, columnNumber), TokenKind::Lt));
+      ts.append(Token(getLocation(), 1, TokenKind::Lt));
       code.remove_prefix(1);
-      columnNumber += 1;
     } else if (code.starts_with("..")) {
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      TokenKind::DotDot));
+      ts.append(Token(getLocation(), 2, TokenKind::DotDot));
       code.remove_prefix(2);
-      columnNumber += 2;
     } else if (code.starts_with("\n")) {
       code.remove_prefix(1);
-      ++lineNumber;
-      columnNumber = 0;
     } else if (code.starts_with("'static")) {
+      ts.append(Token(getLocation(), 7, KeyWordKind::KW_STATICLIFETIME,
+                      "'static"));
       code.remove_prefix(7);
-      columnNumber += 7;
-      ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                      KeyWordKind::KW_STATICLIFETIME, "'static"));
     } else {
       if (code.size() == 0) {
-        ts.append(Token(Location(fileName, lineNumber, columnNumber),
-                        TokenKind::Eof));
+        ts.append(Token(getLocation(), 0, TokenKind::Eof));
         return ts;
       }
-      printf("unknown token: x%sx\n", code.data());
-      llvm::outs() << "remaining chars:" << code.size() << "\n";
-      ts.print(50);
+      std::string message = getLocation().toString() + ": " +
+                            getUnknownTokenKind(code) + ": " +
+                            std::string(code.substr(0, code.find('\n')));
+      if (error != nullptr) {
+        *error = message;
+        return ts;
+      }
+      llvm::errs() << message << "\n";
       exit(EXIT_FAILURE);
     }
   }
-  llvm::outs() << "lexer: done"
-               << "\n";
-
-  ts.append(
-      Token(Location(fileName, lineNumber, columnNumber), TokenKind::Eof));
+  ts.append(Token(getLocation(), 0, TokenKind::Eof));
 
   // ts.print(50);
   return ts;
 }
 
+TokenStream lex(basic::FileId file) {
+  return lexFrom(file, 0, [](const Token &) { return false; });
+}
+
+llvm::Expected<TokenStream> tryLex(basic::FileId file) {
+  std::string error;
+  TokenStream ts =
+      lexFrom(file, 0, [](const Token &) { return false; }, &error);
+  if (!error.empty())
+    return llvm::createStringError(std::errc::invalid_argument,
+                                   error.c_str());
+  return ts;
+}
+
+/// The lexer peeks at most this many bytes past the end of a token, e.g.,
+/// for .. and ..=, or a digit after a literal.
+static constexpr uint32_t MaxLookAhead = 4;
+
+TokenStream relex(const TokenStream &previous, const TextEdit &edit,
+                  basic::FileId file) {
+  basic::SourceManager &sm = basic::getSourceManager();
+  std::span<const Token> tokens = previous.getAsView();
+  assert(!tokens.empty() && "previous has no Eof token");
+
+  // all tokens are in one file: translate Locations to file offsets and
+  // back with the bases of the old and the new file
+  Location first = tokens.front().getLocation();
+  uint32_t oldBase = first.getRawEncoding() - sm.getFileOffset(first);
+  uint32_t newBase = sm.getLocation(file, 0).getRawEncoding();
+  auto getOldOffset = [&](const Token &tk) {
+    return tk.getLocation().getRawEncoding() - oldBase;
+  };
+  int64_t delta = int64_t(edit.inserted) - int64_t(edit.removed);
+  auto relocate = [&](Token tk, int64_t shift) {
+    tk.setLocation(
+        Location::fromRawEncoding(getOldOffset(tk) + shift + newBase));
+    return tk;
+  };
+
+  // The first token whose lexing may have seen the edit. Lexing resumes at
+  // the token before it, which also covers edits in the trivia after it.
+  auto affected =
+      std::partition_point(tokens.begin(), tokens.end(), [&](const Token &tk) {
+        return tk.getKind() != TokenKind::Eof &&
+               getOldOffset(tk) + tk.getLength() + MaxLookAhead <=
+                   edit.offset;
+      });
+  size_t restart = affected - tokens.begin();
+  if (restart > 0)
+    --restart;
+
+  // A token that starts past the edit where a token of previous started
+  // sees the same bytes to the end of the file. Block comments and raw
+  // strings that the edit opened or closed end at a different offset and
+  // do not resynchronize.
+  uint32_t editEnd = edit.offset + edit.inserted;
+  size_t next = restart;
+  bool resynchronized = false;
+  TokenStream relexed = lexFrom(
+      file, getOldOffset(tokens[restart]), [&](const Token &tk) {
+        uint32_t offset = tk.getLocation().getRawEncoding() - newBase;
+        if (offset < editEnd)
+          return false;
+        uint32_t oldOffset = offset - delta;
+        while (next < tokens.size() && getOldOffset(tokens[next]) < oldOffset)
+          ++next;
+        resynchronized = next < tokens.size() &&
+                         getOldOffset(tokens[next]) == oldOffset &&
+                         tokens[next].getKind() == tk.getKind();
+        return resynchronized;
+      });
+
+  TokenStream ts;
+  for (size_t i = 0; i < restart; ++i)
+    ts.append(relocate(tokens[i], 0));
+
+  std::span<const Token> fresh = relexed.getAsView();
+  if (!resynchronized) {
+    for (const Token &tk : fresh)
+      ts.append(tk);
+    return ts;
+  }
+
+  for (const Token &tk : fresh.first(fresh.size() - 1))
+    ts.append(tk);
+  for (size_t i = next; i < tokens.size(); ++i)
+    ts.append(relocate(tokens[i], delta));
+  return ts;
+}
+
 } // namespace rust_compiler::lexer
 
 // https://github.com/thepowersgang/mrustc/blob/master/src/parse/lex.cpp
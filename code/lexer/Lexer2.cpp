@@ -1,17 +1,24 @@
 #include "ADT/Utf8String.h"
+#include "Basic/SourceManager.h"
 #include "Lexer/KeyWords.h"
 #include "Lexer/Lexer.h"
+#include "Lexer/ScanKernels.h"
 #include "Lexer/Token.h"
 #include "Lexer/TokenStream.h"
 #include "Location.h"
 
+#include <algorithm>
+#include <cassert>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <llvm/Support/ErrorHandling.h>
 #include <llvm/Support/raw_ostream.h>
 #include <string_view>
 #include <system_error>
 #include <unicode/uchar.h>
 #include <unicode/ustdio.h>
+#include <unicode/utf8.h>
 
 using namespace rust_compiler::adt;
 
@@ -21,25 +28,25 @@ namespace rust_compiler::lexer {
 Token Lexer::advanceToken() {
   UChar32 next;
 
-  if (auto c = bump())
-    next = *c;
-  else {
-    return Token(getLocation(), TokenKind::Eof);
-  }
-
-  // check ASCII
-
-  if (next == '/' && peek(1) == '/')
-    lineComment();
-  if (next == '/' && peek(1) == '*')
-    blockComment();
+  // skip whitespace and comments
+  while (true) {
+    next = getUchar();
+    if (next == U_EOF)
+      return Token(getLocation(), TokenKind::Eof);
 
-  if (isWhiteSpace(next))
-    skipWhiteSpace();
+    if (next == '/' && peek(1) == '/')
+      lineComment();
+    else if (next == '/' && peek(1) == '*')
+      blockComment();
+    else if (isWhiteSpace(next))
+      skipWhiteSpace();
+    else
+      break;
+  }
 
-  if (next == '_' && isIdStart(1))
+  if (next == '_' && isIdContinue(1))
     return lexIdentifierOrKeyWord();
-  if (isIdStart(0))
+  if (next != 'r' && next != 'b' && isIdStart(0))
     return lexIdentifierOrKeyWord();
 
   switch (next) {
@@ -50,8 +57,7 @@ Token Lexer::advanceToken() {
       return lexRawIdentifier();
     if (peek(1) == '#' || peek(1) == '\"')
       return lexRawDoubleQuotedString();
-    return lexIdentifierOrUnknownPrefix();
-    break;
+    return lexIdentifierOrKeyWord();
   }
 
     // byte literal, byte string literal, raw byte string literal, or identifier
@@ -64,13 +70,11 @@ Token Lexer::advanceToken() {
       return lexRawDoubleQuotedString();
     if (peek(1) == 'r' && peek(2) == '#')
       return lexRawDoubleQuotedString();
-    return lexIdentifierOrUnknownPrefix();
+    return lexIdentifierOrKeyWord();
   }
 
     // acount for BOM?
 
-    // Identifier
-
   case '0':
   case '1':
   case '2':
@@ -83,79 +87,152 @@ Token Lexer::advanceToken() {
   case '9':
     return lexNumericalLiteral();
 
-    // one-symbol tokens
+  // Lifetime or character literal
+  case '\'':
+    return lexLifetimeOrChar();
+
+  // string literal
+  case '\"':
+    return lexStringLiteral();
+
+  default:
+    break;
+  }
+
+  if (std::optional<Token> punctuation = lexPunctuation())
+    return *punctuation;
+
+  // Identifier starting with an emoji.
+  if (!isASCII() && isEmoji())
+    return lexFakeIdentifierOrUnknownPrefix();
+
+  llvm::errs() << getLocation().toString() << ": unknown token: " << next
+               << "\n";
+  exit(EXIT_FAILURE);
+}
+
+/// https://doc.rust-lang.org/reference/tokens.html#punctuation
+/// Dispatches on the first character and munches the longest spelling with
+/// the next one or two.
+std::optional<Token> Lexer::lexPunctuation() {
+  auto punctuation = [&](unsigned length, TokenKind kind) {
+    Token token = Token(getLocation(), length, kind);
+    skipN(length);
+    return token;
+  };
+
+  UChar32 second = peek(1);
+  switch (peek()) {
   case ';':
-    return Token(getLocation(), TokenKind::Semi);
+    return punctuation(1, TokenKind::Semi);
   case ',':
-    return Token(getLocation(), TokenKind::Comma);
-  case '.':
-    return Token(getLocation(), TokenKind::Dot);
+    return punctuation(1, TokenKind::Comma);
   case '(':
-    return Token(getLocation(), TokenKind::ParenOpen);
+    return punctuation(1, TokenKind::ParenOpen);
   case ')':
-    return Token(getLocation(), TokenKind::ParenClose);
+    return punctuation(1, TokenKind::ParenClose);
   case '{':
-    return Token(getLocation(), TokenKind::BraceOpen);
+    return punctuation(1, TokenKind::BraceOpen);
   case '}':
-    return Token(getLocation(), TokenKind::BraceClose);
+    return punctuation(1, TokenKind::BraceClose);
   case '[':
-    return Token(getLocation(), TokenKind::SquareOpen);
+    return punctuation(1, TokenKind::SquareOpen);
   case ']':
-    return Token(getLocation(), TokenKind::SquareClose);
+    return punctuation(1, TokenKind::SquareClose);
   case '@':
-    return Token(getLocation(), TokenKind::At);
-  case '#': {
-    return Token(getLocation(), TokenKind::Hash);
+    return punctuation(1, TokenKind::At);
+  case '#':
+    return punctuation(1, TokenKind::Hash);
   case '~':
-    return Token(getLocation(), TokenKind::Tilde);
+    return punctuation(1, TokenKind::Tilde);
   case '?':
-    return Token(getLocation(), TokenKind::QMark);
-  case ':':
-    return Token(getLocation(), TokenKind::Colon);
+    return punctuation(1, TokenKind::QMark);
   case '$':
-    return Token(getLocation(), TokenKind::Dollar);
+    return punctuation(1, TokenKind::Dollar);
+  case '_':
+    return punctuation(1, TokenKind::Underscore);
+  case '.':
+    if (second == '.') {
+      if (peek(2) == '.')
+        return punctuation(3, TokenKind::DotDotDot);
+      if (peek(2) == '=')
+        return punctuation(3, TokenKind::DotDotEq);
+      return punctuation(2, TokenKind::DotDot);
+    }
+    return punctuation(1, TokenKind::Dot);
+  case ':':
+    if (second == ':')
+      return punctuation(2, TokenKind::PathSep);
+    return punctuation(1, TokenKind::Colon);
   case '=':
-    return Token(getLocation(), TokenKind::Eq);
+    if (second == '>')
+      return punctuation(2, TokenKind::FatArrow);
+    if (second == '=')
+      return punctuation(2, TokenKind::EqEq);
+    return punctuation(1, TokenKind::Eq);
   case '!':
-    return Token(getLocation(), TokenKind::Not);
+    if (second == '=')
+      return punctuation(2, TokenKind::Ne);
+    return punctuation(1, TokenKind::Not);
   case '<':
-    return Token(getLocation(), TokenKind::Lt);
+    if (second == '<') {
+      if (peek(2) == '=')
+        return punctuation(3, TokenKind::ShlEq);
+      return punctuation(2, TokenKind::Shl);
+    }
+    if (second == '=')
+      return punctuation(2, TokenKind::Le);
+    return punctuation(1, TokenKind::Lt);
   case '>':
-    return Token(getLocation(), TokenKind::Gt);
+    if (second == '>') {
+      if (peek(2) == '=')
+        return punctuation(3, TokenKind::ShrEq);
+      return punctuation(2, TokenKind::Shr);
+    }
+    if (second == '=')
+      return punctuation(2, TokenKind::Ge);
+    return punctuation(1, TokenKind::Gt);
   case '-':
-    return Token(getLocation(), TokenKind::Minus);
+    if (second == '>')
+      return punctuation(2, TokenKind::RArrow);
+    if (second == '=')
+      return punctuation(2, TokenKind::MinusEq);
+    return punctuation(1, TokenKind::Minus);
   case '&':
-    return Token(getLocation(), TokenKind::And);
+    if (second == '&')
+      return punctuation(2, TokenKind::AndAnd);
+    if (second == '=')
+      return punctuation(2, TokenKind::AndEq);
+    return punctuation(1, TokenKind::And);
   case '|':
-    return Token(getLocation(), TokenKind::Or);
+    if (second == '|')
+      return punctuation(2, TokenKind::OrOr);
+    if (second == '=')
+      return punctuation(2, TokenKind::OrEq);
+    return punctuation(1, TokenKind::Or);
   case '+':
-    return Token(getLocation(), TokenKind::Plus);
+    if (second == '=')
+      return punctuation(2, TokenKind::PlusEq);
+    return punctuation(1, TokenKind::Plus);
   case '*':
-    return Token(getLocation(), TokenKind::Star);
-  case '^':
-    return Token(getLocation(), TokenKind::Caret);
+    if (second == '=')
+      return punctuation(2, TokenKind::StarEq);
+    return punctuation(1, TokenKind::Star);
+  case '/':
+    if (second == '=')
+      return punctuation(2, TokenKind::SlashEq);
+    return punctuation(1, TokenKind::Slash);
   case '%':
-    return Token(getLocation(), TokenKind::Percent);
-
-  // Lifetime or character literal
-  case '\'':
-    return lexLifetimeOrChar();
-
-  // string literal
-  case '\"':
-    return lexStringLiteral();
-
-  // Identifier starting with an emoji.
-  default: {
-    if (!isASCII() && isEmoji())
-      return lexFakeIdentifierOrUnknownPrefix();
-    // Error report
-    llvm::errs() << "unknown token: " << next << "\n";
-    assert(false);
-  }
-  }
+    if (second == '=')
+      return punctuation(2, TokenKind::PercentEq);
+    return punctuation(1, TokenKind::Percent);
+  case '^':
+    if (second == '=')
+      return punctuation(2, TokenKind::CaretEq);
+    return punctuation(1, TokenKind::Caret);
+  default:
+    return std::nullopt;
   }
-  llvm_unreachable("unknown token");
 }
 
 bool Lexer::isIdStart(int i) {
@@ -169,11 +246,11 @@ bool Lexer::isIdContinue(int i) {
 UChar32 Lexer::getUchar(int i) { return peek(i); }
 
 Token Lexer::lexNumericalLiteral() {
-  if (peek() == 'b')
+  if (peek() == '0' && peek(1) == 'b')
     return lexBinLiteral();
-  else if (peek() == 'o')
+  else if (peek() == '0' && peek(1) == 'o')
     return lexOctLiteral();
-  else if (peek() == 'x')
+  else if (peek() == '0' && peek(1) == 'x')
     return lexHexLiteral();
 
   return lexDecOrFloatLiteral();
@@ -187,61 +264,69 @@ Token Lexer::lexDecOrFloatLiteral() {
     skip();
     current = getUchar();
   }
+
+  // 1.0 and 1e5, but not 1..2 or 1.foo()
+  bool isFloat =
+      (current == '.' && peek(1) != '.' && peek(1) != '_' && !isIdStart(1)) ||
+      ((current == 'e' or current == 'E') &&
+       (u_isdigit(peek(1)) ||
+        ((peek(1) == '+' || peek(1) == '-') && u_isdigit(peek(2)))));
   recover(checkpoint);
-  if (current == '.')
+  if (isFloat)
     return lexFloatLiteral();
   return lexDecimalLiteral();
 }
 
 Token Lexer::lexFloatLiteral() {
-  std::string storage;
+  Location loc = getLocation();
+  uint32_t start = offset;
 
   // lex decimal literal
   UChar32 current = getUchar();
   while (u_isdigit(current) or current == '_') {
-    storage += current;
     skip();
     current = getUchar();
   }
 
-  if (current == '.') {
-    storage += '.';
+  if (current == '.' && peek(1) != '.' && !isIdStart(1)) {
+    skip();
+    current = getUchar();
     // after dot
     while (u_isdigit(current) or current == '_') {
-      storage += current;
       skip();
       current = getUchar();
     }
-  } else if (current == 'e' or current == 'E') { // exponent
-    storage += current;
+  }
+
+  if (current == 'e' or current == 'E') { // exponent
     skip();
     current = getUchar();
     if (current == '+' or current == '-') {
-      storage += current;
       skip();
       current = getUchar();
     }
-  } else {
-    // report error
+    while (u_isdigit(current) or current == '_') {
+      skip();
+      current = getUchar();
+    }
   }
 
-  if (checkFloatTypeHint()) {
-  }
-  assert(false);
-}
+  std::string_view literal = getSourceText(start);
+
+  if (std::optional<TypeHint> hint = lexTypeHint())
+    return Token(loc, TokenKind::FLOAT_LITERAL, literal, *hint);
 
-// Token Lexer::lexRawIdentifier() {}
+  return Token(loc, TokenKind::FLOAT_LITERAL, literal);
+}
 
 Token Lexer::lexIdentifierOrKeyWord() {
   Location loc = getLocation();
+  uint32_t start = offset;
 
   UChar32 current = getUchar();
 
-  adt::Utf8String identifier;
-
   // location!!!!!
   if (current == '_') {
-    identifier.append(current);
     skip();
 
     current = getUchar();
@@ -251,60 +336,143 @@ Token Lexer::lexIdentifierOrKeyWord() {
       // report error
     }
 
-    identifier.append(current);
     skip();
-    current = getUchar();
+  } else if (isIdStart()) {
+    skip();
+  } else {
+    llvm::errs() << getLocation().toString()
+                 << ": failed to lex identifier: wrong prefix"
+                 << "\n";
+    exit(EXIT_FAILURE);
+  }
 
-    while (u_hasBinaryProperty(current, UCHAR_XID_CONTINUE)) {
-      identifier.append(current);
-      skip();
-      current = getUchar();
-    } // report EOF!!!
+  lexIdentifierContinue(); // report EOF!!!
+
+  // the spelling is a slice of the buffer; keywords are ASCII
+  std::string_view identifier = getSourceText(start);
+  if (std::optional<KeyWordKind> keyword = isKeyWord(identifier))
+    return Token(loc, *keyword, identifier);
+
+  return Token(loc, TokenKind::Identifier, identifier);
+}
+
+/// XID_Continue*
+void Lexer::lexIdentifierContinue() {
+  UChar32 current = getUchar();
 
-    if (identifier.isASCII()) {
-      if (auto keyword = isKeyWord(identifier.toString()))
-        return Token(loc, *keyword, identifier.toString());
+  while (true) {
+    if (mode == LexerMode::MemoryMappedUtf8) {
+      const char *start = getCurrentByte();
+      skipASCII(scanIdentifierContinue(start, buffer->getBufferEnd()) - start);
+      current = getUchar();
+      if (current < 0x80)
+        return;
     }
 
-    return Token(loc, TokenKind::Identifier, identifier);
-  } else if (isIdStart()) {
-    identifier.append(current);
-    skip();
+    if (!u_hasBinaryProperty(current, UCHAR_XID_CONTINUE))
+      return;
 
+    skip();
     current = getUchar();
-    while (u_hasBinaryProperty(current, UCHAR_XID_CONTINUE)) {
-      identifier.append(current);
-      skip();
-      current = getUchar();
-    } // report EOF!!!
+  }
+}
 
-    if (identifier.isASCII()) {
-      if (auto keyword = isKeyWord(identifier.toString()))
-        return Token(loc, *keyword, identifier.toString());
-    }
+TokenStream Lexer::lex(std::string_view _fileName, LexerMode _mode) {
+  open(_fileName, _mode);
 
-    return Token(loc, TokenKind::Identifier, identifier);
+  TokenStream tokenStream;
+  while (true) {
+    Token token = next();
+    tokenStream.append(token);
+    if (token.getKind() == TokenKind::Eof)
+      return tokenStream;
   }
-  llvm::errs() << getLocation().toString()
-               << ": failed to lex identifier: wrong prefix"
-               << "\n";
-  exit(EXIT_FAILURE);
 }
 
-void Lexer::lex(std::string_view fileName) {
-  UFILE *file = u_fopen(fileName.data(), "r", nullptr, nullptr);
+void Lexer::open(std::string_view _fileName, LexerMode _mode) {
+  fileName = _fileName;
+  mode = _mode;
+
+  switch (mode) {
+  case LexerMode::Utf32:
+    tokens.clear();
+    loadUtf32(fileName);
+    break;
+  case LexerMode::MemoryMappedUtf8:
+    loadMemoryMappedUtf8(fileName);
+    break;
+  }
+
+  offset = 0;
+  lineNumber = 1;
+  columnNumber = 0;
+}
+
+Token Lexer::next() { return advanceToken(); }
 
-  UChar32 token = u_fgetcx(file);
-  tokens.push_back(token);
+/// The file is registered with the SourceManager once, so that the
+/// Locations of the tokens are offsets into it as in MemoryMappedUtf8 mode.
+void Lexer::loadUtf32(std::string_view fileName) {
+  loadMemoryMappedUtf8(fileName);
 
-  while (token != U_EOF) {
-    token = u_fgetcx(file);
-    tokens.push_back(token);
+  const uint8_t *bytes =
+      reinterpret_cast<const uint8_t *>(buffer->getBufferStart());
+  int32_t length = getBufferSize();
+
+  byteOffsets.clear();
+  int32_t i = 0;
+  while (i < length) {
+    byteOffsets.push_back(i);
+    UChar32 c;
+    U8_NEXT(bytes, i, length, c);
+    tokens.push_back(c < 0 ? 0xFFFD : c); // ill-formed sequence
   }
+  byteOffsets.push_back(length);
+  tokens.push_back(U_EOF);
+}
 
-  u_fclose(file);
+void Lexer::loadMemoryMappedUtf8(std::string_view fileName) {
+  basic::SourceManager &sm = basic::getSourceManager();
+  file = sm.loadFile(fileName);
+  buffer = sm.getMemoryBuffer(file);
+  fileStart = sm.getLocation(file, 0).getRawEncoding();
+}
 
-  offset = 0;
+UChar32 Lexer::decodeUtf8(uint32_t pos) const {
+  const uint8_t *bytes =
+      reinterpret_cast<const uint8_t *>(buffer->getBufferStart());
+  int32_t length = getBufferSize();
+
+  if (pos == getBufferSize())
+    return U_EOF;
+
+  // ASCII fast path
+  if (bytes[pos] < 0x80)
+    return bytes[pos];
+
+  UChar32 c;
+  int32_t i = pos;
+  U8_NEXT(bytes, i, length, c);
+  if (c < 0) // ill-formed sequence
+    return 0xFFFD;
+  return c;
+}
+
+uint32_t Lexer::nextUtf8(uint32_t pos) const {
+  const uint8_t *bytes =
+      reinterpret_cast<const uint8_t *>(buffer->getBufferStart());
+  int32_t length = getBufferSize();
+
+  if (pos >= getBufferSize())
+    return pos;
+
+  // ASCII fast path
+  if (bytes[pos] < 0x80)
+    return pos + 1;
+
+  int32_t i = pos;
+  U8_FWD_1(bytes, i, length);
+  return i;
 }
 
 bool Lexer::isWhiteSpace(UChar32 next) {
@@ -314,13 +482,52 @@ bool Lexer::isWhiteSpace(UChar32 next) {
 void Lexer::skipWhiteSpace() {
   UChar32 current = getUchar();
 
-  while (isWhiteSpace(current)) {
+  while (true) {
+    if (mode == LexerMode::MemoryMappedUtf8) {
+      const char *start = getCurrentByte();
+      skipASCII(scanWhiteSpace(start, buffer->getBufferEnd()) - start);
+      current = getUchar();
+      if (current < 0x80)
+        return;
+    }
+
+    if (!isWhiteSpace(current))
+      return;
+
     skip();
     current = getUchar();
   }
 }
 
+void Lexer::skipASCII(uint32_t count) {
+  const char *start = getCurrentByte();
+  const char *stop = start + count;
+
+  while (const char *newLine = static_cast<const char *>(
+             memchr(start, '\n', stop - start))) {
+    ++lineNumber;
+    columnNumber = 0;
+    start = newLine + 1;
+  }
+
+  columnNumber += stop - start;
+  offset += count;
+}
+
 UChar32 Lexer::peek(int i) {
+  if (mode == LexerMode::MemoryMappedUtf8) {
+    uint32_t pos = offset;
+    for (int k = 0; k < i; ++k) {
+      if (pos >= getBufferSize()) {
+        llvm::errs() << "peek beyond end of tokens"
+                     << "\n";
+        exit(EXIT_FAILURE);
+      }
+      pos = nextUtf8(pos);
+    }
+    return decodeUtf8(pos);
+  }
+
   if (offset + i < tokens.size()) {
     return tokens[offset + i];
   } else {
@@ -330,19 +537,39 @@ UChar32 Lexer::peek(int i) {
   }
 }
 
+std::string_view Lexer::getSourceText(uint32_t start) {
+  if (mode == LexerMode::MemoryMappedUtf8)
+    return std::string_view(buffer->getBufferStart() + start, offset - start);
+
+  utf32Text.clear();
+  for (uint32_t i = start; i < offset; ++i) {
+    uint8_t bytes[U8_MAX_LENGTH];
+    int32_t length = 0;
+    U8_APPEND_UNSAFE(bytes, length, tokens[i]);
+    utf32Text.append(reinterpret_cast<const char *>(bytes), length);
+  }
+  return utf32Text;
+}
+
 Location Lexer::getLocation() {
-  return Location(fileName, lineNumber, columnNumber);
+  uint32_t byteOffset =
+      mode == LexerMode::MemoryMappedUtf8 ? offset : byteOffsets[offset];
+  assert(byteOffset <= getBufferSize());
+  return Location::fromRawEncoding(fileStart + byteOffset);
 }
 
 void Lexer::skip() {
   UChar32 current = getUchar();
 
-  if (u_hasBinaryProperty(current, UCHAR_LINE_BREAK)) {
+  if (mode == LexerMode::MemoryMappedUtf8)
+    offset = nextUtf8(offset);
+  else
     ++offset;
+
+  if (current == '\n') {
     ++lineNumber;
     columnNumber = 0;
   } else {
-    ++offset;
     ++columnNumber;
   }
 }
@@ -350,37 +577,32 @@ void Lexer::skip() {
 bool Lexer::isASCII() { return getUchar() < 128; }
 
 Token Lexer::lexByte() {
-  adt::Utf8String byte;
   Location loc = getLocation();
+  uint32_t start = offset;
 
   UChar b = getUchar();
-  if (b != 0062) { // a b
+  if (b != 'b') {
     llvm::errs() << "failed to lex byte"
                  << "\n";
     exit(EXIT_FAILURE);
   }
-  byte.append(b);
   skip();
   b = getUchar();
-  if (b != 0027) { // a single-quote
+  if (b != '\'') {
     llvm::errs() << "failed to lex byte"
                  << "\n";
     exit(EXIT_FAILURE);
   }
-  byte.append(b);
   skip();
   b = getUchar();
   if (b == '\\') { // a slash: BYTE_ESCAPE
-    byte.append(b);
     skip();
     b = getUchar();
-    if (b == 'n' || b == 'r' || b == 'r' || b == '\\' || b == '\'' ||
-        b == '\"') { // not a slash
-      byte.append(b);
+    if (b == 'n' || b == 'r' || b == 't' || b == '\\' || b == '0' ||
+        b == '\'' || b == '\"') { // not a slash
       skip();
       b = getUchar();
     } else if (b == 'x') { // HEX_DIGIT  HEX_DIGIT
-      byte.append(b);
       skip();
       b = getUchar();
       if (!u_hasBinaryProperty(b, UCHAR_ASCII_HEX_DIGIT)) {
@@ -388,7 +610,6 @@ Token Lexer::lexByte() {
                      << "\n";
         exit(EXIT_FAILURE);
       }
-      byte.append(b);
       skip();
       b = getUchar();
       if (!u_hasBinaryProperty(b, UCHAR_ASCII_HEX_DIGIT)) {
@@ -396,7 +617,6 @@ Token Lexer::lexByte() {
                      << "\n";
         exit(EXIT_FAILURE);
       }
-      byte.append(b);
       skip();
       b = getUchar();
     } else {
@@ -406,7 +626,6 @@ Token Lexer::lexByte() {
     }
   } else if (b <= 0x7F && b != '\'' && b != '\\' && b != '\n' && b != '\r' &&
              b != '\t') { // not a slash: ASCII_FOR_CHAR
-    byte.append(b);
     skip();
     b = getUchar();
   } else {
@@ -415,18 +634,16 @@ Token Lexer::lexByte() {
     exit(EXIT_FAILURE);
   }
 
-  if (b != 0027) { // a single-quote
+  if (b != '\'') {
     llvm::errs() << "failed to lex byte"
                  << "\n";
     exit(EXIT_FAILURE);
   }
-
-  byte.append(b); // the terminating '
-  skip();
+  skip(); // the terminating '
 
   // FIXME SUFFIX?
 
-  return Token(loc, TokenKind::BYTE_LITERAL, byte);
+  return Token(loc, TokenKind::BYTE_LITERAL, getSourceText(start));
 }
 
 void Lexer::lineComment() {
@@ -447,18 +664,33 @@ void Lexer::lineComment() {
 
   // found //
   c = getUchar();
-  while (!u_hasBinaryProperty(c, UCHAR_LINE_BREAK)) {
+  while (true) {
+    if (mode == LexerMode::MemoryMappedUtf8) {
+      const char *start = getCurrentByte();
+      skipASCII(scanLineComment(start, buffer->getBufferEnd()) - start);
+      c = getUchar();
+    }
+    if (c == '\n' || c == U_EOF)
+      return;
     skip();
     c = getUchar();
   }
 }
 
 std::optional<UChar32> Lexer::bump() {
-  if (offset + 1 < tokens.size()) {
-    ++offset;
-    return tokens[offset];
+  if (mode == LexerMode::MemoryMappedUtf8) {
+    offset = nextUtf8(offset);
+    if (offset >= getBufferSize())
+      return std::nullopt;
+    return decodeUtf8(offset);
   }
-  return std::nullopt;
+
+  // the last entry of tokens is the U_EOF sentinel
+  if (offset + 1 < tokens.size())
+    ++offset;
+  if (offset + 1 >= tokens.size())
+    return std::nullopt;
+  return tokens[offset];
 }
 
 Token Lexer::lexIntegerLiteral() {
@@ -478,25 +710,30 @@ Token Lexer::lexIntegerLiteral() {
 }
 
 Token Lexer::lexDecimalLiteral() {
-  std::string literal;
   Location loc = getLocation();
+  uint32_t start = offset;
 
   UChar32 current = getUchar();
   while (u_isdigit(current) or current == '_') {
-    literal += current;
     skip();
     current = getUchar();
   }
 
-  if (checkIntegerTypeHint())
-    return Token(loc, TokenKind::INTEGER_LITERAL, literal, getTypeHint());
+  std::string_view literal = getSourceText(start);
 
-  return Token(loc, TokenKind::INTEGER_LITERAL, literal);
+  std::optional<TypeHint> hint = lexTypeHint();
+  if (!hint)
+    return Token(loc, TokenKind::INTEGER_LITERAL, literal);
+
+  // 1f32
+  if (*hint == TypeHint::f32 || *hint == TypeHint::f64)
+    return Token(loc, TokenKind::FLOAT_LITERAL, literal, *hint);
+  return Token(loc, TokenKind::INTEGER_LITERAL, literal, *hint);
 }
 
 Token Lexer::lexBinLiteral() {
-  std::string literal;
   Location loc = getLocation();
+  uint32_t start = offset;
 
   UChar32 current = getUchar();
 
@@ -511,31 +748,32 @@ Token Lexer::lexBinLiteral() {
   }
 
   current = getUchar();
-
   size_t binDigits = 0;
-  while (current == '0' or current == '1' or current == '_') {
-    if (current == '0' or current == '1')
+  while ((current == '0' or current == '1') or current == '_') {
+    if (current != '_')
       ++binDigits;
-    literal += current;
     skip();
     current = getUchar();
   }
 
-  if (binDigits == 0)
+  if (binDigits == 0) {
     llvm::errs() << getLocation().toString()
                  << ": failed to lex bin literal: no bin digits"
                  << "\n";
-  exit(EXIT_FAILURE);
+    exit(EXIT_FAILURE);
+  }
 
-  if (checkIntegerTypeHint())
-    return Token(loc, TokenKind::INTEGER_LITERAL, literal, getTypeHint());
+  std::string_view literal = getSourceText(start);
+
+  if (std::optional<TypeHint> hint = lexTypeHint())
+    return Token(loc, TokenKind::INTEGER_LITERAL, literal, *hint);
 
   return Token(loc, TokenKind::INTEGER_LITERAL, literal);
 }
 
 Token Lexer::lexOctLiteral() {
-  std::string literal;
   Location loc = getLocation();
+  uint32_t start = offset;
 
   UChar32 current = getUchar();
 
@@ -544,7 +782,7 @@ Token Lexer::lexOctLiteral() {
     skip(); // 'o'
   } else {
     llvm::errs() << getLocation().toString()
-                 << ": failed to lex bin literal: wrong prefix"
+                 << ": failed to lex oct literal: wrong prefix"
                  << "\n";
     exit(EXIT_FAILURE);
   }
@@ -552,28 +790,30 @@ Token Lexer::lexOctLiteral() {
   current = getUchar();
   size_t octDigits = 0;
   while ((current >= '0' and current <= '7') or current == '_') {
-    if (current >= '0' and current <= '7')
+    if (current != '_')
       ++octDigits;
-    literal += current;
     skip();
     current = getUchar();
   }
 
-  if (octDigits == 0)
+  if (octDigits == 0) {
     llvm::errs() << getLocation().toString()
-                 << ": failed to lex bin literal: no oct digits"
+                 << ": failed to lex oct literal: no oct digits"
                  << "\n";
-  exit(EXIT_FAILURE);
+    exit(EXIT_FAILURE);
+  }
+
+  std::string_view literal = getSourceText(start);
 
-  if (checkIntegerTypeHint())
-    return Token(loc, TokenKind::INTEGER_LITERAL, literal, getTypeHint());
+  if (std::optional<TypeHint> hint = lexTypeHint())
+    return Token(loc, TokenKind::INTEGER_LITERAL, literal, *hint);
 
   return Token(loc, TokenKind::INTEGER_LITERAL, literal);
 }
 
 Token Lexer::lexHexLiteral() {
-  std::string literal;
   Location loc = getLocation();
+  uint32_t start = offset;
 
   UChar32 current = getUchar();
 
@@ -591,36 +831,36 @@ Token Lexer::lexHexLiteral() {
   size_t hexDigits = 0;
   while (u_hasBinaryProperty(current, UCHAR_ASCII_HEX_DIGIT) or
          current == '_') {
-    if (u_hasBinaryProperty(current, UCHAR_ASCII_HEX_DIGIT))
+    if (current != '_')
       ++hexDigits;
-    literal += current;
     skip();
     current = getUchar();
   }
 
-  if (hexDigits == 0)
+  if (hexDigits == 0) {
     llvm::errs() << getLocation().toString()
                  << ": failed to lex hex literal: no hex digits"
                  << "\n";
-  exit(EXIT_FAILURE);
+    exit(EXIT_FAILURE);
+  }
+
+  std::string_view literal = getSourceText(start);
 
-  if (checkIntegerTypeHint())
-    return Token(loc, TokenKind::INTEGER_LITERAL, literal, getTypeHint());
+  if (std::optional<TypeHint> hint = lexTypeHint())
+    return Token(loc, TokenKind::INTEGER_LITERAL, literal, *hint);
 
   return Token(loc, TokenKind::INTEGER_LITERAL, literal);
 }
 
 Token Lexer::lexByteString() {
   Location loc = getLocation();
+  uint32_t start = offset;
 
   UChar32 current = getUchar();
-  Utf8String literal;
 
   if (current == 'b' && peek(1) == '"') {
     skip(); // 'b'
-    literal.append('b');
     skip(); // '"'
-    literal.append('"');
   } else {
     llvm::errs() << getLocation().toString()
                  << ": failed to lex byte string literal: wrong prefix"
@@ -628,40 +868,28 @@ Token Lexer::lexByteString() {
     exit(EXIT_FAILURE);
   }
 
-  bool byteStringContinue = true;
-  while (byteStringContinue) {
-    if (isASCIIForString(current, peek(1))) {
-      literal.append(current);
-      skip();
-      current = getUchar();
-      byteStringContinue = true;
-    } else if (isByteEscape()) {
-      byteStringContinue = true;
-      current = getUchar();
+  current = getUchar();
+  while (current != '"') {
+    if (isByteEscape()) {
+      skipN(peek(1) == 'x' ? 4 : 2);
     } else if (isStringContinue()) {
-      byteStringContinue = true;
-      current = getUchar();
-    } else if (current == '"') {
-      literal.append('"');
+      skipN(2);
+    } else if (isASCIIForString(current, peek(1))) {
       skip();
-      byteStringContinue = false;
-      current = getUchar();
     } else {
       llvm::errs() << getLocation().toString()
                    << ": failed to lex byte string literal: wrong postfix"
                    << "\n";
       exit(EXIT_FAILURE);
     }
+    current = getUchar();
   }
+  skip(); // '"'
 
-  if (checkSuffix()) {
-    adt::Utf8String suffix = lexSuffixToUtf8();
+  if (checkSuffix())
+    lexSuffixToUtf8();
 
-    literal += suffix;
-    return Token(loc, TokenKind::BYTE_STRING_LITERAL, literal);
-  }
-
-  return Token(loc, TokenKind::BYTE_STRING_LITERAL, literal);
+  return Token(loc, TokenKind::BYTE_STRING_LITERAL, getSourceText(start));
 }
 
 bool Lexer::isASCIIForString(UChar32 current, UChar32 next) {
@@ -682,8 +910,7 @@ bool Lexer::checkSuffix() {
 
 Token Lexer::lexStringLiteral() {
   Location loc = getLocation();
-
-  adt::Utf8String literal;
+  uint32_t start = offset;
 
   UChar32 current = getUchar();
 
@@ -695,30 +922,34 @@ Token Lexer::lexStringLiteral() {
   }
 
   skip(); // "
-  literal.append('"');
-  current = getUchar();
 
   while (true) {
+    if (mode == LexerMode::MemoryMappedUtf8) {
+      // only quotes and escapes end a run of the string
+      std::string_view rest(getCurrentByte(),
+                            buffer->getBufferEnd() - getCurrentByte());
+      skipASCII(std::min(rest.find_first_of("\"\\"), rest.size()));
+    }
+
     current = getUchar();
     if (current == '"') {
       // done
-      literal.append('"');
       skip();
-      if (checkSuffix()) {
-        adt::Utf8String suffix = lexSuffixToUtf8();
-
-        literal += suffix;
-      }
-      return Token(loc, TokenKind::STRING_LITERAL, literal);
-    } else if (current == '\\' && (peek(1) == '\\' || peek(1) == '"')) {
-      // escape char;
-      literal.append('\\');
+      if (checkSuffix())
+        lexSuffixToUtf8();
+      return Token(loc, TokenKind::STRING_LITERAL, getSourceText(start));
+    } else if (current == U_EOF) {
+      llvm::errs() << loc.toString()
+                   << ": failed to lex string literal: unterminated"
+                   << "\n";
+      exit(EXIT_FAILURE);
+    } else if (current == '\\') {
+      // escape: the backslash and the escaped code point
       skip();
-      current = getUchar();
+      if (getUchar() != U_EOF)
+        skip();
     } else {
-      literal.append(current);
       skip();
-      current = getUchar();
     }
   }
 }
@@ -755,7 +986,6 @@ Token Lexer::lexLifetimeToken() {
   skip();
 
   Utf8String label = getIdentifierOrKeyWord();
-  skipN(label.getLength());
 
   storage += label;
   return Token(loc, TokenKind::LIFETIME_TOKEN, storage);
@@ -778,7 +1008,6 @@ Token Lexer::lexLifetimeOrLabel() {
   skip();
 
   Utf8String label = getNonKeyWordIdentifier();
-  skipN(label.getLength());
 
   storage += label;
   return Token(loc, TokenKind::LIFETIME_OR_LABEL, storage);
@@ -826,7 +1055,7 @@ bool Lexer::isQuoteEscape() {
 }
 
 Token Lexer::lexRawIdentifier() {
-  Location loc;
+  Location loc = getLocation();
 
   UChar32 current = getUchar();
   if (current != 'r' || peek(1) != '#') {
@@ -847,7 +1076,7 @@ Token Lexer::lexRawIdentifier() {
     storage.append(current);
     skip();
     while (isIdContinue()) {
-      storage.append(current);
+      storage.append(getUchar());
       skip();
     }
     if (storage.isEqualASCII("crate") || storage.isEqualASCII("self") ||
@@ -863,7 +1092,7 @@ Token Lexer::lexRawIdentifier() {
     storage.append(current);
     skip();
     while (isIdContinue()) {
-      storage.append(current);
+      storage.append(getUchar());
       skip();
     }
     if (storage.isEqualASCII("crate") || storage.isEqualASCII("self") ||
@@ -1060,82 +1289,98 @@ Token Lexer::lexLifetime() {
 
 Token Lexer::lexRawDoubleQuotedString() {
   Location loc = getLocation();
-  Utf8String storage;
-  UChar32 current = getUchar();
+  uint32_t start = offset;
+  TokenKind kind = TokenKind::RAW_STRING_LITERAL;
 
-  if (current != 'b' || peek(1) != 'r') {
+  if (getUchar() == 'b') {
+    kind = TokenKind::RAW_BYTE_STRING_LITERAL;
+    skip();
+  }
+
+  if (getUchar() != 'r') {
     llvm::errs() << getLocation().toString()
-                 << ": failed to lex  raw byte string literal: wrong prefix"
+                 << ": failed to lex raw string literal: wrong prefix"
                  << "\n";
     exit(EXIT_FAILURE);
   }
-
-  // storage.append('b');
-  // storage.append('r');
   skip();
-  skip();
-
-  current = getUchar();
-
-  Utf8String rawString = getRawByteStringContent();
 
-  llvm::errs() << getLocation().toString()
-               << ": failed to lex  raw byte string literal: wrong prefix"
-               << "\n";
-  exit(EXIT_FAILURE);
-}
-
-adt::Utf8String Lexer::getRawByteStringContent() {
-  Utf8String storage;
-  UChar32 current = getUchar();
-  if (current == '"') {
+  unsigned hashes = 0;
+  while (getUchar() == '#') {
+    ++hashes;
     skip();
-    current = getUchar();
-    while (current < 128 && current != '"') {
-      storage.append(current);
-      skip();
-      current = getUchar();
-    }
+  }
 
-    if (current == '"') {
-      skip();
-      return storage;
-    }
+  if (getUchar() != '"') {
     llvm::errs() << getLocation().toString()
-                 << ": failed to lex  raw byte string content: wrong postfix"
+                 << ": failed to lex raw string literal: wrong prefix"
                  << "\n";
     exit(EXIT_FAILURE);
+  }
+  skip();
 
-  } else if (current == '#') {
-    skip();
-    storage = getRawByteStringContent();
-    current = getUchar();
-    if (current != '#') {
+  // the first quote that is followed by as many hashes as the opening
+  while (true) {
+    UChar32 current = getUchar();
+    if (current == U_EOF) {
+      llvm::errs() << loc.toString()
+                   << ": failed to lex raw string literal: unterminated"
+                   << "\n";
+      exit(EXIT_FAILURE);
+    }
+    if (kind == TokenKind::RAW_BYTE_STRING_LITERAL && current > 0x7F) {
       llvm::errs() << getLocation().toString()
-                   << ": failed to lex  raw byte string content: wrong postfix"
+                   << ": failed to lex raw byte string literal: not ASCII"
                    << "\n";
       exit(EXIT_FAILURE);
     }
-    return storage;
+    skip();
+    if (current != '"')
+      continue;
+
+    unsigned closing = 0;
+    while (closing < hashes && getUchar() == '#') {
+      ++closing;
+      skip();
+    }
+    if (closing == hashes)
+      break;
   }
-  llvm::errs() << getLocation().toString()
-               << ": failed to lex  raw byte string content: wrong prefix"
-               << "\n";
-  exit(EXIT_FAILURE);
+
+  if (checkSuffix())
+    lexSuffixToUtf8();
+
+  return Token(loc, kind, getSourceText(start));
 }
 
 Token Lexer::lexChar() {
   Location loc = getLocation();
-  Utf8String literal;
+  uint32_t start = offset;
 
   UChar32 current = getUchar();
 
   if (current == '\'' && peek(1) != '\\' && peek(2) == '\'') {
-    literal.append(current);
-    literal.append(peek(1));
-    literal.append(peek(2));
+    skipN(3);
+    return Token(loc, TokenKind::CHAR_LITERAL, getSourceText(start));
+  }
 
-    return Token(loc, TokenKind::CHAR_LITERAL, literal);
+  // '\n', '\'', '\x7F', or '\u{1F600}'
+  if (current == '\'' && peek(1) == '\\') {
+    skipN(2);
+    current = getUchar();
+    // the escaped character, which may be a quote
+    if (current != '\n' && current != U_EOF) {
+      skip();
+      current = getUchar();
+    }
+    while (current != '\'' && current != '\n' && current != U_EOF) {
+      skip();
+      current = getUchar();
+    }
+    if (current == '\'') {
+      skip();
+      return Token(loc, TokenKind::CHAR_LITERAL, getSourceText(start));
+    }
   }
   llvm::errs() << getLocation().toString()
                << ": failed to lex char content: wrong prefix"
@@ -1234,16 +1479,30 @@ void Lexer::blockComment() {
 
   size_t depth = 1;
   while (true) {
-    if (current == '/' && peek(1) == '*') {
-      skip();
+    if (mode == LexerMode::MemoryMappedUtf8) {
+      const char *start = getCurrentByte();
+      skipASCII(scanBlockComment(start, buffer->getBufferEnd()) - start);
+      current = getUchar();
+    }
+
+    if (current == U_EOF) {
+      llvm::errs() << loc.toString()
+                   << ": failed to lex block comment: unterminated"
+                   << "\n";
+      exit(EXIT_FAILURE);
+    } else if (current == '/' && peek(1) == '*') {
+      skipN(2);
       current = getUchar();
       ++depth;
     } else if (current == '*' && peek(1) == '/') {
-      skip();
+      skipN(2);
       current = getUchar();
       --depth;
       if (depth == 0)
         break;
+    } else {
+      skip();
+      current = getUchar();
     }
   }
 }
@@ -1266,6 +1525,9 @@ bool Lexer::checkIntegerTypeHint() {
 
     if (peek(1) == '1' && peek(2) == '2' && peek(3) == '8')
       return true;
+
+    if (peek(1) == 's' && peek(2) == 'i' && peek(3) == 'z' && peek(4) == 'e')
+      return true;
   }
 
   return false;
@@ -1301,6 +1563,9 @@ TypeHint Lexer::getTypeHint() {
 
     if (peek(1) == '1' && peek(2) == '2' && peek(3) == '8')
       return TypeHint::i128;
+
+    if (peek(1) == 's' && peek(2) == 'i' && peek(3) == 'z' && peek(4) == 'e')
+      return TypeHint::isize;
   }
 
   if (current == 'u') {
@@ -1318,6 +1583,9 @@ TypeHint Lexer::getTypeHint() {
 
     if (peek(1) == '1' && peek(2) == '2' && peek(3) == '8')
       return TypeHint::u128;
+
+    if (peek(1) == 's' && peek(2) == 'i' && peek(3) == 'z' && peek(4) == 'e')
+      return TypeHint::usize;
   }
 
   if (current == 'f' && peek(1) == '3' && peek(2) == '2')
@@ -1331,6 +1599,31 @@ TypeHint Lexer::getTypeHint() {
   exit(EXIT_FAILURE);
 }
 
+std::optional<TypeHint> Lexer::lexTypeHint() {
+  if (!checkIntegerTypeHint() && !checkFloatTypeHint())
+    return std::nullopt;
+
+  TypeHint hint = getTypeHint();
+  switch (hint) {
+  case TypeHint::u8:
+  case TypeHint::i8:
+    skipN(2);
+    break;
+  case TypeHint::u128:
+  case TypeHint::i128:
+    skipN(4);
+    break;
+  case TypeHint::usize:
+  case TypeHint::isize:
+    skipN(5);
+    break;
+  default:
+    skipN(3);
+    break;
+  }
+  return hint;
+}
+
 adt::Utf8String Lexer::getNonKeyWordIdentifier() {
   Utf8String identifier;
   UChar32 current = getUchar();
@@ -0,0 +1,252 @@
+#include "Lexer/Literal.h"
+
+#include "Lexer/Interner.h"
+#include "LiteralCache.h"
+
+#include <llvm/ADT/StringRef.h>
+
+#include <limits>
+#include <unicode/utf8.h>
+
+namespace rust_compiler::lexer {
+
+namespace {
+
+std::optional<unsigned> getDigitValue(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return std::nullopt;
+}
+
+/// The text between the quotes of a literal.
+struct Contents {
+  std::string_view text;
+  bool isRaw;
+  bool isByte;
+};
+
+/// Strips the prefix, the quotes, and the suffix of spelling.
+std::optional<Contents> getContents(std::string_view spelling) {
+  Contents contents = {spelling, false, false};
+  if (spelling.starts_with('b')) {
+    contents.isByte = true;
+    spelling.remove_prefix(1);
+  }
+  if (spelling.starts_with('r')) {
+    contents.isRaw = true;
+    spelling.remove_prefix(1);
+  }
+
+  if (contents.isRaw) {
+    // r#"..."#: the first quote followed by as many hashes as the opening
+    size_t hashes = spelling.find('"');
+    if (hashes == std::string_view::npos)
+      return std::nullopt;
+    std::string closing = '"' + std::string(hashes, '#');
+    size_t end = spelling.find(closing, hashes + 1);
+    if (end == std::string_view::npos)
+      return std::nullopt;
+    contents.text = spelling.substr(hashes + 1, end - hashes - 1);
+    return contents;
+  }
+
+  if (spelling.empty() || (spelling[0] != '"' && spelling[0] != '\''))
+    return std::nullopt;
+  char quote = spelling[0];
+  for (size_t i = 1; i < spelling.size(); ++i) {
+    if (spelling[i] == '\\') {
+      ++i;
+    } else if (spelling[i] == quote) {
+      contents.text = spelling.substr(1, i - 1);
+      return contents;
+    }
+  }
+  return std::nullopt;
+}
+
+void appendUtf8(std::string &out, UChar32 c) {
+  uint8_t buffer[U8_MAX_LENGTH];
+  int32_t length = 0;
+  U8_APPEND_UNSAFE(buffer, length, c);
+  out.append(reinterpret_cast<const char *>(buffer), length);
+}
+
+/// https://doc.rust-lang.org/reference/tokens.html#escapes
+std::optional<std::string> expandEscapes(std::string_view text,
+                                         bool isByte) {
+  std::string result;
+  result.reserve(text.size());
+
+  while (!text.empty()) {
+    size_t backslash = text.find('\\');
+    result.append(text.substr(0, backslash));
+    if (backslash == std::string_view::npos)
+      return result;
+
+    text.remove_prefix(backslash + 1);
+    if (text.empty())
+      return std::nullopt;
+
+    char escape = text[0];
+    text.remove_prefix(1);
+    switch (escape) {
+    case 'n':
+      result += '\n';
+      break;
+    case 'r':
+      result += '\r';
+      break;
+    case 't':
+      result += '\t';
+      break;
+    case '\\':
+    case '\'':
+    case '"':
+      result += escape;
+      break;
+    case '0':
+      result += '\0';
+      break;
+    case 'x': {
+      // \x7F; bytes may use the full range
+      if (text.size() < 2)
+        return std::nullopt;
+      std::optional<unsigned> high = getDigitValue(text[0]);
+      std::optional<unsigned> low = getDigitValue(text[1]);
+      if (!high || !low || *high > (isByte ? 0xF : 0x7))
+        return std::nullopt;
+      result += static_cast<char>(*high * 16 + *low);
+      text.remove_prefix(2);
+      break;
+    }
+    case 'u': {
+      // \u{1F600}
+      if (isByte || !text.starts_with('{'))
+        return std::nullopt;
+      size_t close = text.find('}');
+      if (close == std::string_view::npos)
+        return std::nullopt;
+      UChar32 c = 0;
+      unsigned digits = 0;
+      for (char d : text.substr(1, close - 1)) {
+        if (d == '_')
+          continue;
+        std::optional<unsigned> value = getDigitValue(d);
+        if (!value || ++digits > 6)
+          return std::nullopt;
+        c = c * 16 + *value;
+      }
+      if (digits == 0 || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+        return std::nullopt;
+      appendUtf8(result, c);
+      text.remove_prefix(close + 1);
+      break;
+    }
+    case '\n': {
+      // string continuation: skip the line break and the leading whitespace
+      size_t next = text.find_first_not_of(" \t\n\r");
+      text.remove_prefix(next == std::string_view::npos ? text.size()
+                                                        : next);
+      break;
+    }
+    default:
+      return std::nullopt;
+    }
+  }
+
+  return result;
+}
+
+} // namespace
+
+std::optional<uint128_t> parseIntegerLiteral(std::string_view spelling) {
+  unsigned radix = 10;
+  if (spelling.starts_with("0x"))
+    radix = 16;
+  else if (spelling.starts_with("0o"))
+    radix = 8;
+  else if (spelling.starts_with("0b"))
+    radix = 2;
+  if (radix != 10)
+    spelling.remove_prefix(2);
+
+  constexpr uint128_t max = std::numeric_limits<uint128_t>::max();
+  uint128_t value = 0;
+  bool hasDigits = false;
+  for (char c : spelling) {
+    if (c == '_')
+      continue;
+    std::optional<unsigned> digit = getDigitValue(c);
+    if (!digit || *digit >= radix)
+      return std::nullopt;
+    if (value > (max - *digit) / radix)
+      return std::nullopt;
+    value = value * radix + *digit;
+    hasDigits = true;
+  }
+
+  if (!hasDigits)
+    return std::nullopt;
+  return value;
+}
+
+std::optional<uint128_t> getDecodedIntegerLiteral(uint32_t id) {
+  Interner &interner = getInterner();
+  LiteralCache &cache = interner.getLiteralCache();
+  if (std::optional<std::optional<uint128_t>> cached =
+          cache.lookupInteger(id))
+    return *cached;
+
+  std::optional<uint128_t> value = parseIntegerLiteral(interner.lookup(id));
+  cache.insertInteger(id, value);
+  return value;
+}
+
+std::optional<double> parseFloatLiteral(std::string_view spelling) {
+  std::string digits;
+  digits.reserve(spelling.size());
+  for (char c : spelling)
+    if (c != '_')
+      digits += c;
+
+  double value;
+  if (llvm::StringRef(digits).getAsDouble(value))
+    return std::nullopt;
+  return value;
+}
+
+std::optional<std::string> decodeStringLiteral(std::string_view spelling) {
+  std::optional<Contents> contents = getContents(spelling);
+  if (!contents)
+    return std::nullopt;
+  if (contents->isRaw)
+    return std::string(contents->text);
+  return expandEscapes(contents->text, contents->isByte);
+}
+
+std::optional<std::string_view> getDecodedStringLiteral(uint32_t id) {
+  std::optional<Contents> contents =
+      getContents(getInterner().lookup(id));
+  if (!contents)
+    return std::nullopt;
+
+  // the interned spelling outlives the token
+  if (contents->isRaw || contents->text.find('\\') == std::string_view::npos)
+    return contents->text;
+
+  LiteralCache &cache = getInterner().getLiteralCache();
+  if (std::optional<std::string_view> cached = cache.lookupString(id))
+    return *cached;
+
+  std::optional<std::string> decoded =
+      expandEscapes(contents->text, contents->isByte);
+  if (!decoded)
+    return std::nullopt;
+  return cache.insertString(id, *decoded);
+}
+
+} // namespace rust_compiler::lexer
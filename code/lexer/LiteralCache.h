@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Lexer/Literal.h"
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/Allocator.h>
+#include <llvm/Support/StringSaver.h>
+
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+
+namespace rust_compiler::lexer {
+
+/// The values decoded from the literals of one Interner, indexed by its
+/// ids. It lives and dies with the Interner.
+class LiteralCache {
+  std::shared_mutex mutex;
+  /// the decoded literals with escapes
+  llvm::DenseMap<uint32_t, std::string_view> strings;
+  llvm::BumpPtrAllocator allocator;
+  llvm::StringSaver saver = llvm::StringSaver(allocator);
+  /// the values of integer literals; nullopt for literals that do not fit
+  /// into 128 bits
+  llvm::DenseMap<uint32_t, std::optional<uint128_t>> integers;
+
+public:
+  std::optional<std::string_view> lookupString(uint32_t id) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = strings.find(id);
+    if (it == strings.end())
+      return std::nullopt;
+    return it->second;
+  }
+
+  std::string_view insertString(uint32_t id, std::string_view value) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto [it, inserted] = strings.try_emplace(id);
+    if (inserted)
+      it->second = saver.save(llvm::StringRef(value.data(), value.size()));
+    return it->second;
+  }
+
+  std::optional<std::optional<uint128_t>> lookupInteger(uint32_t id) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = integers.find(id);
+    if (it == integers.end())
+      return std::nullopt;
+    return it->second;
+  }
+
+  void insertInteger(uint32_t id, std::optional<uint128_t> value) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    integers.try_emplace(id, value);
+  }
+};
+
+} // namespace rust_compiler::lexer
@@ -0,0 +1,310 @@
+#include "Lexer/ScanKernels.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define RUST_COMPILER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace rust_compiler::lexer {
+
+namespace {
+
+/// The scalar kernels are the reference implementation and handle the tails
+/// of the vectorized kernels.
+
+inline bool isASCIIWhiteSpace(uint8_t c) {
+  return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+inline bool isASCIIIdentifierContinue(uint8_t c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9') || c == '_';
+}
+
+const char *scanWhiteSpaceScalar(const char *begin, const char *end) {
+  while (begin != end && isASCIIWhiteSpace(*begin))
+    ++begin;
+  return begin;
+}
+
+const char *scanLineCommentScalar(const char *begin, const char *end) {
+  while (begin != end && *begin != '\n' &&
+         static_cast<uint8_t>(*begin) < 0x80)
+    ++begin;
+  return begin;
+}
+
+const char *scanBlockCommentScalar(const char *begin, const char *end) {
+  while (begin != end && *begin != '*' && *begin != '/' &&
+         static_cast<uint8_t>(*begin) < 0x80)
+    ++begin;
+  return begin;
+}
+
+const char *scanIdentifierContinueScalar(const char *begin, const char *end) {
+  while (begin != end && isASCIIIdentifierContinue(*begin))
+    ++begin;
+  return begin;
+}
+
+#ifdef RUST_COMPILER_X86
+
+/// The SSE2 and AVX2 kernels compute, per block, a bit mask of the bytes
+/// that stop the scan. movemask also sets the bits of all bytes >= 0x80.
+
+__attribute__((target("sse2"))) inline __m128i
+isInRangeSSE2(__m128i chunk, char low, char width) {
+  // unsigned (chunk - low) <= width
+  __m128i sub = _mm_sub_epi8(chunk, _mm_set1_epi8(low));
+  return _mm_cmpeq_epi8(_mm_min_epu8(sub, _mm_set1_epi8(width)), sub);
+}
+
+template <typename StopMask>
+__attribute__((target("sse2"))) inline const char *
+scanSSE2(const char *begin, const char *end, StopMask stopMask,
+         const char *(*tail)(const char *, const char *)) {
+  while (end - begin >= 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+    uint32_t mask = stopMask(chunk);
+    if (mask != 0)
+      return begin + __builtin_ctz(mask);
+    begin += 16;
+  }
+  return tail(begin, end);
+}
+
+struct WhiteSpaceStopSSE2 {
+  __attribute__((target("sse2"))) uint32_t operator()(__m128i chunk) const {
+    __m128i ws = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                              isInRangeSSE2(chunk, '\t', '\r' - '\t'));
+    return static_cast<uint32_t>(_mm_movemask_epi8(ws)) ^ 0xFFFF;
+  }
+};
+
+__attribute__((target("sse2"))) const char *
+scanWhiteSpaceSSE2(const char *begin, const char *end) {
+  return scanSSE2(begin, end, WhiteSpaceStopSSE2(), scanWhiteSpaceScalar);
+}
+
+struct LineCommentStopSSE2 {
+  __attribute__((target("sse2"))) uint32_t operator()(__m128i chunk) const {
+    __m128i nl = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'));
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_or_si128(nl, chunk)));
+  }
+};
+
+__attribute__((target("sse2"))) const char *
+scanLineCommentSSE2(const char *begin, const char *end) {
+  return scanSSE2(begin, end, LineCommentStopSSE2(), scanLineCommentScalar);
+}
+
+struct BlockCommentStopSSE2 {
+  __attribute__((target("sse2"))) uint32_t operator()(__m128i chunk) const {
+    __m128i star = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('*'));
+    __m128i slash = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('/'));
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(star, slash), chunk)));
+  }
+};
+
+__attribute__((target("sse2"))) const char *
+scanBlockCommentSSE2(const char *begin, const char *end) {
+  return scanSSE2(begin, end, BlockCommentStopSSE2(), scanBlockCommentScalar);
+}
+
+struct IdentifierContinueStopSSE2 {
+  __attribute__((target("sse2"))) uint32_t operator()(__m128i chunk) const {
+    __m128i lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+    __m128i ident = _mm_or_si128(
+        _mm_or_si128(isInRangeSSE2(lower, 'a', 'z' - 'a'),
+                     isInRangeSSE2(chunk, '0', '9' - '0')),
+        _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')));
+    return static_cast<uint32_t>(_mm_movemask_epi8(ident)) ^ 0xFFFF;
+  }
+};
+
+__attribute__((target("sse2"))) const char *
+scanIdentifierContinueSSE2(const char *begin, const char *end) {
+  return scanSSE2(begin, end, IdentifierContinueStopSSE2(),
+                  scanIdentifierContinueScalar);
+}
+
+__attribute__((target("avx2"))) inline __m256i
+isInRangeAVX2(__m256i chunk, char low, char width) {
+  // unsigned (chunk - low) <= width
+  __m256i sub = _mm256_sub_epi8(chunk, _mm256_set1_epi8(low));
+  return _mm256_cmpeq_epi8(_mm256_min_epu8(sub, _mm256_set1_epi8(width)), sub);
+}
+
+template <typename StopMask>
+__attribute__((target("avx2"))) inline const char *
+scanAVX2(const char *begin, const char *end, StopMask stopMask,
+         const char *(*tail)(const char *, const char *)) {
+  while (end - begin >= 32) {
+    __m256i chunk =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin));
+    uint32_t mask = stopMask(chunk);
+    if (mask != 0)
+      return begin + __builtin_ctz(mask);
+    begin += 32;
+  }
+  return tail(begin, end);
+}
+
+struct WhiteSpaceStopAVX2 {
+  __attribute__((target("avx2"))) uint32_t operator()(__m256i chunk) const {
+    __m256i ws =
+        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')),
+                        isInRangeAVX2(chunk, '\t', '\r' - '\t'));
+    return ~static_cast<uint32_t>(_mm256_movemask_epi8(ws));
+  }
+};
+
+__attribute__((target("avx2"))) const char *
+scanWhiteSpaceAVX2(const char *begin, const char *end) {
+  return scanAVX2(begin, end, WhiteSpaceStopAVX2(), scanWhiteSpaceSSE2);
+}
+
+struct LineCommentStopAVX2 {
+  __attribute__((target("avx2"))) uint32_t operator()(__m256i chunk) const {
+    __m256i nl = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n'));
+    return static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_or_si256(nl, chunk)));
+  }
+};
+
+__attribute__((target("avx2"))) const char *
+scanLineCommentAVX2(const char *begin, const char *end) {
+  return scanAVX2(begin, end, LineCommentStopAVX2(), scanLineCommentSSE2);
+}
+
+struct BlockCommentStopAVX2 {
+  __attribute__((target("avx2"))) uint32_t operator()(__m256i chunk) const {
+    __m256i star = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('*'));
+    __m256i slash = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('/'));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_or_si256(_mm256_or_si256(star, slash), chunk)));
+  }
+};
+
+__attribute__((target("avx2"))) const char *
+scanBlockCommentAVX2(const char *begin, const char *end) {
+  return scanAVX2(begin, end, BlockCommentStopAVX2(), scanBlockCommentSSE2);
+}
+
+struct IdentifierContinueStopAVX2 {
+  __attribute__((target("avx2"))) uint32_t operator()(__m256i chunk) const {
+    __m256i lower = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+    __m256i ident = _mm256_or_si256(
+        _mm256_or_si256(isInRangeAVX2(lower, 'a', 'z' - 'a'),
+                        isInRangeAVX2(chunk, '0', '9' - '0')),
+        _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('_')));
+    return ~static_cast<uint32_t>(_mm256_movemask_epi8(ident));
+  }
+};
+
+__attribute__((target("avx2"))) const char *
+scanIdentifierContinueAVX2(const char *begin, const char *end) {
+  return scanAVX2(begin, end, IdentifierContinueStopAVX2(),
+                  scanIdentifierContinueSSE2);
+}
+
+#endif
+
+using ScanKernel = const char *(*)(const char *, const char *);
+
+struct ScanKernels {
+  ScanKernel whiteSpace;
+  ScanKernel lineComment;
+  ScanKernel blockComment;
+  ScanKernel identifierContinue;
+};
+
+/// indexed by ScanKernelISA
+const ScanKernels Kernels[] = {
+    {scanWhiteSpaceScalar, scanLineCommentScalar, scanBlockCommentScalar,
+     scanIdentifierContinueScalar},
+#ifdef RUST_COMPILER_X86
+    {scanWhiteSpaceSSE2, scanLineCommentSSE2, scanBlockCommentSSE2,
+     scanIdentifierContinueSSE2},
+    {scanWhiteSpaceAVX2, scanLineCommentAVX2, scanBlockCommentAVX2,
+     scanIdentifierContinueAVX2},
+#endif
+};
+
+bool isSupported(ScanKernelISA isa) {
+  switch (isa) {
+  case ScanKernelISA::Scalar:
+    return true;
+#ifdef RUST_COMPILER_X86
+  case ScanKernelISA::SSE2:
+    return __builtin_cpu_supports("sse2");
+  case ScanKernelISA::AVX2:
+    return __builtin_cpu_supports("avx2");
+#else
+  case ScanKernelISA::SSE2:
+  case ScanKernelISA::AVX2:
+    return false;
+#endif
+  }
+  return false;
+}
+
+ScanKernelISA detectISA() {
+#ifdef RUST_COMPILER_X86
+  __builtin_cpu_init();
+#endif
+  if (isSupported(ScanKernelISA::AVX2))
+    return ScanKernelISA::AVX2;
+  if (isSupported(ScanKernelISA::SSE2))
+    return ScanKernelISA::SSE2;
+  return ScanKernelISA::Scalar;
+}
+
+ScanKernelISA currentISA = detectISA();
+const ScanKernels *current = &Kernels[static_cast<unsigned>(currentISA)];
+
+} // namespace
+
+const char *scanWhiteSpace(const char *begin, const char *end) {
+  return current->whiteSpace(begin, end);
+}
+
+const char *scanLineComment(const char *begin, const char *end) {
+  return current->lineComment(begin, end);
+}
+
+const char *scanBlockComment(const char *begin, const char *end) {
+  return current->blockComment(begin, end);
+}
+
+const char *scanIdentifierContinue(const char *begin, const char *end) {
+  return current->identifierContinue(begin, end);
+}
+
+ScanKernelISA getScanKernelISA() { return currentISA; }
+
+bool setScanKernelISA(ScanKernelISA isa) {
+  if (!isSupported(isa))
+    return false;
+  currentISA = isa;
+  current = &Kernels[static_cast<unsigned>(isa)];
+  return true;
+}
+
+std::string_view ScanKernelISA2String(ScanKernelISA isa) {
+  switch (isa) {
+  case ScanKernelISA::Scalar:
+    return "scalar";
+  case ScanKernelISA::SSE2:
+    return "sse2";
+  case ScanKernelISA::AVX2:
+    return "avx2";
+  }
+  return "unknown";
+}
+
+} // namespace rust_compiler::lexer
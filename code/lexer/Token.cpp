@@ -1,21 +1,63 @@
 #include "Lexer/Token.h"
 
 #include "Lexer/KeyWords.h"
+#include "Lexer/Literal.h"
+
+#include <unicode/utf8.h>
 
 namespace rust_compiler::lexer {
 
+static std::string encodeUtf8(const adt::Utf8String &id) {
+  std::string result;
+  for (UChar32 c : id.getCodePoints()) {
+    uint8_t buffer[U8_MAX_LENGTH];
+    int32_t length = 0;
+    U8_APPEND_UNSAFE(buffer, length, c);
+    result.append(reinterpret_cast<const char *>(buffer), length);
+  }
+  return result;
+}
+
+Token::Token(rust_compiler::Location loc, TokenKind tk,
+             const adt::Utf8String &id)
+    : Token(loc, tk, encodeUtf8(id)) {}
+
+adt::Utf8String Token::getUtf8Storage() const {
+  std::string_view spelling = getSpelling();
+  adt::Utf8String result;
+  int32_t offset = 0;
+  while (offset < static_cast<int32_t>(spelling.size())) {
+    UChar32 c;
+    U8_NEXT(spelling.data(), offset, spelling.size(), c);
+    result.append(c < 0 ? 0xFFFD : c);
+  }
+  return result;
+}
+
+std::optional<uint128_t> Token::getIntegerValue() const {
+  return getDecodedIntegerLiteral(value);
+}
+
+std::optional<double> Token::getFloatValue() const {
+  return parseFloatLiteral(getSpelling());
+}
+
+std::optional<std::string_view> Token::getStringValue() const {
+  return getDecodedStringLiteral(value);
+}
+
 bool Token::isUseToken() const {
-  return kind == TokenKind::Keyword && storage == "use";
+  return kind == TokenKind::Keyword && getSpelling() == "use";
 }
 
 bool Token::isPubToken() const {
-  return kind == TokenKind::Keyword && storage == "pub";
+  return kind == TokenKind::Keyword && getSpelling() == "pub";
 }
 
 bool Token::isIdentifier() const { return kind == TokenKind::Identifier; }
 
 bool Token::isAs() const {
-  return kind == TokenKind::Keyword && storage == "as";
+  return kind == TokenKind::Keyword && getSpelling() == "as";
 }
 
 std::string Token2String(TokenKind kind) {
@@ -387,6 +429,8 @@ std::string Token2String(TokenKind kind) {
 //  }
 //}
 
-std::string Token::charToString() const { return utf8Storage.toString(); }
+std::string Token::charToString() const {
+  return getUtf8Storage().toString();
+}
 
 } // namespace rust_compiler::lexer
@@ -1,11 +1,103 @@
 #include "Lexer/TokenStream.h"
 
+#include "Lexer/TokenSource.h"
+
+#include <algorithm>
+
 namespace rust_compiler::lexer {
 
-void TokenStream::append(Token tk) { tokens.push_back(tk); }
+namespace {
+
+/// the index of the kind of a delimiter into TokenStream::openCounts
+size_t getDelimiterIndex(TokenKind delimiter) {
+  switch (delimiter) {
+  case TokenKind::ParenOpen:
+  case TokenKind::ParenClose:
+    return 0;
+  case TokenKind::SquareOpen:
+  case TokenKind::SquareClose:
+    return 1;
+  default:
+    return 2;
+  }
+}
+
+} // namespace
+
+void TokenStream::append(Token tk) {
+  assert(tokens.size() < NoMatch && "too many tokens");
+  uint32_t at = tokens.size();
+  tokens.push_back(tk);
+  matches.push_back(NoMatch);
+
+  switch (tk.getKind()) {
+  case TokenKind::ParenOpen:
+  case TokenKind::SquareOpen:
+  case TokenKind::BraceOpen:
+    open.push_back(at);
+    ++openCounts[getDelimiterIndex(tk.getKind())];
+    break;
+  case TokenKind::ParenClose:
+  case TokenKind::SquareClose:
+  case TokenKind::BraceClose:
+    matchDelimiter(at);
+    break;
+  default:
+    break;
+  }
+}
+
+// A closing delimiter matches the innermost open one of its kind, and the
+// open ones in between stay unmatched, e.g., the ( in { ( }. A closing
+// delimiter without an open one of its kind stays unmatched. Every open
+// delimiter is passed over at most once, hence matching is linear in the
+// tokens, even for input with many unbalanced delimiters.
+void TokenStream::matchDelimiter(uint32_t close) {
+  size_t kind = getDelimiterIndex(tokens[close].getKind());
+  if (openCounts[kind] == 0)
+    return;
+  while (true) {
+    uint32_t at = open.back();
+    open.pop_back();
+    size_t openKind = getDelimiterIndex(tokens[at].getKind());
+    --openCounts[openKind];
+    if (openKind == kind) {
+      matches[at] = close;
+      matches[close] = at;
+      return;
+    }
+  }
+}
 
 std::span<Token> TokenStream::getAsView() { return std::span<Token>(tokens); }
 
+std::span<const Token> TokenStream::getAsView() const {
+  return std::span<const Token>(tokens);
+}
+
+TokenStream TokenStream::slice(size_t begin, size_t end) const {
+  assert(begin <= end && end <= tokens.size());
+  // the delimiters are matched again, within the slice
+  TokenStream ts;
+  ts.tokens.reserve(end - begin);
+  ts.matches.reserve(end - begin);
+  for (size_t i = begin; i < end; ++i)
+    ts.append(tokens[i]);
+  return ts;
+}
+
+Token TokenStreamSource::next() {
+  if (offset < ts.getLength())
+    return ts.getAt(offset++);
+  if (ts.getLength() > 0)
+    return ts.getAt(ts.getLength() - 1);
+  return Token(Location(), TokenKind::Eof);
+}
+
+void TokenStreamSource::skip(size_t count) {
+  offset = std::min(offset + count, ts.getLength());
+}
+
 void TokenStream::print(unsigned limit) {
   unsigned idx = 0;
 
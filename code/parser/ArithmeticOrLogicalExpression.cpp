@@ -13,56 +13,65 @@ namespace rust_compiler::parser {
 
 StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseArithmeticOrLogicalExpression(std::shared_ptr<ast::Expression> lhs,
+                                           Precedence rightBindingPower,
                                            Restrictions restrictions) {
   Location loc = getLocation();
 
   ArithmeticOrLogicalExpression arith = {loc};
   arith.setLhs(lhs);
 
-  //  llvm::outs() << "parseArithmeticOrLogicalExpression"
-  //               << "\n";
-
-  if (check(TokenKind::Plus)) {
+  switch (getToken().getKind()) {
+  case TokenKind::Plus:
     arith.setKind(ArithmeticOrLogicalExpressionKind::Addition);
-  } else if (check(TokenKind::Minus)) {
+    break;
+  case TokenKind::Minus:
     arith.setKind(ArithmeticOrLogicalExpressionKind::Subtraction);
-  } else if (check(TokenKind::Star)) {
+    break;
+  case TokenKind::Star:
     arith.setKind(ArithmeticOrLogicalExpressionKind::Multiplication);
-  } else if (check(TokenKind::Slash)) {
+    break;
+  case TokenKind::Slash:
     arith.setKind(ArithmeticOrLogicalExpressionKind::Division);
-  } else if (check(TokenKind::Percent)) {
+    break;
+  case TokenKind::Percent:
     arith.setKind(ArithmeticOrLogicalExpressionKind::Remainder);
-  } else if (check(TokenKind::And)) {
+    break;
+  case TokenKind::And:
     arith.setKind(ArithmeticOrLogicalExpressionKind::BitwiseAnd);
-  } else if (check(TokenKind::Or)) {
+    break;
+  case TokenKind::Or:
     arith.setKind(ArithmeticOrLogicalExpressionKind::BitwiseOr);
-  } else if (check(TokenKind::Caret)) {
+    break;
+  case TokenKind::Caret:
     arith.setKind(ArithmeticOrLogicalExpressionKind::BitwiseXor);
-  } else if (check(TokenKind::Shl)) {
+    break;
+  case TokenKind::Shl:
     arith.setKind(ArithmeticOrLogicalExpressionKind::LeftShift);
-  } else if (check(TokenKind::Shr)) {
+    break;
+  case TokenKind::Shr:
     arith.setKind(ArithmeticOrLogicalExpressionKind::RightShift);
-  } else {
+    break;
+  default:
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse arithmetic or logical expression");
+        adt::Error("failed to parse arithmetic or logical expression",
+                   getLocation()));
   }
 
   // the operator
   assert(eat(getToken().getKind()));
 
   StringResult<std::shared_ptr<ast::Expression>> expr =
-      parseExpression({}, restrictions);
+      parseExpression(rightBindingPower, {}, restrictions);
   if (!expr) {
-    llvm::errs()
-        << "failed to parse expression in arithmetic or logical expression: "
-        << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in arithmetic or logical "
+                    "expression",
+                    expr.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   arith.setRhs(expr.getValue());
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<ArithmeticOrLogicalExpression>(arith));
+      context->create<ArithmeticOrLogicalExpression>(arith));
 }
 
 } // namespace rust_compiler::parser
@@ -21,24 +21,26 @@ StringResult<ast::OuterAttribute> Parser::parseOuterAttribute() {
   OuterAttribute outer = {loc};
 
   if (!check(TokenKind::Hash))
-    return StringResult<ast::OuterAttribute>("failed to parse outer attribute");
+    return StringResult<ast::OuterAttribute>(
+        adt::Error("failed to parse outer attribute", getLocation()));
   assert(eat(TokenKind::Hash));
 
   if (!check(TokenKind::SquareOpen))
-    return StringResult<ast::OuterAttribute>("failed to parse outer attribute");
+    return StringResult<ast::OuterAttribute>(
+        adt::Error("failed to parse outer attribute", getLocation()));
   assert(eat(TokenKind::SquareOpen));
 
   StringResult<Attr> attr = parseAttr();
   if (!attr) {
-    llvm::errs() << "failed to parse attr  in outer attribute: "
-                 << attr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse attr  in outer attribute",
+                    attr.getError()};
+    return StringResult<ast::OuterAttribute>(s);
   }
   outer.setAttr(attr.getValue());
 
   if (!check(TokenKind::SquareClose))
-    return StringResult<ast::OuterAttribute>("failed to parse outer attribute");
+    return StringResult<ast::OuterAttribute>(
+        adt::Error("failed to parse outer attribute", getLocation()));
   assert(eat(TokenKind::SquareClose));
 
   return StringResult<ast::OuterAttribute>(outer);
@@ -52,28 +54,31 @@ StringResult<ast::InnerAttribute> Parser::parseInnerAttribute() {
   InnerAttribute inner = {loc};
 
   if (!check(TokenKind::Hash))
-    return StringResult<ast::InnerAttribute>("failed to parse inner attribute");
+    return StringResult<ast::InnerAttribute>(
+        adt::Error("failed to parse inner attribute", getLocation()));
   assert(eat(TokenKind::Hash));
 
   if (!check(TokenKind::Not))
-    return StringResult<ast::InnerAttribute>("failed to parse inner attribute");
+    return StringResult<ast::InnerAttribute>(
+        adt::Error("failed to parse inner attribute", getLocation()));
   assert(eat(TokenKind::Not));
 
   if (!check(TokenKind::SquareOpen))
-    return StringResult<ast::InnerAttribute>("failed to parse inner attribute");
+    return StringResult<ast::InnerAttribute>(
+        adt::Error("failed to parse inner attribute", getLocation()));
   assert(eat(TokenKind::SquareOpen));
 
   StringResult<Attr> attr = parseAttr();
   if (!attr) {
-    llvm::errs() << "failed to parse attr  in inner attribute: "
-                 << attr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse attr  in inner attribute",
+                    attr.getError()};
+    return StringResult<ast::InnerAttribute>(s);
   }
   inner.setAttr(attr.getValue());
 
   if (!check(TokenKind::SquareClose))
-    return StringResult<ast::InnerAttribute>("failed to parse inner attribute");
+    return StringResult<ast::InnerAttribute>(
+        adt::Error("failed to parse inner attribute", getLocation()));
   assert(eat(TokenKind::SquareClose));
 
   return StringResult<ast::InnerAttribute>(inner);
@@ -87,10 +92,8 @@ StringResult<ast::Attr> Parser::parseAttr() {
 
   StringResult<ast::SimplePath> path = parseSimplePath();
   if (!path) {
-    llvm::errs() << "failed to parse simple path  in attr: " << path.getError()
-                 << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse simple path  in attr", path.getError()};
+    return StringResult<ast::Attr>(s);
   }
   attr.setSimplePath(path.getValue());
 
@@ -98,10 +101,9 @@ StringResult<ast::Attr> Parser::parseAttr() {
   } else {
     StringResult<ast::AttrInput> attrInput = parseAttrInput();
     if (!attrInput) {
-      llvm::errs() << "failed to parse attr input in attr: "
-                   << attrInput.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse attr input in attr",
+                      attrInput.getError()};
+      return StringResult<ast::Attr>(s);
     }
     attr.setAttrInput(attrInput.getValue());
   }
@@ -118,13 +120,12 @@ StringResult<ast::AttrInput> Parser::parseAttrInput() {
   if (check(TokenKind::Eq)) {
     assert(eat(TokenKind::Eq));
     Restrictions restrictions;
-    Result<std::shared_ptr<ast::Expression>, std::string> expr =
+    StringResult<std::shared_ptr<ast::Expression>> expr =
         parseExpression({}, restrictions);
     if (!expr) {
-      llvm::errs() << "failed to parse expression in AttrInput: "
-                   << expr.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse expression in AttrInput",
+                      expr.getError()};
+      return StringResult<ast::AttrInput>(s);
     }
     input.setExpression(expr.getValue());
     return StringResult<ast::AttrInput>(input);
@@ -133,10 +134,9 @@ StringResult<ast::AttrInput> Parser::parseAttrInput() {
   StringResult<std::shared_ptr<ast::DelimTokenTree>> tokenTree =
       parseDelimTokenTree();
   if (!tokenTree) {
-    llvm::errs() << "failed to parse delim token tree in attr input: "
-                 << tokenTree.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse delim token tree in attr input",
+                    tokenTree.getError()};
+    return StringResult<ast::AttrInput>(s);
   }
   input.setTokenTree(tokenTree.getValue());
   return StringResult<ast::AttrInput>(input);
@@ -149,14 +149,13 @@ StringResult<std::vector<ast::OuterAttribute>> Parser::parseOuterAttributes() {
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<std::vector<ast::OuterAttribute>>(
-          "failed to parse outer attributes");
+          adt::Error("failed to parse outer attributes", getLocation()));
     } else if (checkOuterAttribute()) {
       StringResult<ast::OuterAttribute> outerAttr = parseOuterAttribute();
       if (!outerAttr) {
-        llvm::errs() << "failed to parse outer attribute in outer attributes: "
-                     << outerAttr.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse outer attribute in outer attributes",
+                        outerAttr.getError()};
+        return StringResult<std::vector<ast::OuterAttribute>>(s);
       }
       outer.push_back(outerAttr.getValue());
     } else {
@@ -172,14 +171,13 @@ StringResult<std::vector<ast::InnerAttribute>> Parser::parseInnerAttributes() {
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<std::vector<ast::InnerAttribute>>(
-          "failed to parse inner attributes");
+          adt::Error("failed to parse inner attributes", getLocation()));
     } else if (checkInnerAttribute()) {
       StringResult<ast::InnerAttribute> innerAttr = parseInnerAttribute();
       if (!innerAttr) {
-        llvm::errs() << "failed to parse inner attribute in inner attributes: "
-                     << innerAttr.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse inner attribute in inner attributes",
+                        innerAttr.getError()};
+        return StringResult<std::vector<ast::InnerAttribute>>(s);
       }
       inner.push_back(innerAttr.getValue());
     } else {
@@ -27,11 +27,7 @@ bool Parser::checkMaybeNamedParamLeadingComma() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in check maybe name "
-                      "param leading comma: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      return false;
     }
     if (checkIdentifier() && check(TokenKind::Colon, 1))
       return true;
@@ -59,16 +55,9 @@ Parser::parseMaybeNamedFunctionParameters() {
 
   StringResult<ast::types::MaybeNamedParam> namedParam = parseMaybeNamedParam();
   if (!namedParam) {
-    llvm::errs() << "failed to parse mabe named param in parse maybe named "
-                    "function parameters: "
-                 << namedParam.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0}\n{1}",
-                      "failed to parse mabe named param in parse maybe named "
-                      "function parameters: ",
-                      namedParam.getError())
-            .str();
+    adt::Error s = {"failed to parse mabe named param in parse maybe named "
+                    "function parameters",
+                    namedParam.getError()};
     return StringResult<
         std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(s);
   }
@@ -78,35 +67,28 @@ Parser::parseMaybeNamedFunctionParameters() {
     if (check(TokenKind::Eof)) {
       return StringResult<
           std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-          "failed to parse maybe named function parameters: eof");
+          adt::Error("failed to parse maybe named function parameters: eof",
+                     getLocation()));
     } else if (check(TokenKind::ParenClose)) {
       // done
       return StringResult<
           std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-          std::make_shared<MaybeNamedFunctionParameters>(maybe));
+          context->create<MaybeNamedFunctionParameters>(maybe));
     } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
       // done
       assert(eat(TokenKind::Comma));
       maybe.setTrailingComma();
       return StringResult<
           std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-          std::make_shared<MaybeNamedFunctionParameters>(maybe));
+          context->create<MaybeNamedFunctionParameters>(maybe));
     } else if (check(TokenKind::Comma)) {
       assert(eat(TokenKind::Comma));
       StringResult<ast::types::MaybeNamedParam> namedParam =
           parseMaybeNamedParam();
       if (!namedParam) {
-        llvm::errs() << "failed to parse mabe named param in parse maybe named "
-                        "function parameters: "
-                     << namedParam.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse mabe named param in parse maybe named "
-                "function parameters: ",
-                namedParam.getError())
-                .str();
+        adt::Error s = {"failed to parse mabe named param in parse maybe named "
+                        "function parameters",
+                        namedParam.getError()};
         return StringResult<
             std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
             s);
@@ -115,12 +97,14 @@ Parser::parseMaybeNamedFunctionParameters() {
     } else {
       return StringResult<
           std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-          "failed to parse maybe named function parameters");
+          adt::Error("failed to parse maybe named function parameters",
+                     getLocation()));
     }
   }
   return StringResult<
       std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-      "failed to parse maybe named function parameters: eof");
+      adt::Error("failed to parse maybe named function parameters: eof",
+                 getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>
@@ -130,17 +114,10 @@ Parser::parseMaybeNamedFunctionParametersVariadic() {
 
   StringResult<ast::types::MaybeNamedParam> namedParam = parseMaybeNamedParam();
   if (!namedParam) {
-    llvm::errs() << "failed to parse mabe named param in parse maybe named "
-                    "function parameters variadic: "
-                 << namedParam.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv("{0}\n{1}",
-                      "failed to parse mabe named param in parse maybe named "
-                      "function parameters variadic: ",
-                      namedParam.getError())
-            .str();
+    adt::Error s = {"failed to parse mabe named param in parse maybe named "
+                    "function parameters variadic",
+                    namedParam.getError()};
     return StringResult<
         std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(s);
   }
@@ -150,31 +127,25 @@ Parser::parseMaybeNamedFunctionParametersVariadic() {
     if (check(TokenKind::Eof)) {
       return StringResult<
           std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-          "failed to parse maybe named function parameters variadic: eof");
+          adt::Error(
+              "failed to parse maybe named function parameters variadic: eof",
+              getLocation()));
     } else if (check(TokenKind::DotDotDot) && check(TokenKind::ParenClose, 1)) {
       // done
       assert(eat(TokenKind::DotDotDot));
       return StringResult<
           std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-          std::make_shared<MaybeNamedFunctionParametersVariadic>(maybe));
+          context->create<MaybeNamedFunctionParametersVariadic>(maybe));
     } else if (check(TokenKind::Comma) && checkOuterAttribute(1)) {
       assert(eat(TokenKind::Comma));
       StringResult<std::vector<ast::OuterAttribute>> outer =
           parseOuterAttributes();
       if (!outer) {
-        llvm::errs()
-            << "failed to parse outer paramaeters in parse maybe named "
-               "function parameters variadic: "
-            << outer.getError() << "\n";
-        printFunctionStack();
         // exit(EXIT_FAILURE);
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse outer paramaeters in parse maybe named "
-                "function parameters variadic: ",
-                outer.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse outer paramaeters in parse maybe named "
+            "function parameters variadic",
+            outer.getError()};
         return StringResult<
             std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
             s);
@@ -186,18 +157,10 @@ Parser::parseMaybeNamedFunctionParametersVariadic() {
       StringResult<ast::types::MaybeNamedParam> namedParam =
           parseMaybeNamedParam();
       if (!namedParam) {
-        llvm::errs()
-            << "failed to parse maybe named param in parse maybe named "
-               "function parameters variadic: "
-            << namedParam.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse maybe named param in parse maybe named "
-                "function parameters variadic: ",
-                namedParam.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse maybe named param in parse maybe named "
+            "function parameters variadic",
+            namedParam.getError()};
         return StringResult<
             std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
             s);
@@ -206,12 +169,14 @@ Parser::parseMaybeNamedFunctionParametersVariadic() {
     } else {
       return StringResult<
           std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-          "failed to parse maybe named function parameters variadic");
+          adt::Error("failed to parse maybe named function parameters variadic",
+                     getLocation()));
     }
   }
   return StringResult<
       std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-      "failed to parse maybe named function parameters: eof");
+      adt::Error("failed to parse maybe named function parameters: eof",
+                 getLocation()));
 }
 
 StringResult<ast::types::MaybeNamedParam> Parser::parseMaybeNamedParam() {
@@ -223,11 +188,10 @@ StringResult<ast::types::MaybeNamedParam> Parser::parseMaybeNamedParam() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in parse maybe named "
-                      "parameter: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in parse maybe named "
+                      "parameter",
+                      outer.getError()};
+      return StringResult<ast::types::MaybeNamedParam>(s);
     }
     std::vector<ast::OuterAttribute> ot = outer.getValue();
     param.setOuterAttributes(ot);
@@ -238,28 +202,22 @@ StringResult<ast::types::MaybeNamedParam> Parser::parseMaybeNamedParam() {
     assert(eat(TokenKind::Identifier));
     if (!check(TokenKind::Colon))
       return StringResult<ast::types::MaybeNamedParam>(
-          "failed to parse : in maybe named param");
+          adt::Error("failed to parse : in maybe named param", getLocation()));
     assert(eat(TokenKind::Colon));
   } else if (check(TokenKind::Underscore) && check(TokenKind::Colon, 1)) {
     assert(eat(TokenKind::Underscore));
     param.setUnderscore();
     if (!check(TokenKind::Colon))
       return StringResult<ast::types::MaybeNamedParam>(
-          "failed to parse : in maybe named param");
+          adt::Error("failed to parse : in maybe named param", getLocation()));
     assert(eat(TokenKind::Colon));
   }
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in parse maybe named "
-                    "parameter: "
-                 << type.getError() << "\n";
-    printFunctionStack();
-    std::string s = llvm::formatv("{0} {1}",
-                                  "failed to parse type in parse maybe named "
-                                  "parameter: ",
-                                  type.getError())
-                        .str();
+    adt::Error s = {"failed to parse type in parse maybe named "
+                    "parameter",
+                    type.getError()};
     return StringResult<ast::types::MaybeNamedParam>(s);
   }
   param.setType(type.getValue());
@@ -273,18 +231,10 @@ Parser::parseFunctionParametersMaybeNamedVariadic() {
 
   StringResult<ast::types::MaybeNamedParam> namedParam = parseMaybeNamedParam();
   if (!namedParam) {
-    llvm::errs() << "failed to parse maybe named param  in function parameters "
-                    "maybe varadic pattern: "
-                 << namedParam.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to parse maybe named param  in function parameters "
-            "maybe varadic pattern: ",
-            namedParam.getError())
-            .str();
+    adt::Error s = {"failed to parse maybe named param  in function parameters "
+                    "maybe varadic pattern",
+                    namedParam.getError()};
     return StringResult<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(s);
   }
   while (true) {
@@ -294,8 +244,10 @@ Parser::parseFunctionParametersMaybeNamedVariadic() {
       llvm::errs() << getToken().getIdentifier().toString() << "\n";
     if (check(TokenKind::Eof)) {
       return StringResult<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-          "failed to parse in function parameters maybe named variadic: "
-          "eof");
+          adt::Error(
+              "failed to parse in function parameters maybe named variadic: "
+              "eof",
+              getLocation()));
     } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
       recover(cp);
       return StringResult<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
@@ -309,18 +261,10 @@ Parser::parseFunctionParametersMaybeNamedVariadic() {
       StringResult<ast::types::MaybeNamedParam> namedParam =
           parseMaybeNamedParam();
       if (!namedParam) {
-        llvm::errs() << "failed to parse maybe named param  in function "
-                        "parameters "
-                        "maybe varadic: "
-                     << namedParam.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv(
-                "{0} {1}",
-                "failed to parse maybe named param  in function parameters "
-                "maybe varadic pattern: ",
-                namedParam.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse maybe named param  in function parameters "
+            "maybe varadic pattern",
+            namedParam.getError()};
         return StringResult<std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
             s);
         // exit(EXIT_FAILURE);
@@ -337,7 +281,8 @@ Parser::parseFunctionParametersMaybeNamedVariadic() {
   }
   return StringResult<
       std::shared_ptr<ast::types::FunctionParametersMaybeNamedVariadic>>(
-      "failed to parse in function parameters maybe named variadic");
+      adt::Error("failed to parse in function parameters maybe named variadic",
+                 getLocation()));
 }
 
 StringResult<ast::types::BareFunctionReturnType>
@@ -348,18 +293,17 @@ Parser::parseBareFunctionReturnType() {
 
   if (!check(TokenKind::RArrow))
     return StringResult<ast::types::BareFunctionReturnType>(
-        "failed to parse -> in bare function return type");
+        adt::Error("failed to parse -> in bare function return type",
+                   getLocation()));
   assert(eat(TokenKind::RArrow));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> text =
       parseTypeNoBounds();
   if (!text) {
-    llvm::errs()
-        << "failed to parse type no bounds  in bare function return type "
-           "maybe varadic: "
-        << text.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type no bounds  in bare function return "
+                    "type maybe varadic",
+                    text.getError()};
+    return StringResult<ast::types::BareFunctionReturnType>(s);
   }
   qual.setType(text.getValue());
 
@@ -382,11 +326,9 @@ Parser::parseFunctionTypeQualifiers() {
 
     StringResult<Abi> ab = parseAbi();
     if (!ab) {
-      llvm::errs() << "failed to parse abi in parse "
-                      "function type qualifiers"
-                   << ab.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse abi in parse function type qualifiers",
+                      ab.getError()};
+      return StringResult<ast::types::FunctionTypeQualifiers>(s);
     }
     qual.setAbi(ab.getValue());
   }
@@ -406,10 +348,9 @@ Parser::parseBareFunctionType() {
   if (checkKeyWord(KeyWordKind::KW_FOR)) {
     StringResult<ast::types::ForLifetimes> forL = parseForLifetimes();
     if (!forL) {
-      llvm::errs() << "failed to parse for lifetimes in bare function type "
-                   << forL.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse for lifetimes in bare function type",
+                      forL.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
     }
     bare.setForLifetimes(forL.getValue());
   }
@@ -417,22 +358,23 @@ Parser::parseBareFunctionType() {
   StringResult<ast::types::FunctionTypeQualifiers> qual =
       parseFunctionTypeQualifiers();
   if (!qual) {
-    llvm::errs()
-        << "failed to parse function type qualifiers in bare function type "
-        << qual.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse function type qualifiers in bare "
+                    "function type",
+                    qual.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   bare.setQualifiers(qual.getValue());
 
   if (!checkKeyWord(KeyWordKind::KW_FN))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse fn keyword in bare function type");
+        adt::Error("failed to parse fn keyword in bare function type",
+                   getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_FN));
 
   if (!check(TokenKind::ParenOpen))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse ( token in bare function type");
+        adt::Error("failed to parse ( token in bare function type",
+                   getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
@@ -441,33 +383,24 @@ Parser::parseBareFunctionType() {
       StringResult<ast::types::BareFunctionReturnType> ret =
           parseBareFunctionReturnType();
       if (!ret) {
-        llvm::errs() << "failed to parse bare function return type in parse "
-                        "bare function type"
-                     << ret.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse bare function return type in parse "
+                        "bare function type",
+                        ret.getError()};
+        return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
       }
       bare.setReturnType(ret.getValue());
     }
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<BareFunctionType>(bare));
+        context->create<BareFunctionType>(bare));
   } else {
     StringResult<std::shared_ptr<FunctionParametersMaybeNamedVariadic>>
         varadic = parseFunctionParametersMaybeNamedVariadic();
     if (!varadic) {
-      llvm::errs() << "failed to parse function parameters maybe named "
-                      "variadic in parse "
-                      "bare function type"
-                   << varadic.getError() << "\n";
-      printFunctionStack();
       // exit(EXIT_FAILURE);
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "failed to parse function parameters maybe named "
-                        "variadic in parse "
-                        "bare function type",
-                        varadic.getError())
-              .str();
+      adt::Error s = {"failed to parse function parameters maybe named "
+                      "variadic in parse "
+                      "bare function type",
+                      varadic.getError()};
 
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
     }
@@ -475,27 +408,27 @@ Parser::parseBareFunctionType() {
 
     if (!check(TokenKind::ParenClose))
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          "failed to parse ) token in bare function type");
+          adt::Error("failed to parse ) token in bare function type",
+                     getLocation()));
     assert(eat(TokenKind::ParenClose));
 
     if (check((TokenKind::RArrow))) {
       StringResult<ast::types::BareFunctionReturnType> ret =
           parseBareFunctionReturnType();
       if (!ret) {
-        llvm::errs() << "failed to parse bare function return type in parse "
-                        "bare function type"
-                     << ret.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse bare function return type in parse "
+                        "bare function type",
+                        ret.getError()};
+        return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
       }
       bare.setReturnType(ret.getValue());
     }
 
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<BareFunctionType>(bare));
+        context->create<BareFunctionType>(bare));
   }
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      "failed to parse bare function type");
+      adt::Error("failed to parse bare function type", getLocation()));
 }
 
 } // namespace rust_compiler::parser
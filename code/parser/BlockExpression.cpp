@@ -27,19 +27,13 @@ StringResult<ExpressionOrStatement>
 Parser::parseStatementOrExpressionWithBlock(std::span<OuterAttribute> outer) {
   Location loc = getLocation();
 
-  Result<std::shared_ptr<ast::Expression>, std::string> withBlock =
+  StringResult<std::shared_ptr<ast::Expression>> withBlock =
       parseExpressionWithBlock(outer);
   if (!withBlock) {
     // report error
-    llvm::errs() << "failed to parse expression with block in statement or "
-                    "expression with block: "
-                 << withBlock.getError() << "\n";
-    std::string s =
-        llvm::formatv("{0}\n{1}",
-                      "failed to parse expression with block in statement or "
-                      "expression with block",
-                      withBlock.getError())
-            .str();
+    adt::Error s = {"failed to parse expression with block in statement or "
+                    "expression with block",
+                    withBlock.getError()};
     return StringResult<ExpressionOrStatement>(s);
   }
 
@@ -57,7 +51,7 @@ Parser::parseStatementOrExpressionWithBlock(std::span<OuterAttribute> outer) {
   }
 
   return StringResult<ExpressionOrStatement>(
-      ExpressionOrStatement(std::make_shared<ExpressionStatement>(stmt)));
+      ExpressionOrStatement(context->create<ExpressionStatement>(stmt)));
 }
 
 StringResult<ExpressionOrStatement>
@@ -68,26 +62,20 @@ Parser::parseStatementOrExpressionWithoutBlock() {
     // empty statement; early exit
     assert(eat(TokenKind::Semi));
     return StringResult<ExpressionOrStatement>(
-        ExpressionOrStatement(std::make_shared<EmptyStatement>(loc)));
+        ExpressionOrStatement(context->create<EmptyStatement>(loc)));
   }
 
   std::vector<ast::OuterAttribute> outerAttr;
 
   // parse outer attr
   if (checkOuterAttribute()) {
-    Result<std::vector<ast::OuterAttribute>, std::string> outer =
+    StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
       // report error
-      llvm::errs() << "failed to parse outer attributes in statement or "
-                      "expression without block: "
-                   << outer.getError() << "\n";
-      std::string s =
-          llvm::formatv("{0}\n{1}",
-                        "failed to parse outer attributes in statement or "
-                        "expression without block",
-                        outer.getError())
-              .str();
+      adt::Error s = {"failed to parse outer attributes in statement or "
+                      "expression without block",
+                      outer.getError()};
       return StringResult<ExpressionOrStatement>(s);
     }
     outerAttr = outer.getValue();
@@ -99,18 +87,12 @@ Parser::parseStatementOrExpressionWithoutBlock() {
     switch (getToken().getKeyWordKind()) {
     case KeyWordKind::KW_LET: {
       // let statement
-      Result<std::shared_ptr<ast::Statement>, std::string> let =
+      StringResult<std::shared_ptr<ast::Statement>> let =
           parseLetStatement(outerAttr, restrictions);
       if (!let) {
-        llvm::errs() << "failed to parse let statement in statement or "
-                        "expression without block: "
-                     << let.getError() << "\n";
-        std::string s =
-            llvm::formatv("{0}\n{1}",
-                          "failed to parse let statement in statement or "
-                          "expression without block: ",
-                          let.getError())
-                .str();
+        adt::Error s = {"failed to parse let statement in statement or "
+                        "expression without block",
+                        let.getError()};
         return StringResult<ExpressionOrStatement>(s);
       }
       return StringResult<ExpressionOrStatement>(
@@ -130,18 +112,11 @@ Parser::parseStatementOrExpressionWithoutBlock() {
     case KeyWordKind::KW_UNION:
     case KeyWordKind::KW_IMPL: {
       // parse vis item
-      Result<std::shared_ptr<ast::Item>, std::string> item =
-          parseVisItem(outerAttr);
+      StringResult<std::shared_ptr<ast::Item>> item = parseVisItem(outerAttr);
       if (!item) {
-        llvm::errs() << "failed to parse vis item in statement or "
-                        "expression without block: "
-                     << item.getError() << "\n";
-        std::string s =
-            llvm::formatv("{0}\n{1}",
-                          "failed to parse vis item in statement or "
-                          "expression without block: ",
-                          item.getError())
-                .str();
+        adt::Error s = {"failed to parse vis item in statement or "
+                        "expression without block",
+                        item.getError()};
         return StringResult<ExpressionOrStatement>(s);
       };
       return StringResult<ExpressionOrStatement>(
@@ -153,53 +128,32 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         return parseStatementOrExpressionWithBlock(outerAttr);
       } else if (checkKeyWord(KeyWordKind::KW_TRAIT, 1)) {
         // unsafe trait
-        Result<std::shared_ptr<ast::Item>, std::string> item =
-            parseVisItem(outerAttr);
+        StringResult<std::shared_ptr<ast::Item>> item = parseVisItem(outerAttr);
         if (!item) {
-          llvm::errs() << "failed to parse vis item in statement or "
-                          "expression without block: "
-                       << item.getError() << "\n";
-          std::string s =
-              llvm::formatv("{0}\n{1}",
-                            "failed to parse vis item in statement or "
-                            "expression without block: ",
-                            item.getError())
-                  .str();
+          adt::Error s = {"failed to parse vis item in statement or "
+                          "expression without block",
+                          item.getError()};
           return StringResult<ExpressionOrStatement>(s);
         }
         return StringResult<ExpressionOrStatement>(
             ExpressionOrStatement(item.getValue()));
       } else if (checkKeyWord(KeyWordKind::KW_FN, 1)) {
         // unsafe function
-        Result<std::shared_ptr<ast::Item>, std::string> item =
-            parseVisItem(outerAttr);
+        StringResult<std::shared_ptr<ast::Item>> item = parseVisItem(outerAttr);
         if (!item) {
-          llvm::errs() << "failed to parse vis item in statement or "
-                          "expression without block: "
-                       << item.getError() << "\n";
-          std::string s =
-              llvm::formatv("{0}\n{1}",
-                            "failed to parse vis item in statement or "
-                            "expression without block: ",
-                            item.getError())
-                  .str();
+          adt::Error s = {"failed to parse vis item in statement or "
+                          "expression without block",
+                          item.getError()};
         }
         return StringResult<ExpressionOrStatement>(
             ExpressionOrStatement(item.getValue()));
       } else if (checkKeyWord(KeyWordKind::KW_IMPL, 1)) {
         // unsafe trait impl
-        Result<std::shared_ptr<ast::Item>, std::string> item =
-            parseVisItem(outerAttr);
+        StringResult<std::shared_ptr<ast::Item>> item = parseVisItem(outerAttr);
         if (!item) {
-          llvm::errs() << "failed to parse vis item in statement or "
-                          "expression without block: "
-                       << item.getError() << "\n";
-          std::string s =
-              llvm::formatv("{0}\n{1}",
-                            "failed to parse vis item in statement or "
-                            "expression without block: ",
-                            item.getError())
-                  .str();
+          adt::Error s = {"failed to parse vis item in statement or "
+                          "expression without block",
+                          item.getError()};
         }
         return StringResult<ExpressionOrStatement>(
             ExpressionOrStatement(item.getValue()));
@@ -209,8 +163,10 @@ Parser::parseStatementOrExpressionWithoutBlock() {
                         "expression without block"
                      << "\n";
         return StringResult<ExpressionOrStatement>(
-            "unknown kind of unsafe structure in statement or "
-            "expression without block");
+            adt::Error(
+                "unknown kind of unsafe structure in statement or "
+                "expression without block",
+                getLocation()));
       }
     }
     case KeyWordKind::KW_SUPER:
@@ -218,7 +174,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
     case KeyWordKind::KW_SELFTYPE: {
       // something that starts with a path:
       Restrictions restrictions;
-      Result<std::shared_ptr<ast::Expression>, std::string> expr =
+      StringResult<std::shared_ptr<ast::Expression>> expr =
           parseExpressionWithoutBlock(outerAttr, restrictions);
       if (!expr) {
         llvm::errs() << "failed to parse expression without block in statement "
@@ -232,7 +188,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         stmt.setTrailingSemi();
         stmt.setExprWoBlock(expr.getValue());
         return StringResult<ExpressionOrStatement>(
-            ExpressionOrStatement(std::make_shared<ExpressionStatement>(stmt)));
+            ExpressionOrStatement(context->create<ExpressionStatement>(stmt)));
       } else {
         // must be expression
         return StringResult<ExpressionOrStatement>(
@@ -250,20 +206,13 @@ Parser::parseStatementOrExpressionWithoutBlock() {
     }
     case KeyWordKind::KW_MACRO_RULES: {
       /// macro_rules!
-      adt::Result<std::shared_ptr<ast::Item>, std::string> macro =
+      adt::StringResult<std::shared_ptr<ast::Item>> macro =
           parseMacroRulesDefinition();
       if (!macro) {
         // report error
-        llvm::errs() << "failed to parse macro rules definition in expression "
-                        "or statement: "
-                     << macro.getError() << "\n";
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse macro rules definition in expression "
-                "or statement",
-                macro.getError())
-                .str();
+        adt::Error s = {"failed to parse macro rules definition in expression "
+                        "or statement",
+                        macro.getError()};
         return StringResult<ExpressionOrStatement>(s);
       }
       return StringResult<ExpressionOrStatement>(
@@ -274,21 +223,14 @@ Parser::parseStatementOrExpressionWithoutBlock() {
           << "unknown keyword in statement or expression without block: "
           << KeyWord2String(getToken().getKeyWordKind()) << "\n";
 
-      Result<std::shared_ptr<ast::Expression>, std::string> expr =
+      StringResult<std::shared_ptr<ast::Expression>> expr =
           parseExpressionWithoutBlock(outerAttr, restrictions);
       if (!expr) {
-        llvm::errs()
-            << "failed to parse expression without block in statement or "
-               "expression without block: "
-            << expr.getError() << "\n";
         // report error
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse expression without block in statement or "
-                "expression without block",
-                expr.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse expression without block in statement or "
+            "expression without block",
+            expr.getError()};
         return StringResult<ExpressionOrStatement>(s);
       }
 
@@ -299,7 +241,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         stmt.setExprWoBlock(expr.getValue());
         stmt.setTrailingSemi();
         return StringResult<ExpressionOrStatement>(
-            ExpressionOrStatement(std::make_shared<ExpressionStatement>(stmt)));
+            ExpressionOrStatement(context->create<ExpressionStatement>(stmt)));
       }
 
       break;
@@ -312,7 +254,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         break;
       // something that starts with a path:
       Restrictions restrictions;
-      Result<std::shared_ptr<ast::Expression>, std::string> expr =
+      StringResult<std::shared_ptr<ast::Expression>> expr =
           parseExpressionWithoutBlock(outerAttr, restrictions);
       if (!expr) {
         llvm::errs() << "failed to parse expression without block in statement "
@@ -326,7 +268,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         stmt.setTrailingSemi();
         stmt.setExprWoBlock(expr.getValue());
         return StringResult<ExpressionOrStatement>(
-            ExpressionOrStatement(std::make_shared<ExpressionStatement>(stmt)));
+            ExpressionOrStatement(context->create<ExpressionStatement>(stmt)));
       }
       // must be expression
       return StringResult<ExpressionOrStatement>(
@@ -335,20 +277,14 @@ Parser::parseStatementOrExpressionWithoutBlock() {
     case TokenKind::BraceOpen: {
       // maybe block expr
       CheckPoint cp = getCheckPoint();
-      Result<std::shared_ptr<ast::Expression>, std::string> block =
+      StringResult<std::shared_ptr<ast::Expression>> block =
           parseBlockExpression(outerAttr);
       if (!block) {
         // report error
-        llvm::errs() << "failed to parse block expression in statement or "
-                        "expression without block: "
-                     << block.getError() << "\n";
         // report error
-        std::string s =
-            llvm::formatv("{0}\n{1}",
-                          "failed to parse block expression in statement or "
-                          "expression without block",
-                          block.getError())
-                .str();
+        adt::Error s = {"failed to parse block expression in statement or "
+                        "expression without block",
+                        block.getError()};
         return StringResult<ExpressionOrStatement>(s);
       }
 
@@ -357,22 +293,15 @@ Parser::parseStatementOrExpressionWithoutBlock() {
             ExpressionOrStatement(block.getValue()));
       } else {
         recover(cp);
-        adt::Result<std::shared_ptr<ast::Expression>, std::string> expr =
+        adt::StringResult<std::shared_ptr<ast::Expression>> expr =
             parseExpression({}, restrictions);
         if (!expr) {
           // report error
-          llvm::errs()
-              << "failed to parse expression without block in statement or "
-                 "expression without block: "
-              << expr.getError() << "\n";
           // report error
-          std::string s =
-              llvm::formatv(
-                  "{0}\n{1}",
-                  "failed to parse expression without block  in statement or "
-                  "expression without block",
-                  expr.getError())
-                  .str();
+          adt::Error s = {
+              "failed to parse expression without block  in statement or "
+              "expression without block",
+              expr.getError()};
           return StringResult<ExpressionOrStatement>(s);
         }
         return StringResult<ExpressionOrStatement>(
@@ -381,22 +310,15 @@ Parser::parseStatementOrExpressionWithoutBlock() {
     }
     case TokenKind::Identifier: {
       // path and ...
-      Result<std::shared_ptr<ast::Expression>, std::string> woBlock =
+      StringResult<std::shared_ptr<ast::Expression>> woBlock =
           parseExpressionWithoutBlock(outerAttr, restrictions);
       if (!woBlock) {
         // report block
-        llvm::errs()
-            << "failed to parse expression without block in statement or "
-               "expression without block: "
-            << woBlock.getError() << "\n";
         // report error
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse expression without block in statement or "
-                "expression without block",
-                woBlock.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse expression without block in statement or "
+            "expression without block",
+            woBlock.getError()};
         return StringResult<ExpressionOrStatement>(s);
       }
 
@@ -407,7 +329,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         stmt.setExprWoBlock(woBlock.getValue());
         stmt.setTrailingSemi();
         return StringResult<ExpressionOrStatement>(
-            ExpressionOrStatement(std::make_shared<ExpressionStatement>(stmt)));
+            ExpressionOrStatement(context->create<ExpressionStatement>(stmt)));
       } else {
         return StringResult<ExpressionOrStatement>(
             ExpressionOrStatement(woBlock.getValue()));
@@ -421,22 +343,15 @@ Parser::parseStatementOrExpressionWithoutBlock() {
     case TokenKind::RAW_BYTE_STRING_LITERAL:
     case TokenKind::INTEGER_LITERAL:
     case TokenKind::FLOAT_LITERAL: {
-      Result<std::shared_ptr<ast::Expression>, std::string> woBlock =
+      StringResult<std::shared_ptr<ast::Expression>> woBlock =
           parseExpressionWithoutBlock(outerAttr, restrictions);
       if (!woBlock) {
         // report block
-        llvm::errs()
-            << "failed to parse expression without block in statement or "
-               "expression without block: "
-            << woBlock.getError() << "\n";
         // report error
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse expression without block in statement or "
-                "expression without block",
-                woBlock.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse expression without block in statement or "
+            "expression without block",
+            woBlock.getError()};
         return StringResult<ExpressionOrStatement>(s);
       }
 
@@ -447,25 +362,19 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         stmt.setExprWoBlock(woBlock.getValue());
         stmt.setTrailingSemi();
         return StringResult<ExpressionOrStatement>(
-            ExpressionOrStatement(std::make_shared<ExpressionStatement>(stmt)));
+            ExpressionOrStatement(context->create<ExpressionStatement>(stmt)));
       } else {
         return StringResult<ExpressionOrStatement>(
             ExpressionOrStatement(woBlock.getValue()));
       }
     }
     case TokenKind::ParenOpen: {
-      adt::Result<std::shared_ptr<ast::Expression>, std::string> paren =
+      adt::StringResult<std::shared_ptr<ast::Expression>> paren =
           parseGroupedOrTupleExpression(restrictions);
       if (!paren) {
-        llvm::errs() << "failed to parse grouped or parenthesis expression in "
-                        "statement or expression without block"
-                     << "\n";
-        std::string s =
-            llvm::formatv(
-                "failed to parse grouped or parenthesis expression in "
-                "statement or expression without block: {0}",
-                paren.getError())
-                .str();
+        adt::Error s = {"failed to parse grouped or parenthesis expression in "
+                        "statement or expression without block",
+                        paren.getError()};
         return StringResult<ExpressionOrStatement>(s);
       }
       if (getToken().getKind() == TokenKind::Semi) {
@@ -475,7 +384,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         stmt.setExprWoBlock(paren.getValue());
         stmt.setTrailingSemi();
         return StringResult<ExpressionOrStatement>(
-            ExpressionOrStatement(std::make_shared<ExpressionStatement>(stmt)));
+            ExpressionOrStatement(context->create<ExpressionStatement>(stmt)));
       } else {
         return StringResult<ExpressionOrStatement>(
             ExpressionOrStatement(paren.getValue()));
@@ -483,22 +392,15 @@ Parser::parseStatementOrExpressionWithoutBlock() {
     }
     case TokenKind::Lt: {
       // qualified path and ...
-      Result<std::shared_ptr<ast::Expression>, std::string> woBlock =
+      StringResult<std::shared_ptr<ast::Expression>> woBlock =
           parseExpressionWithoutBlock(outerAttr, restrictions);
       if (!woBlock) {
         // report block
-        llvm::errs()
-            << "failed to parse expression without block in statement or "
-               "expression without block: "
-            << woBlock.getError() << "\n";
         // report error
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse expression without block in statement or "
-                "expression without block",
-                woBlock.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse expression without block in statement or "
+            "expression without block",
+            woBlock.getError()};
         return StringResult<ExpressionOrStatement>(s);
       }
       if (getToken().getKind() == TokenKind::Semi) {
@@ -508,7 +410,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         stmt.setExprWoBlock(woBlock.getValue());
         stmt.setTrailingSemi();
         return StringResult<ExpressionOrStatement>(
-            ExpressionOrStatement(std::make_shared<ExpressionStatement>(stmt)));
+            ExpressionOrStatement(context->create<ExpressionStatement>(stmt)));
       } else {
         return StringResult<ExpressionOrStatement>(
             ExpressionOrStatement(woBlock.getValue()));
@@ -518,21 +420,14 @@ Parser::parseStatementOrExpressionWithoutBlock() {
       llvm::errs() << "unknown token in statement or expression without block: "
                    << Token2String(getToken().getKind()) << "\n";
 
-      Result<std::shared_ptr<ast::Expression>, std::string> expr =
+      StringResult<std::shared_ptr<ast::Expression>> expr =
           parseExpressionWithoutBlock(outerAttr, restrictions);
       if (!expr) {
-        llvm::errs()
-            << "failed to parse expression without block in statement or "
-               "expression without block: "
-            << expr.getError() << "\n";
         // report error
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse expression without block in statement or "
-                "expression without block",
-                expr.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse expression without block in statement or "
+            "expression without block",
+            expr.getError()};
         return StringResult<ExpressionOrStatement>(s);
       }
 
@@ -543,7 +438,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
         stmt.setExprWoBlock(expr.getValue());
         stmt.setTrailingSemi();
         return StringResult<ExpressionOrStatement>(
-            ExpressionOrStatement(std::make_shared<ExpressionStatement>(stmt)));
+            ExpressionOrStatement(context->create<ExpressionStatement>(stmt)));
       }
       // expression
       return StringResult<ExpressionOrStatement>(
@@ -554,7 +449,7 @@ Parser::parseStatementOrExpressionWithoutBlock() {
   llvm_unreachable("either keyword or not");
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseBlockExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -566,8 +461,8 @@ Parser::parseBlockExpression(std::span<OuterAttribute>) {
 
   if (!check(TokenKind::BraceOpen)) {
     llvm::errs() << Token2String(getToken().getKind()) << "\n";
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse { in block expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse { in block expression", getLocation()));
   }
 
   assert(eat(TokenKind::BraceOpen));
@@ -576,15 +471,9 @@ Parser::parseBlockExpression(std::span<OuterAttribute>) {
     StringResult<std::vector<ast::InnerAttribute>> innerAttributes =
         parseInnerAttributes();
     if (!innerAttributes) {
-      llvm::errs() << "failed to parse inner attributes in block expression: "
-                   << innerAttributes.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0}\n{1}",
-                        "failed to parse inner attributes in block expression",
-                        innerAttributes.getError())
-              .str();
-      return Result<std::shared_ptr<ast::Expression>, std::string>(s);
+      adt::Error s = {"failed to parse inner attributes in block expression",
+                      innerAttributes.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     std::vector<InnerAttribute> inner = innerAttributes.getValue();
     bloc.setInnerAttributes(inner);
@@ -596,24 +485,18 @@ Parser::parseBlockExpression(std::span<OuterAttribute>) {
     assert(eat(TokenKind::BraceClose));
     bloc.setStatements(stmts);
 
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<BlockExpression>(bloc));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<BlockExpression>(bloc));
   }
 
   while (getToken().getKind() != TokenKind::BraceClose) {
-    adt::StringResult<ExpressionOrStatement> expr =
-        parseStatementOrExpressionWithoutBlock();
+    adt::StringResult<ExpressionOrStatement> expr = parseStatementOrRecover();
     if (!expr) {
       // report error
-      llvm::errs() << "failed to parse statement or expression without block "
-                      "in block expression: "
-                   << expr.getError() << "\n";
-      std::string s = llvm::formatv("{0}\n{1}",
-                                    "failed to parse statement or expression "
-                                    "without block in block expression : ",
-                                    expr.getError())
-                          .str();
-      return Result<std::shared_ptr<ast::Expression>, std::string>(s);
+      adt::Error s = {"failed to parse statement or expression "
+                      "without block in block expression",
+                      expr.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
 
     ExpressionOrStatement eos = expr.getValue();
@@ -631,7 +514,7 @@ Parser::parseBlockExpression(std::span<OuterAttribute>) {
       std::shared_ptr<ast::Item> item = eos.getItem();
       ItemDeclaration decl = {item->getLocation()};
       decl.setVisItem(item);
-      stmts.addStmt(std::make_shared<ItemDeclaration>(decl));
+      stmts.addStmt(context->create<ItemDeclaration>(decl));
       break;
     }
     }
@@ -641,7 +524,7 @@ Parser::parseBlockExpression(std::span<OuterAttribute>) {
     //   std::shared_ptr<ast::Item> item = eos.getItem();
     //   ItemDeclaration decl = {item->getLocation()};
     //   decl.setVisItem(item);
-    //   stmts.addStmt(std::make_shared<ItemDeclaration>(decl));
+    //   stmts.addStmt(context->create<ItemDeclaration>(decl));
     // } else if (eos.getKind() == ExpressionOrStatementKind::Expression) {
     //   stmts.setTrailing(eos.getExpression());
     // } else {
@@ -652,15 +535,15 @@ Parser::parseBlockExpression(std::span<OuterAttribute>) {
   if (!check(TokenKind::BraceClose)) {
     llvm::errs() << "real token: " << Token2String(getToken().getKind())
                  << "\n";
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse } in block expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse } in block expression", getLocation()));
   }
   assert(eat(TokenKind::BraceClose));
 
   bloc.setStatements(stmts);
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<BlockExpression>(bloc));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<BlockExpression>(bloc));
 }
 
 } // namespace rust_compiler::parser
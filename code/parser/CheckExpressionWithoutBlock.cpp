@@ -68,11 +68,7 @@ bool Parser::checkExpressionWithoutBlock() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in check expression "
-                      "without block: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      return false;
     }
   }
 
@@ -131,10 +127,6 @@ bool Parser::checkExpressionWithoutBlock() {
   StringResult<std::shared_ptr<ast::Expression>> left =
       parseExpression({}, restritions);
   if (!left) {
-    llvm::errs() << "failed to parse expression in check expression "
-                    "without block: "
-                 << left.getError() << "\n";
-    printFunctionStack();
   }
 
   return checkExpressionWithoutBlock(left.getValue());
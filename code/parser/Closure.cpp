@@ -37,22 +37,17 @@ Parser::parseClosureExpression(std::span<ast::OuterAttribute> outer) {
     // parameters
     StringResult<ast::ClosureParameters> parameters = parseClosureParameters();
     if (!parameters) {
-      llvm::errs()
-          << "failed to parse closure parameters in closure expression: "
-          << parameters.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse closure parameters in closure "
+                      "expression",
+                      parameters.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     clos.setParameters(parameters.getValue());
 
     if (!check(TokenKind::Or)) {
-      if (check(TokenKind::Identifier))
-        llvm::errs() << getToken().getIdentifier().toString() << "\n";
-      llvm::errs() << Token2String(getToken().getKind()) << "\n";
-      llvm::errs()
-          << "failed to parse | token in  closure parameters in closure"
-          << "\n";
-      exit(EXIT_FAILURE);
+      return StringResult<std::shared_ptr<ast::Expression>>(adt::Error(
+          "failed to parse | token in closure parameters in closure",
+          getLocation()));
     }
     assert(eat(TokenKind::Or));
   } else {
@@ -65,42 +60,39 @@ Parser::parseClosureExpression(std::span<ast::OuterAttribute> outer) {
     StringResult<std::shared_ptr<ast::types::TypeExpression>> types =
         parseTypeNoBounds();
     if (!types) {
-      llvm::errs() << "failed to parse type no bounds in closure expression: "
-                   << types.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type no bounds in closure expression",
+                      types.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     clos.setType(types.getValue());
     StringResult<std::shared_ptr<ast::Expression>> block =
         parseBlockExpression({});
     if (!block) {
-      llvm::errs()
-          << "failed to parse type noblock expression in closure expression: "
-          << block.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type noblock expression in closure "
+                      "expression",
+                      block.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     clos.setBlock(block.getValue());
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<ClosureExpression>(clos));
+        context->create<ClosureExpression>(clos));
   } else {
     Restrictions restrictions;
     StringResult<std::shared_ptr<ast::Expression>> expr =
         parseExpression({}, restrictions);
     if (!expr) {
-      llvm::errs() << "failed to parse  expression in closure expression: "
-                   << expr.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse  expression in closure expression",
+                      expr.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     clos.setBlock(expr.getValue());
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<ClosureExpression>(clos));
+        context->create<ClosureExpression>(clos));
   }
 
   // error
   return StringResult<std::shared_ptr<ast::Expression>>(
-      "failed to parse closure expression ");
+      adt::Error("failed to parse closure expression ", getLocation()));
 }
 
 StringResult<ast::ClosureParameters> Parser::parseClosureParameters() {
@@ -110,10 +102,9 @@ StringResult<ast::ClosureParameters> Parser::parseClosureParameters() {
 
   StringResult<ast::ClosureParam> first = parseClosureParam();
   if (!first) {
-    llvm::errs() << "failed to parse  closure param in closure parameters: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse  closure param in closure parameters",
+                    first.getError()};
+    return StringResult<ast::ClosureParameters>(s);
   }
   params.addParam(first.getValue());
 
@@ -121,7 +112,7 @@ StringResult<ast::ClosureParameters> Parser::parseClosureParameters() {
     if (check(TokenKind::Eof)) {
       // abort
       return StringResult<ast::ClosureParameters>(
-          "failed to parse closure parameters: eof");
+          adt::Error("failed to parse closure parameters: eof", getLocation()));
     } else if (check(TokenKind::Comma) && check(TokenKind::Or, 1)) {
       assert(eat(TokenKind::Comma));
       // done
@@ -133,17 +124,16 @@ StringResult<ast::ClosureParameters> Parser::parseClosureParameters() {
       assert(eat(TokenKind::Comma));
       StringResult<ast::ClosureParam> cp = parseClosureParam();
       if (!cp) {
-        llvm::errs() << "failed to parse  closure param in closure parameters: "
-                     << cp.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse  closure param in closure parameters",
+                        cp.getError()};
+        return StringResult<ast::ClosureParameters>(s);
       }
       params.addParam(cp.getValue());
     }
   }
   // error
   return StringResult<ast::ClosureParameters>(
-      "failed to parse closure parameters");
+      adt::Error("failed to parse closure parameters", getLocation()));
 }
 
 StringResult<ast::ClosureParam> Parser::parseClosureParam() {
@@ -155,10 +145,9 @@ StringResult<ast::ClosureParam> Parser::parseClosureParam() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in closure param: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in closure param",
+                      outer.getError()};
+      return StringResult<ast::ClosureParam>(s);
     }
     std::vector<ast::OuterAttribute> ot = outer.getValue();
     param.setOuterAttributes(ot);
@@ -167,10 +156,9 @@ StringResult<ast::ClosureParam> Parser::parseClosureParam() {
   StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>> pattern =
       parsePatternNoTopAlt();
   if (!pattern) {
-    llvm::errs() << "failed to parse pattern in closure param: "
-                 << pattern.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse pattern in closure param",
+                    pattern.getError()};
+    return StringResult<ast::ClosureParam>(s);
   }
   param.setPattern(pattern.getValue());
 
@@ -180,10 +168,8 @@ StringResult<ast::ClosureParam> Parser::parseClosureParam() {
     StringResult<std::shared_ptr<ast::types::TypeExpression>> type =
         parseType();
     if (!type) {
-      llvm::errs() << "failed to parse type in closure param: "
-                   << type.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type in closure param", type.getError()};
+      return StringResult<ast::ClosureParam>(s);
     }
     param.setType(type.getValue());
   }
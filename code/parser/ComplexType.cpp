@@ -36,8 +36,10 @@ Parser::parseTraitObjectTypeOrTypePathOrMacroInvocation() {
       // recover(cp);
       // return parseTypePath();
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          "failed to parse "
-          "raitObjectTypeOrTypePathOrMacroInvocation: eof");
+          adt::Error(
+              "failed to parse "
+              "raitObjectTypeOrTypePathOrMacroInvocation: eof",
+              getLocation()));
     } else if (check(TokenKind::PathSep)) {
       assert(eat(TokenKind::PathSep));
     } else if (check(TokenKind::QMark)) {
@@ -114,18 +116,16 @@ Parser::parseTraitObjectTypeOrTypePathOrMacroInvocation() {
       return parseTypePath();
     }
     if (iterations > 10) {
-      llvm::errs() << "failed parseTraitObjectTypeOrTypePathOrMacroInvocation()"
-                   << "\n";
-      llvm::errs() << "iterations limited exceed at "
-                   << getToken().getLocation().toString() << "\n";
-      llvm::errs() << "iterations limited exceed with: "
-                   << Token2String(getToken().getKind()) << "\n";
-      exit(EXIT_FAILURE);
+      return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
+          adt::Error("failed to parse trait object type, type path, or "
+                     "macro invocation: iteration limit exceeded",
+                     getLocation()));
     }
   }
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      "failed to parse "
-      "raitObjectTypeOrTypePathOrMacroInvocation");
+      adt::Error("failed to parse "
+                 "raitObjectTypeOrTypePathOrMacroInvocation",
+                 getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>> Parser::
@@ -157,11 +157,10 @@ StringResult<std::shared_ptr<ast::types::TypeExpression>> Parser::
   } else if (checkKeyWord(KeyWordKind::KW_FOR)) {
     StringResult<ast::types::ForLifetimes> forL = parseForLifetimes();
     if (!forL) {
-      llvm::errs() << "failed to parse for litetimes in check expression "
-                      "without block: "
-                   << forL.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse for litetimes in check expression "
+                      "without block",
+                      forL.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
     }
     if (checkKeyWord(KeyWordKind::KW_UNSAFE)) {
       recover(cp);
@@ -182,12 +181,14 @@ StringResult<std::shared_ptr<ast::types::TypeExpression>> Parser::
     return parseTraitObjectTypeOrTypePathOrMacroInvocation();
   }
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      "failed to parse "
-      "TupleOrParensTypeOrTypePathOrMacroInvocationOrTrait"
-      "ObjectTypeOrBareFunctionType");
+      adt::Error(
+          "failed to parse "
+          "TupleOrParensTypeOrTypePathOrMacroInvocationOrTrait"
+          "ObjectTypeOrBareFunctionType",
+          getLocation()));
 }
 
-adt::Result<std::shared_ptr<ast::types::TypeParamBound>, std::string>
+adt::StringResult<std::shared_ptr<ast::types::TypeParamBound>>
 Parser::parseTypePathOrTraitObjectType() {
 
   assert(false);
@@ -0,0 +1,141 @@
+#include "AST/Function.h"
+#include "Basic/Ids.h"
+#include "Lexer/TokenSource.h"
+#include "Parser/Parser.h"
+
+#include <llvm/Support/ThreadPool.h>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+using namespace rust_compiler::ast;
+using namespace rust_compiler::adt;
+using namespace rust_compiler::lexer;
+
+namespace rust_compiler::parser {
+
+namespace {
+
+/// The node ids reserved for a body of the given number of tokens. The
+/// bodies of the testsuite use 1.3 ids per token on average and 2 at most,
+/// and the unused ids of a budget are lost. A body that needs more is
+/// parsed again after the pool, with the NodeIdAllocator.
+uint32_t getNodeIdBudget(size_t tokens) { return 2 * tokens + 16; }
+
+/// the bodies parsed by one task, with one fork of the ASTContext
+constexpr size_t ChunkSize = 32;
+
+struct DeferredBody {
+  basic::NodeId begin;
+  basic::NodeId end;
+  std::optional<StringResult<std::shared_ptr<Expression>>> result;
+  bool exhausted = false;
+};
+
+} // namespace
+
+StringResult<lexer::TokenStream> Parser::skipBlockExpression() {
+  ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
+  TokenStream body;
+
+  if (!check(TokenKind::BraceOpen))
+    return StringResult<TokenStream>(
+        adt::Error("failed to parse { token in block expression",
+                   getLocation()));
+
+  // the table of the TokenStream knows the matching }
+  if (std::optional<size_t> close = tokens.getMatchingDelimiter()) {
+    body = tokens.getTokenStream()->slice(tokens.getOffset(), *close + 1);
+    tokens.skipTo(*close + 1);
+    body.append(Token(getLocation(), TokenKind::Eof));
+    return StringResult<TokenStream>(body);
+  }
+
+  size_t depth = 0;
+  do {
+    const Token &tok = getToken();
+    switch (tok.getKind()) {
+    case TokenKind::BraceOpen:
+      ++depth;
+      break;
+    case TokenKind::BraceClose:
+      --depth;
+      break;
+    case TokenKind::Eof:
+      return StringResult<TokenStream>(adt::Error(
+          "failed to find the matching } of block expression",
+          getLocation()));
+    default:
+      break;
+    }
+    body.append(tok);
+    [[maybe_unused]] bool eaten = eat(tok.getKind());
+    assert(eaten);
+  } while (depth > 0);
+
+  body.append(Token(getLocation(), TokenKind::Eof));
+  return StringResult<TokenStream>(body);
+}
+
+StringResult<std::shared_ptr<ast::Expression>>
+Parser::parseDeferredBody(const ast::Function &fun,
+                          std::shared_ptr<ast::ASTContext> context) {
+  TokenStreamSource source(fun.getDeferredBody());
+  Parser parser = {source, std::move(context)};
+
+  StringResult<std::shared_ptr<ast::Expression>> body =
+      parser.parseBlockExpression({});
+  if (!body) {
+    adt::Error s = {"failed to parse body in function", body.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
+  }
+  if (!parser.check(TokenKind::Eof))
+    return StringResult<std::shared_ptr<ast::Expression>>(adt::Error(
+        "failed to parse body in function: trailing tokens",
+        parser.getLocation()));
+  return body;
+}
+
+StringResult<size_t> Parser::parseDeferredBodies(
+    ast::ASTContext &context,
+    std::span<const std::shared_ptr<ast::Function>> functions,
+    llvm::ThreadPoolStrategy strategy) {
+  // the ids are reserved in the order of functions, not of the schedule
+  std::vector<DeferredBody> bodies(functions.size());
+  for (size_t i = 0; i < functions.size(); ++i) {
+    uint32_t budget =
+        getNodeIdBudget(functions[i]->getDeferredBody().getLength());
+    bodies[i].begin = basic::reserveNodeIds(budget);
+    bodies[i].end = bodies[i].begin + budget;
+  }
+
+  {
+    llvm::ThreadPool pool(strategy);
+    for (size_t chunk = 0; chunk < functions.size(); chunk += ChunkSize) {
+      pool.async([&context, &functions, &bodies, chunk] {
+        std::shared_ptr<ASTContext> arena = context.fork();
+        size_t end = std::min(chunk + ChunkSize, functions.size());
+        for (size_t i = chunk; i < end; ++i) {
+          basic::NodeIdRange ids = {bodies[i].begin, bodies[i].end};
+          bodies[i].result = parseDeferredBody(*functions[i], arena);
+          bodies[i].exhausted = ids.isExhausted();
+        }
+      });
+    }
+    pool.wait();
+  }
+
+  for (size_t i = 0; i < functions.size(); ++i) {
+    // rare and deterministic: the budget was too small
+    if (bodies[i].exhausted)
+      bodies[i].result = parseDeferredBody(*functions[i], context.fork());
+    if (!*bodies[i].result)
+      return StringResult<size_t>(bodies[i].result->getError());
+    functions[i]->setBody(bodies[i].result->getValue());
+  }
+
+  return StringResult<size_t>(functions.size());
+}
+
+} // namespace rust_compiler::parser
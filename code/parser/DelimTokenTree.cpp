@@ -21,10 +21,9 @@ StringResult<ast::TokenTree> Parser::parseTokenTree() {
     StringResult<std::shared_ptr<ast::DelimTokenTree>> delimTokenTree =
         parseDelimTokenTree();
     if (!delimTokenTree) {
-      llvm::errs() << "failed to parse delim token tree in token tree: "
-                   << delimTokenTree.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse delim token tree in token tree",
+                      delimTokenTree.getError()};
+      return StringResult<ast::TokenTree>(s);
     }
     tree.setTree(delimTokenTree.getValue());
     return StringResult<ast::TokenTree>(tree);
@@ -46,18 +45,18 @@ Parser::parseDelimTokenTree() {
     while (true) {
       if (check(TokenKind::Eof)) {
         return StringResult<std::shared_ptr<ast::DelimTokenTree>>(
-            "failed to parse delim token tree (eof)");
+            adt::Error("failed to parse delim token tree (eof)",
+                       getLocation()));
       } else if (check(TokenKind::ParenClose)) {
         assert(eat(TokenKind::ParenClose));
         return StringResult<std::shared_ptr<ast::DelimTokenTree>>(
-            std::make_shared<DelimTokenTree>(tree));
+            context->create<DelimTokenTree>(tree));
       } else {
         StringResult<ast::TokenTree> tokenTree = parseTokenTree();
         if (!tokenTree) {
-          llvm::errs() << "failed to parse token tree in delim token tree: "
-                       << tokenTree.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse token tree in delim token tree",
+                          tokenTree.getError()};
+          return StringResult<std::shared_ptr<ast::DelimTokenTree>>(s);
         }
         tree.addTree(tokenTree.getValue());
       }
@@ -68,18 +67,18 @@ Parser::parseDelimTokenTree() {
     while (true) {
       if (check(TokenKind::Eof)) {
         return StringResult<std::shared_ptr<ast::DelimTokenTree>>(
-            "failed to parse delim token tree (eof)");
+            adt::Error("failed to parse delim token tree (eof)",
+                       getLocation()));
       } else if (check(TokenKind::SquareClose)) {
         assert(eat(TokenKind::SquareClose));
         return StringResult<std::shared_ptr<ast::DelimTokenTree>>(
-            std::make_shared<DelimTokenTree>(tree));
+            context->create<DelimTokenTree>(tree));
       } else {
         StringResult<ast::TokenTree> tokenTree = parseTokenTree();
         if (!tokenTree) {
-          llvm::errs() << "failed to parse token tree in delim token tree: "
-                       << tokenTree.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse token tree in delim token tree",
+                          tokenTree.getError()};
+          return StringResult<std::shared_ptr<ast::DelimTokenTree>>(s);
         }
         tree.addTree(tokenTree.getValue());
       }
@@ -90,18 +89,18 @@ Parser::parseDelimTokenTree() {
     while (true) {
       if (check(TokenKind::Eof)) {
         return StringResult<std::shared_ptr<ast::DelimTokenTree>>(
-            "failed to parse delim token tree (eof)");
+            adt::Error("failed to parse delim token tree (eof)",
+                       getLocation()));
       } else if (check(TokenKind::BraceClose)) {
         assert(eat(TokenKind::BraceClose));
         return StringResult<std::shared_ptr<ast::DelimTokenTree>>(
-            std::make_shared<DelimTokenTree>(tree));
+            context->create<DelimTokenTree>(tree));
       } else {
         StringResult<ast::TokenTree> tokenTree = parseTokenTree();
         if (!tokenTree) {
-          llvm::errs() << "failed to parse token tree in delim token tree: "
-                       << tokenTree.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse token tree in delim token tree",
+                          tokenTree.getError()};
+          return StringResult<std::shared_ptr<ast::DelimTokenTree>>(s);
         }
         tree.addTree(tokenTree.getValue());
       }
@@ -116,7 +115,7 @@ Parser::parseDelimTokenTree() {
   llvm::errs() << getToken().getLocation().toString() << "\n";
 
   return StringResult<std::shared_ptr<ast::DelimTokenTree>>(
-      "failed to parse delim token tree");
+      adt::Error("failed to parse delim token tree", getLocation()));
 }
 
 } // namespace rust_compiler::parser
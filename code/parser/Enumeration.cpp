@@ -30,10 +30,9 @@ StringResult<ast::EnumItem> Parser::parseEnumItem() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in enum item: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in enum item",
+                      outer.getError()};
+      return StringResult<ast::EnumItem>(s);
     }
     std::vector<OuterAttribute> ot = outer.getValue();
     item.setOuterAttributes(ot);
@@ -42,21 +41,17 @@ StringResult<ast::EnumItem> Parser::parseEnumItem() {
   if (checkKeyWord(KeyWordKind::KW_PUB)) {
     StringResult<ast::Visibility> vis = parseVisibility();
     if (!vis) {
-      llvm::errs() << "failed to parse visibility in enum item: "
-                   << vis.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse visibility in enum item",
+                      vis.getError()};
+      return StringResult<ast::EnumItem>(s);
     }
     item.setVisibility(vis.getValue());
   }
 
   if (!check(TokenKind::Identifier)) {
-    llvm::errs() << "failed to parse identifier token in enum item@"
-                 << getToken().getLocation().toString() << "\n";
-    llvm::errs() << Token2String(getToken().getKind()) << "\n";
-    exit(EXIT_FAILURE);
     return StringResult<ast::EnumItem>(
-        "failed to parse identifier token in enum item");
+        adt::Error("failed to parse identifier token in enum item",
+                   getLocation()));
   }
   Token tok = getToken();
   item.setIdentifier(tok.getIdentifier());
@@ -66,20 +61,18 @@ StringResult<ast::EnumItem> Parser::parseEnumItem() {
     // Struct
     StringResult<ast::EnumItemStruct> struc = parseEnumItemStruct();
     if (!struc) {
-      llvm::errs() << "failed to parse enum item struct in enum item: "
-                   << struc.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse enum item struct in enum item",
+                      struc.getError()};
+      return StringResult<ast::EnumItem>(s);
     }
     item.setEnumItemStruct(struc.getValue());
   } else if (check(TokenKind::ParenOpen)) {
     // Tupl
     StringResult<ast::EnumItemTuple> tupl = parseEnumItemTuple();
     if (!tupl) {
-      llvm::errs() << "failed to parse enum item tuple in enum item: "
-                   << tupl.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse enum item tuple in enum item",
+                      tupl.getError()};
+      return StringResult<ast::EnumItem>(s);
     }
     item.setEnumItemTuple(tupl.getValue());
   }
@@ -88,11 +81,10 @@ StringResult<ast::EnumItem> Parser::parseEnumItem() {
     // Dis
     StringResult<ast::EnumItemDiscriminant> dis = parseEnumItemDiscriminant();
     if (!dis) {
-      llvm::errs()
-        << "failed to parse enum item discriminatn tuple in enum item: "
-        << dis.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse enum item discriminatn tuple in enum "
+                      "item",
+                      dis.getError()};
+      return StringResult<ast::EnumItem>(s);
     }
     item.setEnumItemDiscriminant(dis.getValue());
   }
@@ -110,13 +102,13 @@ Parser::parseEnumeration(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(lexer::KeyWordKind::KW_ENUM)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse enum keyword in enum ");
+        adt::Error("failed to parse enum keyword in enum ", getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_ENUM));
 
   if (!check(TokenKind::Identifier)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse identifier token in enum ");
+        adt::Error("failed to parse identifier token in enum ", getLocation()));
   }
 
   enu.setIdentifier(getToken().getIdentifier());
@@ -126,10 +118,9 @@ Parser::parseEnumeration(std::span<OuterAttribute> outer,
     // GenericParams
     StringResult<ast::GenericParams> genericParams = parseGenericParams();
     if (!genericParams) {
-      llvm::errs() << "failed to parse generic params in enumeration: "
-                   << genericParams.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in enumeration",
+                      genericParams.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     enu.setGenericParams(genericParams.getValue());
   }
@@ -137,17 +128,16 @@ Parser::parseEnumeration(std::span<OuterAttribute> outer,
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> whereClause = parseWhereClause();
     if (!whereClause) {
-      llvm::errs() << "failed to parse where clause in enumeration: "
-                   << whereClause.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse where clause in enumeration",
+                      whereClause.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     enu.setWhereClause(whereClause.getValue());
   }
 
   if (!check(TokenKind::BraceOpen)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse { token in enum ");
+        adt::Error("failed to parse { token in enum ", getLocation()));
   }
   assert(eat(TokenKind::BraceOpen));
 
@@ -156,22 +146,21 @@ Parser::parseEnumeration(std::span<OuterAttribute> outer,
   } else {
     StringResult<ast::EnumItems> items = parseEnumItems();
     if (!items) {
-      llvm::errs() << "failed to parse enum items in enumeration: "
-                   << items.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse enum items in enumeration",
+                      items.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     enu.setItems(items.getValue());
   }
 
   if (!check(TokenKind::BraceClose)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse } token in enum ");
+        adt::Error("failed to parse } token in enum ", getLocation()));
   }
   assert(eat(TokenKind::BraceClose));
 
   return StringResult<std::shared_ptr<ast::Item>>(
-      std::make_shared<Enumeration>(enu));
+      context->create<Enumeration>(enu));
 }
 
 StringResult<ast::EnumItemTuple> Parser::parseEnumItemTuple() {
@@ -182,7 +171,8 @@ StringResult<ast::EnumItemTuple> Parser::parseEnumItemTuple() {
 
   if (!check(TokenKind::ParenOpen))
     return StringResult<ast::EnumItemTuple>(
-        "failed to parse ( token in enum item tuple");
+        adt::Error("failed to parse ( token in enum item tuple",
+                   getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
@@ -192,16 +182,16 @@ StringResult<ast::EnumItemTuple> Parser::parseEnumItemTuple() {
 
   StringResult<ast::TupleFields> fields = parseTupleFields();
   if (!fields) {
-    llvm::errs() << "failed to parse tuple fields in enum item tuple: "
-                 << fields.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse tuple fields in enum item tuple",
+                    fields.getError()};
+    return StringResult<ast::EnumItemTuple>(s);
   }
   tup.setTupleFields(fields.getValue());
 
   if (!check(TokenKind::ParenClose)) {
     return StringResult<ast::EnumItemTuple>(
-        "failed to parse ) token in enum item tuple");
+        adt::Error("failed to parse ) token in enum item tuple",
+                   getLocation()));
   }
   assert(eat(TokenKind::ParenClose));
 
@@ -216,7 +206,8 @@ StringResult<ast::EnumItemStruct> Parser::parseEnumItemStruct() {
 
   if (!check(TokenKind::BraceOpen))
     return StringResult<ast::EnumItemStruct>(
-        "failed to parse { token in enum item discriminant");
+        adt::Error("failed to parse { token in enum item discriminant",
+                   getLocation()));
 
   assert(eat(TokenKind::BraceOpen));
 
@@ -227,16 +218,16 @@ StringResult<ast::EnumItemStruct> Parser::parseEnumItemStruct() {
 
   StringResult<ast::StructFields> fields = parseStructFields();
   if (!fields) {
-    llvm::errs() << "failed to parse struct fields in enum item struct: "
-                 << fields.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse struct fields in enum item struct",
+                    fields.getError()};
+    return StringResult<ast::EnumItemStruct>(s);
   }
   str.setStructFields(fields.getValue());
 
   if (!check(TokenKind::BraceClose))
     return StringResult<ast::EnumItemStruct>(
-        "failed to parse } token in enum item discriminant");
+        adt::Error("failed to parse } token in enum item discriminant",
+                   getLocation()));
 
   assert(eat(TokenKind::BraceClose));
 
@@ -251,7 +242,8 @@ StringResult<ast::EnumItemDiscriminant> Parser::parseEnumItemDiscriminant() {
 
   if (!check(TokenKind::Eq))
     return StringResult<ast::EnumItemDiscriminant>(
-        "failed to parse = token in enum item discriminant");
+        adt::Error("failed to parse = token in enum item discriminant",
+                   getLocation()));
 
   assert(eat(TokenKind::Eq));
 
@@ -259,10 +251,9 @@ StringResult<ast::EnumItemDiscriminant> Parser::parseEnumItemDiscriminant() {
   StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse expression in enum item discriminant: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in enum item discriminant",
+                    expr.getError()};
+    return StringResult<ast::EnumItemDiscriminant>(s);
   }
   dis.setExpression(expr.getValue());
 
@@ -277,16 +268,16 @@ StringResult<ast::EnumItems> Parser::parseEnumItems() {
 
   StringResult<ast::EnumItem> first = parseEnumItem();
   if (!first) {
-    llvm::errs() << "failed to parse enum item in enum items: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse enum item in enum items",
+                    first.getError()};
+    return StringResult<ast::EnumItems>(s);
   }
-  items.addItem(std::make_shared<EnumItem>(first.getValue()));
+  items.addItem(context->create<EnumItem>(first.getValue()));
 
   while (true) {
     if (check(TokenKind::Eof)) {
-      return StringResult<ast::EnumItems>("failed to parse enum items: eof ");
+      return StringResult<ast::EnumItems>(
+          adt::Error("failed to parse enum items: eof ", getLocation()));
     } else if (check(TokenKind::BraceClose)) {
       // done
       return StringResult<ast::EnumItems>(items);
@@ -300,15 +291,15 @@ StringResult<ast::EnumItems> Parser::parseEnumItems() {
     } else {
       StringResult<ast::EnumItem> item = parseEnumItem();
       if (!item) {
-        llvm::errs() << "failed to parse enum item in enum items: "
-                     << item.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse enum item in enum items",
+                        item.getError()};
+        return StringResult<ast::EnumItems>(s);
       }
-      items.addItem(std::make_shared<EnumItem>(item.getValue()));
+      items.addItem(context->create<EnumItem>(item.getValue()));
     }
   }
-  return StringResult<ast::EnumItems>("failed to parse enum items");
+  return StringResult<ast::EnumItems>(
+      adt::Error("failed to parse enum items", getLocation()));
 }
 
 } // namespace rust_compiler::parser
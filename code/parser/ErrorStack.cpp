@@ -2,13 +2,10 @@
 
 namespace rust_compiler::parser {
 
-ParserErrorStack::ParserErrorStack(Parser *_parser,
-                                   std::string_view _functionName) {
-  functionName = _functionName;
-  parser = _parser;
-  parser->pushFunction(functionName);
-}
-
-ParserErrorStack::~ParserErrorStack() { parser->popFunction(functionName); }
+#ifdef NDEBUG
+bool ParserErrorStack::tracing = false;
+#else
+bool ParserErrorStack::tracing = true;
+#endif
 
 } // namespace rust_compiler::parser
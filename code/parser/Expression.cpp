@@ -59,11 +59,7 @@ bool Parser::checkExpressionWithBlock() {
     StringResult<std::vector<ast::OuterAttribute>> outerAttributes =
         parseOuterAttributes();
     if (!outerAttributes) {
-      llvm::errs()
-          << "failed to parse outer attributes in expression with block: "
-          << outerAttributes.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      return false;
     }
   }
 
@@ -83,7 +79,7 @@ bool Parser::checkExpressionWithBlock() {
   return false;
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseLiteralExpression(std::span<ast::OuterAttribute> outer) {
   Location loc = getLocation();
   LiteralExpression lit = {loc};
@@ -109,15 +105,16 @@ Parser::parseLiteralExpression(std::span<ast::OuterAttribute> outer) {
   else if (checkKeyWord(KeyWordKind::KW_FALSE))
     lit.setKind(LiteralExpressionKind::False);
   else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse literal  in literal expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse literal  in literal expression",
+                   getLocation()));
   }
   lit.setStorage(getToken().getLiteral());
 
   assert(eat(getToken().getKind()));
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<LiteralExpression>(lit));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<LiteralExpression>(lit));
 }
 
 StringResult<std::shared_ptr<ast::Expression>>
@@ -128,31 +125,29 @@ Parser::parseMacroInvocationExpression() {
 
   StringResult<ast::SimplePath> path = parseSimplePath();
   if (!path) {
-    llvm::errs() << "failed to simple path in macro invocation expression: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to simple path in macro invocation expression",
+                    path.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   macro.setSimplePath(path.getValue());
 
   if (!check(TokenKind::Not))
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse ! token in macro invocation expression");
+        adt::Error("failed to parse ! token in macro invocation expression",
+                   getLocation()));
   assert(eat(TokenKind::Not));
 
   StringResult<std::shared_ptr<ast::DelimTokenTree>> token =
       parseDelimTokenTree();
   if (!token) {
-    llvm::errs()
-        << "failed to delim token tree in macro invocation expression: "
-        << token.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to delim token tree in macro invocation expression",
+                    token.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   macro.setTree(token.getValue());
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<MacroInvocationExpression>(macro));
+      context->create<MacroInvocationExpression>(macro));
 }
 
 bool Parser::checkRangeTerminator() {
@@ -170,120 +165,118 @@ bool Parser::checkRangeTerminator() {
   // heuristic :, or ; or ) or ] or )
 }
 
-Result<ArrayElements, std::string>
+StringResult<ArrayElements>
 Parser::parseArrayElements(std::span<OuterAttribute>,
                            Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   ArrayElements el = {loc};
 
-  Result<std::shared_ptr<ast::Expression>, std::string> first =
+  StringResult<std::shared_ptr<ast::Expression>> first =
       parseExpression({}, restrictions);
   if (!first) {
-    llvm::errs() << "failed to parse expression in array elements: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in array elements",
+                    first.getError()};
+    return StringResult<ArrayElements>(s);
   }
   if (check(TokenKind::Semi)) {
     assert(eat(TokenKind::Semi));
-    Result<std::shared_ptr<ast::Expression>, std::string> second =
+    StringResult<std::shared_ptr<ast::Expression>> second =
         parseExpression({}, restrictions);
     if (!second) {
-      llvm::errs() << "failed to parse expression in array elements: "
-                   << second.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse expression in array elements",
+                      second.getError()};
+      return StringResult<ArrayElements>(s);
     }
     el.setKind(ArrayElementsKind::Repeated);
     el.setValue(first.getValue());
     el.setCount(second.getValue());
-    return Result<ArrayElements, std::string>(el);
+    return StringResult<ArrayElements>(el);
   } else if (check(TokenKind::Comma) && check(TokenKind::SquareClose, 1)) {
     assert(eat(TokenKind::Comma));
     el.setKind(ArrayElementsKind::List);
     el.addElement(first.getValue());
-    return Result<ArrayElements, std::string>(el);
+    return StringResult<ArrayElements>(el);
   } else {
     el.setKind(ArrayElementsKind::List);
     while (true) {
       if (check(TokenKind::Eof)) {
-        return Result<ArrayElements, std::string>(
-            "failed to parse array elements: eof");
+        return StringResult<ArrayElements>(
+            adt::Error("failed to parse array elements: eof", getLocation()));
       } else if (check(TokenKind::Comma) && check(TokenKind::SquareClose, 1)) {
         assert(eat(TokenKind::Comma));
-        return Result<ArrayElements, std::string>(el);
+        return StringResult<ArrayElements>(el);
       } else if (check(TokenKind::SquareClose)) {
-        return Result<ArrayElements, std::string>(el);
+        return StringResult<ArrayElements>(el);
       } else if (check(TokenKind::Comma)) {
         assert(eat(TokenKind::Comma));
-        Result<std::shared_ptr<ast::Expression>, std::string> next =
+        StringResult<std::shared_ptr<ast::Expression>> next =
             parseExpression({}, restrictions);
         if (!next) {
-          llvm::errs() << "failed to parse expression in array elements: "
-                       << next.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse expression in array elements",
+                          next.getError()};
+          return StringResult<ArrayElements>(s);
         }
         el.addElement(next.getValue());
       }
     }
   }
-  return Result<ArrayElements, std::string>("failed to parse array elements");
+  return StringResult<ArrayElements>(
+      adt::Error("failed to parse array elements", getLocation()));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseArrayExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   ArrayExpression array = {loc};
 
   if (!check(TokenKind::SquareOpen))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse [ token in array elements");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse [ token in array elements", getLocation()));
   assert(eat(TokenKind::SquareOpen));
   if (check(TokenKind::SquareClose)) {
     assert(eat(TokenKind::SquareClose));
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<ArrayExpression>(array));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<ArrayExpression>(array));
   }
 
   Restrictions restrictions;
   StringResult<ast::ArrayElements> elements =
       parseArrayElements({}, restrictions);
   if (!elements) {
-    llvm::errs() << "failed to parse array elements in array expression: "
-                 << elements.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse array elements in array expression",
+                    elements.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   array.setElements(elements.getValue());
 
   if (!check(TokenKind::SquareClose))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse ] token in array elements");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse ] token in array elements", getLocation()));
   assert(eat(TokenKind::SquareClose));
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<ArrayExpression>(array));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<ArrayExpression>(array));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseUnderScoreExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   UnderScoreExpression under = {loc};
 
   if (!check(TokenKind::Underscore))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse _ token in underscore expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse _ token in underscore expression",
+                   getLocation()));
   assert(eat(TokenKind::Underscore));
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<UnderScoreExpression>(under));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<UnderScoreExpression>(under));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseCallExpression(std::shared_ptr<ast::Expression> e,
                             std::span<OuterAttribute>,
                             Restrictions restrictions) {
@@ -294,37 +287,38 @@ Parser::parseCallExpression(std::shared_ptr<ast::Expression> e,
   call.setFunction(e);
 
   if (!check(TokenKind::ParenOpen)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse ( token in call expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse ( token in call expression",
+                   getLocation()));
   }
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
     assert(eat(TokenKind::ParenClose));
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<CallExpression>(call));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<CallExpression>(call));
   }
 
-  Result<ast::CallParams, std::string> params = parseCallParams(restrictions);
+  StringResult<ast::CallParams> params = parseCallParams(restrictions);
   if (!params) {
-    llvm::errs() << "failed to parse call params in call expression: "
-                 << params.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse call params in call expression",
+                    params.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   call.setParams(params.getValue());
 
   if (!check(TokenKind::ParenClose)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse ) token in call expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse ) token in call expression",
+                   getLocation()));
   }
   assert(eat(TokenKind::ParenClose));
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<CallExpression>(call));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<CallExpression>(call));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseTupleIndexingExpression(std::shared_ptr<ast::Expression> lhs,
                                      std::span<OuterAttribute> outer,
                                      Restrictions restrictions) {
@@ -335,20 +329,23 @@ Parser::parseTupleIndexingExpression(std::shared_ptr<ast::Expression> lhs,
   tuple.setTuple(lhs);
 
   if (!check(TokenKind::Dot)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse . token in tuple indexing expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse . token in tuple indexing expression",
+                   getLocation()));
   }
   assert(eat(TokenKind::Dot));
 
   if (!check(TokenKind::INTEGER_LITERAL)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse INTEGER_LITERAL token in tuple indexing expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error(
+            "failed to parse INTEGER_LITERAL token in tuple indexing expression",
+            getLocation()));
   }
   tuple.setIndex(getToken().getLiteral());
   assert(eat(TokenKind::INTEGER_LITERAL));
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<TupleIndexingExpression>(tuple));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<TupleIndexingExpression>(tuple));
 }
 
 StringResult<std::shared_ptr<ast::Expression>>
@@ -363,22 +360,24 @@ Parser::parseFieldExpression(std::shared_ptr<ast::Expression> l,
 
   if (!check(TokenKind::Dot))
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse . token in field expression");
+        adt::Error("failed to parse . token in field expression",
+                   getLocation()));
   assert(eat(TokenKind::Dot));
 
   if (!checkIdentifier())
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse identifier token in field expression");
+        adt::Error("failed to parse identifier token in field expression",
+                   getLocation()));
 
   field.setIdentifier(getToken().getIdentifier());
 
   assert(eat(TokenKind::Identifier));
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<FieldExpression>(field));
+      context->create<FieldExpression>(field));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseIndexExpression(std::shared_ptr<ast::Expression> left,
                              std::span<OuterAttribute>,
                              Restrictions restrictions) {
@@ -389,36 +388,28 @@ Parser::parseIndexExpression(std::shared_ptr<ast::Expression> left,
   idx.setLeft(left);
 
   if (!check(TokenKind::SquareOpen))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse [ token in index expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse [ token in index expression",
+                   getLocation()));
   assert(eat(TokenKind::SquareOpen));
 
-  Result<std::shared_ptr<ast::Expression>, std::string> expr =
+  StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse expression in index expression: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv(
-            "{0}\n{1}",
-            "failed to parse expression in index expression: ", expr.getError())
-            .str();
-    return Result<std::shared_ptr<ast::Expression>, std::string>(expr);
+    adt::Error s = {"failed to parse expression in index expression",
+                    expr.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(expr);
   }
   idx.setRight(expr.getValue());
 
   if (!check(TokenKind::SquareClose)) {
-    std::string s = llvm::formatv("{0}{1}{2}", "failed to parse ] found ",
-                                  Token2String(getToken().getKind()),
-                                  " token in index expression")
-                        .str();
-    return Result<std::shared_ptr<ast::Expression>, std::string>(s);
+    return StringResult<std::shared_ptr<ast::Expression>>(adt::Error(
+        "failed to parse ] token in index expression", getLocation()));
   }
   assert(eat(TokenKind::SquareClose));
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<IndexExpression>(idx));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<IndexExpression>(idx));
 }
 
 StringResult<std::shared_ptr<ast::Expression>>
@@ -431,26 +422,27 @@ Parser::parseTypeCastExpression(std::shared_ptr<ast::Expression> lhs) {
 
   if (!checkKeyWord(KeyWordKind::KW_AS))
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse as keyword in type cast expression");
+        adt::Error("failed to parse as keyword in type cast expression",
+                   getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_AS));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> noBounds =
       parseTypeNoBounds();
   if (!noBounds) {
-    llvm::errs()
-        << "failed to parse type no bounds expression in type cast expression: "
-        << noBounds.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type no bounds expression in type cast "
+                    "expression",
+                    noBounds.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   ty.setType(noBounds.getValue());
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<TypeCastExpression>(ty));
+      context->create<TypeCastExpression>(ty));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseAssignmentExpression(std::shared_ptr<ast::Expression> lhs,
+                                  Precedence rightBindingPower,
                                   std::span<OuterAttribute> outer,
                                   Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
@@ -460,69 +452,68 @@ Parser::parseAssignmentExpression(std::shared_ptr<ast::Expression> lhs,
   ass.setLeft(lhs);
 
   if (!check(TokenKind::Eq))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse = token in assignment expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse = token in assignment expression",
+                   getLocation()));
   assert(eat(TokenKind::Eq));
 
-  Result<std::shared_ptr<ast::Expression>, std::string> rhs =
-      parseExpression(Precedence::Assign, {}, restrictions);
+  StringResult<std::shared_ptr<ast::Expression>> rhs =
+      parseExpression(rightBindingPower, {}, restrictions);
   if (!rhs) {
-    llvm::errs() << "failed to parse expression in assignment expression: "
-                 << rhs.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in assignment expression",
+                    rhs.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   ass.setRight(rhs.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<AssignmentExpression>(ass));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<AssignmentExpression>(ass));
 }
 
-Result<ast::CallParams, std::string>
+StringResult<ast::CallParams>
 Parser::parseCallParams(Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   CallParams param = {loc};
 
-  Result<std::shared_ptr<ast::Expression>, std::string> expr =
+  StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse expression in call params: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in call params",
+                    expr.getError()};
+    return StringResult<ast::CallParams>(s);
   }
   param.addParam(expr.getValue());
 
   while (true) {
     if (check(TokenKind::Eof)) {
-      return Result<ast::CallParams, std::string>(
-          "failed to parse call params: eof");
+      return StringResult<ast::CallParams>(
+          adt::Error("failed to parse call params: eof", getLocation()));
     } else if (check(TokenKind::ParenClose)) {
-      return Result<ast::CallParams, std::string>(param);
+      return StringResult<ast::CallParams>(param);
     } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
       assert(eat(TokenKind::Comma));
-      return Result<ast::CallParams, std::string>(param);
+      return StringResult<ast::CallParams>(param);
     } else if (check(TokenKind::Comma) && !check(TokenKind::ParenClose, 1)) {
       assert(eat(TokenKind::Comma));
-      Result<std::shared_ptr<ast::Expression>, std::string> expr =
+      StringResult<std::shared_ptr<ast::Expression>> expr =
           parseExpression({}, restrictions);
       if (!expr) {
-        llvm::errs() << "failed to parse expression in call params: "
-                     << expr.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse expression in call params",
+                        expr.getError()};
+        return StringResult<ast::CallParams>(s);
       }
       param.addParam(expr.getValue());
     } else {
-      return Result<ast::CallParams, std::string>(
-          "failed to parse call params");
+      return StringResult<ast::CallParams>(
+          adt::Error("failed to parse call params", getLocation()));
     }
   }
-  return Result<ast::CallParams, std::string>("failed to parse call params");
+  return StringResult<ast::CallParams>(
+      adt::Error("failed to parse call params", getLocation()));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseMethodCallExpression(std::shared_ptr<ast::Expression> receiver,
                                   std::span<OuterAttribute>,
                                   Restrictions restrictions) {
@@ -536,61 +527,63 @@ Parser::parseMethodCallExpression(std::shared_ptr<ast::Expression> receiver,
   call.setReceiver(receiver);
 
   if (!check(TokenKind::Dot)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse . token in method call expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse . token in method call expression",
+                   getLocation()));
   }
   assert(eat(TokenKind::Dot));
 
   StringResult<ast::PathExprSegment> segment = parsePathExprSegment();
   if (!segment) {
-    llvm::errs()
-        << "failed to parse path expr segment in method call expression: "
-        << segment.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse path expr segment in method call "
+                    "expression",
+                    segment.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   call.setSegment(segment.getValue());
 
   if (!check(TokenKind::ParenOpen)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse ( token in method call expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse ( token in method call expression",
+                   getLocation()));
   }
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
     assert(eat(TokenKind::ParenClose));
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<MethodCallExpression>(call));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<MethodCallExpression>(call));
   } else {
-    Result<ast::CallParams, std::string> params = parseCallParams(restrictions);
+    StringResult<ast::CallParams> params = parseCallParams(restrictions);
     if (!params) {
       llvm::errs() << getToken().getLocation().toString() << "\n";
-      llvm::errs() << "failed to parse call param in method call expression: "
-                   << params.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse call param in method call expression",
+                      params.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     call.setCallParams(params.getValue());
 
     if (!check(TokenKind::ParenClose))
-      return Result<std::shared_ptr<ast::Expression>, std::string>(
-          "failed to parse ) token in method call expression");
+      return StringResult<std::shared_ptr<ast::Expression>>(
+          adt::Error("failed to parse ) token in method call expression",
+                     getLocation()));
     assert(eat(TokenKind::ParenClose));
 
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<MethodCallExpression>(call));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<MethodCallExpression>(call));
   }
   llvm::errs() << "failed to parse method call expression"
                << "\n";
   llvm::errs() << Token2String(getToken().getKind()) << "\n";
   if (getToken().getKind() == TokenKind::Identifier)
     llvm::errs() << getToken().getIdentifier().toString() << "\n";
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      "failed to parse method call expression");
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      adt::Error("failed to parse method call expression", getLocation()));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseLazyBooleanExpression(std::shared_ptr<ast::Expression> e,
+                                   Precedence rightBindingPower,
                                    Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -600,29 +593,32 @@ Parser::parseLazyBooleanExpression(std::shared_ptr<ast::Expression> e,
 
   if (check(TokenKind::OrOr)) {
     laz.setKind(LazyBooleanExpressionKind::Or);
-  } else if (check(TokenKind::OrOr)) {
+  } else if (check(TokenKind::AndAnd)) {
     laz.setKind(LazyBooleanExpressionKind::And);
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse kind in lazy boolean expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse kind in lazy boolean expression",
+                   getLocation()));
   }
+  [[maybe_unused]] bool eaten = eat(getToken().getKind());
+  assert(eaten);
 
-  Result<std::shared_ptr<ast::Expression>, std::string> first =
-      parseExpression({}, restrictions);
+  StringResult<std::shared_ptr<ast::Expression>> first =
+      parseExpression(rightBindingPower, {}, restrictions);
   if (!first) {
-    llvm::errs() << "failed to parse expression in lazy boolean expression: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in lazy boolean expression",
+                    first.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   laz.setRhs(first.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<LazyBooleanExpression>(laz));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<LazyBooleanExpression>(laz));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseComparisonExpression(std::shared_ptr<ast::Expression> lhs,
+                                  Precedence rightBindingPower,
                                   Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -632,185 +628,179 @@ Parser::parseComparisonExpression(std::shared_ptr<ast::Expression> lhs,
   //              << "\n";
   comp.setLhs(lhs);
 
-  Precedence pred;
-  if (check(TokenKind::EqEq)) {
+  switch (getToken().getKind()) {
+  case TokenKind::EqEq:
     comp.setKind(ComparisonExpressionKind::Equal);
-    pred = Precedence::Equal;
-  } else if (check(TokenKind::Ne)) {
-    pred = Precedence::NotEqual;
+    break;
+  case TokenKind::Ne:
     comp.setKind(ComparisonExpressionKind::NotEqual);
-  } else if (check(TokenKind::Gt)) {
-    pred = Precedence::GreaterThan;
+    break;
+  case TokenKind::Gt:
     comp.setKind(ComparisonExpressionKind::GreaterThan);
-  } else if (check(TokenKind::Lt)) {
-    pred = Precedence::LessThan;
+    break;
+  case TokenKind::Lt:
     comp.setKind(ComparisonExpressionKind::LessThan);
-  } else if (check(TokenKind::Ge)) {
-    pred = Precedence::GreaterThanOrEqualTo;
+    break;
+  case TokenKind::Ge:
     comp.setKind(ComparisonExpressionKind::GreaterThanOrEqualTo);
-  } else if (check(TokenKind::Le)) {
-    pred = Precedence::LessThanOrEqualTo;
+    break;
+  case TokenKind::Le:
     comp.setKind(ComparisonExpressionKind::LessThanOrEqualTo);
-  } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse kind in comparison expression");
+    break;
+  default:
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse kind in comparison expression",
+                   getLocation()));
   }
 
   assert(eat(getToken().getKind())); // cheating
 
-  Result<std::shared_ptr<ast::Expression>, std::string> first =
-      parseExpression(pred, {}, restrictions);
+  StringResult<std::shared_ptr<ast::Expression>> first =
+      parseExpression(rightBindingPower, {}, restrictions);
   if (!first) {
-    llvm::errs() << "failed to parse expression in comparison expression: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0} {1}",
-                      "failed to parse expression in comparison expression: ",
-                      first.getError())
-            .str();
-    return Result<std::shared_ptr<ast::Expression>, std::string>(s);
+    adt::Error s = {"failed to parse expression in comparison expression",
+                    first.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
 
     // exit(EXIT_FAILURE);
   }
   comp.setRhs(first.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<ComparisonExpression>(comp));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<ComparisonExpression>(comp));
 }
 
-Result<TupleElements, std::string>
+StringResult<TupleElements>
 Parser::parseTupleElements(Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   TupleElements tuple = {loc};
 
-  Result<std::shared_ptr<ast::Expression>, std::string> first =
+  StringResult<std::shared_ptr<ast::Expression>> first =
       parseExpression({}, restrictions);
   if (!first) {
-    llvm::errs() << "failed to parse expression in tuple elements: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in tuple elements",
+                    first.getError()};
+    return StringResult<TupleElements>(s);
   }
 
   tuple.addElement(first.getValue());
 
   if (!check(TokenKind::Comma))
-    return Result<TupleElements, std::string>(
-        "failed to parse comma token in tuple elements");
+    return StringResult<TupleElements>(
+        adt::Error("failed to parse comma token in tuple elements",
+                   getLocation()));
   assert(eat(TokenKind::Comma));
 
   while (true) {
     if (check(TokenKind::Eof)) {
-      return Result<TupleElements, std::string>(
-          "failed to parse tuple elements: eof");
+      return StringResult<TupleElements>(
+          adt::Error("failed to parse tuple elements: eof", getLocation()));
     } else if (check(TokenKind::ParenClose)) {
-      return Result<TupleElements, std::string>(tuple);
+      return StringResult<TupleElements>(tuple);
     } else {
-      Result<std::shared_ptr<ast::Expression>, std::string> next =
+      StringResult<std::shared_ptr<ast::Expression>> next =
           parseExpression({}, restrictions);
       if (!next) {
-        llvm::errs() << "failed to parse expression in tuple elements: "
-                     << next.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse expression in tuple elements",
+                        next.getError()};
+        return StringResult<TupleElements>(s);
       }
       tuple.addElement(next.getValue());
       if (check(TokenKind::ParenClose))
         continue;
       if (!check(TokenKind::Comma))
-        return Result<TupleElements, std::string>(
-            "failed to parse comma token in tuple elements");
+        return StringResult<TupleElements>(
+            adt::Error("failed to parse comma token in tuple elements",
+                       getLocation()));
       assert(eat(TokenKind::Comma));
     }
   }
-  return Result<TupleElements, std::string>("failed to parse tuple elements");
+  return StringResult<TupleElements>(
+      adt::Error("failed to parse tuple elements", getLocation()));
 }
 
 // FIXME Comma
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseTupleExpression(Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   TupleExpression tuple = {loc};
 
   if (!check(TokenKind::ParenOpen))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse ( token in tuple expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse ( token in tuple expression",
+                   getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
     // done
     assert(eat(TokenKind::ParenClose));
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<TupleExpression>(tuple));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<TupleExpression>(tuple));
   }
 
-  Result<TupleElements, std::string> tupleEl = parseTupleElements(restrictions);
+  StringResult<TupleElements> tupleEl = parseTupleElements(restrictions);
   if (!tupleEl) {
-    llvm::errs() << "failed to parse tuple elements in tuple expression: "
-                 << tupleEl.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0} {1}",
-                      "failed to parse tuple elements in tuple expression: ",
-                      tupleEl.getError())
-            .str();
-    return Result<std::shared_ptr<ast::Expression>, std::string>(s);
+    adt::Error s = {"failed to parse tuple elements in tuple expression",
+                    tupleEl.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   tuple.setElements(tupleEl.getValue());
 
   if (!check(TokenKind::ParenClose)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse ) token in tuple expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse ) token in tuple expression",
+                   getLocation()));
     assert(eat(TokenKind::ParenOpen));
   }
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<TupleExpression>(tuple));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<TupleExpression>(tuple));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseGroupedExpression(Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   GroupedExpression group = {loc};
 
   if (!check(TokenKind::ParenOpen))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse ( token in grouped expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse ( token in grouped expression",
+                   getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
-  Result<std::shared_ptr<ast::Expression>, std::string> first =
+  StringResult<std::shared_ptr<ast::Expression>> first =
       parseExpression({}, restrictions);
   if (!first) {
-    llvm::errs() << "failed to parse tuple elements in grouped expression: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse tuple elements in grouped expression",
+                    first.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   group.setExpression(first.getValue());
 
   if (!check(TokenKind::ParenClose))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse ) token in grouped expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse ) token in grouped expression",
+                   getLocation()));
   assert(eat(TokenKind::ParenClose));
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<GroupedExpression>(group));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<GroupedExpression>(group));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseGroupedOrTupleExpression(Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   CheckPoint cp = getCheckPoint();
 
   if (!check(TokenKind::ParenOpen))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse ( token in grouped or tuple expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse ( token in grouped or tuple expression",
+                   getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
@@ -819,21 +809,13 @@ Parser::parseGroupedOrTupleExpression(Restrictions restrictions) {
     return parseTupleExpression(restrictions);
   }
 
-  Result<std::shared_ptr<ast::Expression>, std::string> first =
+  StringResult<std::shared_ptr<ast::Expression>> first =
       parseExpression({}, restrictions);
   if (!first) {
-    llvm::errs()
-        << "failed to parse expression in grouped or tuple expression: "
-        << first.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to parse expression in grouped or tuple expression: ",
-            first.getError())
-            .str();
-    return Result<std::shared_ptr<ast::Expression>, std::string>(s);
+    adt::Error s = {"failed to parse expression in grouped or tuple expression",
+                    first.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   if (check(TokenKind::ParenClose)) {
@@ -867,8 +849,9 @@ Parser::parseGroupedOrTupleExpression(Restrictions restrictions) {
 //   assert(eat(TokenKind::Dot));
 // }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseCompoundAssignmentExpression(std::shared_ptr<ast::Expression> e,
+                                          Precedence rightBindingPower,
                                           Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -876,65 +859,57 @@ Parser::parseCompoundAssignmentExpression(std::shared_ptr<ast::Expression> e,
 
   comp.setLhs(e);
 
-  Precedence pred;
-  if (check(TokenKind::PlusEq)) {
+  switch (getToken().getKind()) {
+  case TokenKind::PlusEq:
     comp.setKind(CompoundAssignmentExpressionKind::Add);
-    pred = Precedence::PlusAssign;
-    assert(eat(TokenKind::PlusEq));
-  } else if (check(TokenKind::MinusEq)) {
+    break;
+  case TokenKind::MinusEq:
     comp.setKind(CompoundAssignmentExpressionKind::Sub);
-    pred = Precedence::MinusAssign;
-    assert(eat(TokenKind::MinusEq));
-  } else if (check(TokenKind::StarEq)) {
+    break;
+  case TokenKind::StarEq:
     comp.setKind(CompoundAssignmentExpressionKind::Mul);
-    pred = Precedence::MulAssign;
-    assert(eat(TokenKind::StarEq));
-  } else if (check(TokenKind::SlashEq)) {
+    break;
+  case TokenKind::SlashEq:
     comp.setKind(CompoundAssignmentExpressionKind::Div);
-    pred = Precedence::DivAssign;
-    assert(eat(TokenKind::SlashEq));
-  } else if (check(TokenKind::PercentEq)) {
+    break;
+  case TokenKind::PercentEq:
     comp.setKind(CompoundAssignmentExpressionKind::Rem);
-    pred = Precedence::RemAssign;
-    assert(eat(TokenKind::PercentEq));
-  } else if (check(TokenKind::CaretEq)) {
+    break;
+  case TokenKind::CaretEq:
     comp.setKind(CompoundAssignmentExpressionKind::Xor);
-    pred = Precedence::XorAssign;
-    assert(eat(TokenKind::CaretEq));
-  } else if (check(TokenKind::AndEq)) {
+    break;
+  case TokenKind::AndEq:
     comp.setKind(CompoundAssignmentExpressionKind::And);
-    pred = Precedence::AndAssign;
-    assert(eat(TokenKind::AndEq));
-  } else if (check(TokenKind::OrEq)) {
+    break;
+  case TokenKind::OrEq:
     comp.setKind(CompoundAssignmentExpressionKind::Or);
-    pred = Precedence::OrAssign;
-    assert(eat(TokenKind::OrEq));
-  } else if (check(TokenKind::ShlEq)) {
+    break;
+  case TokenKind::ShlEq:
     comp.setKind(CompoundAssignmentExpressionKind::Shl);
-    pred = Precedence::ShlAssign;
-    assert(eat(TokenKind::ShlEq));
-  } else if (check(TokenKind::ShrEq)) {
+    break;
+  case TokenKind::ShrEq:
     comp.setKind(CompoundAssignmentExpressionKind::Shr);
-    pred = Precedence::ShrAssign;
-    assert(eat(TokenKind::ShrEq));
-  } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse token in compound assignment expression");
+    break;
+  default:
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse token in compound assignment expression",
+                   getLocation()));
   }
+  [[maybe_unused]] bool eaten = eat(getToken().getKind());
+  assert(eaten);
 
-  Result<std::shared_ptr<ast::Expression>, std::string> expr =
-      parseExpression(pred, {}, restrictions);
+  StringResult<std::shared_ptr<ast::Expression>> expr =
+      parseExpression(rightBindingPower, {}, restrictions);
   if (!expr) {
-    llvm::errs()
-        << "failed to parse expression in compound assignment expression: "
-        << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in compound assignment "
+                    "expression",
+                    expr.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   comp.setRhs(expr.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<CompoundAssignmentExpression>(comp));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<CompoundAssignmentExpression>(comp));
 }
 
 StringResult<std::shared_ptr<ast::Expression>>
@@ -945,41 +920,44 @@ Parser::parseErrorPropagationExpression(std::shared_ptr<ast::Expression> er) {
 
   if (!check(TokenKind::QMark)) {
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse ? token in await expression");
+        adt::Error("failed to parse ? token in await expression",
+                   getLocation()));
   }
   assert(eat(TokenKind::QMark));
 
   ep.setLhs(er);
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<ErrorPropagationExpression>(ep));
+      context->create<ErrorPropagationExpression>(ep));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseAwaitExpression(std::shared_ptr<ast::Expression> e) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   AwaitExpression a = {loc};
 
   if (!check(TokenKind::Dot)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse : token in await expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse : token in await expression",
+                   getLocation()));
   }
   assert(eat(TokenKind::Dot));
 
   if (!checkKeyWord(KeyWordKind::KW_AWAIT)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse await keyword in await expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse await keyword in await expression",
+                   getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_AWAIT));
 
   a.setLhs(e);
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<AwaitExpression>(a));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<AwaitExpression>(a));
 }
 
-adt::Result<std::shared_ptr<ast::Expression>, std::string>
+adt::StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseAwaitExpression(std::shared_ptr<ast::Expression> e,
                              std::span<ast::OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
@@ -987,24 +965,26 @@ Parser::parseAwaitExpression(std::shared_ptr<ast::Expression> e,
   AwaitExpression a = {loc};
 
   if (!check(TokenKind::Dot)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse : token in await expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse : token in await expression",
+                   getLocation()));
   }
   assert(eat(TokenKind::Dot));
 
   if (!checkKeyWord(KeyWordKind::KW_AWAIT)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse await keyword in await expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse await keyword in await expression",
+                   getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_AWAIT));
 
   a.setLhs(e);
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<AwaitExpression>(a));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<AwaitExpression>(a));
 }
 
-Result<ast::Scrutinee, std::string> Parser::parseScrutinee() {
+StringResult<ast::Scrutinee> Parser::parseScrutinee() {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
   Scrutinee scrut = {loc};
@@ -1012,21 +992,19 @@ Result<ast::Scrutinee, std::string> Parser::parseScrutinee() {
   Restrictions restrictions;
   restrictions.canBeStructExpr = false;
 
-  Result<std::shared_ptr<ast::Expression>, std::string> expr =
+  StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse expression in scrutinee: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in scrutinee", expr.getError()};
+    return StringResult<ast::Scrutinee>(s);
   }
 
   scrut.setExpression(expr.getValue());
 
-  return Result<ast::Scrutinee, std::string>(scrut);
+  return StringResult<ast::Scrutinee>(scrut);
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseUnsafeBlockExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1035,26 +1013,26 @@ Parser::parseUnsafeBlockExpression(std::span<OuterAttribute>) {
   if (checkKeyWord(KeyWordKind::KW_UNSAFE)) {
     assert(eatKeyWord(KeyWordKind::KW_UNSAFE));
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse unsafe token in unsafe block expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse unsafe token in unsafe block expression",
+                   getLocation()));
   }
 
-  Result<std::shared_ptr<ast::Expression>, std::string> block =
+  StringResult<std::shared_ptr<ast::Expression>> block =
       parseBlockExpression({});
   if (!block) {
-    llvm::errs()
-        << "failed to parse block expression in unsafe block expression: "
-        << block.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block expression in unsafe block "
+                    "expression",
+                    block.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   unsafeExpr.setBlock(block.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<UnsafeBlockExpression>(unsafeExpr));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<UnsafeBlockExpression>(unsafeExpr));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseAsyncBlockExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1063,8 +1041,8 @@ Parser::parseAsyncBlockExpression(std::span<OuterAttribute>) {
   if (checkKeyWord(KeyWordKind::KW_ASYNC)) {
     assert(eatKeyWord(KeyWordKind::KW_ASYNC));
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to async token in async expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to async token in async expression", getLocation()));
   }
 
   if (checkKeyWord(KeyWordKind::KW_MOVE)) {
@@ -1072,22 +1050,21 @@ Parser::parseAsyncBlockExpression(std::span<OuterAttribute>) {
     asyncExpr.setMove();
   }
 
-  Result<std::shared_ptr<ast::Expression>, std::string> block =
+  StringResult<std::shared_ptr<ast::Expression>> block =
       parseBlockExpression({});
   if (!block) {
-    llvm::errs()
-        << "failed to parse block expression in async block expression: "
-        << block.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block expression in async block "
+                    "expression",
+                    block.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   asyncExpr.setBlock(block.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<AsyncBlockExpression>(asyncExpr));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<AsyncBlockExpression>(asyncExpr));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseBreakExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1097,8 +1074,8 @@ Parser::parseBreakExpression(std::span<OuterAttribute>) {
     assert(eatKeyWord(KeyWordKind::KW_BREAK));
   } else {
     // check error
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse break keyword");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse break keyword", getLocation()));
   }
 
   if (check(TokenKind::LIFETIME_OR_LABEL)) {
@@ -1110,26 +1087,25 @@ Parser::parseBreakExpression(std::span<OuterAttribute>) {
   }
 
   if (check(TokenKind::Semi)) {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<BreakExpression>(breakExpr));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<BreakExpression>(breakExpr));
   } else {
     Restrictions restrictions;
-    Result<std::shared_ptr<ast::Expression>, std::string> expr =
+    StringResult<std::shared_ptr<ast::Expression>> expr =
         parseExpression({}, restrictions);
     if (!expr) {
-      llvm::errs() << "failed to parse expression in return expression: "
-                   << expr.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse expression in return expression",
+                      expr.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     breakExpr.setExpression(expr.getValue());
   }
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<BreakExpression>(breakExpr));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<BreakExpression>(breakExpr));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseIfLetExpression(std::span<OuterAttribute> outer) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1138,25 +1114,25 @@ Parser::parseIfLetExpression(std::span<OuterAttribute> outer) {
   if (checkKeyWord(KeyWordKind::KW_IF)) {
     assert(eatKeyWord(KeyWordKind::KW_IF));
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-
-        "failed to parse if key word in if let expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse if key word in if let expression",
+                   getLocation()));
   }
 
   if (checkKeyWord(KeyWordKind::KW_LET)) {
     assert(eatKeyWord(KeyWordKind::KW_LET));
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse let key word in if let expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse let key word in if let expression",
+                   getLocation()));
   }
 
   StringResult<std::shared_ptr<ast::patterns::Pattern>> pattern =
       parsePattern();
   if (!pattern) {
-    llvm::errs() << "failed to parse pattern in if let expression: "
-                 << pattern.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse pattern in if let expression",
+                    pattern.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   ifLet.setPattern(pattern.getValue());
@@ -1164,79 +1140,75 @@ Parser::parseIfLetExpression(std::span<OuterAttribute> outer) {
   if (check(TokenKind::Eq)) {
     assert(eat(TokenKind::Eq));
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse = token in if let expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse = token in if let expression",
+                   getLocation()));
   }
 
-  Result<ast::Scrutinee, std::string> scrutinee = parseScrutinee();
+  StringResult<ast::Scrutinee> scrutinee = parseScrutinee();
   if (!scrutinee) {
-    llvm::errs() << "failed to parse scrutinee in if let expression: "
-                 << scrutinee.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse scrutinee in if let expression",
+                    scrutinee.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   ifLet.setScrutinee(scrutinee.getValue());
 
-  Result<std::shared_ptr<ast::Expression>, std::string> block =
+  StringResult<std::shared_ptr<ast::Expression>> block =
       parseBlockExpression({});
   if (!block) {
-    llvm::errs() << "failed to parse block expression in if let expression: "
-                 << block.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block expression in if let expression",
+                    block.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   ifLet.setBlock(block.getValue());
 
   if (checkKeyWord(KeyWordKind::KW_ELSE)) {
     assert(eatKeyWord(KeyWordKind::KW_ELSE));
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<IfLetExpression>(ifLet));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<IfLetExpression>(ifLet));
     // done
   }
 
   // FIXME
   if (checkKeyWord(KeyWordKind::KW_IF) &&
       checkKeyWord(KeyWordKind::KW_LET, 1)) {
-    Result<std::shared_ptr<ast::Expression>, std::string> ifLetExpr =
+    StringResult<std::shared_ptr<ast::Expression>> ifLetExpr =
         parseIfLetExpression({});
     if (!ifLetExpr) {
-      llvm::errs() << "failed to parse if let expression in if let expression: "
-                   << ifLetExpr.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse if let expression in if let expression",
+                      ifLetExpr.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     ifLet.setIfLet(ifLetExpr.getValue());
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<IfLetExpression>(ifLet));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<IfLetExpression>(ifLet));
   } else if (checkKeyWord(KeyWordKind::KW_IF) &&
              !checkKeyWord(KeyWordKind::KW_LET, 1)) {
-    Result<std::shared_ptr<ast::Expression>, std::string> ifExpr =
+    StringResult<std::shared_ptr<ast::Expression>> ifExpr =
         parseIfExpression({});
     if (!ifExpr) {
-      llvm::errs() << "failed to parse if expression in if let expression: "
-                   << ifExpr.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse if expression in if let expression",
+                      ifExpr.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     ifLet.setIf(ifExpr.getValue());
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<IfLetExpression>(ifLet));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<IfLetExpression>(ifLet));
   }
-  Result<std::shared_ptr<ast::Expression>, std::string> block2 =
+  StringResult<std::shared_ptr<ast::Expression>> block2 =
       parseBlockExpression({});
   if (!block2) {
-    llvm::errs() << "failed to parse block expression in if let expression: "
-                 << block2.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block expression in if let expression",
+                    block2.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   ifLet.setTailBlock(block2.getValue());
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<IfLetExpression>(ifLet));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<IfLetExpression>(ifLet));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseDereferenceExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1245,29 +1217,29 @@ Parser::parseDereferenceExpression(std::span<OuterAttribute>) {
   if (check(TokenKind::Star)) {
     assert(eat(TokenKind::Star));
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse * token in dereference expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse * token in dereference expression",
+                   getLocation()));
   }
 
   Restrictions enteredFromUnary;
   enteredFromUnary.enteredFromUnary = true;
   enteredFromUnary.canBeStructExpr = false;
-  Result<std::shared_ptr<ast::Expression>, std::string> expr =
+  StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression(Precedence::UnaryAsterisk, {}, enteredFromUnary);
   if (!expr) {
-    llvm::errs() << "failed to parse expression in dereference expression: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in dereference expression",
+                    expr.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   defer.setExpression(expr.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<DereferenceExpression>(defer));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<DereferenceExpression>(defer));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseIfExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1276,30 +1248,27 @@ Parser::parseIfExpression(std::span<OuterAttribute>) {
   if (checkKeyWord(KeyWordKind::KW_IF)) {
     assert(eatKeyWord(KeyWordKind::KW_IF));
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse if expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse if expression", getLocation()));
   }
 
   Restrictions noStructExpr;
   noStructExpr.canBeStructExpr = false;
-  Result<std::shared_ptr<ast::Expression>, std::string> cond =
+  StringResult<std::shared_ptr<ast::Expression>> cond =
       parseExpression({}, noStructExpr);
   if (!cond) {
-    llvm::errs() << "failed to parse condition in if expression: "
-                 << cond.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse condition in if expression",
+                    cond.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   ifExpr.setCondition(cond.getValue());
 
-  Result<std::shared_ptr<ast::Expression>, std::string> block =
+  StringResult<std::shared_ptr<ast::Expression>> block =
       parseBlockExpression({});
   if (!block) {
     llvm::errs() << Token2String(getToken().getKind()) << "\n";
-    llvm::errs() << "failed to parse block in if expression: "
-                 << block.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block in if expression", block.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   ifExpr.setBlock(block.getValue());
 
@@ -1307,57 +1276,54 @@ Parser::parseIfExpression(std::span<OuterAttribute>) {
     assert(eatKeyWord(KeyWordKind::KW_ELSE));
   } else {
     // without else
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<IfExpression>(ifExpr));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<IfExpression>(ifExpr));
   }
 
   // FIXME
   if (checkKeyWord(KeyWordKind::KW_IF) &&
       checkKeyWord(KeyWordKind::KW_LET, 1)) {
-    Result<std::shared_ptr<ast::Expression>, std::string> ifLetExpr =
+    StringResult<std::shared_ptr<ast::Expression>> ifLetExpr =
         parseIfLetExpression({});
     if (!ifLetExpr) {
-      llvm::errs() << "failed to parse if let expression in if expression: "
-                   << ifLetExpr.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse if let expression in if expression",
+                      ifLetExpr.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     ifExpr.setTrailing(ifLetExpr.getValue());
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<IfExpression>(ifExpr));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<IfExpression>(ifExpr));
   } else if (checkKeyWord(KeyWordKind::KW_IF) &&
              !checkKeyWord(KeyWordKind::KW_LET, 1)) {
-    Result<std::shared_ptr<ast::Expression>, std::string> ifExprTail =
+    StringResult<std::shared_ptr<ast::Expression>> ifExprTail =
         parseIfExpression({});
     if (!ifExprTail) {
-      llvm::errs() << "failed to parse if expression in if expression: "
-                   << ifExprTail.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse if expression in if expression",
+                      ifExprTail.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     ifExpr.setTrailing(ifExprTail.getValue());
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<IfExpression>(ifExpr));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<IfExpression>(ifExpr));
   } else {
-    Result<std::shared_ptr<ast::Expression>, std::string> block =
+    StringResult<std::shared_ptr<ast::Expression>> block =
         parseBlockExpression({});
     if (!block) {
-      llvm::errs() << "failed to parse block expression in if expression: "
-                   << block.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse block expression in if expression",
+                      block.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     ifExpr.setTrailing(block.getValue());
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<IfExpression>(ifExpr));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<IfExpression>(ifExpr));
   }
 
   // no tail
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<IfExpression>(ifExpr));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<IfExpression>(ifExpr));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseBorrowExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1385,22 +1351,20 @@ Parser::parseBorrowExpression(std::span<OuterAttribute>) {
   if (isMutable)
     pred = Precedence::UnaryAndMut;
 
-  Result<std::shared_ptr<ast::Expression>, std::string> expr =
+  StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression(pred, {}, enteredFromUnary);
   if (!expr) {
-    llvm::errs() << "failed to parse borrow tail expression: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse borrow tail expression", expr.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   borrow.setExpression(expr.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<BorrowExpression>(borrow));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<BorrowExpression>(borrow));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseNegationExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1416,28 +1380,28 @@ Parser::parseNegationExpression(std::span<OuterAttribute>) {
     pred = Precedence::UnaryNot;
     assert(eat(TokenKind::Not));
   } else {
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to negation token in negation expression");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to negation token in negation expression",
+                   getLocation()));
   }
 
   Restrictions enteredFromUnary;
   enteredFromUnary.enteredFromUnary = true;
-  Result<std::shared_ptr<ast::Expression>, std::string> expr =
+  StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression(pred, {}, enteredFromUnary);
   if (!expr) {
-    llvm::errs() << "failed to parse negation tail expression: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse negation tail expression",
+                    expr.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   neg.setRight(expr.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<NegationExpression>(neg));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<NegationExpression>(neg));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseContinueExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1445,8 +1409,8 @@ Parser::parseContinueExpression(std::span<OuterAttribute>) {
   ContinueExpression cont = {loc};
 
   if (!checkKeyWord(KeyWordKind::KW_CONTINUE))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse continue token");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse continue token", getLocation()));
 
   assert(eatKeyWord(KeyWordKind::KW_CONTINUE));
 
@@ -1458,11 +1422,11 @@ Parser::parseContinueExpression(std::span<OuterAttribute>) {
     cont.setLifetime(l);
   }
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<ContinueExpression>(cont));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<ContinueExpression>(cont));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseReturnExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -1473,30 +1437,24 @@ Parser::parseReturnExpression(std::span<OuterAttribute>) {
   //               << "\n";
 
   if (!checkKeyWord(KeyWordKind::KW_RETURN))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse return token");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse return token", getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_RETURN));
 
   if (check(TokenKind::Semi))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<ReturnExpression>(ret));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<ReturnExpression>(ret));
 
   if (check(TokenKind::Eof)) // for gtest
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        std::make_shared<ReturnExpression>(ret));
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        context->create<ReturnExpression>(ret));
 
   Restrictions restrictions;
-  Result<std::shared_ptr<ast::Expression>, std::string> expr =
+  StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse return tail expression: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0} {1}", "failed to parse return tail expression: ",
-                      expr.getError())
-            .str();
-    return Result<std::shared_ptr<ast::Expression>, std::string>(s);
+    adt::Error s = {"failed to parse return tail expression", expr.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
     // exit(EXIT_FAILURE);
   }
 
@@ -1505,11 +1463,11 @@ Parser::parseReturnExpression(std::span<OuterAttribute>) {
   //  llvm::errs() << "end of return expression: "
   //               << Token2String(getToken().getKind()) << "\n";
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<ReturnExpression>(ret));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<ReturnExpression>(ret));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseExpressionWithBlock(std::span<OuterAttribute> outer) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   //  std::vector<ast::OuterAttribute> attributes;
@@ -1566,11 +1524,11 @@ Parser::parseExpressionWithBlock(std::span<OuterAttribute> outer) {
     return parseIteratorLoopExpression(outer);
 
   /// FIXME
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      "failed to parse expression with block");
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      adt::Error("failed to parse expression with block", getLocation()));
 }
 
-// Result<std::shared_ptr<ast::Expression>, std::string>
+// StringResult<std::shared_ptr<ast::Expression>>
 // Parser::parseExpressionWithoutBlock() {
 //   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
 //
@@ -1585,7 +1543,6 @@ Parser::parseExpressionWithBlock(std::span<OuterAttribute> outer) {
 //       llvm::errs()
 //           << "failed to parse outer attributes expression without block: "
 //           << outerAttributes.getError() << "\n";
-//       printFunctionStack();
 //       exit(EXIT_FAILURE);
 //     }
 //     outer = outerAttributes.getValue();
@@ -1828,22 +1785,22 @@ Parser::parseMacroInvocationExpressionPratt(
 
   if (!check(TokenKind::Not))
     return adt::StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse ! token in parse macro invocation expression pratt");
+        adt::Error(
+            "failed to parse ! token in parse macro invocation expression pratt",
+            getLocation()));
   assert(eat(TokenKind::Not));
 
   StringResult<std::shared_ptr<ast::DelimTokenTree>> token =
       parseDelimTokenTree();
   if (!token) {
-    llvm::errs()
-        << "failed to delim token tree in macro invocation expression: "
-        << token.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to delim token tree in macro invocation expression",
+                    token.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   macro.setTree(token.getValue());
 
   return adt::StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<MacroInvocationExpression>(macro));
+      context->create<MacroInvocationExpression>(macro));
 }
 
 } // namespace rust_compiler::parser
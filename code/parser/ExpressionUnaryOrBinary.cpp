@@ -49,10 +49,9 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
       StringResult<std::shared_ptr<Expression>> path =
           parsePathInExpressionPratt();
       if (!path) {
-        llvm::errs() << "failed to parse pathin expression pratt: "
-                     << path.getError() << "\n";
         return StringResult<std::shared_ptr<ast::Expression>>(
-            "failed to parse pathin expression prat");
+            adt::Error("failed to parse pathin expression prat",
+                       getLocation()));
       }
 
       switch (getToken().getKind()) {
@@ -146,11 +145,13 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
         neg.setRight(expr.getValue());
         neg.setNot();
         return StringResult<std::shared_ptr<ast::Expression>>(
-            std::make_shared<NegationExpression>(neg));
+            context->create<NegationExpression>(neg));
       } else {
         // report error
         return StringResult<std::shared_ptr<ast::Expression>>(
-            "failed to parse expression in unary expression with UnaryNot");
+            adt::Error(
+                "failed to parse expression in unary expression with UnaryNot",
+                getLocation()));
       }
     }
     case TokenKind::Star: {
@@ -165,11 +166,13 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
         DereferenceExpression der = {getLocation()};
         der.setExpression(expr.getValue());
         return StringResult<std::shared_ptr<ast::Expression>>(
-            std::make_shared<DereferenceExpression>(der));
+            context->create<DereferenceExpression>(der));
       } else {
         // report error
         return StringResult<std::shared_ptr<ast::Expression>>(
-            "failed to parse expression in unary expression with UnaryStar");
+            adt::Error(
+                "failed to parse expression in unary expression with UnaryStar",
+                getLocation()));
       }
     }
     case TokenKind::And: {
@@ -188,12 +191,14 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
           borrow.setMut();
           borrow.setExpression(expr.getValue());
           return StringResult<std::shared_ptr<ast::Expression>>(
-              std::make_shared<BorrowExpression>(borrow));
+              context->create<BorrowExpression>(borrow));
         } else {
           // report error
           return StringResult<std::shared_ptr<ast::Expression>>(
-              "failed to parse expression in unary expression with "
-              "UnaryAndMut");
+              adt::Error(
+                  "failed to parse expression in unary expression with "
+                  "UnaryAndMut",
+                  getLocation()));
         }
       } else {
         StringResult<std::shared_ptr<Expression>> expr =
@@ -202,11 +207,13 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
           BorrowExpression borrow = {getLocation()};
           borrow.setExpression(expr.getValue());
           return StringResult<std::shared_ptr<ast::Expression>>(
-              std::make_shared<BorrowExpression>(borrow));
+              context->create<BorrowExpression>(borrow));
         } else {
           // report error
           return StringResult<std::shared_ptr<ast::Expression>>(
-              "failed to parse expression in unary expression with UnaryAnd");
+              adt::Error(
+                  "failed to parse expression in unary expression with UnaryAnd",
+                  getLocation()));
         }
       }
     }
@@ -226,12 +233,14 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
           borrow.setExpression(expr.getValue());
           borrow.setDoubleBorrow();
           return StringResult<std::shared_ptr<ast::Expression>>(
-              std::make_shared<BorrowExpression>(borrow));
+              context->create<BorrowExpression>(borrow));
         } else {
           // report error
           return StringResult<std::shared_ptr<ast::Expression>>(
-              "failed to parse expression in unary expression with "
-              "UnaryAndMut");
+              adt::Error(
+                  "failed to parse expression in unary expression with "
+                  "UnaryAndMut",
+                  getLocation()));
         }
       } else {
         StringResult<std::shared_ptr<Expression>> expr =
@@ -241,11 +250,13 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
           borrow.setExpression(expr.getValue());
           borrow.setDoubleBorrow();
           return StringResult<std::shared_ptr<ast::Expression>>(
-              std::make_shared<BorrowExpression>(borrow));
+              context->create<BorrowExpression>(borrow));
         } else {
           // report error
           return StringResult<std::shared_ptr<ast::Expression>>(
-              "failed to parse expression in unary expression with UnaryAnd");
+              adt::Error(
+                  "failed to parse expression in unary expression with UnaryAnd",
+                  getLocation()));
         }
       }
       break;
@@ -253,7 +264,8 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
     case TokenKind::PathSep: {
       // report error
       return StringResult<std::shared_ptr<ast::Expression>>(
-          "unexpected :: in unary expression with UnaryAnd");
+          adt::Error("unexpected :: in unary expression with UnaryAnd",
+                     getLocation()));
     }
     case TokenKind::DotDot:
     case TokenKind::DotDotEq:
@@ -279,7 +291,8 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
       if (!path) {
         // handle error
         return StringResult<std::shared_ptr<ast::Expression>>(
-            "failed to parse pathin expression in unary expression");
+            adt::Error("failed to parse pathin expression in unary expression",
+                       getLocation()));
       }
 
       std::shared_ptr<PathInExpression> p =
@@ -317,16 +330,8 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
       }
     }
     default: {
-      llvm::errs() << getToken().getLocation().toString() << "\n";
-      llvm::errs() << "parseUnaryExpressio2n: error unhandled token kind: "
-                   << Token2String(getToken().getKind()) << "\n";
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "parseUnaryExpression: error unhandled token kind: ",
-                        Token2String(getToken().getKind()))
-              .str();
-
-      return StringResult<std::shared_ptr<ast::Expression>>(s);
+      return StringResult<std::shared_ptr<ast::Expression>>(adt::Error(
+          "parseUnaryExpression: error unhandled token kind", getLocation()));
     }
     }
   }
@@ -346,7 +351,8 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
       if (!path) {
         // handle error
         return StringResult<std::shared_ptr<ast::Expression>>(
-            "failed to parse pathin expression in unary expression");
+            adt::Error("failed to parse pathin expression in unary expression",
+                       getLocation()));
       }
 
       std::shared_ptr<PathInExpression> p =
@@ -441,7 +447,7 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
       llvm::errs() << "in parseUnaryExpression: "
                    << KeyWord2String(getToken().getKeyWordKind()) << "\n";
       return StringResult<std::shared_ptr<ast::Expression>>(
-          "unexpected token in unary expression");
+          adt::Error("unexpected token in unary expression", getLocation()));
     }
     }
   }
@@ -450,7 +456,7 @@ Parser::parseUnaryExpression(std::span<ast::OuterAttribute> outer,
   llvm::errs() << "in parseUnaryExpression: "
                << KeyWord2String(getToken().getKeyWordKind()) << "\n";
   return StringResult<std::shared_ptr<ast::Expression>>(
-      "unexpected token in unary expression");
+      adt::Error("unexpected token in unary expression", getLocation()));
 }
 
 ///  Note that this only parses segment-first paths, not global ones, i.e.
@@ -491,7 +497,8 @@ StringResult<std::shared_ptr<Expression>> Parser::parsePathInExpressionPratt() {
         llvm::outs() << "unknown keyword: " << *kind << "\n";
       }
       return StringResult<std::shared_ptr<Expression>>(
-          "unknown keyword in parsePathInExpressionPratt");
+          adt::Error("unknown keyword in parsePathInExpressionPratt",
+                     getLocation()));
     }
     }
     assert(eat(TokenKind::Keyword));
@@ -500,7 +507,8 @@ StringResult<std::shared_ptr<Expression>> Parser::parsePathInExpressionPratt() {
                  << "in start of pathin expression"
                  << "\n";
     return StringResult<std::shared_ptr<Expression>>(
-        "unknown token in parsePathInExpressionPratt");
+        adt::Error("unknown token in parsePathInExpressionPratt",
+                   getLocation()));
   }
 
   PathExprSegment initialSegment = PathExprSegment(getLocation());
@@ -510,7 +518,7 @@ StringResult<std::shared_ptr<Expression>> Parser::parsePathInExpressionPratt() {
       (getToken(1).getKind() == TokenKind::Lt)) {
     assert(eat(TokenKind::PathSep));
 
-    adt::Result<ast::GenericArgs, std::string> arg = parseGenericArgs();
+    adt::StringResult<ast::GenericArgs> arg = parseGenericArgs();
     if (arg)
       initialSegment.addGenerics(arg.getValue());
   }
@@ -521,14 +529,14 @@ StringResult<std::shared_ptr<Expression>> Parser::parsePathInExpressionPratt() {
     assert(eat(TokenKind::PathSep));
 
     // parse the segment, it is a real error if it fails
-    adt::Result<ast::PathExprSegment, std::string> seg = parsePathExprSegment();
+    adt::StringResult<ast::PathExprSegment> seg = parsePathExprSegment();
     if (!seg) {
       // ignore error ???
       llvm::errs() << "failed to parse expected path expr segment in path in "
                       "expression pratt"
                    << "\n";
       return StringResult<std::shared_ptr<Expression>>(
-          "failed to pars path expr segment");
+          adt::Error("failed to pars path expr segment", getLocation()));
     }
 
     pathIn.addDoubleColon();
@@ -536,7 +544,7 @@ StringResult<std::shared_ptr<Expression>> Parser::parsePathInExpressionPratt() {
   }
 
   return StringResult<std::shared_ptr<Expression>>(
-      std::make_shared<PathInExpression>(pathIn));
+      context->create<PathInExpression>(pathIn));
 }
 
 } // namespace rust_compiler::parser
@@ -13,7 +13,7 @@ using namespace rust_compiler::adt;
 
 namespace rust_compiler::parser {
 
-adt::Result<std::shared_ptr<ast::Expression>, std::string>
+adt::StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseExpressionWithoutBlock(std::span<ast::OuterAttribute> outer,
                                     Restrictions restrictions) {
 //  llvm::errs() << "parseExpressionWithoutBlock"
@@ -54,33 +54,18 @@ Parser::parseExpressionWithoutBlock(std::span<ast::OuterAttribute> outer,
     adt::StringResult<std::shared_ptr<ast::Expression>> expr =
         parseExpression(outer, restrictions);
     if (!expr) {
-      llvm::errs() << "parseExpressionWithoutBlock: failed to parse "
-                      "expression: "
-                   << expr.getError() << "\n";
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "parseExpressionWithoutBlock: failed to parse "
-                        "expression ",
-                        expr.getError())
-              .str();
-      return adt::Result<std::shared_ptr<ast::Expression>, std::string>(s);
+      adt::Error s = {"parseExpressionWithoutBlock: failed to parse "
+                      "expression",
+                      expr.getError()};
+      return adt::StringResult<std::shared_ptr<ast::Expression>>(s);
     }
 
     switch (expr.getValue()->getExpressionKind()) {
     case ast::ExpressionKind::ExpressionWithBlock: {
-      llvm::errs() << "parseExpressionWithoutBlock: expected expression "
-                      "without block but:"
-                   << "\n";
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "parseExpressionWithoutBlock: expected expression "
-                        "without block but:",
-                        ExpressionWithBlockKind2String(
-                            std::static_pointer_cast<ast::ExpressionWithBlock>(
-                                expr.getValue())
-                                ->getWithBlockKind()))
-              .str();
-      return adt::Result<std::shared_ptr<ast::Expression>, std::string>(s);
+      return adt::StringResult<std::shared_ptr<ast::Expression>>(
+          adt::Error("parseExpressionWithoutBlock: expected expression "
+                     "without block",
+                     expr.getValue()->getLocation()));
     }
     case ast::ExpressionKind::ExpressionWithoutBlock: {
       return expr;
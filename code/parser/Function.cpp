@@ -43,12 +43,12 @@ StringResult<std::shared_ptr<ast::SelfParam>> Parser::parseShorthandSelf() {
 
   if (!checkKeyWord(KeyWordKind::KW_SELFVALUE))
     return StringResult<std::shared_ptr<ast::SelfParam>>(
-        "failed to parse self");
+        adt::Error("failed to parse self", getLocation()));
 
   assert(eatKeyWord(KeyWordKind::KW_SELFVALUE));
 
   return StringResult<std::shared_ptr<ast::SelfParam>>(
-      std::make_shared<ShorthandSelf>(self));
+      context->create<ShorthandSelf>(self));
 }
 
 StringResult<std::shared_ptr<ast::SelfParam>> Parser::parseTypedSelf() {
@@ -62,27 +62,25 @@ StringResult<std::shared_ptr<ast::SelfParam>> Parser::parseTypedSelf() {
 
   if (!checkKeyWord(KeyWordKind::KW_SELFVALUE))
     return StringResult<std::shared_ptr<ast::SelfParam>>(
-        "failed to parse self");
+        adt::Error("failed to parse self", getLocation()));
 
   assert(eatKeyWord(KeyWordKind::KW_SELFVALUE));
 
   if (!check(TokenKind::Colon))
     return StringResult<std::shared_ptr<ast::SelfParam>>(
-        "failed to parse colon");
+        adt::Error("failed to parse colon", getLocation()));
 
   assert(eat(TokenKind::Colon));
 
-  Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
-      parseType();
+  StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type: " << type.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type", type.getError()};
+    return StringResult<std::shared_ptr<ast::SelfParam>>(s);
   }
   self.setType(type.getValue());
 
   return StringResult<std::shared_ptr<ast::SelfParam>>(
-      std::make_shared<TypedSelf>(self));
+      context->create<TypedSelf>(self));
 }
 
 StringResult<ast::SelfParam> Parser::parseSelfParam() {
@@ -98,10 +96,9 @@ StringResult<ast::SelfParam> Parser::parseSelfParam() {
     StringResult<std::vector<ast::OuterAttribute>> parsedOuterAttributes =
         parseOuterAttributes();
     if (!parsedOuterAttributes) {
-      llvm::errs() << "failed to parse outer attributes in self param: "
-                   << parsedOuterAttributes.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in self param",
+                      parsedOuterAttributes.getError()};
+      return StringResult<ast::SelfParam>(s);
     }
     std::vector<ast::OuterAttribute> outer = parsedOuterAttributes.getValue();
     self.setOuterAttributes(outer);
@@ -111,10 +108,9 @@ StringResult<ast::SelfParam> Parser::parseSelfParam() {
     // ShordhandSelf
     StringResult<std::shared_ptr<ast::SelfParam>> shortA = parseShorthandSelf();
     if (!shortA) {
-      llvm::errs() << "failed to parse shorthand self in self param: "
-                   << shortA.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse shorthand self in self param",
+                      shortA.getError()};
+      return StringResult<ast::SelfParam>(s);
     }
     self.setSelf(SelfParamKind::ShorthandSelf, shortA.getValue());
     return StringResult<ast::SelfParam>(self);
@@ -123,10 +119,9 @@ StringResult<ast::SelfParam> Parser::parseSelfParam() {
       if (check(TokenKind::Colon, 2)) {
         StringResult<std::shared_ptr<ast::SelfParam>> shortA = parseTypedSelf();
         if (!shortA) {
-          llvm::errs() << "failed to parse shortand self in self param: "
-                       << shortA.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse shortand self in self param",
+                          shortA.getError()};
+          return StringResult<ast::SelfParam>(s);
         }
         self.setSelf(SelfParamKind::TypeSelf, shortA.getValue());
         return StringResult<ast::SelfParam>(self);
@@ -135,10 +130,9 @@ StringResult<ast::SelfParam> Parser::parseSelfParam() {
         StringResult<std::shared_ptr<ast::SelfParam>> shortA =
             parseShorthandSelf();
         if (!shortA) {
-          llvm::errs() << "failed to parse shortand self in self param: "
-                       << shortA.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse shortand self in self param",
+                          shortA.getError()};
+          return StringResult<ast::SelfParam>(s);
         }
         self.setSelf(SelfParamKind::ShorthandSelf, shortA.getValue());
         return StringResult<ast::SelfParam>(self);
@@ -148,10 +142,9 @@ StringResult<ast::SelfParam> Parser::parseSelfParam() {
     if (check(TokenKind::Colon, 1)) {
       StringResult<std::shared_ptr<ast::SelfParam>> shortA = parseTypedSelf();
       if (!shortA) {
-        llvm::errs() << "failed to parse shortand self in self param: "
-                     << shortA.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse shortand self in self param",
+                        shortA.getError()};
+        return StringResult<ast::SelfParam>(s);
       }
       self.setSelf(SelfParamKind::TypeSelf, shortA.getValue());
       return StringResult<ast::SelfParam>(self);
@@ -159,16 +152,16 @@ StringResult<ast::SelfParam> Parser::parseSelfParam() {
       StringResult<std::shared_ptr<ast::SelfParam>> shortA =
           parseShorthandSelf();
       if (!shortA) {
-        llvm::errs() << "failed to parse shortand self in self param: "
-                     << shortA.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse shortand self in self param",
+                        shortA.getError()};
+        return StringResult<ast::SelfParam>(s);
       }
       self.setSelf(SelfParamKind::ShorthandSelf, shortA.getValue());
       return StringResult<ast::SelfParam>(self);
     }
   }
-  return StringResult<ast::SelfParam>("failed to parse colonself param");
+  return StringResult<ast::SelfParam>(
+      adt::Error("failed to parse colonself param", getLocation()));
 }
 
 bool Parser::checkSelfParam() {
@@ -178,15 +171,8 @@ bool Parser::checkSelfParam() {
     StringResult<std::vector<ast::OuterAttribute>> parsedOuterAttributes =
         parseOuterAttributes();
     if (!parsedOuterAttributes) {
-      llvm::errs() << "failed to parse outer attributes in check self param: "
-                   << parsedOuterAttributes.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv(
-              "{0} {1}",
-              "failed to parse outer attributes in check self param: ",
-              parsedOuterAttributes.getError())
-              .str();
+      adt::Error s = {"failed to parse outer attributes in check self param",
+                      parsedOuterAttributes.getError()};
       return StringResult<ast::FunctionParam>(s);
     }
   }
@@ -215,14 +201,8 @@ StringResult<ast::FunctionParameters> Parser::parseFunctionParameters() {
   if (checkSelfParam()) {
     StringResult<ast::SelfParam> selfParam = parseSelfParam();
     if (!selfParam) {
-      llvm::errs() << "failed to parse self param: " << selfParam.getError()
-                   << "\n";
-      printFunctionStack();
       // exit(EXIT_FAILURE);
-      std::string s =
-          llvm::formatv("{0}\n{1}",
-                        "failed to parse self param: ", selfParam.getError())
-              .str();
+      adt::Error s = {"failed to parse self param", selfParam.getError()};
       return StringResult<ast::FunctionParameters>(s);
     }
     parameters.addSelfParam(selfParam.getValue());
@@ -235,9 +215,8 @@ StringResult<ast::FunctionParameters> Parser::parseFunctionParameters() {
       while (true) {
         // copy and paste
         if (check(TokenKind::Eof)) {
-          llvm::errs() << "unexpected EOF"
-                       << "\n";
-          exit(EXIT_FAILURE);
+          return StringResult<ast::FunctionParameters>(adt::Error(
+              "failed to parse function parameters: eof", getLocation()));
         } else if (check(TokenKind::ParenClose)) {
           return StringResult<ast::FunctionParameters>(parameters);
         } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
@@ -248,10 +227,8 @@ StringResult<ast::FunctionParameters> Parser::parseFunctionParameters() {
         } else {
           StringResult<ast::FunctionParam> param = parseFunctionParam();
           if (!param) {
-            llvm::errs() << "failed to parse function param: "
-                         << param.getError() << "\n";
-            printFunctionStack();
-            exit(EXIT_FAILURE);
+            adt::Error s = {"failed to parse function param", param.getError()};
+            return StringResult<ast::FunctionParameters>(s);
           }
           parameters.addFunctionParam(param.getValue());
         }
@@ -261,9 +238,8 @@ StringResult<ast::FunctionParameters> Parser::parseFunctionParameters() {
     // no self param
     while (true) {
       if (check(TokenKind::Eof)) {
-        llvm::errs() << "unexpected EOF"
-                     << "\n";
-        exit(EXIT_FAILURE);
+        return StringResult<ast::FunctionParameters>(adt::Error(
+            "failed to parse function parameters: eof", getLocation()));
       } else if (check(TokenKind::ParenClose)) {
         return StringResult<ast::FunctionParameters>(parameters);
       } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
@@ -274,10 +250,8 @@ StringResult<ast::FunctionParameters> Parser::parseFunctionParameters() {
       } else {
         StringResult<ast::FunctionParam> param = parseFunctionParam();
         if (!param) {
-          llvm::errs() << "failed to parse function param: " << param.getError()
-                       << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse function param", param.getError()};
+          return StringResult<ast::FunctionParameters>(s);
         }
         parameters.addFunctionParam(param.getValue());
       }
@@ -299,25 +273,15 @@ StringResult<ast::FunctionParamPattern> Parser::parseFunctionParamPattern() {
   StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>> pattern =
       parsePatternNoTopAlt();
   if (!pattern) {
-    llvm::errs()
-        << "failed to parse pattern no top alt in function param pattern: "
-        << pattern.getError() << "\n";
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to parse pattern no top alt in function param pattern: ",
-            pattern.getError())
-            .str();
-    printFunctionStack();
+    adt::Error s = {
+        "failed to parse pattern no top alt in function param pattern",
+        pattern.getError()};
     return StringResult<ast::FunctionParamPattern>(s);
   }
   if (!check(TokenKind::Colon)) {
     // error
-    llvm::errs() << getToken().getLocation().toString()
-                 << "failed to parse : token in function param pattern: "
-                 << Token2String(getToken().getKind()) << "\n";
-    std::string s = "failed to parse : token in function param pattern";
-    return StringResult<ast::FunctionParamPattern>(s);
+    return StringResult<ast::FunctionParamPattern>(adt::Error(
+        "failed to parse : token in function param pattern", getLocation()));
   }
 
   assert(eat(TokenKind::Colon));
@@ -334,18 +298,11 @@ StringResult<ast::FunctionParamPattern> Parser::parseFunctionParamPattern() {
   //  llvm::errs() << "parseFunctionParamPattern: type"
   //               << "\n";
 
-  Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
-      parseType();
+  StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in function param pattern: "
-                 << type.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv(
-            "{0}\n{1}",
-            "failed to parse type in function param pattern: ", type.getError())
-            .str();
+    adt::Error s = {"failed to parse type in function param pattern",
+                    type.getError()};
     return StringResult<ast::FunctionParamPattern>(s);
   }
 
@@ -368,14 +325,8 @@ StringResult<ast::FunctionParam> Parser::parseFunctionParam() {
     StringResult<std::vector<ast::OuterAttribute>> parsedOuterAttributes =
         parseOuterAttributes();
     if (!parsedOuterAttributes) {
-      llvm::errs() << "failed to parse outer attributes in function param: "
-                   << parsedOuterAttributes.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "failed to parse outer attributes in function param: ",
-                        parsedOuterAttributes.getError())
-              .str();
+      adt::Error s = {"failed to parse outer attributes in function param",
+                      parsedOuterAttributes.getError()};
       // exit(EXIT_FAILURE);
       return StringResult<ast::FunctionParam>(s);
     }
@@ -394,14 +345,8 @@ StringResult<ast::FunctionParam> Parser::parseFunctionParam() {
     StringResult<ast::FunctionParamPattern> pattern =
         parseFunctionParamPattern();
     if (!pattern) {
-      llvm::errs() << "failed to parse pattern in function param: "
-                   << pattern.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv(
-              "{0} {1}",
-              "failed to parse pattern in function param: ", pattern.getError())
-              .str();
+      adt::Error s = {"failed to parse pattern in function param",
+                      pattern.getError()};
       // exit(EXIT_FAILURE);
       return StringResult<ast::FunctionParam>(s);
     }
@@ -409,7 +354,8 @@ StringResult<ast::FunctionParam> Parser::parseFunctionParam() {
     param.setOuterAttributes(outerAttributes);
     return StringResult<ast::FunctionParam>(param);
   }
-  return StringResult<ast::FunctionParam>("failed to parse function param");
+  return StringResult<ast::FunctionParam>(
+      adt::Error("failed to parse function param", getLocation()));
 }
 
 StringResult<ast::Abi> Parser::parseAbi() {
@@ -429,7 +375,8 @@ StringResult<ast::Abi> Parser::parseAbi() {
     return StringResult<ast::Abi>(abi);
   }
 
-  return StringResult<ast::Abi>("failed to parse Abi");
+  return StringResult<ast::Abi>(
+      adt::Error("failed to parse Abi", getLocation()));
 }
 
 StringResult<ast::FunctionQualifiers> Parser::parseFunctionQualifiers() {
@@ -459,10 +406,9 @@ StringResult<ast::FunctionQualifiers> Parser::parseFunctionQualifiers() {
     if (!checkKeyWord(KeyWordKind::KW_FN)) {
       StringResult<ast::Abi> abi = Parser::parseAbi();
       if (!abi) {
-        llvm::errs() << "failed to parse abi in function qualifiers: "
-                     << abi.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse abi in function qualifiers",
+                        abi.getError()};
+        return StringResult<ast::FunctionQualifiers>(s);
       }
       qual.setAbi(abi.getValue());
     }
@@ -478,16 +424,15 @@ StringResult<ast::FunctionReturnType> Parser::parseFunctionReturnType() {
 
   if (!check(TokenKind::RArrow)) {
     return StringResult<ast::FunctionReturnType>(
-        "failed to parse -> token in function return type");
+        adt::Error("failed to parse -> token in function return type",
+                   getLocation()));
   }
   assert(eat(TokenKind::RArrow));
 
-  Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
-      parseType();
+  StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type: " << type.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type", type.getError()};
+    return StringResult<ast::FunctionReturnType>(s);
   }
   t.setType(type.getValue());
 
@@ -513,18 +458,16 @@ Parser::parseFunction(std::span<OuterAttribute> outer,
     StringResult<ast::FunctionQualifiers> qualifiers =
         parseFunctionQualifiers();
     if (!qualifiers) {
-      llvm::errs() << "failed to parse function qualifiers in function: "
-                   << qualifiers.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse function qualifiers in function",
+                      qualifiers.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     fun.setQualifiers(qualifiers.getValue());
   }
 
   if (!checkKeyWord(KeyWordKind::KW_FN)) {
-    llvm::errs() << "found no fn"
-                 << "\n";
-    exit(EXIT_FAILURE);
+    return StringResult<std::shared_ptr<ast::Item>>(
+        adt::Error("failed to parse fn keyword in function", getLocation()));
   }
 
   assert(eatKeyWord(KeyWordKind::KW_FN));
@@ -545,17 +488,16 @@ Parser::parseFunction(std::span<OuterAttribute> outer,
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> genericParams = parseGenericParams();
     if (!genericParams) {
-      llvm::errs() << "failed to parse generic params in function: "
-                   << genericParams.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in function",
+                      genericParams.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     fun.setGenericParams(genericParams.getValue());
   }
 
   if (!check(TokenKind::ParenOpen)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse generic params");
+        adt::Error("failed to parse generic params", getLocation()));
   }
 
   assert(eat(TokenKind::ParenOpen));
@@ -565,10 +507,9 @@ Parser::parseFunction(std::span<OuterAttribute> outer,
     StringResult<ast::FunctionParameters> parameters =
         parseFunctionParameters();
     if (!parameters) {
-      llvm::errs() << "failed to parse function parameters in function: "
-                   << parameters.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse function parameters in function",
+                      parameters.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     fun.setParameters(parameters.getValue());
   }
@@ -579,10 +520,9 @@ Parser::parseFunction(std::span<OuterAttribute> outer,
   if (check(TokenKind::RArrow)) {
     StringResult<FunctionReturnType> returnType = parseFunctionReturnType();
     if (!returnType) {
-      llvm::errs() << "failed to parse function return type in function: "
-                   << returnType.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse function return type in function",
+                      returnType.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     fun.setReturnType(returnType.getValue());
   }
@@ -590,13 +530,8 @@ Parser::parseFunction(std::span<OuterAttribute> outer,
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> whereClause = parseWhereClause();
     if (!whereClause) {
-      llvm::errs() << "failed to parse where clause in function: "
-                   << whereClause.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0} {1}", "failed to parse where clause in function",
-                        whereClause.getError())
-              .str();
+      adt::Error s = {"failed to parse where clause in function",
+                      whereClause.getError()};
       return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     fun.setWhereClasue(whereClause.getValue());
@@ -605,28 +540,30 @@ Parser::parseFunction(std::span<OuterAttribute> outer,
   if (check(TokenKind::Semi)) {
     assert(eat(TokenKind::Semi));
     return StringResult<std::shared_ptr<ast::Item>>(
-        std::make_shared<ast::VisItem>(fun));
+        context->create<ast::VisItem>(fun));
   }
 
   if (!check(TokenKind::BraceOpen)) {
-    llvm::outs() << "parseFunction: parse body: "
-                 << Token2String(getToken().getKind()) << "\n";
-    if (check(TokenKind::Identifier))
-      llvm::errs() << getToken().getIdentifier().toString() << "\n";
-    std::string s =
-        llvm::formatv("failed to parse body in function: no { token").str();
-    return StringResult<std::shared_ptr<ast::Item>>(s);
+    return StringResult<std::shared_ptr<ast::Item>>(adt::Error(
+        "failed to parse body in function: no { token", getLocation()));
+  }
+
+  if (deferFunctionBodies) {
+    StringResult<lexer::TokenStream> body = skipBlockExpression();
+    if (!body) {
+      adt::Error s = {"failed to skip body in function", body.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
+    }
+    fun.setDeferredBody(body.moveValue());
+    std::shared_ptr<Function> f = context->create<Function>(fun);
+    deferredFunctions.push_back(f);
+    return StringResult<std::shared_ptr<ast::Item>>(f);
   }
 
-  Result<std::shared_ptr<ast::Expression>, std::string> body =
+  StringResult<std::shared_ptr<ast::Expression>> body =
       parseBlockExpression({});
   if (!body) {
-    llvm::errs() << "failed to parse body in function: " << body.getError()
-                 << "\n";
-    printFunctionStack();
-    std::string s = llvm::formatv("{0} {1}", "failed to parse body in function",
-                                  body.getError())
-                        .str();
+    adt::Error s = {"failed to parse body in function", body.getError()};
     return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   fun.setBody(body.getValue());
@@ -638,7 +575,7 @@ Parser::parseFunction(std::span<OuterAttribute> outer,
   //               << "\n";
 
   return StringResult<std::shared_ptr<ast::Item>>(
-      std::make_shared<Function>(fun));
+      context->create<Function>(fun));
 }
 
 } // namespace rust_compiler::parser
@@ -5,21 +5,14 @@
 namespace rust_compiler::parser {
 
 void Parser::printFunctionStack() {
-  llvm::outs() << "parsing failed"
+  if (!ParserErrorStack::isTracing())
+    return;
+  llvm::errs() << "parsing failed"
                << "\n";
-  while (!functionStack.empty()) {
-    llvm::outs() << "    : " << functionStack.top() << "\n";
-    functionStack.pop();
-  }
-}
-
-void Parser::pushFunction(std::string_view f) {
-  functionStack.push(std::string(f));
-}
-
-void Parser::popFunction(std::string_view f) {
-  assert(functionStack.top() == f);
-  functionStack.pop();
+  for (auto it = farthestStack.rbegin(); it != farthestStack.rend(); ++it)
+    llvm::errs() << "    : " << *it << "\n";
+  // the next error starts a trail of its own
+  farthestStack.clear();
 }
 
 } // namespace rust_compiler::parser
@@ -40,19 +40,19 @@ Parser::tryParseIdentifierPattern(std::span<lexer::Token> tokens) {
   if (view.front().isIdentifier()) {
     pattern.setIdentifier(view.front().getIdentifier());
     return std::static_pointer_cast<PatternWithoutRange>(
-        std::make_shared<ast::patterns::IdentifierPattern>(pattern));
+        context->create<ast::patterns::IdentifierPattern>(pattern));
   }
 
   if (view[1].isIdentifier()) {
     pattern.setIdentifier(view[1].getIdentifier());
     return std::static_pointer_cast<PatternWithoutRange>(
-        std::make_shared<ast::patterns::IdentifierPattern>(pattern));
+        context->create<ast::patterns::IdentifierPattern>(pattern));
   }
 
   if (view[2].isIdentifier()) {
     pattern.setIdentifier(view[2].getIdentifier());
     return std::static_pointer_cast<PatternWithoutRange>(
-        std::make_shared<ast::patterns::IdentifierPattern>(pattern));
+        context->create<ast::patterns::IdentifierPattern>(pattern));
   }
 
   // FIXME add PatternNoTopAlt
@@ -42,25 +42,24 @@ Parser::parseMacroInvocationSemiItem() {
 
   StringResult<ast::SimplePath> path = parseSimplePath();
   if (!path) {
-    llvm::errs() << "failed to parse simple path in macro invocation item: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse simple path in macro invocation item",
+                    path.getError()};
+    return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   macro.setPath(path.getValue());
 
   if (!check(TokenKind::Not)) {
-    llvm::errs()
-        << "failed to parse ! token in macro invocation semi statement: "
-        << "\n";
-    exit(EXIT_FAILURE);
+    return StringResult<std::shared_ptr<ast::Item>>(adt::Error(
+        "failed to parse ! token in macro invocation semi item",
+        getLocation()));
   }
   assert(eat(TokenKind::Not));
 
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<std::shared_ptr<ast::Item>>(
-          "failed to parse macro invocation semi statement: eof");
+          adt::Error("failed to parse macro invocation semi statement: eof",
+                     getLocation()));
     } else if (check(TokenKind::ParenOpen)) {
       macro.setKind(MacroInvocationSemiItemKind::Paren);
       assert(eat(TokenKind::ParenOpen));
@@ -73,40 +72,43 @@ Parser::parseMacroInvocationSemiItem() {
     } else if (check(TokenKind::ParenClose) && check(TokenKind::Semi, 1)) {
       if (macro.getKind() != MacroInvocationSemiItemKind::Paren)
         return StringResult<std::shared_ptr<ast::Item>>(
-            "failed to parse macro invocation semi statement");
+            adt::Error("failed to parse macro invocation semi statement",
+                       getLocation()));
       assert(eat(TokenKind::ParenClose));
       assert(eat(TokenKind::Semi));
       return StringResult<std::shared_ptr<ast::Item>>(
-          std::make_shared<MacroInvocationSemiItem>(macro));
+          context->create<MacroInvocationSemiItem>(macro));
     } else if (check(TokenKind::SquareClose) && check(TokenKind::Semi, 1)) {
       if (macro.getKind() != MacroInvocationSemiItemKind::Square)
         return StringResult<std::shared_ptr<ast::Item>>(
-            "failed to parse macro invocation semi statement");
+            adt::Error("failed to parse macro invocation semi statement",
+                       getLocation()));
       assert(eat(TokenKind::SquareClose));
       assert(eat(TokenKind::Semi));
       return StringResult<std::shared_ptr<ast::Item>>(
-          std::make_shared<MacroInvocationSemiItem>(macro));
+          context->create<MacroInvocationSemiItem>(macro));
     } else if (check(TokenKind::BraceClose)) {
       if (macro.getKind() != MacroInvocationSemiItemKind::Brace)
         return StringResult<std::shared_ptr<ast::Item>>(
-            "failed to parse macro invocation semi statement");
+            adt::Error("failed to parse macro invocation semi statement",
+                       getLocation()));
       assert(eat(TokenKind::BraceClose));
       return StringResult<std::shared_ptr<ast::Item>>(
-          std::make_shared<MacroInvocationSemiItem>(macro));
+          context->create<MacroInvocationSemiItem>(macro));
     } else {
       StringResult<ast::TokenTree> tree = parseTokenTree();
       if (!tree) {
-        llvm::errs() << "failed to parse token tree in macro invocation item: "
-                     << tree.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse token tree in macro invocation item",
+                        tree.getError()};
+        return StringResult<std::shared_ptr<ast::Item>>(s);
       }
       macro.addTree(tree.getValue());
     }
   }
 
   return StringResult<std::shared_ptr<ast::Item>>(
-      "failed to parse macro invocation semi statement");
+      adt::Error("failed to parse macro invocation semi statement",
+                 getLocation()));
 }
 
 StringResult<ast::AssociatedItem> Parser::parseAssociatedItem() {
@@ -117,10 +119,9 @@ StringResult<ast::AssociatedItem> Parser::parseAssociatedItem() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in associated item: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in associated item",
+                      outer.getError()};
+      return StringResult<ast::AssociatedItem>(s);
     }
     std::vector<ast::OuterAttribute> out = outer.getValue();
     item.setOuterAttributes(out);
@@ -130,21 +131,19 @@ StringResult<ast::AssociatedItem> Parser::parseAssociatedItem() {
     StringResult<std::shared_ptr<ast::Item>> macroItem =
         parseMacroInvocationSemiItem();
     if (!macroItem) {
-      llvm::errs()
-          << "failed to parse macro invocation semi in associated item: "
-          << macroItem.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse macro invocation semi in associated "
+                      "item",
+                      macroItem.getError()};
+      return StringResult<ast::AssociatedItem>(s);
     }
     item.setMacroItem(macroItem.getValue());
     return StringResult<ast::AssociatedItem>(item);
   } else if (checkKeyWord(KeyWordKind::KW_PUB)) {
     StringResult<ast::Visibility> vis = parseVisibility();
     if (!vis) {
-      llvm::errs() << "failed to parse visibility in associated item: "
-                   << vis.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse visibility in associated item",
+                      vis.getError()};
+      return StringResult<ast::AssociatedItem>(s);
     }
     item.setVisiblity(vis.getValue());
     if (checkKeyWord(KeyWordKind::KW_TYPE)) {
@@ -152,10 +151,9 @@ StringResult<ast::AssociatedItem> Parser::parseAssociatedItem() {
       StringResult<std::shared_ptr<ast::Item>> typeAlias =
           parseTypeAlias({}, vis.getValue());
       if (!typeAlias) {
-        llvm::errs() << "failed to parse type alias in associated item: "
-                     << typeAlias.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse type alias in associated item",
+                        typeAlias.getError()};
+        return StringResult<ast::AssociatedItem>(s);
       }
       item.setTypeAlias(typeAlias.getValue());
       return StringResult<ast::AssociatedItem>(item);
@@ -165,10 +163,9 @@ StringResult<ast::AssociatedItem> Parser::parseAssociatedItem() {
       StringResult<std::shared_ptr<ast::Item>> constantItem =
         parseConstantItem({}, vis.getValue());
       if (!constantItem) {
-        llvm::errs() << "failed to parse constant item in associated item: "
-                     << constantItem.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse constant item in associated item",
+                        constantItem.getError()};
+        return StringResult<ast::AssociatedItem>(s);
       }
       item.setConstantItem(constantItem.getValue());
       return StringResult<ast::AssociatedItem>(item);
@@ -181,27 +178,25 @@ StringResult<ast::AssociatedItem> Parser::parseAssociatedItem() {
       StringResult<std::shared_ptr<ast::Item>> fun =
           parseFunction({}, vis.getValue());
       if (!fun) {
-        llvm::errs() << "failed to parse function in associated item: "
-                     << fun.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse function in associated item",
+                        fun.getError()};
+        return StringResult<ast::AssociatedItem>(s);
       }
       item.setFunction(fun.getValue());
       return StringResult<ast::AssociatedItem>(item);
     } else {
       // error
       return StringResult<ast::AssociatedItem>(
-          "failed to parse associated item");
+          adt::Error("failed to parse associated item", getLocation()));
     }
   } else if (checkKeyWord(KeyWordKind::KW_TYPE)) {
     // type alias
     StringResult<std::shared_ptr<ast::Item>> typeAlias =
       parseTypeAlias({}, std::nullopt);
     if (!typeAlias) {
-      llvm::errs() << "failed to parse type alias in associated item: "
-                   << typeAlias.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type alias in associated item",
+                      typeAlias.getError()};
+      return StringResult<ast::AssociatedItem>(s);
     }
     item.setTypeAlias(typeAlias.getValue());
     return StringResult<ast::AssociatedItem>(item);
@@ -211,10 +206,9 @@ StringResult<ast::AssociatedItem> Parser::parseAssociatedItem() {
     StringResult<std::shared_ptr<ast::Item>> constantItem =
       parseConstantItem({}, std::nullopt);
     if (!constantItem) {
-      llvm::errs() << "failed to parse constant item in associated item: "
-                   << constantItem.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse constant item in associated item",
+                      constantItem.getError()};
+      return StringResult<ast::AssociatedItem>(s);
     }
     item.setConstantItem(constantItem.getValue());
     return StringResult<ast::AssociatedItem>(item);
@@ -227,17 +221,18 @@ StringResult<ast::AssociatedItem> Parser::parseAssociatedItem() {
     StringResult<std::shared_ptr<ast::Item>> fun =
         parseFunction({}, std::nullopt);
     if (!fun) {
-      llvm::errs() << "failed to parse function in associated item: "
-                   << fun.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse function in associated item",
+                      fun.getError()};
+      return StringResult<ast::AssociatedItem>(s);
     }
     item.setFunction(fun.getValue());
     return StringResult<ast::AssociatedItem>(item);
   } else {
-    return StringResult<ast::AssociatedItem>("failed to parse associated item");
+    return StringResult<ast::AssociatedItem>(
+        adt::Error("failed to parse associated item", getLocation()));
   }
-  return StringResult<ast::AssociatedItem>("failed to parse associated item");
+  return StringResult<ast::AssociatedItem>(
+      adt::Error("failed to parse associated item", getLocation()));
 }
 
 StringResult<ast::ExternalItem>
@@ -250,10 +245,9 @@ Parser::parseExternalItem(std::span<OuterAttribute> outer) {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in external item: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in external item",
+                      outer.getError()};
+      return StringResult<ast::ExternalItem>(s);
     }
     std::vector<ast::OuterAttribute> out = outer.getValue();
     impl.setOuterAttributes(out);
@@ -262,19 +256,17 @@ Parser::parseExternalItem(std::span<OuterAttribute> outer) {
   if (checkKeyWord(KeyWordKind::KW_PUB)) {
     StringResult<ast::Visibility> vis = parseVisibility();
     if (!vis) {
-      llvm::errs() << "failed to parse visibility in external item: "
-                   << vis.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse visibility in external item",
+                      vis.getError()};
+      return StringResult<ast::ExternalItem>(s);
     }
     if (checkKeyWord(KeyWordKind::KW_STATIC)) {
       StringResult<std::shared_ptr<ast::Item>> stat =
           parseStaticItem(outer, vis.getValue());
       if (!stat) {
-        llvm::errs() << "failed to parse static item in external item: "
-                     << stat.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse static item in external item",
+                        stat.getError()};
+        return StringResult<ast::ExternalItem>(s);
       }
       impl.setStaticItem(stat.getValue());
       return StringResult<ast::ExternalItem>(impl);
@@ -286,24 +278,23 @@ Parser::parseExternalItem(std::span<OuterAttribute> outer) {
       StringResult<std::shared_ptr<ast::Item>> fn =
           parseFunction(outer, vis.getValue());
       if (!fn) {
-        llvm::errs() << "failed to parse function in external item: "
-                     << fn.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse function in external item",
+                        fn.getError()};
+        return StringResult<ast::ExternalItem>(s);
       }
       impl.setFunction(fn.getValue());
       return StringResult<ast::ExternalItem>(impl);
     } else {
-      return StringResult<ast::ExternalItem>("failed to parse external item");
+      return StringResult<ast::ExternalItem>(
+          adt::Error("failed to parse external item", getLocation()));
     }
   } else if (checkKeyWord(KeyWordKind::KW_STATIC)) {
     StringResult<std::shared_ptr<ast::Item>> stat =
         parseStaticItem(outer, std::nullopt);
     if (!stat) {
-      llvm::errs() << "failed to parse static item in external item: "
-                   << stat.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse static item in external item",
+                      stat.getError()};
+      return StringResult<ast::ExternalItem>(s);
     }
     impl.setStaticItem(stat.getValue());
     return StringResult<ast::ExternalItem>(impl);
@@ -315,10 +306,9 @@ Parser::parseExternalItem(std::span<OuterAttribute> outer) {
     StringResult<std::shared_ptr<ast::Item>> fn =
         parseFunction(outer, std::nullopt);
     if (!fn) {
-      llvm::errs() << "failed to parse function item in external item: "
-                   << fn.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse function item in external item",
+                      fn.getError()};
+      return StringResult<ast::ExternalItem>(s);
     }
     impl.setFunction(fn.getValue());
     return StringResult<ast::ExternalItem>(impl);
@@ -327,16 +317,16 @@ Parser::parseExternalItem(std::span<OuterAttribute> outer) {
     StringResult<std::shared_ptr<ast::Expression>> macro =
         parseMacroInvocationExpression();
     if (!macro) {
-      llvm::errs() << "failed to parse macro invocation expression item in "
-                      "external item: "
-                   << macro.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse macro invocation expression item in "
+                      "external item",
+                      macro.getError()};
+      return StringResult<ast::ExternalItem>(s);
     }
     impl.setMacroInvocation(macro.getValue());
     return StringResult<ast::ExternalItem>(impl);
   }
-  return StringResult<ast::ExternalItem>("failed to parse external item");
+  return StringResult<ast::ExternalItem>(
+      adt::Error("failed to parse external item", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -353,33 +343,29 @@ Parser::parseExternBlock(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_EXTERN))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse extern keyword in extern block");
+        adt::Error("failed to parse extern keyword in extern block",
+                   getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_EXTERN));
 
   StringResult<ast::Abi> abi = parseAbi();
   if (!abi) {
-    llvm::errs() << "failed to parse abi in "
-                    "external block: "
-                 << abi.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse abi in external block", abi.getError()};
+    return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   impl.setAbi(abi.getValue());
 
   if (!check(TokenKind::BraceOpen))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse { token in extern block");
+        adt::Error("failed to parse { token in extern block", getLocation()));
   assert(eat(TokenKind::BraceOpen));
 
   if (checkInnerAttribute()) {
     StringResult<std::vector<ast::InnerAttribute>> innerAttributes =
         parseInnerAttributes();
     if (!innerAttributes) {
-      llvm::errs() << "failed to parse inner attributes in "
-                      "external block: "
-                   << innerAttributes.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse inner attributes in external block",
+                      innerAttributes.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     std::vector<ast::InnerAttribute> inner = innerAttributes.getValue();
     impl.setInnerAttributes(inner);
@@ -392,22 +378,20 @@ Parser::parseExternBlock(std::span<OuterAttribute> outer,
       // done
       assert(eat(TokenKind::BraceClose));
       return StringResult<std::shared_ptr<ast::Item>>(
-          std::make_shared<ExternBlock>(impl));
+          context->create<ExternBlock>(impl));
     } else {
       StringResult<ast::ExternalItem> item = parseExternalItem(outer);
       if (!item) {
-        llvm::errs() << "failed to parse external item in "
-                        "external block: "
-                     << item.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse external item in external block",
+                        item.getError()};
+        return StringResult<std::shared_ptr<ast::Item>>(s);
       }
       impl.addItem(item.getValue());
     }
   }
 
   return StringResult<std::shared_ptr<ast::Item>>(
-      "failed to parse  extern block");
+      adt::Error("failed to parse  extern block", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -427,18 +411,17 @@ Parser::parseImplementation(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_IMPL))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse impl keyword in implementation");
+        adt::Error("failed to parse impl keyword in implementation",
+                   getLocation()));
 
   assert(eatKeyWord(KeyWordKind::KW_IMPL));
 
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> generic = parseGenericParams();
     if (!generic) {
-      llvm::errs() << "failed to parse generic params in "
-                      "implementation: "
-                   << generic.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in implementation",
+                      generic.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
   }
 
@@ -458,10 +441,7 @@ Parser::parseImplementation(std::span<OuterAttribute> outer,
     }
   } else {
     // report error
-    std::string s =
-        llvm::formatv("{0} {1}", "failed to parse type in implementation",
-                      path.getError())
-            .str();
+    adt::Error s = {"failed to parse type in implementation", path.getError()};
     return StringResult<std::shared_ptr<ast::Item>>(s);
   }
 
@@ -483,12 +463,13 @@ Parser::parseTypeAlias(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_TYPE))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse type keyword in type alias");
+        adt::Error("failed to parse type keyword in type alias",
+                   getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_TYPE));
 
   if (!check(TokenKind::Identifier))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse identifier in type alias");
+        adt::Error("failed to parse identifier in type alias", getLocation()));
 
   Token id = getToken();
   alias.setIdentifier(id.getIdentifier());
@@ -497,11 +478,9 @@ Parser::parseTypeAlias(std::span<OuterAttribute> outer,
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> genericParams = parseGenericParams();
     if (!genericParams) {
-      llvm::errs() << "failed to parse generic params in "
-                      "type alias "
-                   << genericParams.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in type alias",
+                      genericParams.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     alias.setGenericParams(genericParams.getValue());
   }
@@ -509,18 +488,16 @@ Parser::parseTypeAlias(std::span<OuterAttribute> outer,
   if (check(TokenKind::Semi)) {
     assert(eat(TokenKind::Semi));
     return StringResult<std::shared_ptr<ast::Item>>(
-        std::make_shared<TypeAlias>(alias));
+        context->create<TypeAlias>(alias));
   }
 
   if (check(TokenKind::Colon)) {
     assert(eat(TokenKind::Colon));
     StringResult<ast::types::TypeParamBounds> bounds = parseTypeParamBounds();
     if (!bounds) {
-      llvm::errs() << "failed to parse type param bounds in "
-                      "type alias "
-                   << bounds.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type param bounds in type alias",
+                      bounds.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     alias.setParamBounds(bounds.getValue());
   }
@@ -528,17 +505,15 @@ Parser::parseTypeAlias(std::span<OuterAttribute> outer,
   if (check(TokenKind::Semi)) {
     assert(eat(TokenKind::Semi));
     return StringResult<std::shared_ptr<ast::Item>>(
-        std::make_shared<TypeAlias>(alias));
+        context->create<TypeAlias>(alias));
   }
 
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> where = parseWhereClause();
     if (!where) {
-      llvm::errs() << "failed to parse where clause in "
-                      "type alias "
-                   << where.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse where clause in type alias",
+                      where.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     alias.setWhereClause(where.getValue());
   }
@@ -546,28 +521,22 @@ Parser::parseTypeAlias(std::span<OuterAttribute> outer,
   if (check(TokenKind::Semi)) {
     assert(eat(TokenKind::Semi));
     return StringResult<std::shared_ptr<ast::Item>>(
-        std::make_shared<TypeAlias>(alias));
+        context->create<TypeAlias>(alias));
   } else if (check(TokenKind::Eq)) {
     assert(eat(TokenKind::Eq));
   } else {
     llvm::errs() << "failed to parse where keyword or ; token in type alias 1: "
                  << Token2String(getToken().getKind()) << "\n";
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse where keyword or ; token in type alias");
+        adt::Error("failed to parse where keyword or ; token in type alias",
+                   getLocation()));
   }
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in "
-                    "type alias "
-                 << type.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s = llvm::formatv("{0}\n{1}",
-                                  "failed to parse type in "
-                                  "type alias ",
-                                  type.getError())
-                        .str();
+    adt::Error s = {"failed to parse type in "
+                    "type alias", type.getError()};
     return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   alias.setType(type.getValue());
@@ -575,28 +544,27 @@ Parser::parseTypeAlias(std::span<OuterAttribute> outer,
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> where = parseWhereClause();
     if (!where) {
-      llvm::errs() << "failed to parse where clause in "
-                      "type alias "
-                   << where.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse where clause in type alias",
+                      where.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     alias.setTypeWhereClause(where.getValue());
   } else if (check(TokenKind::Semi)) {
     assert(eat(TokenKind::Semi));
 
     return StringResult<std::shared_ptr<ast::Item>>(
-        std::make_shared<TypeAlias>(alias));
+        context->create<TypeAlias>(alias));
   } else {
     llvm::errs() << "failed to parse where keyword or ; token in type alias 2: "
                  << Token2String(getToken().getKind()) << "\n";
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse where keyword or ; token in type alias");
+        adt::Error("failed to parse where keyword or ; token in type alias",
+                   getLocation()));
   }
 
   assert(eat(TokenKind::Semi));
   return StringResult<std::shared_ptr<ast::Item>>(
-      std::make_shared<TypeAlias>(alias));
+      context->create<TypeAlias>(alias));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -608,7 +576,8 @@ Parser::parseStaticItem(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_STATIC))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse static keyword in static item");
+        adt::Error("failed to parse static keyword in static item",
+                   getLocation()));
 
   assert(eatKeyWord(KeyWordKind::KW_STATIC));
 
@@ -619,7 +588,7 @@ Parser::parseStaticItem(std::span<OuterAttribute> outer,
 
   if (!check(TokenKind::Identifier))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse identifier in static item");
+        adt::Error("failed to parse identifier in static item", getLocation()));
 
   Token id = getToken();
   stat.setIdentifier(id.getIdentifier());
@@ -627,44 +596,39 @@ Parser::parseStaticItem(std::span<OuterAttribute> outer,
 
   if (!check(TokenKind::Semi))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse : in static item");
+        adt::Error("failed to parse : in static item", getLocation()));
   assert(eat(TokenKind::Semi));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> typeExpr =
       parseType();
   if (!typeExpr) {
-    llvm::errs() << "failed to parse type in "
-                    "static item "
-                 << typeExpr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in static item", typeExpr.getError()};
+    return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   stat.setType(typeExpr.getValue());
 
   if (check(TokenKind::Semi)) {
     assert(eat(TokenKind::Semi));
     return StringResult<std::shared_ptr<ast::Item>>(
-        std::make_shared<StaticItem>(stat));
+        context->create<StaticItem>(stat));
   } else if (check(TokenKind::Eq)) {
     // initializer
     Restrictions restrictions;
     StringResult<std::shared_ptr<ast::Expression>> init =
         parseExpression({}, restrictions);
     if (!init) {
-      llvm::errs() << "failed to parse expression in "
-                      "static item "
-                   << init.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse expression in static item",
+                      init.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     stat.setInit(init.getValue());
     assert(eat(TokenKind::Semi));
   } else {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse static item");
+        adt::Error("failed to parse static item", getLocation()));
   }
   return StringResult<std::shared_ptr<ast::Item>>(
-      std::make_shared<StaticItem>(stat));
+      context->create<StaticItem>(stat));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -676,7 +640,8 @@ Parser::parseConstantItem(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_CONST))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse const keyword in constant item");
+        adt::Error("failed to parse const keyword in constant item",
+                   getLocation()));
 
   assert(eatKeyWord(KeyWordKind::KW_CONST));
 
@@ -689,12 +654,14 @@ Parser::parseConstantItem(std::span<OuterAttribute> outer,
     assert(eat(TokenKind::Identifier));
   } else {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse identifier token in constant item");
+        adt::Error("failed to parse identifier token in constant item",
+                   getLocation()));
   }
 
   if (!check(TokenKind::Colon)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse colon token in constant item");
+        adt::Error("failed to parse colon token in constant item",
+                   getLocation()));
   }
 
   assert(eat(TokenKind::Colon));
@@ -702,18 +669,16 @@ Parser::parseConstantItem(std::span<OuterAttribute> outer,
   StringResult<std::shared_ptr<ast::types::TypeExpression>> typeExpr =
       parseType();
   if (!typeExpr) {
-    llvm::errs() << "failed to parse type in "
-                    "constant item "
-                 << typeExpr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in constant item",
+                    typeExpr.getError()};
+    return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   con.setType(typeExpr.getValue());
 
   if (check(TokenKind::Semi)) {
     assert(eat(TokenKind::Semi));
     return StringResult<std::shared_ptr<ast::Item>>(
-        std::make_shared<ConstantItem>(con));
+        context->create<ConstantItem>(con));
   } else if (check(TokenKind::Eq)) {
     assert(eat(TokenKind::Eq));
     // initializer
@@ -721,21 +686,19 @@ Parser::parseConstantItem(std::span<OuterAttribute> outer,
     StringResult<std::shared_ptr<ast::Expression>> init =
         parseExpression({}, restrictions);
     if (!init) {
-      llvm::errs() << "failed to parse expression in "
-                      "constant item "
-                   << init.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse expression in constant item",
+                      init.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     con.setInit(init.getValue());
     assert(eat(TokenKind::Semi));
   } else {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse constant item");
+        adt::Error("failed to parse constant item", getLocation()));
   }
 
   return StringResult<std::shared_ptr<ast::Item>>(
-      std::make_shared<ConstantItem>(con));
+      context->create<ConstantItem>(con));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -747,13 +710,13 @@ Parser::parseUnion(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_UNION))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse union keyword in union");
+        adt::Error("failed to parse union keyword in union", getLocation()));
 
   assert(eatKeyWord(KeyWordKind::KW_UNION));
 
   if (!check(TokenKind::Identifier))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse identifier token in union");
+        adt::Error("failed to parse identifier token in union", getLocation()));
 
   Token tok = getToken();
   uni.setIdentifier(tok.getIdentifier());
@@ -763,11 +726,9 @@ Parser::parseUnion(std::span<OuterAttribute> outer,
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> genericParams = parseGenericParams();
     if (!genericParams) {
-      llvm::errs() << "failed to parse generic params in "
-                      "union "
-                   << genericParams.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in union",
+                      genericParams.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     uni.setGenericParams(genericParams.getValue());
   }
@@ -775,33 +736,29 @@ Parser::parseUnion(std::span<OuterAttribute> outer,
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> whereClause = parseWhereClause();
     if (!whereClause) {
-      llvm::errs() << "failed to parse where clause in "
-                      "union "
-                   << whereClause.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse where clause in union",
+                      whereClause.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     uni.setWhereClause(whereClause.getValue());
   }
 
   if (!check(TokenKind::BraceOpen)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse { token in union");
+        adt::Error("failed to parse { token in union", getLocation()));
   }
   assert(check(TokenKind::BraceOpen));
 
   StringResult<ast::StructFields> fields = parseStructFields();
   if (!fields) {
-    llvm::errs() << "failed to parse struct fields in "
-                    "union "
-                 << fields.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse struct fields in union",
+                    fields.getError()};
+    return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   uni.setStructfields(fields.getValue());
   assert(check(TokenKind::BraceClose));
 
-  return StringResult<std::shared_ptr<ast::Item>>(std::make_shared<Union>(uni));
+  return StringResult<std::shared_ptr<ast::Item>>(context->create<Union>(uni));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -811,35 +768,31 @@ Parser::parseStruct(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_STRUCT))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse struct keyword in struct");
+        adt::Error("failed to parse struct keyword in struct", getLocation()));
 
   assert(eatKeyWord(KeyWordKind::KW_STRUCT));
 
   if (!check(TokenKind::Identifier)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse identifier in struct");
+        adt::Error("failed to parse identifier in struct", getLocation()));
   }
   assert(eat(TokenKind::Identifier));
 
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> genericParams = parseGenericParams();
     if (!genericParams) {
-      llvm::errs() << "failed to parse generic params in "
-                      "struct: "
-                   << genericParams.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in struct",
+                      genericParams.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
   }
 
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> whereClause = parseWhereClause();
     if (!whereClause) {
-      llvm::errs() << "failed to parse where clause in "
-                      "struct: "
-                   << whereClause.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse where clause in struct",
+                      whereClause.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     recover(cp);
     return parseStructStruct(outer, vis);
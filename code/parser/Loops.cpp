@@ -23,7 +23,7 @@ bool Parser::checkLoopLabel() {
   return (check(TokenKind::LIFETIME_OR_LABEL) && check(TokenKind::Colon, 1));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseLabelBlockExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -32,21 +32,20 @@ Parser::parseLabelBlockExpression(std::span<OuterAttribute>) {
   StringResult<std::shared_ptr<ast::Expression>> block =
       parseBlockExpression({});
   if (!block) {
-    llvm::errs()
-        << "failed to parse block expression in label block expression: "
-        << block.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block expression in label block "
+                    "expression",
+                    block.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   bloc.setBlock(block.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<LabelBlockExpression>(bloc));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<LabelBlockExpression>(bloc));
 }
 
-// Result<LoopLabel, std::string> Parser::parseLoopLabel() {}
+// StringResult<LoopLabel> Parser::parseLoopLabel() {}
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseLoopExpression(std::span<OuterAttribute> outer) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
 
@@ -70,8 +69,9 @@ Parser::parseLoopExpression(std::span<OuterAttribute> outer) {
       } else {
         return parseLabelBlockExpression(outer);
       }
-      return Result<std::shared_ptr<ast::Expression>, std::string>(
-          "failed to parse loop expression with loop label");
+      return StringResult<std::shared_ptr<ast::Expression>>(
+          adt::Error("failed to parse loop expression with loop label",
+                     getLocation()));
     }
   }
 
@@ -87,11 +87,12 @@ Parser::parseLoopExpression(std::span<OuterAttribute> outer) {
   } else {
     return parseLabelBlockExpression(outer);
   }
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      "failed to parse loop expression without loop label");
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      adt::Error("failed to parse loop expression without loop label",
+                 getLocation()));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseIteratorLoopExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -99,23 +100,22 @@ Parser::parseIteratorLoopExpression(std::span<OuterAttribute>) {
   IteratorLoopExpression it = {loc};
 
   if (!checkKeyWord(KeyWordKind::KW_FOR))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse for keyword");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse for keyword", getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_FOR));
 
   StringResult<std::shared_ptr<ast::patterns::Pattern>> pred = parsePattern();
   if (!pred) {
-    llvm::errs() << "failed to parse pattern in iterator loop expression: "
-                 << pred.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse pattern in iterator loop expression",
+                    pred.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   it.setPattern(pred.getValue());
 
   if (!checkKeyWord(KeyWordKind::KW_IN))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse in keyword");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse in keyword", getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_IN));
 
   Restrictions restrictions;
@@ -123,26 +123,24 @@ Parser::parseIteratorLoopExpression(std::span<OuterAttribute>) {
   StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse expression in iterator loop expression: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in iterator loop expression",
+                    expr.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   it.setExpression(expr.getValue());
 
   StringResult<std::shared_ptr<ast::Expression>> block =
       parseBlockExpression({});
   if (!block) {
-    llvm::errs()
-        << "failed to parse block expression in iterator loop expression: "
-        << block.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block expression in iterator loop "
+                    "expression",
+                    block.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   it.setBody(block.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<IteratorLoopExpression>(it));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<IteratorLoopExpression>(it));
 }
 
 StringResult<std::shared_ptr<ast::Expression>>
@@ -154,32 +152,30 @@ Parser::parsePredicatePatternLoopExpression(std::span<ast::OuterAttribute>) {
 
   if (!checkKeyWord(KeyWordKind::KW_WHILE))
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse while keyword");
+        adt::Error("failed to parse while keyword", getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_WHILE));
 
   if (!checkKeyWord(KeyWordKind::KW_LET))
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse let keyword");
+        adt::Error("failed to parse let keyword", getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_LET));
 
   StringResult<std::shared_ptr<ast::patterns::Pattern>> pred = parsePattern();
   if (!pred) {
-    llvm::errs()
-        << "failed to parse pattern in predicate pattern loop expression: "
-        << pred.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse pattern in predicate pattern loop "
+                    "expression",
+                    pred.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   pat.setPattern(pred.getValue());
 
   StringResult<ast::Scrutinee> scrut = parseScrutinee();
   if (!scrut) {
-    llvm::errs()
-        << "failed to parse scrutinee in predicate pattern loop expression: "
-        << scrut.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse scrutinee in predicate pattern loop "
+                    "expression",
+                    scrut.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   pat.setScrutinee(scrut.getValue());
@@ -187,20 +183,19 @@ Parser::parsePredicatePatternLoopExpression(std::span<ast::OuterAttribute>) {
   StringResult<std::shared_ptr<ast::Expression>> block =
       parseBlockExpression({});
   if (!block) {
-    llvm::errs() << "failed to parse block expression in predicate pattern "
-                    "loop expression: "
-                 << block.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block expression in predicate pattern "
+                    "loop expression",
+                    block.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   pat.setBody(block.getValue());
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<PredicatePatternLoopExpression>(pat));
+      context->create<PredicatePatternLoopExpression>(pat));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseInfiniteLoopExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -211,27 +206,26 @@ Parser::parseInfiniteLoopExpression(std::span<OuterAttribute>) {
   InfiniteLoopExpression infini = {loc};
 
   if (!checkKeyWord(KeyWordKind::KW_LOOP))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse loop keyword");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse loop keyword", getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_LOOP));
 
   StringResult<std::shared_ptr<ast::Expression>> block =
       parseBlockExpression({});
   if (!block) {
-    llvm::errs()
-        << "failed to parse block expression in infinite loop expression: "
-        << block.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block expression in infinite loop "
+                    "expression",
+                    block.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   infini.setBody(block.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<InfiniteLoopExpression>(infini));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<InfiniteLoopExpression>(infini));
 }
 
-Result<std::shared_ptr<ast::Expression>, std::string>
+StringResult<std::shared_ptr<ast::Expression>>
 Parser::parsePredicateLoopExpression(std::span<OuterAttribute>) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
   Location loc = getLocation();
@@ -239,18 +233,17 @@ Parser::parsePredicateLoopExpression(std::span<OuterAttribute>) {
   PredicateLoopExpression pred = {loc};
 
   if (!checkKeyWord(KeyWordKind::KW_WHILE))
-    return Result<std::shared_ptr<ast::Expression>, std::string>(
-        "failed to parse while keyword");
+    return StringResult<std::shared_ptr<ast::Expression>>(
+        adt::Error("failed to parse while keyword", getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_WHILE));
 
   Restrictions restrictions;
   StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse expression in predicate loop expression: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse expression in predicate loop expression",
+                    expr.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   pred.setCondition(expr.getValue());
@@ -258,17 +251,16 @@ Parser::parsePredicateLoopExpression(std::span<OuterAttribute>) {
   StringResult<std::shared_ptr<ast::Expression>> block =
       parseBlockExpression({});
   if (!block) {
-    llvm::errs()
-        << "failed to parse block expression in predicate loop expression: "
-        << block.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse block expression in predicate loop "
+                    "expression",
+                    block.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   pred.setBody(block.getValue());
 
-  return Result<std::shared_ptr<ast::Expression>, std::string>(
-      std::make_shared<PredicateLoopExpression>(pred));
+  return StringResult<std::shared_ptr<ast::Expression>>(
+      context->create<PredicateLoopExpression>(pred));
 }
 
 } // namespace rust_compiler::parser
@@ -124,7 +124,7 @@ StringResult<ast::MacroMatch> Parser::parseMacroMatch() {
     if (!matcher) {
       // report error
     }
-    match.setMacroMatcher(std::make_shared<MacroMatcher>(matcher.getValue()));
+    match.setMacroMatcher(context->create<MacroMatcher>(matcher.getValue()));
     return StringResult<ast::MacroMatch>(match);
   } else if (!checkDelimiters()) {
     match.setToken(getToken());
@@ -133,7 +133,8 @@ StringResult<ast::MacroMatch> Parser::parseMacroMatch() {
 
   // error
 
-  return StringResult<ast::MacroMatch>("failed to parse macro match");
+  return StringResult<ast::MacroMatch>(
+      adt::Error("failed to parse macro match", getLocation()));
 }
 
 StringResult<ast::MacroRepSep> Parser::parseMacroRepSep() {
@@ -142,13 +143,17 @@ StringResult<ast::MacroRepSep> Parser::parseMacroRepSep() {
   MacroRepSep sep = {loc};
 
   if (checkDelimiters()) {
-    return StringResult<ast::MacroRepSep>("failed to parse macro rep sep");
+    return StringResult<ast::MacroRepSep>(
+        adt::Error("failed to parse macro rep sep", getLocation()));
   } else if (check(TokenKind::Star)) {
-    return StringResult<ast::MacroRepSep>("failed to parse macro rep sep");
+    return StringResult<ast::MacroRepSep>(
+        adt::Error("failed to parse macro rep sep", getLocation()));
   } else if (check(TokenKind::Plus)) {
-    return StringResult<ast::MacroRepSep>("failed to parse macro rep sep");
+    return StringResult<ast::MacroRepSep>(
+        adt::Error("failed to parse macro rep sep", getLocation()));
   } else if (check(TokenKind::QMark)) {
-    return StringResult<ast::MacroRepSep>("failed to parse macro rep sep");
+    return StringResult<ast::MacroRepSep>(
+        adt::Error("failed to parse macro rep sep", getLocation()));
   }
 
   sep.setToken(getToken());
@@ -166,7 +171,8 @@ StringResult<ast::MacroRepOp> Parser::parseMacroRepOp() {
   } else if (check(TokenKind::QMark)) {
     op.setKind(MacroRepOpKind::Qmark);
   } else {
-    return StringResult<ast::MacroRepOp>("failed to parse marco rep op");
+    return StringResult<ast::MacroRepOp>(
+        adt::Error("failed to parse marco rep op", getLocation()));
   }
 
   return StringResult<ast::MacroRepOp>(op);
@@ -177,7 +183,8 @@ StringResult<ast::MacroFragSpec> Parser::parseMacroFragSpec() {
   MacroFragSpec frag = {loc};
 
   if (!checkIdentifier())
-    return StringResult<ast::MacroFragSpec>("failed to parse marco frag spec");
+    return StringResult<ast::MacroFragSpec>(
+        adt::Error("failed to parse marco frag spec", getLocation()));
 
   MacroFragSpecKind k =
       StringSwitch<MacroFragSpecKind>(getToken().getIdentifier().toString())
@@ -209,10 +216,9 @@ StringResult<ast::MacroTranscriber> Parser::parseMacroTranscriber() {
   StringResult<std::shared_ptr<ast::DelimTokenTree>> tree =
       parseDelimTokenTree();
   if (!tree) {
-    llvm::errs() << "failed to parse delim token tree in macro transcribe: "
-                 << tree.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse delim token tree in macro transcribe",
+                    tree.getError()};
+    return StringResult<ast::MacroTranscriber>(s);
   }
   transcriber.setTree(tree.getValue());
 
@@ -227,7 +233,7 @@ StringResult<ast::MacroMatcher> Parser::parseMacroMatcher() {
     while (true) {
       if (check(TokenKind::Eof)) {
         return StringResult<ast::MacroMatcher>(
-            "failed to parse marco matcher: eof");
+            adt::Error("failed to parse marco matcher: eof", getLocation()));
       } else if (check(TokenKind::ParenClose)) {
         assert(eat(TokenKind::ParenClose));
         matcher.setKind(MacroMatcherKind::Paren);
@@ -235,10 +241,9 @@ StringResult<ast::MacroMatcher> Parser::parseMacroMatcher() {
       } else {
         StringResult<ast::MacroMatch> match = parseMacroMatch();
         if (!match) {
-          llvm::errs() << "failed to parse macro match in macro matcher: "
-                       << match.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse macro match in macro matcher",
+                          match.getError()};
+          return StringResult<ast::MacroMatcher>(s);
         }
         matcher.addMatch(match.getValue());
       }
@@ -247,7 +252,7 @@ StringResult<ast::MacroMatcher> Parser::parseMacroMatcher() {
     while (true) {
       if (check(TokenKind::Eof)) {
         return StringResult<ast::MacroMatcher>(
-            "failed to parse marco matcher: eof");
+            adt::Error("failed to parse marco matcher: eof", getLocation()));
       } else if (check(TokenKind::SquareClose)) {
         assert(eat(TokenKind::SquareClose));
         matcher.setKind(MacroMatcherKind::Square);
@@ -255,10 +260,9 @@ StringResult<ast::MacroMatcher> Parser::parseMacroMatcher() {
       } else {
         StringResult<ast::MacroMatch> match = parseMacroMatch();
         if (!match) {
-          llvm::errs() << "failed to parse macro match in macro matcher: "
-                       << match.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse macro match in macro matcher",
+                          match.getError()};
+          return StringResult<ast::MacroMatcher>(s);
         }
         matcher.addMatch(match.getValue());
       }
@@ -267,7 +271,7 @@ StringResult<ast::MacroMatcher> Parser::parseMacroMatcher() {
     while (true) {
       if (check(TokenKind::Eof)) {
         return StringResult<ast::MacroMatcher>(
-            "failed to parse marco matcher: eof");
+            adt::Error("failed to parse marco matcher: eof", getLocation()));
       } else if (check(TokenKind::BraceClose)) {
         assert(eat(TokenKind::BraceClose));
         matcher.setKind(MacroMatcherKind::Brace);
@@ -275,18 +279,19 @@ StringResult<ast::MacroMatcher> Parser::parseMacroMatcher() {
       } else {
         StringResult<ast::MacroMatch> match = parseMacroMatch();
         if (!match) {
-          llvm::errs() << "failed to parse macro match in macro matcher: "
-                       << match.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse macro match in macro matcher",
+                          match.getError()};
+          return StringResult<ast::MacroMatcher>(s);
         }
         matcher.addMatch(match.getValue());
       }
     }
   } else {
-    return StringResult<ast::MacroMatcher>("failed to parse marco matcher");
+    return StringResult<ast::MacroMatcher>(
+        adt::Error("failed to parse marco matcher", getLocation()));
   }
-  return StringResult<ast::MacroMatcher>("failed to parse marco matcher");
+  return StringResult<ast::MacroMatcher>(
+      adt::Error("failed to parse marco matcher", getLocation()));
 }
 
 StringResult<ast::MacroRule> Parser::parseMacroRule() {
@@ -295,25 +300,23 @@ StringResult<ast::MacroRule> Parser::parseMacroRule() {
 
   StringResult<ast::MacroMatcher> matcher = parseMacroMatcher();
   if (!matcher) {
-    llvm::errs() << "failed to parse macro matcher in macro rule: "
-                 << matcher.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse macro matcher in macro rule",
+                    matcher.getError()};
+    return StringResult<ast::MacroRule>(s);
   }
   rule.setMatcher(matcher.getValue());
 
   if (!check(TokenKind::FatArrow)) {
     return StringResult<ast::MacroRule>(
-        "failed to parse => token in macro rule");
+        adt::Error("failed to parse => token in macro rule", getLocation()));
   }
   assert(eat(TokenKind::FatArrow));
 
   StringResult<ast::MacroTranscriber> transcriber = parseMacroTranscriber();
   if (!transcriber) {
-    llvm::errs() << "failed to parse macro transcriber in macro rule: "
-                 << transcriber.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse macro transcriber in macro rule",
+                    transcriber.getError()};
+    return StringResult<ast::MacroRule>(s);
   }
   rule.setTranscriber(transcriber.getValue());
 
@@ -326,16 +329,16 @@ StringResult<ast::MacroRules> Parser::parseMacroRules() {
 
   StringResult<ast::MacroRule> rule = parseMacroRule();
   if (!rule) {
-    llvm::errs() << "failed to parse macro rule in macro rules: "
-                 << rule.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse macro rule in macro rules",
+                    rule.getError()};
+    return StringResult<ast::MacroRules>(s);
   }
   rules.addRule(rule.getValue());
 
   while (true) {
     if (check(TokenKind::Eof)) {
-      return StringResult<ast::MacroRules>("failed to parse macro rules: eof");
+      return StringResult<ast::MacroRules>(
+          adt::Error("failed to parse macro rules: eof", getLocation()));
     } else if (check(TokenKind::ParenClose)) {
       return StringResult<ast::MacroRules>(rules);
     } else if (check(TokenKind::SquareClose)) {
@@ -355,18 +358,19 @@ StringResult<ast::MacroRules> Parser::parseMacroRules() {
       assert(eat(TokenKind::Semi));
       StringResult<ast::MacroRule> rule = parseMacroRule();
       if (!rule) {
-        llvm::errs() << "failed to parse macro rule in macro rules: "
-                     << rule.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse macro rule in macro rules",
+                        rule.getError()};
+        return StringResult<ast::MacroRules>(s);
       }
       rules.addRule(rule.getValue());
       // FIXME: return rules?
     } else {
-      return StringResult<ast::MacroRules>("failed to parse macro rules");
+      return StringResult<ast::MacroRules>(
+          adt::Error("failed to parse macro rules", getLocation()));
     }
   }
-  return StringResult<ast::MacroRules>("failed to parse macro rules");
+  return StringResult<ast::MacroRules>(
+      adt::Error("failed to parse macro rules", getLocation()));
 }
 
 StringResult<ast::MacroRulesDef> Parser::parseMacroRulesDef() {
@@ -376,63 +380,66 @@ StringResult<ast::MacroRulesDef> Parser::parseMacroRulesDef() {
   if (check(TokenKind::ParenOpen)) {
     StringResult<ast::MacroRules> rules = parseMacroRules();
     if (!rules) {
-      llvm::errs() << "failed to parse macro rules in macro rules def: "
-                   << rules.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse macro rules in macro rules def",
+                      rules.getError()};
+      return StringResult<ast::MacroRulesDef>(s);
     }
     def.setRules(rules.getValue());
     if (!check(TokenKind::ParenClose))
       return StringResult<ast::MacroRulesDef>(
-          "failed to parse ) token in macro rules "
-          "def");
+          adt::Error("failed to parse ) token in macro rules "
+                     "def",
+                     getLocation()));
     assert(eat(TokenKind::ParenClose));
     if (!check(TokenKind::Semi))
       return StringResult<ast::MacroRulesDef>(
-          "failed to parse ; token in macro rules "
-          "def");
+          adt::Error("failed to parse ; token in macro rules "
+                     "def",
+                     getLocation()));
     assert(eat(TokenKind::Semi));
     def.setKind(MacroRulesDefKind::Paren);
     return StringResult<ast::MacroRulesDef>(def);
   } else if (check(TokenKind::SquareOpen)) {
     StringResult<ast::MacroRules> rules = parseMacroRules();
     if (!rules) {
-      llvm::errs() << "failed to parse macro rules in macro rules def: "
-                   << rules.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse macro rules in macro rules def",
+                      rules.getError()};
+      return StringResult<ast::MacroRulesDef>(s);
     }
     def.setRules(rules.getValue());
     if (!check(TokenKind::ParenClose))
       return StringResult<ast::MacroRulesDef>(
-          "failed to parse ] token in macro rules "
-          "def");
+          adt::Error("failed to parse ] token in macro rules "
+                     "def",
+                     getLocation()));
     assert(eat(TokenKind::ParenClose));
     if (!check(TokenKind::Semi))
       return StringResult<ast::MacroRulesDef>(
-          "failed to parse ; token in macro rules "
-          "def");
+          adt::Error("failed to parse ; token in macro rules "
+                     "def",
+                     getLocation()));
     assert(eat(TokenKind::Semi));
     def.setKind(MacroRulesDefKind::Square);
     return StringResult<ast::MacroRulesDef>(def);
   } else if (check(TokenKind::BraceOpen)) {
     StringResult<ast::MacroRules> rules = parseMacroRules();
     if (!rules) {
-      llvm::errs() << "failed to parse macro rules in macro rules def: "
-                   << rules.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse macro rules in macro rules def",
+                      rules.getError()};
+      return StringResult<ast::MacroRulesDef>(s);
     }
     def.setRules(rules.getValue());
     if (!check(TokenKind::ParenClose))
       return StringResult<ast::MacroRulesDef>(
-          "failed to parse } token in macro rules "
-          "def");
+          adt::Error("failed to parse } token in macro rules "
+                     "def",
+                     getLocation()));
     assert(eat(TokenKind::ParenClose));
     def.setKind(MacroRulesDefKind::Brace);
     return StringResult<ast::MacroRulesDef>(def);
   }
-  return StringResult<ast::MacroRulesDef>("failed to parse macro rules def");
+  return StringResult<ast::MacroRulesDef>(
+      adt::Error("failed to parse macro rules def", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Item>> Parser::parseMacroRulesDefinition() {
@@ -441,35 +448,39 @@ StringResult<std::shared_ptr<ast::Item>> Parser::parseMacroRulesDefinition() {
 
   if (!checkKeyWord(KeyWordKind::KW_MACRO_RULES))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse macro_rules keyword in macro "
-        "rules definition");
+        adt::Error(
+            "failed to parse macro_rules keyword in macro "
+            "rules definition",
+            getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_MACRO_RULES));
 
   if (!check(TokenKind::Not))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse ! token in macro rules "
-        "definition");
+        adt::Error("failed to parse ! token in macro rules "
+                   "definition",
+                   getLocation()));
   assert(eat(TokenKind::Not));
 
   if (!check(TokenKind::Identifier))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse identifier token in macro "
-        "rules definition");
+        adt::Error(
+            "failed to parse identifier token in macro "
+            "rules definition",
+            getLocation()));
 
   def.setIdentifier(getToken().getIdentifier());
   assert(eat(TokenKind::Identifier));
 
   StringResult<ast::MacroRulesDef> rulesDef = parseMacroRulesDef();
   if (!rulesDef) {
-    llvm::errs() << "failed to parse macro rules ef in macro rules definition: "
-                 << rulesDef.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse macro rules ef in macro rules definition",
+                    rulesDef.getError()};
+    return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   def.setDefinition(rulesDef.getValue());
 
   return StringResult<std::shared_ptr<ast::Item>>(
-      std::make_shared<MacroRulesDefinition>(def));
+      context->create<MacroRulesDefinition>(def));
 }
 
 } // namespace rust_compiler::parser
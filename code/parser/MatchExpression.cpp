@@ -23,7 +23,8 @@ StringResult<ast::MatchArmGuard> Parser::parseMatchArmGuard() {
   MatchArmGuard guard = {loc};
 
   if (!checkKeyWord(KeyWordKind::KW_IF))
-    return StringResult<ast::MatchArmGuard>("failed to parse match arm guard");
+    return StringResult<ast::MatchArmGuard>(
+        adt::Error("failed to parse match arm guard", getLocation()));
 
   assert(checkKeyWord(KeyWordKind::KW_IF));
 
@@ -31,14 +32,8 @@ StringResult<ast::MatchArmGuard> Parser::parseMatchArmGuard() {
   StringResult<std::shared_ptr<ast::Expression>> expr =
       parseExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse expression in match arm guard: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to parse expression in match arm guard: ", expr.getError())
-            .str();
+    adt::Error s = {"failed to parse expression in match arm guard",
+                    expr.getError()};
     return StringResult<ast::MatchArmGuard>(s);
   }
 
@@ -55,15 +50,9 @@ StringResult<ast::MatchArm> Parser::parseMatchArm() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in match arm: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
       // exit(EXIT_FAILURE);
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "failed to parse outer attributes in match arms: ",
-                        outer.getError())
-              .str();
+      adt::Error s = {"failed to parse outer attributes in match arms",
+                      outer.getError()};
       return StringResult<ast::MatchArm>(s);
     }
     std::vector<ast::OuterAttribute> ot = outer.getValue();
@@ -73,13 +62,7 @@ StringResult<ast::MatchArm> Parser::parseMatchArm() {
   StringResult<std::shared_ptr<ast::patterns::Pattern>> pattern =
       parsePattern();
   if (!pattern) {
-    llvm::errs() << "failed to parse pattern in match arm: "
-                 << pattern.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0} {1}", "failed to parse pattern in match arm: ",
-                      pattern.getError())
-            .str();
+    adt::Error s = {"failed to parse pattern in match arm", pattern.getError()};
     return StringResult<ast::MatchArm>(s);
   }
   arm.setPattern(pattern.getValue());
@@ -87,14 +70,8 @@ StringResult<ast::MatchArm> Parser::parseMatchArm() {
   if (checkKeyWord(KeyWordKind::KW_IF)) {
     StringResult<ast::MatchArmGuard> guard = parseMatchArmGuard();
     if (!guard) {
-      llvm::errs() << "failed to parse match arm guard in match arm: "
-                   << guard.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "failed to parse match arm guard in match arm: ",
-                        guard.getError())
-              .str();
+      adt::Error s = {"failed to parse match arm guard in match arm",
+                      guard.getError()};
       return StringResult<ast::MatchArm>(s);
     }
     arm.setGuard(guard.getValue());
@@ -109,20 +86,14 @@ StringResult<ast::MatchArms> Parser::parseMatchArms() {
 
   StringResult<ast::MatchArm> arm = parseMatchArm();
   if (!arm) {
-    llvm::errs() << "failed to parse match arm in match arms: "
-                 << arm.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0} {1}", "failed to parse match arm in match arms: ",
-                      arm.getError())
-            .str();
+    adt::Error s = {"failed to parse match arm in match arms", arm.getError()};
     return StringResult<ast::MatchArms>(s);
   }
 
   if (!check(TokenKind::FatArrow)) {
     llvm::errs() << Token2String(getToken().getKind()) << "\n";
     return StringResult<ast::MatchArms>(
-        "failed to parse fat arrow in match arms");
+        adt::Error("failed to parse fat arrow in match arms", getLocation()));
   }
   assert(eat(TokenKind::FatArrow));
 
@@ -130,13 +101,8 @@ StringResult<ast::MatchArms> Parser::parseMatchArms() {
   StringResult<std::shared_ptr<Expression>> expr =
       parseExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse expression in match arms: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0} {1}", "failed to parse expression in match arms: ",
-                      expr.getError())
-            .str();
+    adt::Error s = {"failed to parse expression in match arms",
+                    expr.getError()};
     return StringResult<ast::MatchArms>(s);
   }
 
@@ -146,8 +112,10 @@ StringResult<ast::MatchArms> Parser::parseMatchArms() {
       ExpressionKind::ExpressionWithoutBlock) {
     if (!check(TokenKind::Comma)) {
       return StringResult<ast::MatchArms>(
-          "failed to parse , after parse expression without "
-          "block in match arms");
+          adt::Error(
+              "failed to parse , after parse expression without "
+              "block in match arms",
+              getLocation()));
     }
     assert(eat(TokenKind::Comma));
   } else {
@@ -158,7 +126,8 @@ StringResult<ast::MatchArms> Parser::parseMatchArms() {
   while (true) {
     if (check(TokenKind::Eof)) {
       // abort
-      return StringResult<ast::MatchArms>("failed to parse match arms: eof");
+      return StringResult<ast::MatchArms>(
+          adt::Error("failed to parse match arms: eof", getLocation()));
     } else if (check(TokenKind::BraceClose)) {
       // done
       return StringResult<ast::MatchArms>(arms);
@@ -169,19 +138,14 @@ StringResult<ast::MatchArms> Parser::parseMatchArms() {
     } else if (!check(TokenKind::BraceClose)) {
       StringResult<ast::MatchArm> arm = parseMatchArm();
       if (!arm) {
-        llvm::errs() << "failed to parse match arm in match arms: "
-                     << arm.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv(
-                "{0} {1}",
-                "failed to parse match arm in match arms: ", arm.getError())
-                .str();
+        adt::Error s = {"failed to parse match arm in match arms",
+                        arm.getError()};
         return StringResult<ast::MatchArms>(s);
       }
       if (!check(TokenKind::FatArrow)) {
         return StringResult<ast::MatchArms>(
-            "failed to parse fat arrow in match arms");
+            adt::Error("failed to parse fat arrow in match arms",
+                       getLocation()));
       }
       assert(eat(TokenKind::FatArrow));
 
@@ -189,14 +153,8 @@ StringResult<ast::MatchArms> Parser::parseMatchArms() {
       StringResult<std::shared_ptr<Expression>> expr =
           parseExpression({}, restrictions);
       if (!expr) {
-        llvm::errs() << "failed to parse expression in match arms: "
-                     << expr.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv(
-                "{0} {1}",
-                "failed to parse expression in match arms: ", expr.getError())
-                .str();
+        adt::Error s = {"failed to parse expression in match arms",
+                        expr.getError()};
         return StringResult<ast::MatchArms>(s);
       }
       arms.addArm(arm.getValue(), expr.getValue());
@@ -205,8 +163,10 @@ StringResult<ast::MatchArms> Parser::parseMatchArms() {
           ExpressionKind::ExpressionWithoutBlock) {
         if (!check(TokenKind::Comma)) {
           return StringResult<ast::MatchArms>(
-              "failed to parse , after parse expression without "
-              "block in match arms");
+              adt::Error(
+                  "failed to parse , after parse expression without "
+                  "block in match arms",
+                  getLocation()));
         }
         assert(eat(TokenKind::Comma));
       } else {
@@ -218,10 +178,12 @@ StringResult<ast::MatchArms> Parser::parseMatchArms() {
       llvm::errs() << "parseMatchArms unknown token: "
                    << Token2String(getToken().getKind()) << "\n";
       return StringResult<ast::MatchArms>(
-          "failed to parse match arms with unknown token");
+          adt::Error("failed to parse match arms with unknown token",
+                     getLocation()));
     }
   }
-  return StringResult<ast::MatchArms>("failed to parse match arms");
+  return StringResult<ast::MatchArms>(
+      adt::Error("failed to parse match arms", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Expression>>
@@ -233,19 +195,14 @@ Parser::parseMatchExpression(std::span<ast::OuterAttribute>) {
     assert(eatKeyWord(KeyWordKind::KW_MATCH));
   } else {
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse match keyword in match expression");
+        adt::Error("failed to parse match keyword in match expression",
+                   getLocation()));
   }
 
   StringResult<ast::Scrutinee> scrutinee = parseScrutinee();
   if (!scrutinee) {
-    llvm::errs() << "failed to parse scrutinee in match expression: "
-                 << scrutinee.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0} {1}",
-                      "failed to parse scrutinee in match expression: ",
-                      scrutinee.getError())
-            .str();
+    adt::Error s = {"failed to parse scrutinee in match expression",
+                    scrutinee.getError()};
     return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   ma.setScrutinee(scrutinee.getValue());
@@ -254,21 +211,16 @@ Parser::parseMatchExpression(std::span<ast::OuterAttribute>) {
     assert(eat(TokenKind::BraceOpen));
   } else {
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse { token in match expression");
+        adt::Error("failed to parse { token in match expression",
+                   getLocation()));
   }
 
   if (checkInnerAttribute()) {
     StringResult<std::vector<ast::InnerAttribute>> inner =
         parseInnerAttributes();
     if (!inner) {
-      llvm::errs() << "failed to parse inner attribute in match expression: "
-                   << inner.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "failed to parse inner attribute in match expression: ",
-                        inner.getError())
-              .str();
+      adt::Error s = {"failed to parse inner attribute in match expression",
+                      inner.getError()};
       return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     std::vector<ast::InnerAttribute> in = inner.getValue();
@@ -278,19 +230,13 @@ Parser::parseMatchExpression(std::span<ast::OuterAttribute>) {
   if (check(TokenKind::BraceClose)) {
     assert(eat(TokenKind::BraceClose));
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<MatchExpression>(ma));
+        context->create<MatchExpression>(ma));
   }
 
   StringResult<ast::MatchArms> arms = parseMatchArms();
   if (!arms) {
-    llvm::errs() << "failed to parse match arms in match expression: "
-                 << arms.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to parse match arms in match expression: ", arms.getError())
-            .str();
+    adt::Error s = {"failed to parse match arms in match expression",
+                    arms.getError()};
     return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   ma.setMatchArms(arms.getValue());
@@ -298,13 +244,13 @@ Parser::parseMatchExpression(std::span<ast::OuterAttribute>) {
   if (check(TokenKind::BraceClose)) {
     assert(eat(TokenKind::BraceClose));
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<MatchExpression>(ma));
+        context->create<MatchExpression>(ma));
   }
 
   llvm::errs() << "parseMatchExpression: " << Token2String(getToken().getKind())
                << "\n";
   return StringResult<std::shared_ptr<ast::Expression>>(
-      "failed to parse match expression");
+      adt::Error("failed to parse match expression", getLocation()));
 }
 
 } // namespace rust_compiler::parser
@@ -1,5 +1,4 @@
 #include "ADT/Result.h"
-#include "AST/ErrorPropagationExpression.h"
 #include "Lexer/KeyWords.h"
 #include "Lexer/Token.h"
 #include "Parser/Parser.h"
@@ -26,41 +25,25 @@ adt::StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseExpression(Precedence rightBindingPower,
                         std::span<ast::OuterAttribute> outer,
                         Restrictions restrictions) {
-  //  llvm::errs() << "parseExpression"
-  //               << "\n";
-
   adt::StringResult<std::shared_ptr<ast::Expression>> expr =
       parseUnaryExpression({}, restrictions);
   if (!expr) {
-    llvm::errs() << "failed to parse unary expression in expression: "
-                 << expr.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to parse unary expression in expression: ", expr.getError())
-            .str();
+    adt::Error s = {"failed to parse unary expression in expression",
+                    expr.getError()};
     return adt::StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
-  llvm::errs() << "token found after unary expression: "
-               << Token2String(getToken().getKind()) << "\n";
-
   // stop parsing if find lower priority token - parse higher priority first
-  while (rightBindingPower < getLeftBindingPower()) {
+  while (const InfixOperator *op = getInfixOperator()) {
+    if (op->leftBindingPower <= rightBindingPower)
+      break;
     CheckPoint cp = getCheckPoint();
-    expr = parseInfixExpression(expr.getValue(), outer, restrictions);
+    expr = op->parselet(*this, expr.getValue(), op->rightBindingPower, outer,
+                        restrictions);
     if (!expr) {
-      llvm::errs() << "failed to parse unary expression in expression: "
-                   << expr.getError() << "\n";
-      llvm::errs() << "returning nullptr"
-                   << "\n";
       recover(cp);
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "failed to parse unary expression in expression: ",
-                        expr.getError())
-              .str();
+      adt::Error s = {"failed to parse unary expression in expression",
+                      expr.getError()};
 
       return adt::StringResult<std::shared_ptr<ast::Expression>>(s);
     }
@@ -69,106 +52,6 @@ Parser::parseExpression(Precedence rightBindingPower,
   return expr;
 }
 
-StringResult<std::shared_ptr<ast::Expression>>
-Parser::parseInfixExpression(std::shared_ptr<Expression> left,
-                             std::span<OuterAttribute> outer,
-                             Restrictions restrictions) {
-  switch (getToken().getKind()) {
-  case TokenKind::QMark: {
-    Location loc = getLocation();
-    ErrorPropagationExpression error = {loc};
-    error.setLhs(left);
-    assert(eat(TokenKind::QMark));
-    return adt::StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<ErrorPropagationExpression>(error));
-  }
-  case TokenKind::Plus: {
-    return parseArithmeticOrLogicalExpression(left, restrictions);
-  }
-  case TokenKind::Minus: {
-    return parseArithmeticOrLogicalExpression(left, restrictions);
-  }
-  case TokenKind::Star: {
-    return parseArithmeticOrLogicalExpression(left, restrictions);
-  }
-  case TokenKind::Shr: {
-    return parseArithmeticOrLogicalExpression(left, restrictions);
-  }
-  case TokenKind::Shl: {
-    return parseArithmeticOrLogicalExpression(left, restrictions);
-  }
-  case TokenKind::Lt: {
-    return parseComparisonExpression(left, restrictions);
-  }
-  case TokenKind::Gt: {
-    return parseComparisonExpression(left, restrictions);
-  }
-  case TokenKind::EqEq: {
-    return parseComparisonExpression(left, restrictions);
-  }
-  case TokenKind::Eq: {
-    return parseAssignmentExpression(left, outer, restrictions);
-  }
-  case TokenKind::DotDot: {
-    return parseRangeExpression(left, outer, restrictions);
-  }
-  case TokenKind::DotDotEq: {
-    return parseRangeExpression(left, outer, restrictions);
-  }
-  case TokenKind::SquareOpen: {
-    return parseIndexExpression(left, outer, restrictions);
-  }
-  case TokenKind::ParenOpen: {
-    return parseCallExpression(left, outer, restrictions);
-  }
-  case TokenKind::PlusEq: {
-    return parseCompoundAssignmentExpression(left, restrictions);
-  }
-  case TokenKind::Keyword: {
-    switch (getToken().getKeyWordKind()) {
-    case KeyWordKind::KW_AS: {
-      return parseTypeCastExpression(left);
-    }
-    default: {
-      llvm::errs() << KeyWord2String(getToken().getKeyWordKind()) << "\n";
-      assert(false);
-    }
-    }
-  }
-  case TokenKind::Dot: {
-    // field expression or method call
-    if (checkKeyWord(KeyWordKind::KW_AWAIT, 1)) {
-      return parseAwaitExpression(left, outer);
-    } else if (check(TokenKind::INTEGER_LITERAL, 1)) {
-      return parseTupleIndexingExpression(left, outer, restrictions);
-    } else if (check(TokenKind::Identifier, 1) &&
-               !check(TokenKind::ParenOpen, 2) &&
-               !check(TokenKind::PathSep, 2)) {
-      return parseFieldExpression(left, outer, restrictions);
-    }
-    return parseMethodCallExpression(left, outer, restrictions);
-  }
-  case TokenKind::Eof: {
-    std::string s =
-        llvm::formatv("{0} {1}", "found eof token in parse infix expression",
-                      "eof")
-            .str();
-    return StringResult<std::shared_ptr<ast::Expression>>(s);
-  }
-  default: {
-    std::string s =
-        llvm::formatv("{0} {1}",
-                      "error unhandled token kind in parse infix expression: ",
-                      Token2String(getToken().getKind()))
-            .str();
-    llvm::errs() << "error unhandled token kind in parse infix expression: "
-                 << Token2String(getToken().getKind()) << "\n";
-    return StringResult<std::shared_ptr<ast::Expression>>(s);
-    // exit(EXIT_FAILURE);
-  }
-  }
-}
-
 } // namespace rust_compiler::parser
 
 /*
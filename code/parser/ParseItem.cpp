@@ -16,10 +16,9 @@ StringResult<std::shared_ptr<ast::Item>> Parser::parseItem() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in item: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in item",
+                      outer.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
 
     std::vector<OuterAttribute> ot = outer.getValue();
@@ -28,7 +27,8 @@ StringResult<std::shared_ptr<ast::Item>> Parser::parseItem() {
     } else if (checkMacroItem()) {
       return parseMacroItem(ot);
     }
-    return StringResult<std::shared_ptr<ast::Item>>("failed to parse item2");
+    return StringResult<std::shared_ptr<ast::Item>>(
+        adt::Error("failed to parse item2", getLocation()));
   }
 
   std::vector<OuterAttribute> outer;
@@ -41,7 +41,8 @@ StringResult<std::shared_ptr<ast::Item>> Parser::parseItem() {
   llvm::errs() << Token2String(getToken().getKind()) << "\n";
   llvm::errs() << "failed to parse item1@"
                << getToken().getLocation().toString() << "\n";
-  return StringResult<std::shared_ptr<ast::Item>>("failed to parse item1");
+  return StringResult<std::shared_ptr<ast::Item>>(
+      adt::Error("failed to parse item1", getLocation()));
 }
 
 } // namespace rust_compiler::parser
@@ -12,6 +12,7 @@
 
 #include <llvm/Support/FormatVariadic.h>
 #include <llvm/Support/raw_ostream.h>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -23,22 +24,8 @@ using namespace rust_compiler::adt;
 namespace rust_compiler::parser {
 
 bool Parser::checkPostFix() {
-  return check(TokenKind::QMark) || check(TokenKind::Plus) ||
-         check(TokenKind::Minus) || check(TokenKind::Star) ||
-         check(TokenKind::Slash) || check(TokenKind::Percent) ||
-         check(TokenKind::Or) || check(TokenKind::Caret) ||
-         check(TokenKind::Shl) || check(TokenKind::Shr) ||
-         check(TokenKind::EqEq) || check(TokenKind::Ne) ||
-         check(TokenKind::Gt) || check(TokenKind::Lt) || check(TokenKind::Ge) ||
-         check(TokenKind::Le) || check(TokenKind::OrOr) ||
-         check(TokenKind::AndAnd) || checkKeyWord(KeyWordKind::KW_AS) ||
-         check(TokenKind::PlusEq) || check(TokenKind::MinusEq) ||
-         check(TokenKind::StarEq) || check(TokenKind::SlashEq) ||
-         check(TokenKind::PercentEq) || check(TokenKind::AndEq) ||
-         check(TokenKind::AndEq) || check(TokenKind::OrEq) ||
-         check(TokenKind::ShlEq) || check(TokenKind::Dot) ||
-         check(TokenKind::SquareOpen) || check(TokenKind::DotDot) ||
-         check(TokenKind::DotDotEq) || check(TokenKind::ShrEq);
+  const InfixOperator *op = getInfixOperator();
+  return op && op->isPostfix;
 }
 
 bool Parser::checkMacroItem() {
@@ -92,8 +79,9 @@ bool Parser::checkMacroItem() {
       recover(cp);
       return false;
     } else {
-      llvm::errs() << "checkMacroItem: unknown token: "
-                   << Token2String(getToken().getKind()) << "\n";
+      // e.g. ) or the ( of a call: no macro invocation
+      recover(cp);
+      return false;
     }
   }
 }
@@ -134,7 +122,8 @@ StringResult<ast::Lifetime> Parser::parseLifetimeAsLifetime() {
     assert(eat(TokenKind::LIFETIME_TOKEN));
     lf.setLifetime(getToken().getStorage());
   } else {
-    return StringResult<ast::Lifetime>("failed to parse lifetime");
+    return StringResult<ast::Lifetime>(
+        adt::Error("failed to parse lifetime", getLocation()));
   }
 
   return StringResult<ast::Lifetime>(lf);
@@ -242,9 +231,21 @@ bool Parser::checkLiteral(uint8_t off) {
          checkKeyWord(KeyWordKind::KW_FALSE, off);
 }
 
-CheckPoint Parser::getCheckPoint() { return CheckPoint(offset); }
+CheckPoint Parser::getCheckPoint() { return tokens.getCheckPoint(); }
 
-void Parser::recover(const CheckPoint &cp) { offset = cp.readOffset(); }
+void Parser::recover(const CheckPoint &cp, const std::source_location &site) {
+  if (profile)
+    profile->recordBacktrack(site);
+  tokens.recover(cp);
+}
+
+bool Parser::skipTokenTree() {
+  std::optional<size_t> match = tokens.getMatchingDelimiter();
+  if (!match)
+    return false;
+  tokens.skipTo(*match + 1);
+  return true;
+}
 
 bool Parser::checkOuterAttribute(uint8_t off) {
   if (check(TokenKind::Hash, off) && check(TokenKind::SquareOpen, off + 1))
@@ -259,51 +260,26 @@ bool Parser::checkInnerAttribute() {
   return false;
 }
 
-bool Parser::check(lexer::TokenKind token) {
-  return ts.getAt(offset).getKind() == token;
-}
-
-bool Parser::check(lexer::TokenKind token, size_t _offset) {
-  return ts.getAt(offset + _offset).getKind() == token;
-}
-
-bool Parser::checkKeyWord(lexer::KeyWordKind keyword) {
-  if (ts.getAt(offset).getKind() == TokenKind::Keyword)
-    return ts.getAt(offset).getKeyWordKind() == keyword;
-  return false;
-}
-
-bool Parser::checkKeyWord(lexer::KeyWordKind keyword, size_t _offset) {
-  if (ts.getAt(offset + _offset).getKind() == TokenKind::Keyword)
-    return ts.getAt(offset + _offset).getKeyWordKind() == keyword;
-  return false;
-}
-
 bool Parser::eatKeyWord(lexer::KeyWordKind keyword) {
   if (checkKeyWord(keyword)) {
-    ++offset;
+    tokens.advance();
     return true;
   }
-  ++offset;
+  tokens.advance();
   return false;
 }
 
 bool Parser::eat(lexer::TokenKind token) {
   if (check(token)) {
-    ++offset;
+    tokens.advance();
     return true;
   }
-  ++offset;
+  tokens.advance();
   return false;
 }
 
 rust_compiler::Location Parser::getLocation() {
-  return ts.getAt(offset).getLocation();
-}
-
-lexer::Token Parser::getToken(uint8_t off) const {
-  assert(offset + off < ts.getLength() && "out of range access in getToken");
-  return ts.getAt(offset + off);
+  return tokens.peek().getLocation();
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -312,12 +288,10 @@ Parser::parseVisItem(std::span<OuterAttribute> outer) {
 
   if (checkKeyWord(lexer::KeyWordKind::KW_PUB)) {
     // FIXME
-    Result<ast::Visibility, std::string> result = parseVisibility();
+    StringResult<ast::Visibility> result = parseVisibility();
     if (!result) {
-      llvm::errs() << "failed to parse visibility: " << result.getError()
-                   << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse visibility", result.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     vis = result.getValue();
   }
@@ -372,7 +346,8 @@ Parser::parseVisItem(std::span<OuterAttribute> outer) {
     return parseExternBlock(outer, vis);
   }
   // complete?
-  return StringResult<std::shared_ptr<ast::Item>>("failed to parse vis item");
+  return StringResult<std::shared_ptr<ast::Item>>(
+      adt::Error("failed to parse vis item", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -403,7 +378,7 @@ Parser::parseMod(std::span<OuterAttribute> outer, std::optional<ast::Visibility>
 
     return StringResult<std::shared_ptr<ast::Item>>(
         StringResult<std::shared_ptr<ast::Item>>(
-            std::make_shared<ast::Module>(mod)));
+            context->create<ast::Module>(mod)));
   }
 
   if (checkKeyWord(lexer::KeyWordKind::KW_MOD) &&
@@ -423,10 +398,9 @@ Parser::parseMod(std::span<OuterAttribute> outer, std::optional<ast::Visibility>
       StringResult<std::vector<ast::InnerAttribute>> inner =
           parseInnerAttributes();
       if (!inner) {
-        llvm::errs() << "failed to parse inner attributes in mod: "
-                     << inner.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse inner attributes in mod",
+                        inner.getError()};
+        return StringResult<std::shared_ptr<ast::Item>>(s);
       }
       std::vector<InnerAttribute> in = inner.getValue();
       mod.setInnerAttributes(in);
@@ -435,54 +409,49 @@ Parser::parseMod(std::span<OuterAttribute> outer, std::optional<ast::Visibility>
     if (check(TokenKind::BraceClose)) {
       assert(eat(lexer::TokenKind::BraceClose));
       return StringResult<std::shared_ptr<ast::Item>>(
-          std::make_shared<Module>(mod));
+          context->create<Module>(mod));
     }
 
     while (true) {
       if (check(TokenKind::Eof)) {
         return StringResult<std::shared_ptr<ast::Item>>(
-            "failed to parse module: eof");
+            adt::Error("failed to parse module: eof", getLocation()));
       } else if (check(TokenKind::BraceClose)) {
         // done
         assert(eat(lexer::TokenKind::BraceClose));
         return StringResult<std::shared_ptr<ast::Item>>(
-            std::make_shared<Module>(mod));
+            context->create<Module>(mod));
       } else {
-        Result<std::shared_ptr<ast::Item>, std::string> item = parseItem();
+        StringResult<std::shared_ptr<ast::Item>> item = parseItemOrRecover();
         if (!item) {
-          llvm::errs() << "failed to parse item in mod: " << item.getError()
-                       << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse item in mod", item.getError()};
+          return StringResult<std::shared_ptr<ast::Item>>(s);
         }
         mod.addItem(item.getValue());
       }
     }
   }
 
-  return StringResult<std::shared_ptr<ast::Item>>("failed to parse module");
+  return StringResult<std::shared_ptr<ast::Item>>(
+      adt::Error("failed to parse module", getLocation()));
 }
 
-Result<std::shared_ptr<ast::Crate>, std::string>
+StringResult<std::shared_ptr<ast::Crate>>
 Parser::parseCrateModule(std::string_view crateName, basic::CrateNum crateNum) {
   Location loc = getLocation();
 
   Crate crate = {crateName, crateNum};
+  // the crate owns the arena of its nodes
+  crate.setASTContext(context);
 
   if (checkInnerAttribute()) {
 
     StringResult<std::vector<ast::InnerAttribute>> innerAttributes =
         parseInnerAttributes();
     if (!innerAttributes) {
-      llvm::errs() << "failed to parse inner attributes in crate : "
-                   << innerAttributes.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0}\n{1}",
-                        "failed to parse inner attributes in crate : ",
-                        innerAttributes.getError())
-              .str();
-      return Result<std::shared_ptr<ast::Crate>, std::string>(s);
+      adt::Error s = {"failed to parse inner attributes in crate",
+                      innerAttributes.getError()};
+      return StringResult<std::shared_ptr<ast::Crate>>(s);
     }
     std::vector<InnerAttribute> inner = innerAttributes.getValue();
     crate.setInnerAttributes(inner);
@@ -491,61 +460,54 @@ Parser::parseCrateModule(std::string_view crateName, basic::CrateNum crateNum) {
   while (true) {
     if (check(TokenKind::Eof)) {
       // done
-      return Result<std::shared_ptr<ast::Crate>, std::string>(
+      return StringResult<std::shared_ptr<ast::Crate>>(
           std::make_shared<Crate>(crate));
     }
-    Result<std::shared_ptr<ast::Item>, std::string> item = parseItem();
+    StringResult<std::shared_ptr<ast::Item>> item = parseItemOrRecover();
     if (!item) {
-      llvm::errs() << "failed to parse item in crate: " << item.getError()
-                   << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0}\n{1}",
-                        "failed to parse item in crate : ", item.getError())
-              .str();
-      return Result<std::shared_ptr<ast::Crate>, std::string>(s);
+      adt::Error s = {"failed to parse item in crate", item.getError()};
+      return StringResult<std::shared_ptr<ast::Crate>>(s);
     }
     crate.addItem(item.getValue());
   }
 
-  return Result<std::shared_ptr<ast::Crate>, std::string>(
+  return StringResult<std::shared_ptr<ast::Crate>>(
       std::make_shared<Crate>(crate));
 }
 
-Result<std::shared_ptr<ast::WhereClauseItem>, std::string>
+StringResult<std::shared_ptr<ast::WhereClauseItem>>
 Parser::parseLifetimeWhereClauseItem() {
   Location loc = getLocation();
   LifetimeWhereClauseItem item = {loc};
 
   StringResult<ast::Lifetime> lifetime = parseLifetimeAsLifetime();
   if (!lifetime) {
-    llvm::errs() << "failed to parse lifetime in where clause item: "
-                 << lifetime.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse lifetime in where clause item",
+                    lifetime.getError()};
+    return StringResult<std::shared_ptr<ast::WhereClauseItem>>(s);
   }
   item.setForLifetimes(lifetime.getValue());
 
   if (!check(TokenKind::Colon)) {
-    return Result<std::shared_ptr<ast::WhereClauseItem>, std::string>(
-        "failed to parse :token in lifetime where clause item");
+    return StringResult<std::shared_ptr<ast::WhereClauseItem>>(
+        adt::Error("failed to parse :token in lifetime where clause item",
+                   getLocation()));
   }
   assert(eat(TokenKind::Colon));
 
-  Result<ast::LifetimeBounds, std::string> bounds = parseLifetimeBounds();
+  StringResult<ast::LifetimeBounds> bounds = parseLifetimeBounds();
   if (!bounds) {
-    llvm::errs() << "failed to parse lifetime bounds in where clause item: "
-                 << bounds.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse lifetime bounds in where clause item",
+                    bounds.getError()};
+    return StringResult<std::shared_ptr<ast::WhereClauseItem>>(s);
   }
   item.setLifetimeBounds(bounds.getValue());
 
-  return Result<std::shared_ptr<ast::WhereClauseItem>, std::string>(
-      std::make_shared<LifetimeWhereClauseItem>(item));
+  return StringResult<std::shared_ptr<ast::WhereClauseItem>>(
+      context->create<LifetimeWhereClauseItem>(item));
 }
 
-Result<std::shared_ptr<ast::WhereClauseItem>, std::string>
+StringResult<std::shared_ptr<ast::WhereClauseItem>>
 Parser::parseTypeBoundWhereClauseItem() {
   Location loc = getLocation();
 
@@ -554,47 +516,43 @@ Parser::parseTypeBoundWhereClauseItem() {
   if (checkKeyWord(KeyWordKind::KW_FOR)) {
     StringResult<ast::types::ForLifetimes> forLifetime = parseForLifetimes();
     if (!forLifetime) {
-      llvm::errs()
-          << "failed to parse lifetime in type bound where clause item: "
-          << forLifetime.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse lifetime in type bound where clause "
+                      "item",
+                      forLifetime.getError()};
+      return StringResult<std::shared_ptr<ast::WhereClauseItem>>(s);
     }
     item.setForLifetimes(forLifetime.getValue());
   }
 
-  Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
-      parseType();
+  StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in TypeBoundWhereClauseItem: "
-                 << type.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in TypeBoundWhereClauseItem",
+                    type.getError()};
+    return StringResult<std::shared_ptr<ast::WhereClauseItem>>(s);
   }
   item.setType(type.getValue());
 
   if (!check(TokenKind::Colon))
-    return Result<std::shared_ptr<ast::WhereClauseItem>, std::string>(
-        "failed to parse : token in TypeBoundWhereClauseItem");
+    return StringResult<std::shared_ptr<ast::WhereClauseItem>>(
+        adt::Error("failed to parse : token in TypeBoundWhereClauseItem",
+                   getLocation()));
 
   assert(eat(TokenKind::Colon));
 
-  Result<ast::types::TypeParamBounds, std::string> bounds =
-      parseTypeParamBounds();
+  StringResult<ast::types::TypeParamBounds> bounds = parseTypeParamBounds();
   if (!bounds) {
-    llvm::errs()
-        << "failed to parse type param bounds in type bound where clause item: "
-        << bounds.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type param bounds in type bound where "
+                    "clause item",
+                    bounds.getError()};
+    return StringResult<std::shared_ptr<ast::WhereClauseItem>>(s);
   }
   item.setBounds(bounds.getValue());
 
-  return Result<std::shared_ptr<ast::WhereClauseItem>, std::string>(
-      std::make_shared<TypeBoundWhereClauseItem>(item));
+  return StringResult<std::shared_ptr<ast::WhereClauseItem>>(
+      context->create<TypeBoundWhereClauseItem>(item));
 }
 
-Result<std::shared_ptr<ast::WhereClauseItem>, std::string>
+StringResult<std::shared_ptr<ast::WhereClauseItem>>
 Parser::parseWhereClauseItem() {
   if (checkKeyWord(KeyWordKind::KW_FOR))
     return parseTypeBoundWhereClauseItem();
@@ -603,59 +561,61 @@ Parser::parseWhereClauseItem() {
   return parseTypeBoundWhereClauseItem();
 }
 
-Result<ast::WhereClause, std::string> Parser::parseWhereClause() {
+StringResult<ast::WhereClause> Parser::parseWhereClause() {
   Location loc = getLocation();
 
   WhereClause where{loc};
 
   if (!checkKeyWord(KeyWordKind::KW_WHERE)) {
-    return Result<ast::WhereClause, std::string>(
-        "failed to parse where keyword in where clause");
+    return StringResult<ast::WhereClause>(
+        adt::Error("failed to parse where keyword in where clause",
+                   getLocation()));
   }
 
   assert(eatKeyWord(KeyWordKind::KW_WHERE));
 
   while (true) {
     if (check(TokenKind::Eof)) {
-      return Result<ast::WhereClause, std::string>(
-          "failed to parse where clause: eof");
+      return StringResult<ast::WhereClause>(
+          adt::Error("failed to parse where clause: eof", getLocation()));
     } else if (check(TokenKind::BraceOpen)) {
-      return Result<ast::WhereClause, std::string>(where);
+      return StringResult<ast::WhereClause>(where);
     } else if (check(TokenKind::Semi)) {
-      return Result<ast::WhereClause, std::string>(where);
+      return StringResult<ast::WhereClause>(where);
     } else if (check(TokenKind::Comma) && check(TokenKind::BraceOpen, 1)) {
       assert(eat(TokenKind::Comma));
       where.setTrailingComma();
-      return Result<ast::WhereClause, std::string>(where);
+      return StringResult<ast::WhereClause>(where);
     } else if (check(TokenKind::Comma) && check(TokenKind::Semi, 1)) {
       assert(eat(TokenKind::Comma));
       where.setTrailingComma();
-      return Result<ast::WhereClause, std::string>(where);
+      return StringResult<ast::WhereClause>(where);
     } else if (check(TokenKind::Comma)) {
       assert(eat(TokenKind::Comma));
     } else {
-      Result<std::shared_ptr<ast::WhereClauseItem>, std::string> clauseItem =
+      StringResult<std::shared_ptr<ast::WhereClauseItem>> clauseItem =
           parseWhereClauseItem();
       if (!clauseItem) {
-        llvm::errs() << "failed to parse where clause item in where clause: "
-                     << clauseItem.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse where clause item in where clause",
+                        clauseItem.getError()};
+        return StringResult<ast::WhereClause>(s);
       }
       where.addWhereClauseItem(clauseItem.getValue());
     }
   }
-  return Result<ast::WhereClause, std::string>("failed to parse where clause");
+  return StringResult<ast::WhereClause>(
+      adt::Error("failed to parse where clause", getLocation()));
 }
 
-Result<ast::ConstParam, std::string> Parser::parseConstParam() {
+StringResult<ast::ConstParam> Parser::parseConstParam() {
   Location loc = getLocation();
 
   ConstParam param = {loc};
 
   if (!checkKeyWord(KeyWordKind::KW_CONST)) {
-    return Result<ast::ConstParam, std::string>(
-        "failed to parse const keyword in const param");
+    return StringResult<ast::ConstParam>(
+        adt::Error("failed to parse const keyword in const param",
+                   getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_CONST));
 
@@ -664,24 +624,22 @@ Result<ast::ConstParam, std::string> Parser::parseConstParam() {
     param.setIdentifier(tok.getIdentifier());
     assert(eat(TokenKind::Identifier));
   } else {
-    return Result<ast::ConstParam, std::string>(
-        "failed to parse identifier token in const param");
+    return StringResult<ast::ConstParam>(
+        adt::Error("failed to parse identifier token in const param",
+                   getLocation()));
   }
 
   if (!check(TokenKind::Colon)) {
-    return Result<ast::ConstParam, std::string>(
-        "failed to parse : token in const param");
+    return StringResult<ast::ConstParam>(
+        adt::Error("failed to parse : token in const param", getLocation()));
   }
 
   assert(eat(TokenKind::Colon));
 
-  Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
-      parseType();
+  StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in const param: " << type.getError()
-                 << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in const param", type.getError()};
+    return StringResult<ast::ConstParam>(s);
   }
   param.setType(type.getValue());
 
@@ -689,13 +647,12 @@ Result<ast::ConstParam, std::string> Parser::parseConstParam() {
     assert(eat(TokenKind::Eq));
 
     if (check(TokenKind::BraceOpen)) {
-      Result<std::shared_ptr<ast::Expression>, std::string> block =
+      StringResult<std::shared_ptr<ast::Expression>> block =
           parseBlockExpression({});
       if (!block) {
-        llvm::errs() << "failed to parse block expression in const param: "
-                     << block.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse block expression in const param",
+                        block.getError()};
+        return StringResult<ast::ConstParam>(s);
       }
       param.setBlock(block.getValue());
     } else if (check(TokenKind::Identifier)) {
@@ -704,29 +661,27 @@ Result<ast::ConstParam, std::string> Parser::parseConstParam() {
       assert(check(TokenKind::Identifier));
     } else if (check(TokenKind::Minus)) {
       assert(check(TokenKind::Minus));
-      Result<std::shared_ptr<ast::Expression>, std::string> literal =
+      StringResult<std::shared_ptr<ast::Expression>> literal =
           parseLiteralExpression({});
       if (!literal) {
-        llvm::errs() << "failed to parse literal expression in const param: "
-                     << literal.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse literal expression in const param",
+                        literal.getError()};
+        return StringResult<ast::ConstParam>(s);
       }
       param.setInitLiteral(literal.getValue());
     } else {
-      Result<std::shared_ptr<ast::Expression>, std::string> literal =
+      StringResult<std::shared_ptr<ast::Expression>> literal =
           parseLiteralExpression({});
       if (!literal) {
-        llvm::errs() << "failed to parse literal expression in const param: "
-                     << literal.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse literal expression in const param",
+                        literal.getError()};
+        return StringResult<ast::ConstParam>(s);
       }
       param.setInitLiteral(literal.getValue());
     }
   }
 
-  return Result<ast::ConstParam, std::string>(param);
+  return StringResult<ast::ConstParam>(param);
 }
 
 StringResult<ast::LifetimeBounds> Parser::parseLifetimeBounds() {
@@ -742,14 +697,13 @@ StringResult<ast::LifetimeBounds> Parser::parseLifetimeBounds() {
     if (check(TokenKind::Eof)) {
       // abort
       return StringResult<ast::LifetimeBounds>(
-          "failed to pars elifetime bounds");
+          adt::Error("failed to pars elifetime bounds", getLocation()));
     } else if (!checkLifetime()) {
       StringResult<ast::Lifetime> life = parseLifetimeAsLifetime();
       if (!life) {
-        llvm::errs() << "failed to parse lifetime in lifetime bounds: "
-                     << life.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse lifetime in lifetime bounds",
+                        life.getError()};
+        return StringResult<ast::LifetimeBounds>(s);
       }
       trailingPlus = false;
       bounds.setLifetime(life.getValue());
@@ -773,24 +727,22 @@ StringResult<ast::LifetimeParam> Parser::parseLifetimeParam() {
 
   StringResult<ast::Lifetime> lifeTime = parseLifetimeAsLifetime();
   if (!lifeTime) {
-    llvm::errs() << "failed to parse lifetime in lifetime param: "
-                 << lifeTime.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse lifetime in lifetime param",
+                    lifeTime.getError()};
+    return StringResult<ast::LifetimeParam>(s);
   }
   param.setLifetime(lifeTime.getValue());
 
   if (!check(TokenKind::Colon))
     return StringResult<ast::LifetimeParam>(
-        "failed to parse : token in lifetime param");
+        adt::Error("failed to parse : token in lifetime param", getLocation()));
   assert(eat(TokenKind::Colon));
 
   StringResult<ast::LifetimeBounds> bounds = parseLifetimeBounds();
   if (!bounds) {
-    llvm::errs() << "failed to parse lifetime bounds in lifetime param: "
-                 << bounds.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse lifetime bounds in lifetime param",
+                    bounds.getError()};
+    return StringResult<ast::LifetimeParam>(s);
   }
   param.setBounds(bounds.getValue());
 
@@ -807,7 +759,8 @@ StringResult<ast::TypeParam> Parser::parseTypeParam() {
 
   if (!check(TokenKind::Identifier))
     return StringResult<ast::TypeParam>(
-        "failed to parse identifier token in type param");
+        adt::Error("failed to parse identifier token in type param",
+                   getLocation()));
 
   Token tok = getToken();
   param.setIdentifier(tok.getIdentifier());
@@ -816,26 +769,22 @@ StringResult<ast::TypeParam> Parser::parseTypeParam() {
   if (check(TokenKind::Colon) && check(TokenKind::Eq, 1)) {
     assert(eat(TokenKind::Colon));
     assert(eat(TokenKind::Eq));
-    Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
+    StringResult<std::shared_ptr<ast::types::TypeExpression>> type =
         parseType();
     if (!type) {
-      llvm::errs() << "failed to parse type in type param: " << type.getError()
-                   << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type in type param", type.getError()};
+      return StringResult<ast::TypeParam>(s);
     }
     param.setType(type.getValue());
     return StringResult<ast::TypeParam>(param);
   } else if (check(TokenKind::Eq)) {
     // type
     assert(eat(TokenKind::Eq));
-    Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
+    StringResult<std::shared_ptr<ast::types::TypeExpression>> type =
         parseType();
     if (!type) {
-      llvm::errs() << "failed to parse type in type param: " << type.getError()
-                   << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type in type param", type.getError()};
+      return StringResult<ast::TypeParam>(s);
     }
     param.setType(type.getValue());
     return StringResult<ast::TypeParam>(param);
@@ -846,22 +795,18 @@ StringResult<ast::TypeParam> Parser::parseTypeParam() {
 
     StringResult<ast::types::TypeParamBounds> bounds = parseTypeParamBounds();
     if (!bounds) {
-      llvm::errs() << getToken().getLocation().toString()
-                   << "failed to parse type param bounds in type param: "
-                   << bounds.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type param bounds in type param",
+                      bounds.getError()};
+      return StringResult<ast::TypeParam>(s);
     }
     param.setBounds(bounds.getValue());
     if (check(TokenKind::Eq)) {
       assert(eat(TokenKind::Eq));
-      Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
+      StringResult<std::shared_ptr<ast::types::TypeExpression>> type =
           parseType();
       if (!type) {
-        llvm::errs() << "failed to parse type in type param: "
-                     << type.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse type in type param", type.getError()};
+        return StringResult<ast::TypeParam>(s);
       }
       param.setType(type.getValue());
       return StringResult<ast::TypeParam>(param);
@@ -883,10 +828,9 @@ StringResult<ast::GenericParam> Parser::parseGenericParam() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in generic param: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in generic param",
+                      outer.getError()};
+      return StringResult<ast::GenericParam>(s);
     }
     std::vector<OuterAttribute> out = outer.getValue();
     param.setOuterAttributes(out);
@@ -895,33 +839,31 @@ StringResult<ast::GenericParam> Parser::parseGenericParam() {
   if (checkKeyWord(KeyWordKind::KW_CONST)) {
     StringResult<ast::ConstParam> constParam = parseConstParam();
     if (!constParam) {
-      llvm::errs() << "failed to parse const param in generic param: "
-                   << constParam.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse const param in generic param",
+                      constParam.getError()};
+      return StringResult<ast::GenericParam>(s);
     }
     param.setConstParam(constParam.getValue());
   } else if (check(TokenKind::LIFETIME_OR_LABEL)) {
     StringResult<ast::LifetimeParam> lifetimeParam = parseLifetimeParam();
     if (!lifetimeParam) {
-      llvm::errs() << "failed to parse life time param in generic param: "
-                   << lifetimeParam.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse life time param in generic param",
+                      lifetimeParam.getError()};
+      return StringResult<ast::GenericParam>(s);
     }
     param.setLifetimeParam(lifetimeParam.getValue());
   } else if (check(TokenKind::Identifier)) {
     StringResult<ast::TypeParam> typeParam = parseTypeParam();
     if (!typeParam) {
-      llvm::errs() << "failed to parse type param in generic param: "
-                   << typeParam.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type param in generic param",
+                      typeParam.getError()};
+      return StringResult<ast::GenericParam>(s);
     }
     param.setTypeParam(typeParam.getValue());
   } else {
     // report
-    return StringResult<ast::GenericParam>("failed to parse generic param");
+    return StringResult<ast::GenericParam>(
+        adt::Error("failed to parse generic param", getLocation()));
   }
 
   return StringResult<ast::GenericParam>(param);
@@ -944,7 +886,8 @@ StringResult<ast::GenericParams> Parser::parseGenericParams() {
     while (true) {
       if (check(TokenKind::Eof)) {
         return StringResult<ast::GenericParams>(
-            "failed to parse generic params with eof");
+            adt::Error("failed to parse generic params with eof",
+                       getLocation()));
       } else if (check(TokenKind::Gt)) {
         assert(eat(TokenKind::Gt));
         return StringResult<ast::GenericParams>(params);
@@ -960,22 +903,22 @@ StringResult<ast::GenericParams> Parser::parseGenericParams() {
       } else {
         StringResult<ast::GenericParam> generic = parseGenericParam();
         if (!generic) {
-          llvm::errs() << "failed to parse generic param in generic params: "
-                       << generic.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse generic param in generic params",
+                          generic.getError()};
+          return StringResult<ast::GenericParams>(s);
         }
         params.addGenericParam(generic.getValue());
       }
     }
   } else {
-    return StringResult<ast::GenericParams>("failed to parse generic params");
+    return StringResult<ast::GenericParams>(
+        adt::Error("failed to parse generic params", getLocation()));
   }
 
   return StringResult<ast::GenericParams>(params);
 }
 
-Result<ast::Visibility, std::string> Parser::parseVisibility() {
+StringResult<ast::Visibility> Parser::parseVisibility() {
   Location loc = getLocation();
   Visibility vis = {loc};
 
@@ -988,14 +931,14 @@ Result<ast::Visibility, std::string> Parser::parseVisibility() {
     assert(eatKeyWord(KeyWordKind::KW_CRATE));
     assert(eat(TokenKind::ParenClose));
     vis.setKind(VisibilityKind::PublicCrate);
-    return Result<ast::Visibility, std::string>(vis);
+    return StringResult<ast::Visibility>(vis);
   } else if (checkKeyWord(KeyWordKind::KW_PUB) &&
              check(TokenKind::ParenOpen, 1) &&
              checkKeyWord(KeyWordKind::KW_SELFVALUE, 2) &&
              check(TokenKind::ParenClose, 3)) {
     // pub (self)
     vis.setKind(VisibilityKind::PublicSelf);
-    return Result<ast::Visibility, std::string>(vis);
+    return StringResult<ast::Visibility>(vis);
   } else if (checkKeyWord(KeyWordKind::KW_PUB) &&
              check(TokenKind::ParenOpen, 1) &&
              checkKeyWord(KeyWordKind::KW_SUPER, 2) &&
@@ -1006,7 +949,7 @@ Result<ast::Visibility, std::string> Parser::parseVisibility() {
     assert(eatKeyWord(KeyWordKind::KW_SUPER));
     assert(eat(TokenKind::ParenClose));
     vis.setKind(VisibilityKind::PublicSuper);
-    return Result<ast::Visibility, std::string>(vis);
+    return StringResult<ast::Visibility>(vis);
   } else if (checkKeyWord(KeyWordKind::KW_PUB) &&
              check(TokenKind::ParenOpen, 1) &&
              checkKeyWord(KeyWordKind::KW_IN, 2)) {
@@ -1016,10 +959,9 @@ Result<ast::Visibility, std::string> Parser::parseVisibility() {
     assert(eatKeyWord(KeyWordKind::KW_IN));
     StringResult<ast::SimplePath> simple = parseSimplePath();
     if (!simple) {
-      llvm::errs() << "failed to parse simple path in visibility: "
-                   << simple.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse simple path in visibility",
+                      simple.getError()};
+      return StringResult<ast::Visibility>(s);
     }
     vis.setPath(simple.getValue());
     if (!check(TokenKind::ParenClose))
@@ -1027,16 +969,16 @@ Result<ast::Visibility, std::string> Parser::parseVisibility() {
       assert(eat(TokenKind::ParenClose));
     // done
     vis.setKind(VisibilityKind::PublicIn);
-    return Result<ast::Visibility, std::string>(vis);
+    return StringResult<ast::Visibility>(vis);
   } else if (checkKeyWord(KeyWordKind::KW_PUB)) {
     // pub
     assert(eatKeyWord(KeyWordKind::KW_PUB));
     vis.setKind(VisibilityKind::Public);
-    return Result<ast::Visibility, std::string>(vis);
+    return StringResult<ast::Visibility>(vis);
   }
   // private
   vis.setKind(VisibilityKind::Private);
-  return Result<ast::Visibility, std::string>(vis);
+  return StringResult<ast::Visibility>(vis);
 }
 
 bool Parser::canTokenStartType(const Token &tok) {
@@ -54,7 +54,7 @@ StringResult<ast::SimplePathSegment> Parser::parseSimplePathSegment() {
   }
 
   return StringResult<ast::SimplePathSegment>(
-      "failed to parse simple path segment");
+      adt::Error("failed to parse simple path segment", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Expression>> Parser::parsePathExpression() {
@@ -72,11 +72,10 @@ Parser::parseQualifiedPathInExpression() {
 
   StringResult<ast::types::QualifiedPathType> path = parseQualifiedPathType();
   if (!path) {
-    llvm::errs() << "failed to parse qualified pyth type in parse qualified "
-                    "path in expression: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse qualified pyth type in parse qualified "
+                    "path in expression",
+                    path.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
   expr.setType(path.getValue());
@@ -86,30 +85,24 @@ Parser::parseQualifiedPathInExpression() {
       assert(eat(TokenKind::PathSep));
       StringResult<ast::PathExprSegment> segment = parsePathExprSegment();
       if (!segment) {
-        llvm::errs() << "failed to parse path expr segment  in parse qualified "
-                        "path in expression: "
-                     << segment.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse path expr segment  in parse qualified "
-                "path in expression: ",
-                segment.getError())
-                .str();
+        adt::Error s = {"failed to parse path expr segment  in parse qualified "
+                        "path in expression",
+                        segment.getError()};
         return StringResult<std::shared_ptr<ast::Expression>>(s);
       }
       expr.addSegment(segment.getValue());
     } else if (check(TokenKind::Eof)) {
       return StringResult<std::shared_ptr<ast::Expression>>(
-          "failed to parse qualified path in expression");
+          adt::Error("failed to parse qualified path in expression",
+                     getLocation()));
     } else {
       return StringResult<std::shared_ptr<ast::Expression>>(
-          std::make_shared<QualifiedPathInExpression>(expr));
+          context->create<QualifiedPathInExpression>(expr));
     }
   }
   return StringResult<std::shared_ptr<ast::Expression>>(
-      "failed to parse qualified path in expression");
+      adt::Error("failed to parse qualified path in expression",
+                 getLocation()));
 }
 
 StringResult<ast::PathExprSegment> Parser::parsePathExprSegment() {
@@ -122,17 +115,10 @@ StringResult<ast::PathExprSegment> Parser::parsePathExprSegment() {
 
   StringResult<ast::PathIdentSegment> first = parsePathIdentSegment();
   if (!first) {
-    llvm::errs()
-        << "failed to parse path ident segment in parse path expr segment: "
-        << first.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to parse path ident segment in parse path expr segment: ",
-            first.getError())
-            .str();
+    adt::Error s = {
+        "failed to parse path ident segment in parse path expr segment",
+        first.getError()};
     return StringResult<ast::PathExprSegment>(s);
   }
   seg.addIdentSegment(first.getValue());
@@ -141,11 +127,9 @@ StringResult<ast::PathExprSegment> Parser::parsePathExprSegment() {
     assert(eat(TokenKind::PathSep));
     StringResult<ast::GenericArgs> args = parseGenericArgs();
     if (!args) {
-      llvm::errs()
-          << "failed to parse generic args in parse path expr segment: "
-          << first.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic args in parse path expr segment",
+                      first.getError()};
+      return StringResult<ast::PathExprSegment>(s);
     }
     seg.addGenerics(args.getValue());
   }
@@ -164,37 +148,35 @@ StringResult<std::shared_ptr<ast::Expression>> Parser::parsePathInExpression() {
 
   StringResult<ast::PathExprSegment> first = parsePathExprSegment();
   if (!first) {
-    llvm::errs() << "failed to parse path expr segment in path in expression: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse path expr segment in path in expression",
+                    first.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   path.addSegment(first.getValue());
 
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<std::shared_ptr<ast::Expression>>(
-          std::make_shared<PathInExpression>(path));
+          context->create<PathInExpression>(path));
     } else if (check(TokenKind::PathSep)) {
       assert(eat(TokenKind::PathSep));
       StringResult<ast::PathExprSegment> next = parsePathExprSegment();
       if (!next) {
-        llvm::errs()
-            << "failed to parse path expr segment in path in expression: "
-            << next.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse path expr segment in path in "
+                        "expression",
+                        next.getError()};
+        return StringResult<std::shared_ptr<ast::Expression>>(s);
       }
       path.addSegment(next.getValue());
     } else {
       // done
       return StringResult<std::shared_ptr<ast::Expression>>(
-          std::make_shared<PathInExpression>(path));
+          context->create<PathInExpression>(path));
     }
   }
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      "failed to parse path in expression");
+      adt::Error("failed to parse path in expression", getLocation()));
 }
 
 StringResult<ast::PathIdentSegment> Parser::parsePathIdentSegment() {
@@ -232,7 +214,7 @@ StringResult<ast::PathIdentSegment> Parser::parsePathIdentSegment() {
     llvm::errs() << "failed to parse path ident segment: "
                  << Token2String(getToken().getKind()) << "\n";
     return StringResult<ast::PathIdentSegment>(
-        "failed to parse path ident segment");
+        adt::Error("failed to parse path ident segment", getLocation()));
   }
 
   return StringResult<ast::PathIdentSegment>(seg);
@@ -245,17 +227,16 @@ StringResult<ast::types::TypePathFn> Parser::parseTypePathFn() {
 
   if (!check(TokenKind::ParenOpen)) {
     return StringResult<ast::types::TypePathFn>(
-        "failed to parse ( token in type path fn");
+        adt::Error("failed to parse ( token in type path fn", getLocation()));
   }
   assert(eat(TokenKind::ParenOpen));
 
   if (!check(TokenKind::ParenClose)) {
     StringResult<ast::types::TypePathFnInputs> inputs = parseTypePathFnInputs();
     if (!inputs) {
-      llvm::errs() << "failed to parse type path fn inputs in type path fn: "
-                   << inputs.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type path fn inputs in type path fn",
+                      inputs.getError()};
+      return StringResult<ast::types::TypePathFn>(s);
     }
     fn.setTypePathFnInputs(inputs.getValue());
   }
@@ -266,10 +247,8 @@ StringResult<ast::types::TypePathFn> Parser::parseTypePathFn() {
     StringResult<std::shared_ptr<ast::types::TypeExpression>> type =
         parseType();
     if (!type) {
-      llvm::errs() << "failed to parse type in type path fn: "
-                   << type.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type in type path fn", type.getError()};
+      return StringResult<ast::types::TypePathFn>(s);
     }
     fn.setType(type.getValue());
   }
@@ -284,10 +263,9 @@ StringResult<ast::types::TypePathFnInputs> Parser::parseTypePathFnInputs() {
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> start = parseType();
   if (!start) {
-    llvm::errs() << "failed to parse type in type path fn inputs: "
-                 << start.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in type path fn inputs",
+                    start.getError()};
+    return StringResult<ast::types::TypePathFnInputs>(s);
   }
   inputs.addType(start.getValue());
 
@@ -306,10 +284,9 @@ StringResult<ast::types::TypePathFnInputs> Parser::parseTypePathFnInputs() {
       StringResult<std::shared_ptr<ast::types::TypeExpression>> typ =
           parseType();
       if (!typ) {
-        llvm::errs() << "failed to parse type in type path fn inputs: "
-                     << typ.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse type in type path fn inputs",
+                        typ.getError()};
+        return StringResult<ast::types::TypePathFnInputs>(s);
       }
       inputs.addType(typ.getValue());
       if (check(TokenKind::Eof)) {
@@ -336,17 +313,10 @@ StringResult<ast::types::TypePathSegment> Parser::parseTypePathSegment() {
 
   StringResult<ast::PathIdentSegment> ident = parsePathIdentSegment();
   if (!ident) {
-    llvm::errs()
-        << "failed to parse path ident segment in parse type path segment: "
-        << ident.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv(
-            "{0}\n{1}",
-            " failed to parse path ident segment in parse type path segment : ",
-            ident.getError())
-            .str();
+    adt::Error s = {
+        " failed to parse path ident segment in parse type path segment",
+        ident.getError()};
     return StringResult<ast::types::TypePathSegment>(s);
   }
   seg.setSegment(ident.getValue());
@@ -361,11 +331,9 @@ StringResult<ast::types::TypePathSegment> Parser::parseTypePathSegment() {
     // GenericArgs
     StringResult<ast::GenericArgs> args = parseGenericArgs();
     if (!args) {
-      llvm::errs()
-          << "failed to parse generic args in parse type path segment: "
-          << args.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic args in parse type path segment",
+                      args.getError()};
+      return StringResult<ast::types::TypePathSegment>(s);
     }
     seg.setGenericArgs(args.getValue());
     return StringResult<ast::types::TypePathSegment>(seg);
@@ -373,17 +341,9 @@ StringResult<ast::types::TypePathSegment> Parser::parseTypePathSegment() {
     // TypePathFn
     StringResult<ast::types::TypePathFn> fn = parseTypePathFn();
     if (!fn) {
-      llvm::errs()
-          << "failed to parse type path fn in parse type path segment: "
-          << fn.getError() << "\n";
-      printFunctionStack();
       // exit(EXIT_FAILURE);
-      std::string s =
-          llvm::formatv(
-              "{0}\n{1}",
-              "failed to parse type path fn in parse type path segment: ",
-              fn.getError())
-              .str();
+      adt::Error s = {"failed to parse type path fn in parse type path segment",
+                      fn.getError()};
       return StringResult<ast::types::TypePathSegment>(s);
     }
     seg.setTypePathFn(fn.getValue());
@@ -412,17 +372,10 @@ Parser::parseTypePath() {
 
   StringResult<ast::types::TypePathSegment> first = parseTypePathSegment();
   if (!first) {
-    llvm::errs()
-        << "failed to first parse type path segment in parse type path: "
-        << first.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to first parse type path segment in parse type path: ",
-            first.getError())
-            .str();
+    adt::Error s = {
+        "failed to first parse type path segment in parse type path",
+        first.getError()};
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   path.addSegment(first.getValue());
@@ -434,34 +387,28 @@ Parser::parseTypePath() {
     if (check(TokenKind::Eof)) {
       // error
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          "failed to parse type path (loop): eof");
+          adt::Error("failed to parse type path (loop): eof", getLocation()));
     } else if (check(TokenKind::PathSep)) {
       assert(eat(TokenKind::PathSep));
       StringResult<ast::types::TypePathSegment> next = parseTypePathSegment();
       if (!next) {
-        llvm::errs() << "failed to parse type path segment in parse type path: "
-                     << next.getError() << "\n";
-        printFunctionStack();
         // exit(EXIT_FAILURE);
-        std::string s =
-            llvm::formatv(
-                "{0} {1}",
-                "failed to parse next type path segment in parse type path: ",
-                next.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse next type path segment in parse type path",
+            next.getError()};
         return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
       }
       path.addSegment(next.getValue());
     } else {
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          std::make_shared<ast::types::TypePath>(path));
+          context->create<ast::types::TypePath>(path));
     }
   }
 
   // llvm::errs() << "parseTypePath: " << path.getSegments().size() << "\n";
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      std::make_shared<ast::types::TypePath>(path));
+      context->create<ast::types::TypePath>(path));
 }
 
 StringResult<ast::SimplePath> Parser::parseSimplePath() {
@@ -496,11 +443,8 @@ StringResult<ast::SimplePath> Parser::parseSimplePath() {
     assert(eatKeyWord(KeyWordKind::KW_CRATE));
   } else {
     // error: there are no empty paths
-    std::string s =
-        llvm::formatv("{0} {1}", "parseSimplePath; empty path: unknown token: ",
-                      Token2String(getToken().getKind()))
-            .str();
-    return StringResult<ast::SimplePath>(s);
+    return StringResult<ast::SimplePath>(adt::Error(
+        "parseSimplePath; empty path: unknown token", getLocation()));
   }
 
   path.addPathSegment(segment);
@@ -539,11 +483,8 @@ StringResult<ast::SimplePath> Parser::parseSimplePath() {
         assert(eat(TokenKind::Dollar));
         assert(eatKeyWord(KeyWordKind::KW_CRATE));
       } else {
-        std::string s =
-            llvm::formatv("{0} {1}", "parseSimplePath; unknown token: ",
-                          Token2String(getToken().getKind()))
-                .str();
-        return StringResult<ast::SimplePath>(s);
+        return StringResult<ast::SimplePath>(
+            adt::Error("parseSimplePath; unknown token", getLocation()));
       }
       path.addPathSegment(segment);
     } else {
@@ -559,20 +500,15 @@ StringResult<ast::types::QualifiedPathType> Parser::parseQualifiedPathType() {
 
   if (!check(TokenKind::Lt))
     return StringResult<ast::types::QualifiedPathType>(
-        "failed to parse < token in QualifiedPathType");
+        adt::Error("failed to parse < token in QualifiedPathType",
+                   getLocation()));
   assert(eat(TokenKind::Lt));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in parse qualified path type: "
-                 << type.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv("{0}\n{1}",
-                      "failed to parse type in parse qualified path type: ",
-                      type.getError())
-            .str();
+    adt::Error s = {"failed to parse type in parse qualified path type",
+                    type.getError()};
     return StringResult<ast::types::QualifiedPathType>(s);
   }
   qual.setType(type.getValue());
@@ -582,22 +518,16 @@ StringResult<ast::types::QualifiedPathType> Parser::parseQualifiedPathType() {
     StringResult<std::shared_ptr<ast::types::TypeExpression>> typePath =
         parseTypePath();
     if (!typePath) {
-      llvm::errs() << "failed to parse type path in parse qualified path type: "
-                   << typePath.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv(
-              "{0}\n{1}",
-              "failed to parse type path in parse qualified path type: ",
-              typePath.getError())
-              .str();
+      adt::Error s = {"failed to parse type path in parse qualified path type",
+                      typePath.getError()};
       return StringResult<ast::types::QualifiedPathType>(s);
     }
     qual.setPath(typePath.getValue());
 
     if (!check(TokenKind::Gt))
       return StringResult<ast::types::QualifiedPathType>(
-          "failed to parse > token in QualifiedPathType");
+          adt::Error("failed to parse > token in QualifiedPathType",
+                     getLocation()));
     assert(eat(TokenKind::Gt));
 
     return StringResult<ast::types::QualifiedPathType>(qual);
@@ -605,7 +535,8 @@ StringResult<ast::types::QualifiedPathType> Parser::parseQualifiedPathType() {
 
   if (!check(TokenKind::Gt))
     return StringResult<ast::types::QualifiedPathType>(
-        "failed to parse > token in QualifiedPathType");
+        adt::Error("failed to parse > token in QualifiedPathType",
+                   getLocation()));
   assert(eat(TokenKind::Gt));
 
   return StringResult<ast::types::QualifiedPathType>(qual);
@@ -618,17 +549,16 @@ Parser::parseQualifiedPathInType() {
 
   StringResult<ast::types::QualifiedPathType> seg = parseQualifiedPathType();
   if (!seg) {
-    llvm::errs()
-        << "failed to parse qualified path type in  qualified path in type: "
-        << seg.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse qualified path type in  qualified path "
+                    "in type",
+                    seg.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   qual.setSegment(seg.getValue());
 
   if (!check(TokenKind::PathSep)) {
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<QualifiedPathInType>(qual));
+        context->create<QualifiedPathInType>(qual));
   }
 
   while (true) {
@@ -636,23 +566,23 @@ Parser::parseQualifiedPathInType() {
       assert(eat(TokenKind::PathSep));
       StringResult<ast::types::TypePathSegment> seg = parseTypePathSegment();
       if (!seg) {
-        llvm::errs() << "failed to parse type path segment in parse qualified "
-                        "path type: "
-                     << seg.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse type path segment in parse qualified "
+                        "path type",
+                        seg.getError()};
+        return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
       }
       qual.append(seg.getValue());
     } else if (check(TokenKind::Eof)) {
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          "failed to parse qualified pth in type: eof");
+          adt::Error("failed to parse qualified pth in type: eof",
+                     getLocation()));
     } else {
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          std::make_shared<QualifiedPathInType>(qual));
+          context->create<QualifiedPathInType>(qual));
     }
   }
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      "failed to parse qualified pth in type");
+      adt::Error("failed to parse qualified pth in type", getLocation()));
 }
 
 } // namespace rust_compiler::parser
@@ -27,14 +27,14 @@ Parser::parseRestPattern() {
   if (check(TokenKind::DotDot)) {
     assert(eat(TokenKind::DotDot));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<RestPattern>(pattern));
+        context->create<RestPattern>(pattern));
   }
 
   llvm::errs() << "failed to parse rest pattern: unknown token "
                << Token2String(getToken().getKind()) << "\n";
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      "failed to parse rest pattern: unknown token");
+      adt::Error("failed to parse rest pattern: unknown token", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
@@ -56,7 +56,8 @@ Parser::parseIdentifierPattern() {
   if (!check(TokenKind::Identifier)) {
     // report errro
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse identifier in identifier pattern");
+        adt::Error("failed to parse identifier in identifier pattern",
+                   getLocation()));
   }
 
   Token tok = getToken();
@@ -69,19 +70,18 @@ Parser::parseIdentifierPattern() {
     StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
         patternNoTopAlt = parsePatternNoTopAlt();
     if (!patternNoTopAlt) {
-      llvm::errs()
-          << "failed to parse pattern to top alt in identifier pattern: "
-          << patternNoTopAlt.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse pattern to top alt in identifier "
+                      "pattern",
+                      patternNoTopAlt.getError()};
+      return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
     }
     pattern.addPattern(patternNoTopAlt.getValue());
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<IdentifierPattern>(pattern));
+        context->create<IdentifierPattern>(pattern));
   }
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      std::make_shared<IdentifierPattern>(pattern));
+      context->create<IdentifierPattern>(pattern));
 }
 
 StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
@@ -94,56 +94,56 @@ Parser::parseLiteralPattern() {
     pattern.setKind(LiteralPatternKind::True, getToken().getStorage());
     assert(eatKeyWord(KeyWordKind::KW_TRUE));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (checkKeyWord(KeyWordKind::KW_FALSE)) {
     pattern.setKind(LiteralPatternKind::False, getToken().getStorage());
     assert(eatKeyWord(KeyWordKind::KW_FALSE));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::CHAR_LITERAL)) {
     pattern.setKind(LiteralPatternKind::CharLiteral, getToken().getStorage());
     assert(eat(TokenKind::CHAR_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::BYTE_LITERAL)) {
     pattern.setKind(LiteralPatternKind::ByteLiteral, getToken().getStorage());
     assert(eat(TokenKind::BYTE_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::STRING_LITERAL)) {
     pattern.setKind(LiteralPatternKind::StringLiteral, getToken().getStorage());
     assert(eat(TokenKind::STRING_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::RAW_STRING_LITERAL)) {
     pattern.setKind(LiteralPatternKind::RawStringLiteral,
                     getToken().getStorage());
     assert(eat(TokenKind::RAW_STRING_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::BYTE_STRING_LITERAL)) {
     pattern.setKind(LiteralPatternKind::ByteStringLiteral,
                     getToken().getStorage());
     assert(eat(TokenKind::BYTE_STRING_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::RAW_BYTE_STRING_LITERAL)) {
     pattern.setKind(LiteralPatternKind::RawByteStringLiteral,
                     getToken().getStorage());
     assert(eat(TokenKind::RAW_BYTE_STRING_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::INTEGER_LITERAL)) {
     pattern.setKind(LiteralPatternKind::IntegerLiteral,
                     getToken().getStorage());
     assert(eat(TokenKind::INTEGER_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::FLOAT_LITERAL)) {
     pattern.setKind(LiteralPatternKind::FloatLiteral, getToken().getStorage());
     assert(eat(TokenKind::FLOAT_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::Minus) && check(TokenKind::INTEGER_LITERAL, 1)) {
     pattern.setKind(LiteralPatternKind::IntegerLiteral,
                     getToken().getStorage());
@@ -151,17 +151,17 @@ Parser::parseLiteralPattern() {
     assert(eat(TokenKind::Minus));
     assert(eat(TokenKind::INTEGER_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   } else if (check(TokenKind::Minus) && check(TokenKind::FLOAT_LITERAL, 1)) {
     pattern.setKind(LiteralPatternKind::FloatLiteral, getToken().getStorage());
     pattern.setLeadingMinus();
     assert(eat(TokenKind::Minus));
     assert(eat(TokenKind::FLOAT_LITERAL));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<LiteralPattern>(pattern));
+        context->create<LiteralPattern>(pattern));
   }
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      "failed to parse literal pattern");
+      adt::Error("failed to parse literal pattern", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::patterns::Pattern>> Parser::parsePattern() {
@@ -177,16 +177,10 @@ StringResult<std::shared_ptr<ast::patterns::Pattern>> Parser::parsePattern() {
   StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>> first =
       parsePatternNoTopAlt();
   if (!first) {
-    llvm::outs() << "failed to parse pattern to top alt in pattern: "
-                 << first.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to parse not top alt pattern in parse pattern: first",
-            first.getError())
-            .str();
+    adt::Error s = {
+        "failed to parse not top alt pattern in parse pattern: first",
+        first.getError()};
     return StringResult<std::shared_ptr<ast::patterns::Pattern>>(s);
   }
   pattern.addPattern(first.getValue());
@@ -198,15 +192,9 @@ StringResult<std::shared_ptr<ast::patterns::Pattern>> Parser::parsePattern() {
       StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
           patternNoTopAlt = parsePatternNoTopAlt();
       if (!patternNoTopAlt) {
-        llvm::outs() << "failed to parse pattern to top alt in pattern: "
-                     << patternNoTopAlt.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv(
-                "{0} {1}",
-                "failed to parse not top alt pattern in parse pattern: next",
-                patternNoTopAlt.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse not top alt pattern in parse pattern: next",
+            patternNoTopAlt.getError()};
         return StringResult<std::shared_ptr<ast::patterns::Pattern>>(s);
         // exit(EXIT_FAILURE);
       }
@@ -216,16 +204,16 @@ StringResult<std::shared_ptr<ast::patterns::Pattern>> Parser::parsePattern() {
         continue;
       } else if (check(TokenKind::Eof)) {
         return StringResult<std::shared_ptr<ast::patterns::Pattern>>(
-            "found eof in  pattern");
+            adt::Error("found eof in  pattern", getLocation()));
 
       } else {
         return StringResult<std::shared_ptr<ast::patterns::Pattern>>(
-            std::make_shared<Pattern>(pattern));
+            context->create<Pattern>(pattern));
       }
     }
   }
   return StringResult<std::shared_ptr<ast::patterns::Pattern>>(
-      std::make_shared<Pattern>(pattern));
+      context->create<Pattern>(pattern));
 }
 
 StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
@@ -240,7 +228,7 @@ Parser::parseTupleOrGroupedPattern() {
                  << "\n";
     // report error
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse (");
+        adt::Error("failed to parse (", getLocation()));
   }
   assert(eat(TokenKind::ParenOpen));
 
@@ -255,17 +243,16 @@ Parser::parseTupleOrGroupedPattern() {
     tuple.setItems(items);
 
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<TuplePattern>(tuple));
+        context->create<TuplePattern>(tuple));
   }
 
   StringResult<std::shared_ptr<ast::patterns::Pattern>> pattern =
       parsePattern();
   if (!pattern) {
-    llvm::errs() << "failed to parse pattern in tuple or group: "
-                 << pattern.getError() << "\n";
-    printFunctionStack();
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse pattern in tuple or group pattern: first pattern");
+        adt::Error(
+            "failed to parse pattern in tuple or group pattern: first pattern",
+            getLocation()));
     // exit(EXIT_FAILURE);
   }
   if (check(TokenKind::ParenClose)) {
@@ -274,7 +261,7 @@ Parser::parseTupleOrGroupedPattern() {
     GroupedPattern group = {loc};
     group.setPattern(pattern.getValue());
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<GroupedPattern>(group));
+        context->create<GroupedPattern>(group));
   } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
     assert(eat(TokenKind::Comma));
     assert(eat(TokenKind::ParenClose));
@@ -287,7 +274,7 @@ Parser::parseTupleOrGroupedPattern() {
     tuple.setItems(items);
 
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<TuplePattern>(tuple));
+        context->create<TuplePattern>(tuple));
   } else if (check(TokenKind::Comma) && !check(TokenKind::ParenClose, 1)) {
     // continue
     assert(eat(TokenKind::Comma));
@@ -297,7 +284,9 @@ Parser::parseTupleOrGroupedPattern() {
     llvm::outs() << "found unexpected token in tuple or grouped pattern"
                  << Token2String(getToken().getKind()) << "\n";
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse pattern in tuple or group pattern: unexpected token");
+        adt::Error(
+            "failed to parse pattern in tuple or group pattern: unexpected token",
+            getLocation()));
   }
 
   TuplePatternItems items = {loc};
@@ -308,15 +297,10 @@ Parser::parseTupleOrGroupedPattern() {
     StringResult<std::shared_ptr<ast::patterns::Pattern>> pattern =
         parsePattern();
     if (!pattern) {
-      llvm::errs() << "failed to parse pattern in turple or grouped pattern: "
-                   << pattern.getError() << "\n";
-      printFunctionStack();
-
-      std::string S = llvm::formatv("{0} {1}",
-                                    "failed to parse pattern in tuple or group "
-                                    "pattern, in while loop: ",
-                                    pattern.getError())
-                          .str();
+
+      adt::Error S = {"failed to parse pattern in tuple or group "
+                      "pattern, in while loop",
+                      pattern.getError()};
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(S);
       // exit(EXIT_FAILURE);
     }
@@ -328,7 +312,7 @@ Parser::parseTupleOrGroupedPattern() {
       TuplePattern pattern = {loc};
       pattern.setItems(items);
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-          std::make_shared<TuplePattern>(pattern));
+          context->create<TuplePattern>(pattern));
     } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
       assert(eat(TokenKind::Comma));
       assert(eat(TokenKind::ParenClose));
@@ -336,7 +320,7 @@ Parser::parseTupleOrGroupedPattern() {
       pattern.setItems(items);
       items.setTrailingComma();
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-          std::make_shared<TuplePattern>(pattern));
+          context->create<TuplePattern>(pattern));
     } else if (check(TokenKind::Comma)) {
       assert(eat(TokenKind::Comma));
       continue;
@@ -39,32 +39,30 @@ Parser::parseMacroInvocationPattern() {
 
   StringResult<ast::SimplePath> simplePath = parseSimplePath();
   if (!simplePath) {
-    llvm::errs() << "failed to parse simple path in macro invocation pattern: "
-                 << simplePath.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse simple path in macro invocation pattern",
+                    simplePath.getError()};
+    return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   pattern.setPath(simplePath.getValue());
 
   if (!check(TokenKind::Not)) {
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse macro invocation pattern");
+        adt::Error("failed to parse macro invocation pattern", getLocation()));
   }
   assert(eat(TokenKind::Not));
 
   StringResult<std::shared_ptr<ast::DelimTokenTree>> token =
       parseDelimTokenTree();
   if (!token) {
-    llvm::errs()
-        << "failed to parse delim token tree in macro invocation pattern: "
-        << token.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse delim token tree in macro invocation "
+                    "pattern",
+                    token.getError()};
+    return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   pattern.setTree(token.getValue());
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      std::make_shared<MacroInvocationPattern>(pattern));
+      context->create<MacroInvocationPattern>(pattern));
 }
 
 StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
@@ -79,14 +77,14 @@ Parser::parseWildCardPattern() {
   if (check(TokenKind::Underscore)) {
     assert(eat(TokenKind::Underscore));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<WildcardPattern>(pat));
+        context->create<WildcardPattern>(pat));
   }
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      "failed to parse wild card pattern");
+      adt::Error("failed to parse wild card pattern", getLocation()));
 }
 
-Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
 Parser::parseTupleOrTupleStructPattern() {
   llvm::errs() << "parseTupleOrTupleStructPattern"
                << "\n";
@@ -105,26 +103,27 @@ Parser::parseGroupedPattern() {
 
   if (!check(TokenKind::ParenOpen))
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse ( token in grouped pattern");
+        adt::Error("failed to parse ( token in grouped pattern",
+                   getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   StringResult<std::shared_ptr<ast::patterns::Pattern>> pattern =
       parsePattern();
   if (!pattern) {
-    llvm::errs() << "failed to parse pattern in grouped pattern: "
-                 << pattern.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse pattern in grouped pattern",
+                    pattern.getError()};
+    return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   grouped.setPattern(pattern.getValue());
 
   if (!check(TokenKind::ParenClose))
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse ) token in grouped pattern");
+        adt::Error("failed to parse ) token in grouped pattern",
+                   getLocation()));
   assert(eat(TokenKind::ParenClose));
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      std::make_shared<GroupedPattern>(grouped));
+      context->create<GroupedPattern>(grouped));
 }
 
 StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
@@ -132,15 +131,14 @@ Parser::parseMacroInvocationOrPathOrStructOrTupleStructPattern() {
 
   CheckPoint cp = getCheckPoint();
 
-  adt::Result<std::shared_ptr<ast::Expression>, std::string> path =
+  adt::StringResult<std::shared_ptr<ast::Expression>> path =
       parsePathExpression();
 
   if (!path) {
-    llvm::errs() << "failed to parse path in macro or path or struct or tuple "
-                    "struct pattern: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse path in macro or path or struct or tuple "
+                    "struct pattern",
+                    path.getError()};
+    return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
 
   if (check(TokenKind::Or)) {
@@ -166,7 +164,8 @@ Parser::parseGroupedOrTuplePattern() {
 
   if (!check(TokenKind::ParenOpen))
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse ( token in grouped or tuple pattern");
+        adt::Error("failed to parse ( token in grouped or tuple pattern",
+                   getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::DotDot)) {
@@ -177,11 +176,9 @@ Parser::parseGroupedOrTuplePattern() {
   StringResult<std::shared_ptr<ast::patterns::Pattern>> pattern =
       parsePattern();
   if (!pattern) {
-    llvm::errs() << "failed to parse pattern in grouped or tuple pattern: "
-                 << pattern.getError() << "\n";
-    printFunctionStack();
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse pattern in grouped or tuple pattern");
+        adt::Error("failed to parse pattern in grouped or tuple pattern",
+                   getLocation()));
     // exit(EXIT_FAILURE);
   }
 
@@ -233,11 +230,10 @@ Parser::parsePathOrStructOrTupleStructPattern() {
   StringResult<std::shared_ptr<ast::Expression>> pathIn =
       parsePathInExpression();
   if (!pathIn) {
-    llvm::errs() << "failed to parse path in expression in "
-                    "parsePathOrStructOrTupleStructPattern: "
-                 << pathIn.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse path in expression in "
+                    "parsePathOrStructOrTupleStructPattern",
+                    pathIn.getError()};
+    return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   if (check(TokenKind::ParenOpen)) {
     recover(cp);
@@ -249,7 +245,7 @@ Parser::parsePathOrStructOrTupleStructPattern() {
     PathPattern pat = {loc};
     pat.setPath(pathIn.getValue());
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<PathPattern>(pat));
+        context->create<PathPattern>(pat));
   }
 }
 
@@ -265,17 +261,15 @@ Parser::parsePathPattern() {
   StringResult<std::shared_ptr<ast::Expression>> pathExpr =
       parsePathExpression();
   if (!pathExpr) {
-    llvm::errs() << "failed to parse path  expression in "
-                    "parse path pattern: "
-                 << pathExpr.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse path  expression in parse path pattern",
+                    pathExpr.getError()};
+    return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
 
   path.setPath(pathExpr.getValue());
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      std::make_shared<PathPattern>(path));
+      context->create<PathPattern>(path));
 }
 
 StringResult<ast::patterns::TupleStructItems> Parser::parseTupleStructItems() {
@@ -289,16 +283,10 @@ StringResult<ast::patterns::TupleStructItems> Parser::parseTupleStructItems() {
   StringResult<std::shared_ptr<ast::patterns::Pattern>> pattern =
       parsePattern();
   if (!pattern) {
-    llvm::errs() << "failed to parse  pattern in "
-                    "parse tuple struct item1s: "
-                 << pattern.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s = llvm::formatv("{0} {1}",
-                                  "failed to parse  pattern in "
-                                  "parse tuple struct item1s: ",
-                                  pattern.getError())
-                        .str();
+    adt::Error s = {"failed to parse  pattern in "
+                    "parse tuple struct item1s",
+                    pattern.getError()};
     return StringResult<ast::patterns::TupleStructItems>(s);
   }
   items.addPattern(pattern.getValue());
@@ -306,7 +294,8 @@ StringResult<ast::patterns::TupleStructItems> Parser::parseTupleStructItems() {
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<ast::patterns::TupleStructItems>(
-          "failed to parse tuple struct items field: eof");
+          adt::Error("failed to parse tuple struct items field: eof",
+                     getLocation()));
     } else if (check(TokenKind::ParenClose)) {
       return StringResult<ast::patterns::TupleStructItems>(items);
     } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose)) {
@@ -318,20 +307,19 @@ StringResult<ast::patterns::TupleStructItems> Parser::parseTupleStructItems() {
       StringResult<std::shared_ptr<ast::patterns::Pattern>> pattern =
           parsePattern();
       if (!pattern) {
-        llvm::errs() << "failed to parse  pattern in "
-                        "parse tuple struct ite2ms: "
-                     << pattern.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse  pattern in parse tuple struct ite2ms",
+                        pattern.getError()};
+        return StringResult<ast::patterns::TupleStructItems>(s);
       }
       items.addPattern(pattern.getValue());
     } else {
       return StringResult<ast::patterns::TupleStructItems>(
-          "failed to parse tuple struct items field");
+          adt::Error("failed to parse tuple struct items field",
+                     getLocation()));
     }
   }
   return StringResult<ast::patterns::TupleStructItems>(
-      "failed to parse tuple struct items field");
+      adt::Error("failed to parse tuple struct items field", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
@@ -345,16 +333,10 @@ Parser::parseTupleStructPattern() {
 
   StringResult<std::shared_ptr<ast::Expression>> path = parsePathInExpression();
   if (!path) {
-    llvm::errs() << "failed to parse path in expression in "
-                    "parse tuple struct pattern: "
-                 << path.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s = llvm::formatv("{0} {1}",
-                                  "failed to parse path in expression in "
-                                  "parse tuple struct pattern: ",
-                                  path.getError())
-                        .str();
+    adt::Error s = {"failed to parse path in expression in "
+                    "parse tuple struct pattern",
+                    path.getError()};
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   pat.setPath(path.getValue());
@@ -362,39 +344,35 @@ Parser::parseTupleStructPattern() {
   if (!check(TokenKind::ParenOpen)) {
     llvm::errs() << Token2String(getToken().getKind()) << "\n";
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse ( token in tuple struct pattern");
+        adt::Error("failed to parse ( token in tuple struct pattern",
+                   getLocation()));
   }
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
     assert(eat(TokenKind::ParenClose));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<TupleStructPattern>(pat));
+        context->create<TupleStructPattern>(pat));
   }
 
   StringResult<ast::patterns::TupleStructItems> items = parseTupleStructItems();
   if (!items) {
-    llvm::errs() << "failed to parse tuple struct items in "
-                    "parse tuple struct pattern: "
-                 << items.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s = llvm::formatv("{0} {1}",
-                                  "failed to parse tuple struct items in "
-                                  "parse tuple struct pattern: ",
-                                  items.getError())
-                        .str();
+    adt::Error s = {"failed to parse tuple struct items in "
+                    "parse tuple struct pattern",
+                    items.getError()};
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   pat.setItems(items.getValue());
 
   if (!check(TokenKind::ParenClose))
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse ) token tuple struct pattern");
+        adt::Error("failed to parse ) token tuple struct pattern",
+                   getLocation()));
   assert(eat(TokenKind::ParenClose));
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      std::make_shared<TupleStructPattern>(pat));
+      context->create<TupleStructPattern>(pat));
 }
 
 // llvm::Expected<ast::patterns::StructPatternElements>
@@ -436,7 +414,7 @@ StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
 Parser::parseReferencePattern() {
   if (!check(lexer::TokenKind::And) && !check(lexer::TokenKind::AndAnd)) {
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse reference pattern");
+        adt::Error("failed to parse reference pattern", getLocation()));
   }
 
 //  llvm::errs() << "parseRefencePattern"
@@ -462,22 +440,16 @@ Parser::parseReferencePattern() {
   StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>> woRange =
       parsePatternWithoutRange();
   if (!woRange) {
-    llvm::errs() << "failed to parse pattern without range in "
-                    "parse reference pattern: "
-                 << woRange.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s = llvm::formatv("{0} {1}",
-                                  "failed to parse pattern without range in "
-                                  "parse reference pattern: ",
-                                  woRange.getError())
-                        .str();
+    adt::Error s = {"failed to parse pattern without range in "
+                    "parse reference pattern",
+                    woRange.getError()};
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   refer.setPattern(woRange.getValue());
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      std::make_shared<ReferencePattern>(refer));
+      context->create<ReferencePattern>(refer));
 }
 
 StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
@@ -534,9 +506,11 @@ Parser::parseRangeOrIdentifierOrStructOrTupleStructOrMacroInvocationPattern() {
     if (check(TokenKind::Eof)) {
       // abort
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-          "failed to parse "
-          "RangeOrIdentifierOrStructOrTupleStructOrMacroIn"
-          "vocationPattern: eof");
+          adt::Error(
+              "failed to parse "
+              "RangeOrIdentifierOrStructOrTupleStructOrMacroIn"
+              "vocationPattern: eof",
+              getLocation()));
     } else if (check(TokenKind::PathSep)) {
       assert(eat(TokenKind::PathSep));
     } else if (checkPathIdentSegment()) {
@@ -619,15 +593,10 @@ Parser::parseRangeOrIdentifierOrStructOrTupleStructOrMacroInvocationPattern() {
       return parsePathOrStructOrTupleStructPattern();
     } else {
       // error
-      std::string s =
-          llvm::formatv(
-              "{0} {1}",
-              "failed to parse RangeOrIdentifierOrStructOrTupleStructOrMa"
-              "croInvocationPattern with unknown token",
-              Token2String(getToken().getKind()))
-              .str();
-      llvm::errs() << Token2String(getToken().getKind()) << "\n";
-      return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
+      return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
+          adt::Error("failed to parse RangeOrIdentifierOrStructOrTupleStruct"
+                     "OrMacroInvocationPattern with unknown token",
+                     getLocation()));
     }
   }
 }
@@ -720,7 +689,7 @@ Parser::parsePatternNoTopAlt() {
 //  if (check(lexer::TokenKind::Underscore))
 //    return parseWildCardPattern(); // maybe range literal
 
-adt::Result<std::shared_ptr<ast::patterns::PatternNoTopAlt>, std::string>
+adt::StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
 Parser::parseIdentifierOrPathPattern() {
   if (checkIdentifier() && (getToken(1).getKind() == TokenKind::PathSep))
     return parsePathPattern();
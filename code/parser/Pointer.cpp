@@ -23,7 +23,8 @@ Parser::parseRawPointerType() {
 
   if (!check(TokenKind::Star))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse * token in raw pointer type");
+        adt::Error("failed to parse * token in raw pointer type",
+                   getLocation()));
   assert(eat(TokenKind::Star));
 
   if (checkKeyWord(KeyWordKind::KW_MUT)) {
@@ -34,23 +35,22 @@ Parser::parseRawPointerType() {
     rawPointer.setConst();
   } else {
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-
-        "failed to parse mut or const keyword in raw pointer type");
+        adt::Error("failed to parse mut or const keyword in raw pointer type",
+                   getLocation()));
   }
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> noBounds =
       parseTypeNoBounds();
   if (!noBounds) {
-    llvm::errs() << "failed to parse type no bounds in raw pointer type: "
-                 << noBounds.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type no bounds in raw pointer type",
+                    noBounds.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
 
   rawPointer.setType(noBounds.getValue());
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      std::make_shared<RawPointerType>(rawPointer));
+      context->create<RawPointerType>(rawPointer));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>>
@@ -63,7 +63,7 @@ Parser::parseReferenceType() {
 
   if (!check(TokenKind::And))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse & token in reference type");
+        adt::Error("failed to parse & token in reference type", getLocation()));
   assert(eat(TokenKind::And));
 
   // FIXME Lifetime
@@ -71,16 +71,10 @@ Parser::parseReferenceType() {
   if (check(TokenKind::LIFETIME_OR_LABEL) or
       checkKeyWord(KeyWordKind::KW_STATICLIFETIME) or
       (check(TokenKind::LIFETIME_TOKEN) && getToken().getStorage() == "'_")) {
-    adt::Result<ast::Lifetime, std::string> lifetime =
-        parseLifetimeAsLifetime();
+    adt::StringResult<ast::Lifetime> lifetime = parseLifetimeAsLifetime();
     if (!lifetime) {
-      llvm::errs() << "failed to parse lifetime in reference tpye: "
-                   << lifetime.getError() << "\n";
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "failed to parse lifetime in reference type: ",
-                        lifetime.getError())
-              .str();
+      adt::Error s = {"failed to parse lifetime in reference type",
+                      lifetime.getError()};
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
     }
     refType.setLifetime(lifetime.getValue());
@@ -94,22 +88,16 @@ Parser::parseReferenceType() {
   StringResult<std::shared_ptr<ast::types::TypeExpression>> noBounds =
       parseTypeNoBounds();
   if (!noBounds) {
-    llvm::errs() << "failed to parse type no bounds in reference type: "
-                 << noBounds.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv("{0} {1}",
-                      "failed to parse type no bounds in reference type: ",
-                      noBounds.getError())
-            .str();
+    adt::Error s = {"failed to parse type no bounds in reference type",
+                    noBounds.getError()};
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
 
   refType.setType(noBounds.getValue());
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      std::make_shared<ReferenceType>(refType));
+      context->create<ReferenceType>(refType));
 }
 
 } // namespace rust_compiler::parser
@@ -2,77 +2,154 @@
 
 #include "Lexer/KeyWords.h"
 #include "Lexer/Token.h"
+#include "Parser/Parser.h"
 
-#include <cstdlib>
-#include <llvm/Support/raw_ostream.h>
+#include <array>
+#include <cstddef>
 
 using namespace rust_compiler::lexer;
+using namespace rust_compiler::ast;
+using namespace rust_compiler::adt;
 
 namespace rust_compiler::parser {
 
-Precedence Parser::getLeftBindingPower() {
-  switch (getToken().getKind()) {
-  case TokenKind::PathSep:
-    return Precedence::Path;
-  case TokenKind::Plus:
-    return Precedence::Plus;
-  case TokenKind::Minus:
-    return Precedence::Minus;
-  case TokenKind::Lt:
-    return Precedence::LessThan;
-  case TokenKind::Shr:
-    return Precedence::RShift;
-  case TokenKind::Eq:
-    return Precedence::Equal;
-  case TokenKind::DotDot:
-    return Precedence::DotDot;
-  case TokenKind::DotDotEq:
-    return Precedence::DotDotEq;
-  case TokenKind::ParenOpen:
-    return Precedence::FunctionCall;
-  case TokenKind::PlusEq:
-    return Precedence::PlusAssign;
-  case TokenKind::EqEq:
-    return Precedence::Equal;
-  case TokenKind::Star:
-    return Precedence::Mul;
-  case TokenKind::SquareOpen:
-    return Precedence::ArrayIndexing;
-  case TokenKind::Gt:
-    return Precedence::GreaterThan;
-  case TokenKind::QMark:
-    return Precedence::QuestionMark;
-  case TokenKind::Semi: // no power for your
-    return Precedence::Lowest;
-  case TokenKind::SquareClose: // no power for your
-    return Precedence::Lowest;
-  case TokenKind::ParenClose: // no power for your
-    return Precedence::Lowest;
-  case TokenKind::Dot: {
-    if (getToken(1).isIdentifier() &&
-        getToken(2).getKind() == TokenKind::ParenOpen)
-      return Precedence::FieldExpression;
-    return Precedence::MethodCall;
-  }
-  case TokenKind::Keyword: {
-    switch (getToken().getKeyWordKind()) {
-    case KeyWordKind::KW_AS: {
-      return Precedence::As;
-    }
-    default: {
-      llvm::errs() << KeyWord2String(getToken().getKeyWordKind()) << "\n";
-      assert(false);
-    }
-    }
-    break;
-  }
-  default: {
-    llvm::errs() << "getLeftBindingPower: unknown token: "
-                 << Token2String(getToken().getKind()) << "\n";
-    return Precedence::Lowest;
-    exit(EXIT_FAILURE);
-  }
-  }
+namespace {
+
+constexpr size_t NumTokenKinds = static_cast<size_t>(TokenKind::Tilde) + 1;
+
+} // namespace
+
+/// https://doc.rust-lang.org/reference/expressions.html#expression-precedence
+const Parser::InfixOperator *Parser::getInfixOperator() {
+  static constexpr std::array<InfixOperator, NumTokenKinds> operators = [] {
+    std::array<InfixOperator, NumTokenKinds> ops = {};
+
+    // left-associative: the right operand binds as tight as the operator
+    auto binary = [&](TokenKind kind, Precedence power,
+                      InfixParselet parselet) {
+      ops[static_cast<size_t>(kind)] = {power, power, false, parselet};
+    };
+    // right-associative: the right operand takes any other assignment
+    auto assign = [&](TokenKind kind, InfixParselet parselet) {
+      ops[static_cast<size_t>(kind)] = {Precedence::Assign, Precedence::Lowest,
+                                        false, parselet};
+    };
+    auto postfix = [&](TokenKind kind, Precedence power,
+                       InfixParselet parselet) {
+      ops[static_cast<size_t>(kind)] = {power, Precedence::Lowest, true,
+                                        parselet};
+    };
+
+    InfixParselet arith = [](Parser &p, std::shared_ptr<Expression> left,
+                             Precedence power, std::span<OuterAttribute>,
+                             Restrictions restrictions) {
+      return p.parseArithmeticOrLogicalExpression(left, power, restrictions);
+    };
+    binary(TokenKind::Star, Precedence::Mul, arith);
+    binary(TokenKind::Slash, Precedence::Div, arith);
+    binary(TokenKind::Percent, Precedence::Rem, arith);
+    binary(TokenKind::Plus, Precedence::Plus, arith);
+    binary(TokenKind::Minus, Precedence::Minus, arith);
+    binary(TokenKind::Shl, Precedence::LShift, arith);
+    binary(TokenKind::Shr, Precedence::RShift, arith);
+    binary(TokenKind::And, Precedence::BitAnd, arith);
+    binary(TokenKind::Caret, Precedence::BitXor, arith);
+    binary(TokenKind::Or, Precedence::BitOr, arith);
+
+    InfixParselet comparison =
+        [](Parser &p, std::shared_ptr<Expression> left, Precedence power,
+           std::span<OuterAttribute>, Restrictions restrictions) {
+          return p.parseComparisonExpression(left, power, restrictions);
+        };
+    binary(TokenKind::EqEq, Precedence::Equal, comparison);
+    binary(TokenKind::Ne, Precedence::NotEqual, comparison);
+    binary(TokenKind::Lt, Precedence::LessThan, comparison);
+    binary(TokenKind::Gt, Precedence::GreaterThan, comparison);
+    binary(TokenKind::Le, Precedence::LessThanOrEqualTo, comparison);
+    binary(TokenKind::Ge, Precedence::GreaterThanOrEqualTo, comparison);
+
+    InfixParselet lazy = [](Parser &p, std::shared_ptr<Expression> left,
+                            Precedence power, std::span<OuterAttribute>,
+                            Restrictions restrictions) {
+      return p.parseLazyBooleanExpression(left, power, restrictions);
+    };
+    binary(TokenKind::AndAnd, Precedence::LazyAnd, lazy);
+    binary(TokenKind::OrOr, Precedence::LazyOr, lazy);
+
+    InfixParselet range = [](Parser &p, std::shared_ptr<Expression> left,
+                             Precedence power,
+                             std::span<OuterAttribute> outer,
+                             Restrictions restrictions) {
+      return p.parseRangeExpression(left, power, outer, restrictions);
+    };
+    binary(TokenKind::DotDot, Precedence::DotDot, range);
+    binary(TokenKind::DotDotEq, Precedence::DotDotEq, range);
+
+    assign(TokenKind::Eq,
+           [](Parser &p, std::shared_ptr<Expression> left, Precedence power,
+              std::span<OuterAttribute> outer, Restrictions restrictions) {
+             return p.parseAssignmentExpression(left, power, outer,
+                                                restrictions);
+           });
+    InfixParselet compound =
+        [](Parser &p, std::shared_ptr<Expression> left, Precedence power,
+           std::span<OuterAttribute>, Restrictions restrictions) {
+          return p.parseCompoundAssignmentExpression(left, power,
+                                                     restrictions);
+        };
+    for (TokenKind kind :
+         {TokenKind::PlusEq, TokenKind::MinusEq, TokenKind::StarEq,
+          TokenKind::SlashEq, TokenKind::PercentEq, TokenKind::CaretEq,
+          TokenKind::AndEq, TokenKind::OrEq, TokenKind::ShlEq,
+          TokenKind::ShrEq})
+      assign(kind, compound);
+
+    postfix(TokenKind::QMark, Precedence::QuestionMark,
+            [](Parser &p, std::shared_ptr<Expression> left, Precedence,
+               std::span<OuterAttribute>, Restrictions) {
+              return p.parseErrorPropagationExpression(left);
+            });
+    postfix(TokenKind::ParenOpen, Precedence::FunctionCall,
+            [](Parser &p, std::shared_ptr<Expression> left, Precedence,
+               std::span<OuterAttribute> outer, Restrictions restrictions) {
+              return p.parseCallExpression(left, outer, restrictions);
+            });
+    postfix(TokenKind::SquareOpen, Precedence::ArrayIndexing,
+            [](Parser &p, std::shared_ptr<Expression> left, Precedence,
+               std::span<OuterAttribute> outer, Restrictions restrictions) {
+              return p.parseIndexExpression(left, outer, restrictions);
+            });
+    // the only keyword: `as`, see below
+    postfix(TokenKind::Keyword, Precedence::As,
+            [](Parser &p, std::shared_ptr<Expression> left, Precedence,
+               std::span<OuterAttribute>, Restrictions) {
+              return p.parseTypeCastExpression(left);
+            });
+    // field expression, method call, tuple indexing, or await
+    postfix(TokenKind::Dot, Precedence::MethodCall,
+            [](Parser &p, std::shared_ptr<Expression> left, Precedence,
+               std::span<OuterAttribute> outer, Restrictions restrictions) {
+              if (p.checkKeyWord(KeyWordKind::KW_AWAIT, 1))
+                return p.parseAwaitExpression(left, outer);
+              if (p.check(TokenKind::INTEGER_LITERAL, 1))
+                return p.parseTupleIndexingExpression(left, outer,
+                                                      restrictions);
+              if (p.check(TokenKind::Identifier, 1) &&
+                  !p.check(TokenKind::ParenOpen, 2) &&
+                  !p.check(TokenKind::PathSep, 2))
+                return p.parseFieldExpression(left, outer, restrictions);
+              return p.parseMethodCallExpression(left, outer, restrictions);
+            });
+
+    return ops;
+  }();
+
+  const Token &tok = getToken();
+  if (tok.getKind() == TokenKind::Keyword &&
+      tok.getKeyWordKind() != KeyWordKind::KW_AS)
+    return nullptr;
+  const InfixOperator &op = operators[static_cast<size_t>(tok.getKind())];
+  return op.parselet ? &op : nullptr;
 }
 
 } // namespace rust_compiler::parser
@@ -0,0 +1,106 @@
+#include "Parser/Profile.h"
+
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/TimeProfiler.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace rust_compiler::parser {
+
+namespace {
+
+/// Parser::parseFoo of a __PRETTY_FUNCTION__
+llvm::StringRef getRuleName(llvm::StringRef functionName) {
+  llvm::StringRef name = functionName.split('(').first;
+  size_t scope = name.rfind("::");
+  if (scope == llvm::StringRef::npos)
+    return name;
+  return name.drop_front(scope + 2);
+}
+
+uint64_t toNanoseconds(ParserProfile::Clock::duration d) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+}
+
+} // namespace
+
+void ParserProfile::enter(Frame &frame, const char *functionName) {
+  RuleStats &rule = rules[functionName];
+  if (rule.invocations++ == 0)
+    rule.name = getRuleName(functionName);
+  ++rule.active;
+  if (llvm::timeTraceProfilerEnabled())
+    llvm::timeTraceProfilerBegin(rule.name, "");
+
+  frame.rule = &rule;
+  frame.outer = current;
+  frame.nested = Clock::duration::zero();
+  current = &frame;
+  frame.start = Clock::now();
+}
+
+void ParserProfile::exit(Frame &frame) {
+  Clock::duration elapsed = Clock::now() - frame.start;
+  if (--frame.rule->active == 0)
+    frame.rule->inclusive += elapsed;
+  frame.rule->self += elapsed - frame.nested;
+  if (frame.outer)
+    frame.outer->nested += elapsed;
+  current = frame.outer;
+
+  if (llvm::timeTraceProfilerEnabled())
+    llvm::timeTraceProfilerEnd();
+}
+
+void ParserProfile::recordBacktrack(const std::source_location &site) {
+  BacktrackSite &entry = sites[{site.file_name(), site.line()}];
+  ++entry.count;
+  if (current) {
+    ++current->rule->backtracks;
+    entry.rule = current->rule->name;
+  }
+}
+
+void ParserProfile::printJSON(llvm::raw_ostream &os) const {
+  std::vector<const RuleStats *> byTime;
+  for (const auto &[functionName, rule] : rules)
+    byTime.push_back(&rule);
+  std::sort(byTime.begin(), byTime.end(),
+            [](const RuleStats *a, const RuleStats *b) {
+              return a->self > b->self;
+            });
+
+  std::vector<std::pair<std::pair<const char *, unsigned>, BacktrackSite>>
+      byCount(sites.begin(), sites.end());
+  std::sort(byCount.begin(), byCount.end(), [](const auto &a, const auto &b) {
+    return a.second.count > b.second.count;
+  });
+
+  llvm::json::OStream json(os, /*IndentSize=*/2);
+  json.object([&] {
+    json.attributeArray("rules", [&] {
+      for (const RuleStats *rule : byTime)
+        json.object([&] {
+          json.attribute("name", rule->name);
+          json.attribute("invocations", int64_t(rule->invocations));
+          json.attribute("backtracks", int64_t(rule->backtracks));
+          json.attribute("selfNs", int64_t(toNanoseconds(rule->self)));
+          json.attribute("inclusiveNs",
+                         int64_t(toNanoseconds(rule->inclusive)));
+        });
+    });
+    json.attributeArray("backtracks", [&] {
+      for (const auto &[location, site] : byCount)
+        json.object([&] {
+          json.attribute("file", location.first);
+          json.attribute("line", int64_t(location.second));
+          json.attribute("rule", site.rule);
+          json.attribute("count", int64_t(site.count));
+        });
+    });
+  });
+  os << "\n";
+}
+
+} // namespace rust_compiler::parser
@@ -25,22 +25,21 @@ Parser::parseRangeExpression(std::span<OuterAttribute> outer) {
       // done
       range.setKind(RangeExpressionKind::RangeFullExpr);
       return StringResult<std::shared_ptr<ast::Expression>>(
-          std::make_shared<RangeExpression>(range));
+          context->create<RangeExpression>(range));
     } else {
       // parse
       Restrictions restrictions;
       StringResult<std::shared_ptr<ast::Expression>> right =
           parseExpression(Precedence::DotDot, {}, restrictions);
       if (!right) {
-        llvm::errs() << "failed to parse epxression in range expression: "
-                     << right.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse epxression in range expression",
+                        right.getError()};
+        return StringResult<std::shared_ptr<ast::Expression>>(s);
       }
       range.setRight(right.getValue());
       range.setKind(RangeExpressionKind::RangeToExpr);
       return StringResult<std::shared_ptr<ast::Expression>>(
-          std::make_shared<RangeExpression>(range));
+          context->create<RangeExpression>(range));
     }
   } else if (check(TokenKind::DotDotEq)) {
     assert(eat(TokenKind::DotDotEq));
@@ -49,15 +48,14 @@ Parser::parseRangeExpression(std::span<OuterAttribute> outer) {
     StringResult<std::shared_ptr<ast::Expression>> right =
         parseExpression(Precedence::DotDotEq, {}, restrictions);
     if (!right) {
-      llvm::errs() << "failed to parse expression in range expression: "
-                   << right.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse expression in range expression",
+                      right.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     range.setRight(right.getValue());
     range.setKind(RangeExpressionKind::RangeToInclusiveExpr);
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<RangeExpression>(range));
+        context->create<RangeExpression>(range));
   }
 
   //  Restrictions restrictions;
@@ -66,7 +64,6 @@ Parser::parseRangeExpression(std::span<OuterAttribute> outer) {
   //  if (!left) {
   //    llvm::errs() << "failed to parse expression in range expression: "
   //                 << left.getError() << "\n";
-  //    printFunctionStack();
   //    exit(EXIT_FAILURE);
   //  }
   //
@@ -77,11 +74,12 @@ Parser::parseRangeExpression(std::span<OuterAttribute> outer) {
   llvm::errs() << "failed to parse range expression"
                << "\n";
   return StringResult<std::shared_ptr<ast::Expression>>(
-      "failed to parse range expression");
+      adt::Error("failed to parse range expression", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Expression>>
 Parser::parseRangeExpression(std::shared_ptr<ast::Expression> l,
+                             Precedence rightBindingPower,
                              std::span<OuterAttribute> outer,
                              Restrictions restrictions) {
   ParserErrorStack raai = {this, __PRETTY_FUNCTION__};
@@ -98,51 +96,39 @@ Parser::parseRangeExpression(std::shared_ptr<ast::Expression> l,
     if (checkRangeTerminator()) {
       range.setKind(RangeExpressionKind::RangeFromExpr);
       return StringResult<std::shared_ptr<ast::Expression>>(
-          std::make_shared<RangeExpression>(range));
+          context->create<RangeExpression>(range));
     } else {
       Restrictions restrictions;
       StringResult<std::shared_ptr<ast::Expression>> left =
-          parseExpression({}, restrictions);
+          parseExpression(rightBindingPower, {}, restrictions);
       if (!left) {
-        llvm::errs() << "failed to parse expression in range expression: "
-                     << left.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv("{0}\n{1}",
-                          "failed to parse expression in range expression: ",
-                          left.getError())
-                .str();
+        adt::Error s = {"failed to parse expression in range expression",
+                        left.getError()};
         return StringResult<std::shared_ptr<ast::Expression>>(s);
       }
       range.setRight(left.getValue());
     }
     range.setKind(RangeExpressionKind::RangeExpr);
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<RangeExpression>(range));
+        context->create<RangeExpression>(range));
   } else if (check(TokenKind::DotDotEq)) {
     assert(eat(TokenKind::DotDotEq));
     range.setKind(RangeExpressionKind::RangeInclusiveExpr);
     Restrictions restrictions;
-    Result<std::shared_ptr<ast::Expression>, std::string> left =
-        parseExpression({}, restrictions);
+    StringResult<std::shared_ptr<ast::Expression>> left =
+        parseExpression(rightBindingPower, {}, restrictions);
     if (!left) {
-      llvm::errs() << "failed to parse expression in range expression: "
-                   << left.getError() << "\n";
-      printFunctionStack();
       // exit(EXIT_FAILURE);
-      std::string s =
-          llvm::formatv("{0}\n{1}",
-                        "failed to parse expression in range expression: ",
-                        left.getError())
-              .str();
+      adt::Error s = {"failed to parse expression in range expression",
+                      left.getError()};
       return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     range.setRight(left.getValue());
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<RangeExpression>(range));
+        context->create<RangeExpression>(range));
   }
   return StringResult<std::shared_ptr<ast::Expression>>(
-      "failed to range expression");
+      adt::Error("failed to range expression", getLocation()));
 }
 
 } // namespace rust_compiler::parser
@@ -47,17 +47,10 @@ StringResult<RangePatternBound> Parser::parseRangePatternBound() {
     assert(eat(getToken().getKind()));
   } else {
     // PathExpression
-    Result<std::shared_ptr<ast::Expression>, std::string> path =
-        parsePathExpression();
+    StringResult<std::shared_ptr<ast::Expression>> path = parsePathExpression();
     if (!path) {
-      llvm::errs() << "failed to parse path expression in range pattern bound"
-                   << path.getError() << "\n";
-      std::string s =
-          llvm::formatv(
-              "{0}\n{1}",
-              "failed to parse path expression in range pattern bound",
-              path.getError())
-              .str();
+      adt::Error s = {"failed to parse path expression in range pattern bound",
+                      path.getError()};
       return StringResult<RangePatternBound>(s);
     }
     bound.setKind(RangePatternBoundKind::PathExpression);
@@ -77,34 +70,22 @@ Parser::parseRangePattern() {
     StringResult<RangePatternBound> upper = parseRangePatternBound();
     if (!upper) {
       // report error
-      llvm::errs()
-          << "failed to parse upper range pattern bound in range pattern: "
-          << upper.getError() << "\n";
-      std::string s =
-          llvm::formatv(
-              "{0}\n{1}",
-              "failed to parse upper range pattern bound in range pattern: ",
-              upper.getError())
-              .str();
+      adt::Error s = {
+          "failed to parse upper range pattern bound in range pattern",
+          upper.getError()};
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
     }
     pattern.setUpper(upper.getValue());
     pattern.setKind(RangePatternKind::RangeToInclusivePattern);
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<RangePattern>(pattern));
+        context->create<RangePattern>(pattern));
   } else { // start with lower bound
     StringResult<RangePatternBound> lower = parseRangePatternBound();
     if (!lower) {
       // report error
-      llvm::errs()
-          << "failed to parse lower range pattern bound in range pattern: "
-          << lower.getError() << "\n";
-      std::string s =
-          llvm::formatv(
-              "{0}\n{1}",
-              "failed to parse lower range pattern bound in range pattern: ",
-              lower.getError())
-              .str();
+      adt::Error s = {
+          "failed to parse lower range pattern bound in range pattern",
+          lower.getError()};
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
     }
     pattern.setLower(lower.getValue());
@@ -114,54 +95,42 @@ Parser::parseRangePattern() {
       StringResult<RangePatternBound> upper = parseRangePatternBound();
       if (!upper) {
         // report error
-        llvm::errs()
-            << "failed to parse upper range pattern bound in range pattern: "
-            << upper.getError() << "\n";
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse upper range pattern bound in range pattern: ",
-                upper.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse upper range pattern bound in range pattern",
+            upper.getError()};
         return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
       }
       pattern.setKind(RangePatternKind::RangeInclusivePattern);
       pattern.setUpper(upper.getValue());
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-          std::make_shared<RangePattern>(pattern));
+          context->create<RangePattern>(pattern));
     } else if (check(TokenKind::DotDot)) {
       assert(eat(TokenKind::DotDot));
       // done
       pattern.setKind(RangePatternKind::RangeFromPattern);
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-          std::make_shared<RangePattern>(pattern));
+          context->create<RangePattern>(pattern));
     } else if (check(TokenKind::DotDotDot)) {
       assert(eat(TokenKind::DotDotDot));
       StringResult<RangePatternBound> upper = parseRangePatternBound();
       if (!upper) {
         // report error
-        llvm::errs()
-            << "failed to parse upper range pattern bound in range pattern: "
-            << upper.getError() << "\n";
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse upper range pattern bound in range pattern: ",
-                upper.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse upper range pattern bound in range pattern",
+            upper.getError()};
         return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
         // report error
       }
       pattern.setUpper(upper.getValue());
       pattern.setKind(RangePatternKind::ObsoleteRangePattern);
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-          std::make_shared<RangePattern>(pattern));
+          context->create<RangePattern>(pattern));
     } else {
       // report error
       llvm::errs() << "failed to parse range pattern: "
                    << Token2String(getToken().getKind()) << "\n";
       return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-          "failed to parse range pattern");
+          adt::Error("failed to parse range pattern", getLocation()));
     }
   }
 
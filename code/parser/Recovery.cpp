@@ -0,0 +1,228 @@
+#include "AST/ErrorItem.h"
+#include "AST/ErrorStatement.h"
+#include "Lexer/KeyWords.h"
+#include "Lexer/Token.h"
+#include "Parser/Parser.h"
+
+using namespace rust_compiler::ast;
+using namespace rust_compiler::adt;
+using namespace rust_compiler::lexer;
+
+namespace rust_compiler::parser {
+
+namespace {
+
+/// the keywords that start an item: its visibility, its qualifiers, and
+/// the keyword of its kind
+bool isItemKeyWord(KeyWordKind kind) {
+  switch (kind) {
+  case KeyWordKind::KW_PUB:
+  case KeyWordKind::KW_CONST:
+  case KeyWordKind::KW_ASYNC:
+  case KeyWordKind::KW_UNSAFE:
+  case KeyWordKind::KW_EXTERN:
+  case KeyWordKind::KW_UNION:
+  case KeyWordKind::KW_FN:
+  case KeyWordKind::KW_STRUCT:
+  case KeyWordKind::KW_ENUM:
+  case KeyWordKind::KW_TRAIT:
+  case KeyWordKind::KW_IMPL:
+  case KeyWordKind::KW_MOD:
+  case KeyWordKind::KW_USE:
+  case KeyWordKind::KW_STATIC:
+  case KeyWordKind::KW_TYPE:
+    return true;
+  default:
+    return false;
+  }
+}
+
+} // namespace
+
+StringResult<std::shared_ptr<ast::Item>> Parser::parseItemOrRecover() {
+  if (!recoverFromErrors)
+    return parseItem();
+
+  Location loc = getLocation();
+  CheckPoint cp = getCheckPoint();
+
+  StringResult<std::shared_ptr<ast::Item>> item = parseItem();
+  if (item)
+    return item;
+
+  // skip the item from its start, where the nesting is known
+  recover(cp);
+  // an unmatched } ends no item: the crate loop would stop at it forever
+  if (!skipItem() && !check(TokenKind::Eof)) {
+    [[maybe_unused]] bool eaten = eat(getToken().getKind());
+    assert(eaten);
+  }
+  errors.push_back(item.getError());
+  printFunctionStack();
+  return StringResult<std::shared_ptr<ast::Item>>(
+      context->create<ErrorItem>(loc));
+}
+
+StringResult<ExpressionOrStatement> Parser::parseStatementOrRecover() {
+  if (!recoverFromErrors)
+    return parseStatementOrExpressionWithoutBlock();
+
+  Location loc = getLocation();
+  CheckPoint cp = getCheckPoint();
+
+  StringResult<ExpressionOrStatement> stmt =
+      parseStatementOrExpressionWithoutBlock();
+  if (stmt)
+    return stmt;
+
+  recover(cp);
+  skipStatement();
+  // the block is unterminated: the enclosing item reports it
+  if (check(TokenKind::Eof))
+    return stmt;
+  errors.push_back(stmt.getError());
+  printFunctionStack();
+  std::shared_ptr<ast::Statement> error = context->create<ErrorStatement>(loc);
+  return StringResult<ExpressionOrStatement>(ExpressionOrStatement(error));
+}
+
+// Braces are matched apart from parentheses and brackets: an unbalanced
+// parenthesis is the more common error, and it must not hide the end of a
+// block or the next item. Balanced token trees are skipped in one step
+// with the matching-delimiter table; the counters cover the unbalanced
+// ones and the Parsers that pull from a Lexer.
+
+bool Parser::skipItem() {
+  size_t braces = 0;
+  size_t parens = 0;
+  bool seenItemKeyWord = false;
+  // in a run of item keywords, e.g., pub(crate) unsafe extern "C" fn
+  bool inItemKeyWords = false;
+  bool skipped = false;
+  while (true) {
+    TokenKind kind = getToken().getKind();
+    // the path of pub(..) and the ABI of extern ".." continue the run
+    inItemKeyWords = inItemKeyWords && (kind == TokenKind::ParenOpen ||
+                                        kind == TokenKind::STRING_LITERAL ||
+                                        kind == TokenKind::Keyword);
+    switch (kind) {
+    case TokenKind::Eof:
+      return skipped;
+    case TokenKind::BraceOpen:
+      if (skipTokenTree()) {
+        if (braces == 0)
+          return true;
+        continue;
+      }
+      ++braces;
+      break;
+    case TokenKind::BraceClose:
+      if (braces == 0)
+        return skipped;
+      if (--braces == 0) {
+        [[maybe_unused]] bool eaten = eat(TokenKind::BraceClose);
+        assert(eaten);
+        return true;
+      }
+      break;
+    case TokenKind::ParenOpen:
+    case TokenKind::SquareOpen:
+      if (skipTokenTree())
+        continue;
+      ++parens;
+      break;
+    case TokenKind::ParenClose:
+    case TokenKind::SquareClose:
+      if (parens > 0) {
+        --parens;
+      } else if (braces == 0) {
+        // an unmatched ) or ] at the top ends the item; the keyword after
+        // it starts the next one
+        [[maybe_unused]] bool eaten = eat(kind);
+        assert(eaten);
+        return true;
+      }
+      break;
+    case TokenKind::Semi:
+      if (braces == 0 && parens == 0) {
+        [[maybe_unused]] bool eaten = eat(TokenKind::Semi);
+        assert(eaten);
+        return true;
+      }
+      break;
+    case TokenKind::Keyword:
+      if (braces == 0 && isItemKeyWord(getToken().getKeyWordKind())) {
+        // the next item starts
+        if (seenItemKeyWord && !inItemKeyWords)
+          return skipped;
+        seenItemKeyWord = true;
+        inItemKeyWords = true;
+      } else {
+        inItemKeyWords = false;
+      }
+      break;
+    default:
+      break;
+    }
+    [[maybe_unused]] bool eaten = eat(kind);
+    assert(eaten);
+    skipped = true;
+  }
+}
+
+void Parser::skipStatement() {
+  size_t braces = 0;
+  size_t parens = 0;
+  while (true) {
+    TokenKind kind = getToken().getKind();
+    switch (kind) {
+    case TokenKind::Eof:
+      return;
+    case TokenKind::BraceOpen:
+      if (skipTokenTree()) {
+        // a block ends the statement, unless it continues with ; or else
+        if (braces == 0 && parens == 0 && !check(TokenKind::Semi) &&
+            !checkKeyWord(KeyWordKind::KW_ELSE))
+          return;
+        continue;
+      }
+      ++braces;
+      break;
+    case TokenKind::BraceClose:
+      if (braces == 0)
+        return;
+      // a block ends the statement, unless it continues with ; or else
+      if (--braces == 0 && parens == 0 && !check(TokenKind::Semi, 1) &&
+          !checkKeyWord(KeyWordKind::KW_ELSE, 1)) {
+        [[maybe_unused]] bool eaten = eat(TokenKind::BraceClose);
+        assert(eaten);
+        return;
+      }
+      break;
+    case TokenKind::ParenOpen:
+    case TokenKind::SquareOpen:
+      if (skipTokenTree())
+        continue;
+      ++parens;
+      break;
+    case TokenKind::ParenClose:
+    case TokenKind::SquareClose:
+      if (parens > 0)
+        --parens;
+      break;
+    case TokenKind::Semi:
+      if (braces == 0 && parens == 0) {
+        [[maybe_unused]] bool eaten = eat(TokenKind::Semi);
+        assert(eaten);
+        return;
+      }
+      break;
+    default:
+      break;
+    }
+    [[maybe_unused]] bool eaten = eat(kind);
+    assert(eaten);
+  }
+}
+
+} // namespace rust_compiler::parser
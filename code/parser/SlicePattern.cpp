@@ -23,14 +23,8 @@ Parser::parseSlicePatternItems() {
 
   StringResult<std::shared_ptr<ast::patterns::Pattern>> first = parsePattern();
   if (!first) {
-    llvm::errs() << "failed to parse first pattern in slice pattern items: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0}\n{1}",
-                      "failed to parse first pattern in slice pattern items: ",
-                      first.getError())
-            .str();
+    adt::Error s = {"failed to parse first pattern in slice pattern items",
+                    first.getError()};
     return StringResult<ast::patterns::SlicePatternItems>(s);
   }
   items.addPattern(first.getValue());
@@ -43,7 +37,8 @@ Parser::parseSlicePatternItems() {
     if (check(TokenKind::Eof)) {
       // report error
       return StringResult<ast::patterns::SlicePatternItems>(
-          "failed to parse slice pattern items: eof");
+          adt::Error("failed to parse slice pattern items: eof",
+                     getLocation()));
     } else if (check(TokenKind::SquareClose)) {
       // done
       return StringResult<ast::patterns::SlicePatternItems>(items);
@@ -55,15 +50,8 @@ Parser::parseSlicePatternItems() {
       StringResult<std::shared_ptr<ast::patterns::Pattern>> first =
           parsePattern();
       if (!first) {
-        llvm::errs() << "failed to parse next pattern in slice pattern items: "
-                     << first.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv(
-                "{0}\n{1}",
-                "failed to parse next pattern in slice pattern items: ",
-                first.getError())
-                .str();
+        adt::Error s = {"failed to parse next pattern in slice pattern items",
+                        first.getError()};
         return StringResult<ast::patterns::SlicePatternItems>(s);
       }
       items.addPattern(first.getValue());
@@ -86,7 +74,7 @@ Parser::parseSlicePattern() {
 
   if (!check(TokenKind::SquareOpen)) {
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse [ token in slice pattern");
+        adt::Error("failed to parse [ token in slice pattern", getLocation()));
   }
   assert(eat(TokenKind::SquareOpen));
 
@@ -94,20 +82,14 @@ Parser::parseSlicePattern() {
     // done
     assert(eat(TokenKind::SquareClose));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<SlicePattern>(slice));
+        context->create<SlicePattern>(slice));
   }
 
   StringResult<ast::patterns::SlicePatternItems> items =
       parseSlicePatternItems();
   if (!items) {
-    llvm::errs() << "failed to parse slice pattern items in slice pattern: "
-                 << items.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0}\n{1}",
-                      "failed to parse slice pattern items in slice pattern: ",
-                      items.getError())
-            .str();
+    adt::Error s = {"failed to parse slice pattern items in slice pattern",
+                    items.getError()};
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   slice.setPatternItems(items.getValue());
@@ -115,12 +97,13 @@ Parser::parseSlicePattern() {
   if (!check(TokenKind::SquareClose)) {
     // report error
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse ] token in parse slice pattern");
+        adt::Error("failed to parse ] token in parse slice pattern",
+                   getLocation()));
   }
   assert(eat(TokenKind::SquareClose));
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      std::make_shared<SlicePattern>(slice));
+      context->create<SlicePattern>(slice));
 }
 
 } // namespace rust_compiler::parser
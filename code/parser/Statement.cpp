@@ -33,10 +33,8 @@ Parser::parseExpressionStatement(std::span<ast::OuterAttribute> outer,
     StringResult<std::shared_ptr<ast::Expression>> with =
         parseExpressionWithBlock(outer);
     if (!with) {
-      llvm::errs() << "failed to expression with block: " << with.getError()
-                   << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to expression with block", with.getError()};
+      return StringResult<std::shared_ptr<ast::Statement>>(s);
     }
     exr.setExprWoBlock(with.getValue());
 
@@ -46,32 +44,29 @@ Parser::parseExpressionStatement(std::span<ast::OuterAttribute> outer,
     }
 
     return StringResult<std::shared_ptr<ast::Statement>>(
-        std::make_shared<ExpressionStatement>(exr));
+        context->create<ExpressionStatement>(exr));
   } else if (checkExpressionWithoutBlock()) {
     llvm::outs() << "parseExpressionStatement: wo"
                  << "\n";
     StringResult<std::shared_ptr<ast::Expression>> wo =
         parseExpressionWithoutBlock(outer, restrictions);
     if (!wo) {
-      llvm::errs() << "failed to expression without block: " << wo.getError()
-                   << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to expression without block", wo.getError()};
+      return StringResult<std::shared_ptr<ast::Statement>>(s);
     }
     exr.setExprWithBlock(wo.getValue());
 
     if (!check(TokenKind::Semi)) {
-      llvm::errs() << "failed to parse ; token in expression statement: "
-                   << "\n";
-      exit(EXIT_FAILURE);
+      return StringResult<std::shared_ptr<ast::Statement>>(adt::Error(
+          "failed to parse ; token in expression statement", getLocation()));
     }
     assert(eat(TokenKind::Semi));
 
     return StringResult<std::shared_ptr<ast::Statement>>(
-        std::make_shared<ExpressionStatement>(exr));
+        context->create<ExpressionStatement>(exr));
   }
   return StringResult<std::shared_ptr<ast::Statement>>(
-      "failed to parse expression statement");
+      adt::Error("failed to parse expression statement", getLocation()));
 }
 
 bool Parser::checkStatement() {
@@ -82,10 +77,7 @@ bool Parser::checkStatement() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attribute in check statement: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      return false;
     }
   }
 
@@ -127,25 +119,24 @@ Parser::parseMacroInvocationSemiStatement() {
 
   StringResult<ast::SimplePath> path = parseSimplePath();
   if (!path) {
-    llvm::errs() << "failed to simple path in macro invocation statement: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to simple path in macro invocation statement",
+                    path.getError()};
+    return StringResult<std::shared_ptr<ast::Statement>>(s);
   }
   stmt.setPath(path.getValue());
 
   if (!check(TokenKind::Not)) {
-    llvm::errs()
-        << "failed to parse ! token in macro invocation semi statement: "
-        << "\n";
-    exit(EXIT_FAILURE);
+    return StringResult<std::shared_ptr<ast::Statement>>(adt::Error(
+        "failed to parse ! token in macro invocation semi statement",
+        getLocation()));
   }
   assert(eat(TokenKind::Not));
 
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<std::shared_ptr<ast::Statement>>(
-          "failed to parse macro invocation semi statement: eof");
+          adt::Error("failed to parse macro invocation semi statement: eof",
+                     getLocation()));
     } else if (check(TokenKind::ParenOpen)) {
       stmt.setKind(MacroInvocationSemiStatementKind::Paren);
       assert(eat(TokenKind::ParenOpen));
@@ -158,41 +149,44 @@ Parser::parseMacroInvocationSemiStatement() {
     } else if (check(TokenKind::ParenClose) && check(TokenKind::Semi, 1)) {
       if (stmt.getKind() != MacroInvocationSemiStatementKind::Paren)
         return StringResult<std::shared_ptr<ast::Statement>>(
-            "failed to parse macro invocation semi statement");
+            adt::Error("failed to parse macro invocation semi statement",
+                       getLocation()));
       assert(eat(TokenKind::ParenClose));
       assert(eat(TokenKind::Semi));
       return StringResult<std::shared_ptr<ast::Statement>>(
-          std::make_shared<MacroInvocationSemiStatement>(stmt));
+          context->create<MacroInvocationSemiStatement>(stmt));
     } else if (check(TokenKind::SquareClose) && check(TokenKind::Semi, 1)) {
       if (stmt.getKind() != MacroInvocationSemiStatementKind::Square)
         return StringResult<std::shared_ptr<ast::Statement>>(
-            "failed to parse macro invocation semi statement");
+            adt::Error("failed to parse macro invocation semi statement",
+                       getLocation()));
       assert(eat(TokenKind::SquareClose));
       assert(eat(TokenKind::Semi));
       return StringResult<std::shared_ptr<ast::Statement>>(
-          std::make_shared<MacroInvocationSemiStatement>(stmt));
+          context->create<MacroInvocationSemiStatement>(stmt));
     } else if (check(TokenKind::BraceClose)) {
       if (stmt.getKind() != MacroInvocationSemiStatementKind::Brace)
         return StringResult<std::shared_ptr<ast::Statement>>(
-            "failed to parse macro invocation semi statement");
+            adt::Error("failed to parse macro invocation semi statement",
+                       getLocation()));
       assert(eat(TokenKind::BraceClose));
       return StringResult<std::shared_ptr<ast::Statement>>(
-          std::make_shared<MacroInvocationSemiStatement>(stmt));
+          context->create<MacroInvocationSemiStatement>(stmt));
     } else {
       StringResult<ast::TokenTree> tree = parseTokenTree();
       if (!tree) {
-        llvm::errs()
-            << "failed to parse token tree in macro invocation statement: "
-            << tree.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse token tree in macro invocation "
+                        "statement",
+                        tree.getError()};
+        return StringResult<std::shared_ptr<ast::Statement>>(s);
       }
       stmt.addTree(tree.getValue());
     }
   }
 
   return StringResult<std::shared_ptr<ast::Statement>>(
-      "failed to parse macro invocation semi statement");
+      adt::Error("failed to parse macro invocation semi statement",
+                 getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Statement>>
@@ -206,11 +200,9 @@ Parser::parseLetStatement(std::span<ast::OuterAttribute> outer,
   let.setOuterAttributes(outer);
 
   if (!checkKeyWord(KeyWordKind::KW_LET)) {
-    llvm::errs() << "failed to let token: "
-                 << "\n";
-    std::string s = llvm::formatv("{0}", "failed to parse let token").str();
     // exit(EXIT_FAILURE);
-    return StringResult<std::shared_ptr<ast::Statement>>(s);
+    return StringResult<std::shared_ptr<ast::Statement>>(
+        adt::Error("failed to parse let token", getLocation()));
   }
 
   assert(eatKeyWord(KeyWordKind::KW_LET));
@@ -218,10 +210,9 @@ Parser::parseLetStatement(std::span<ast::OuterAttribute> outer,
   StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>> pattern =
       parsePatternNoTopAlt();
   if (!pattern) {
-    llvm::errs() << "failed to parse pattern in parse let statement: "
-                 << pattern.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse pattern in parse let statement",
+                    pattern.getError()};
+    return StringResult<std::shared_ptr<ast::Statement>>(s);
   }
   let.setPattern(pattern.getValue());
 
@@ -230,14 +221,8 @@ Parser::parseLetStatement(std::span<ast::OuterAttribute> outer,
     StringResult<std::shared_ptr<ast::types::TypeExpression>> type =
         parseType();
     if (!type) {
-      llvm::errs() << "failed to parse type in let statement: "
-                   << type.getError() << "\n";
-      printFunctionStack();
       // exit(EXIT_FAILURE);
-      std::string s =
-          llvm::formatv("{0} {1}", "failed to parse type in let statement: ",
-                        type.getError())
-              .str();
+      adt::Error s = {"failed to parse type in let statement", type.getError()};
       return StringResult<std::shared_ptr<ast::Statement>>(s);
     }
     let.setType(type.getValue());
@@ -248,14 +233,8 @@ Parser::parseLetStatement(std::span<ast::OuterAttribute> outer,
     StringResult<std::shared_ptr<ast::Expression>> expr =
         parseExpression({}, restrictions);
     if (!expr) {
-      llvm::errs() << "failed to parse expression in let statement: "
-                   << expr.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv(
-              "{0} {1}",
-              "failed to parse expression in let statement: ", expr.getError())
-              .str();
+      adt::Error s = {"failed to parse expression in let statement",
+                      expr.getError()};
       return StringResult<std::shared_ptr<ast::Statement>>(s);
       // exit(EXIT_FAILURE);
     }
@@ -267,14 +246,8 @@ Parser::parseLetStatement(std::span<ast::OuterAttribute> outer,
     StringResult<std::shared_ptr<ast::Expression>> block =
         parseBlockExpression({});
     if (!block) {
-      llvm::errs() << "failed to parse block expression in let statement: "
-                   << block.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "failed to parse block expression in let statement: ",
-                        block.getError())
-              .str();
+      adt::Error s = {"failed to parse block expression in let statement",
+                      block.getError()};
       return StringResult<std::shared_ptr<ast::Statement>>(s);
       // exit(EXIT_FAILURE);
     }
@@ -289,14 +262,14 @@ Parser::parseLetStatement(std::span<ast::OuterAttribute> outer,
       llvm::errs() << KeyWord2String(getToken().getKeyWordKind()) << "\n";
     }
     return StringResult<std::shared_ptr<ast::Statement>>(
-        "let statement: failed to parse ; token:");
+        adt::Error("let statement: failed to parse ; token:", getLocation()));
     // exit(EXIT_FAILURE);
   }
 
   assert(eat(TokenKind::Semi));
 
   return StringResult<std::shared_ptr<ast::Statement>>(
-      std::make_shared<LetStatement>(let));
+      context->create<LetStatement>(let));
 }
 
 StringResult<std::shared_ptr<ast::Statement>>
@@ -310,45 +283,42 @@ Parser::parseStatement(Restrictions restriction) {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in parse statement: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in parse statement",
+                      outer.getError()};
+      return StringResult<std::shared_ptr<ast::Statement>>(s);
     }
     std::vector<OuterAttribute> ot = outer.getValue();
     if (checkVisItem()) {
       StringResult<std::shared_ptr<ast::Item>> visItem = parseVisItem(ot);
       if (!visItem) {
-        llvm::errs() << "failed to parse vis item in parse statement: "
-                     << visItem.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse vis item in parse statement",
+                        visItem.getError()};
+        return StringResult<std::shared_ptr<ast::Statement>>(s);
       }
       std::vector<ast::OuterAttribute> out = outer.getValue();
       ItemDeclaration item = {loc};
       item.setOuterAttributes(out);
       item.setVisItem(visItem.getValue());
       return StringResult<std::shared_ptr<ast::Statement>>(
-          std::make_shared<ItemDeclaration>(item));
+          context->create<ItemDeclaration>(item));
     } else if (checkMacroItem()) {
       StringResult<std::shared_ptr<ast::Item>> macroItem = parseMacroItem(ot);
       if (!macroItem) {
-        llvm::errs() << "failed to parse macro item in parse statement: "
-                     << macroItem.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse macro item in parse statement",
+                        macroItem.getError()};
+        return StringResult<std::shared_ptr<ast::Statement>>(s);
       }
       ItemDeclaration item = {loc};
       item.setOuterAttributes(ot);
       item.setMacroItem(macroItem.getValue());
       return StringResult<std::shared_ptr<ast::Statement>>(
-          std::make_shared<ItemDeclaration>(item));
+          context->create<ItemDeclaration>(item));
     } else if (checkKeyWord(KeyWordKind::KW_LET)) {
       recover(cp);
       return parseLetStatement(ot, restriction);
     } else {
       return StringResult<std::shared_ptr<ast::Statement>>(
-          "failed to parse statement");
+          adt::Error("failed to parse statement", getLocation()));
     }
   } else { // no outer attributes
     // COPY & PASTE
@@ -356,30 +326,28 @@ Parser::parseStatement(Restrictions restriction) {
     if (checkVisItem()) {
       StringResult<std::shared_ptr<ast::Item>> visItem = parseVisItem(outer);
       if (!visItem) {
-        llvm::errs() << "failed to parse vis item in parse statement: "
-                     << visItem.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse vis item in parse statement",
+                        visItem.getError()};
+        return StringResult<std::shared_ptr<ast::Statement>>(s);
       }
       ItemDeclaration item = {loc};
       item.setVisItem(visItem.getValue());
       return StringResult<std::shared_ptr<ast::Statement>>(
-          std::make_shared<ItemDeclaration>(item));
+          context->create<ItemDeclaration>(item));
     } else if (checkMacroItem()) {
       llvm::errs() << "parse statement: macro item"
                    << "\n";
       StringResult<std::shared_ptr<ast::Item>> macroItem =
           parseMacroItem(outer);
       if (!macroItem) {
-        llvm::errs() << "failed to parse macro item in parse statement: "
-                     << macroItem.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse macro item in parse statement",
+                        macroItem.getError()};
+        return StringResult<std::shared_ptr<ast::Statement>>(s);
       }
       ItemDeclaration item = {loc};
       item.setMacroItem(macroItem.getValue());
       return StringResult<std::shared_ptr<ast::Statement>>(
-          std::make_shared<ItemDeclaration>(item));
+          context->create<ItemDeclaration>(item));
     } else if (checkKeyWord(KeyWordKind::KW_LET)) {
       return parseLetStatement(outer, restriction);
     } else if (checkExpressionWithBlock() || checkExpressionWithoutBlock()) {
@@ -390,11 +358,11 @@ Parser::parseStatement(Restrictions restriction) {
       return parseMacroInvocationSemiStatement();
     } else {
       return StringResult<std::shared_ptr<ast::Statement>>(
-          "failed to parse statement");
+          adt::Error("failed to parse statement", getLocation()));
     }
   }
   return StringResult<std::shared_ptr<ast::Statement>>(
-      "failed to parse statement");
+      adt::Error("failed to parse statement", getLocation()));
 }
 
 } // namespace rust_compiler::parser
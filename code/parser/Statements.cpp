@@ -49,7 +49,6 @@ namespace rust_compiler::parser {
 //                .str();
 //        llvm::errs() << "failed to parse statement in statements: "
 //                     << stmt.getError() << "\n";
-//        printFunctionStack();
 //        //exit(EXIT_FAILURE);
 //        return StringResult<ast::Statements>(s);
 //      }
@@ -63,7 +62,6 @@ namespace rust_compiler::parser {
 //        llvm::errs()
 //            << "failed to parse expression without block in statements: "
 //            << woBlock.getError() << "\n";
-//        printFunctionStack();
 //        exit(EXIT_FAILURE);
 //      }
 //      stmts.setTrailing(woBlock.getValue());
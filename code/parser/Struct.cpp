@@ -28,11 +28,10 @@ StringResult<ast::StructExprField> Parser::parseStructExprField() {
   StringResult<std::vector<ast::OuterAttribute>> outerAttributes =
       parseOuterAttributes();
   if (!outerAttributes) {
-    llvm::errs()
-        << "failed to parse outer attributes in parse struct expr field: "
-        << outerAttributes.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse outer attributes in parse struct expr "
+                    "field",
+                    outerAttributes.getError()};
+    return StringResult<ast::StructExprField>(s);
   }
   std::vector<ast::OuterAttribute> ot = outerAttributes.getValue();
   field.setOuterAttributes(ot);
@@ -42,17 +41,17 @@ StringResult<ast::StructExprField> Parser::parseStructExprField() {
     assert(eat(TokenKind::Identifier));
     if (!check(TokenKind::Colon)) {
       return StringResult<ast::StructExprField>(
-          "failed to parse : token in struct expr field");
+          adt::Error("failed to parse : token in struct expr field",
+                     getLocation()));
     }
     assert(eat(TokenKind::Colon));
     Restrictions restrictions;
     StringResult<std::shared_ptr<ast::Expression>> expr =
         parseExpression({}, restrictions);
     if (!expr) {
-      llvm::errs() << "failed to parse expression in parse struct expr field: "
-                   << expr.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse expression in parse struct expr field",
+                      expr.getError()};
+      return StringResult<ast::StructExprField>(s);
     }
     field.setExpression(expr.getValue());
     return StringResult<ast::StructExprField>(field);
@@ -62,17 +61,17 @@ StringResult<ast::StructExprField> Parser::parseStructExprField() {
     assert(eat(TokenKind::INTEGER_LITERAL));
     if (!check(TokenKind::Colon)) {
       return StringResult<ast::StructExprField>(
-          "failed to parse : token in struct expr field");
+          adt::Error("failed to parse : token in struct expr field",
+                     getLocation()));
     }
     assert(eat(TokenKind::Colon));
     Restrictions restrictions;
     StringResult<std::shared_ptr<ast::Expression>> expr =
         parseExpression({}, restrictions);
     if (!expr) {
-      llvm::errs() << "failed to parse expression in parse struct expr field: "
-                   << expr.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse expression in parse struct expr field",
+                      expr.getError()};
+      return StringResult<ast::StructExprField>(s);
     }
     field.setExpression(expr.getValue());
     return StringResult<ast::StructExprField>(field);
@@ -81,10 +80,10 @@ StringResult<ast::StructExprField> Parser::parseStructExprField() {
     return StringResult<ast::StructExprField>(field);
   } else {
     return StringResult<ast::StructExprField>(
-        "failed to parse struct expr field");
+        adt::Error("failed to parse struct expr field", getLocation()));
   }
   return StringResult<ast::StructExprField>(
-      "failed to parse struct expr field");
+      adt::Error("failed to parse struct expr field", getLocation()));
 }
 
 StringResult<ast::StructExprFields> Parser::parseStructExprFields() {
@@ -93,15 +92,8 @@ StringResult<ast::StructExprFields> Parser::parseStructExprFields() {
 
   StringResult<StructExprField> first = parseStructExprField();
   if (!first) {
-    llvm::errs() << "failed to parse struct expr field in struct expr fields: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv(
-            "{0} {1}",
-            "failed to parse struct expr field in struct expr fields: ",
-            first.getError())
-            .str();
+    adt::Error s = {"failed to parse struct expr field in struct expr fields",
+                    first.getError()};
     // exit(EXIT_FAILURE);
     return StringResult<ast::StructExprFields>(s);
   }
@@ -110,7 +102,7 @@ StringResult<ast::StructExprFields> Parser::parseStructExprFields() {
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<ast::StructExprFields>(
-          "failed to parse struct expr fields: eof");
+          adt::Error("failed to parse struct expr fields: eof", getLocation()));
     } else if (check(TokenKind::BraceClose)) {
       return StringResult<ast::StructExprFields>(fields);
     } else if (check(TokenKind::Comma) && check(TokenKind::BraceClose, 1)) {
@@ -121,14 +113,8 @@ StringResult<ast::StructExprFields> Parser::parseStructExprFields() {
       assert(eat(TokenKind::Comma));
       StringResult<ast::StructBase> base = parseStructBase();
       if (!base) {
-        llvm::errs() << "failed to parse struct base in struct expr fields: "
-                     << base.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv("{0} {1}",
-                          "failed to parse struct base in struct expr fields: ",
-                          base.getError())
-                .str();
+        adt::Error s = {"failed to parse struct base in struct expr fields",
+                        base.getError()};
         return StringResult<ast::StructExprFields>(s);
       }
       fields.setBase(base.getValue());
@@ -137,23 +123,16 @@ StringResult<ast::StructExprFields> Parser::parseStructExprFields() {
       assert(eat(TokenKind::Comma));
       StringResult<StructExprField> field = parseStructExprField();
       if (!field) {
-        llvm::errs()
-            << "failed to parse struct expr field in struct expr fields: "
-            << field.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv(
-                "{0} {1}",
-                "failed to parse struct expr field in struct expr fields: ",
-                field.getError())
-                .str();
+        adt::Error s = {
+            "failed to parse struct expr field in struct expr fields",
+            field.getError()};
         return StringResult<ast::StructExprFields>(s);
       }
       fields.addField(field.getValue());
     }
   }
   return StringResult<ast::StructExprFields>(
-      "failed to parse struct expr fields");
+      adt::Error("failed to parse struct expr fields", getLocation()));
 }
 
 StringResult<ast::StructBase> Parser::parseStructBase() {
@@ -162,16 +141,15 @@ StringResult<ast::StructBase> Parser::parseStructBase() {
 
   if (!check(TokenKind::DotDot)) {
     return StringResult<ast::StructBase>(
-        "failed to parse .. token struct base");
+        adt::Error("failed to parse .. token struct base", getLocation()));
     assert(eat(TokenKind::ParenOpen));
   }
 
   StringResult<std::shared_ptr<ast::Expression>> path = parsePathInExpression();
   if (!path) {
-    llvm::errs() << "failed to parse path in expression in struct base: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse path in expression in struct base",
+                    path.getError()};
+    return StringResult<ast::StructBase>(s);
   }
   base.setPath(path.getValue());
 
@@ -184,15 +162,14 @@ StringResult<std::shared_ptr<ast::Expression>> Parser::parseStructExprUnit() {
 
   StringResult<std::shared_ptr<ast::Expression>> path = parsePathInExpression();
   if (!path) {
-    llvm::errs() << "failed to parse path in expression in struct expr unit: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse path in expression in struct expr unit",
+                    path.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   unit.setPath(path.getValue());
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<StructExprUnit>(unit));
+      context->create<StructExprUnit>(unit));
 }
 
 StringResult<std::shared_ptr<ast::Expression>> Parser::parseStructExprTuple() {
@@ -202,70 +179,68 @@ StringResult<std::shared_ptr<ast::Expression>> Parser::parseStructExprTuple() {
 
   StringResult<std::shared_ptr<ast::Expression>> path = parsePathInExpression();
   if (!path) {
-    llvm::outs() << "failed to parse path in epxression in struct expr tuple: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse path in expression in struct expr tuple",
+                    path.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   tuple.setPath(path.getValue());
 
   if (!check(TokenKind::ParenOpen))
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse ( token struct expr tuple");
+        adt::Error("failed to parse ( token struct expr tuple", getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
     // empty
     assert(eat(TokenKind::ParenClose));
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<StructExprTuple>(tuple));
+        context->create<StructExprTuple>(tuple));
   } else {
     Restrictions restrictions;
     while (true) {
       StringResult<std::shared_ptr<ast::Expression>> expr =
           parseExpression({}, restrictions);
       if (!expr) {
-        llvm::outs() << "failed to parse expression in struct expr tuple: "
-                     << expr.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse expression in struct expr tuple",
+                        expr.getError()};
+        return StringResult<std::shared_ptr<ast::Expression>>(s);
       }
       tuple.addExpression(expr.getValue());
 
       if (check(TokenKind::Eof)) {
         return StringResult<std::shared_ptr<ast::Expression>>(
-            "failed to parse struct expr tuple: eof");
+            adt::Error("failed to parse struct expr tuple: eof",
+                       getLocation()));
       } else if (check(TokenKind::ParenClose)) {
         assert(eat(TokenKind::ParenClose));
         // done
         return StringResult<std::shared_ptr<ast::Expression>>(
-            std::make_shared<StructExprTuple>(tuple));
+            context->create<StructExprTuple>(tuple));
       } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
         assert(eat(TokenKind::Comma));
         assert(eat(TokenKind::ParenClose));
         tuple.setTrailingComma();
         // done
         return StringResult<std::shared_ptr<ast::Expression>>(
-            std::make_shared<StructExprTuple>(tuple));
+            context->create<StructExprTuple>(tuple));
       } else if (check(TokenKind::Comma) && !check(TokenKind::ParenClose, 1)) {
         assert(eat(TokenKind::Comma));
         StringResult<std::shared_ptr<ast::Expression>> expr =
             parseExpression({}, restrictions);
         if (!expr) {
-          llvm::errs() << "failed to expression in struct expr tuple: "
-                       << expr.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to expression in struct expr tuple",
+                          expr.getError()};
+          return StringResult<std::shared_ptr<ast::Expression>>(s);
         }
         tuple.addExpression(expr.getValue());
       } else {
         return StringResult<std::shared_ptr<ast::Expression>>(
-            "failed to parse struct expr tuple");
+            adt::Error("failed to parse struct expr tuple", getLocation()));
       }
     }
   }
   return StringResult<std::shared_ptr<ast::Expression>>(
-      "failed to parse struct expr tuple");
+      adt::Error("failed to parse struct expr tuple", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Expression>> Parser::parseStructExprStruct() {
@@ -275,41 +250,39 @@ StringResult<std::shared_ptr<ast::Expression>> Parser::parseStructExprStruct() {
 
   StringResult<std::shared_ptr<ast::Expression>> path = parsePathInExpression();
   if (!path) {
-    llvm::errs() << "failed to parse path in expression in struct expr struct: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse path in expression in struct expr struct",
+                    path.getError()};
+    return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
   str.setPath(path.getValue());
 
   if (!check(TokenKind::BraceOpen))
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse { token struct expr struct");
+        adt::Error("failed to parse { token struct expr struct",
+                   getLocation()));
   assert(eat(TokenKind::BraceOpen));
 
   if (check(TokenKind::DotDot)) {
     StringResult<ast::StructBase> base = parseStructBase();
     if (!base) {
-      llvm::errs() << "failed to parse struct base in struct expr struct: "
-                   << base.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse struct base in struct expr struct",
+                      base.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     str.setBase(base.getValue());
   } else {
     StringResult<ast::StructExprFields> fields = parseStructExprFields();
     if (!fields) {
-      llvm::errs()
-          << "failed to parse struct expr fields in struct expr struct: "
-          << fields.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse struct expr fields in struct expr "
+                      "struct",
+                      fields.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     str.setFields(fields.getValue());
   }
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<StructExprStruct>(str));
+      context->create<StructExprStruct>(str));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -322,12 +295,12 @@ Parser::parseStructStruct(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_STRUCT))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse struct struct");
+        adt::Error("failed to parse struct struct", getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_STRUCT));
 
   if (!checkIdentifier())
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse struct struct");
+        adt::Error("failed to parse struct struct", getLocation()));
 
   str.setName(getToken().getIdentifier());
   assert(eat(TokenKind::Identifier));
@@ -335,10 +308,9 @@ Parser::parseStructStruct(std::span<OuterAttribute> outer,
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> params = parseGenericParams();
     if (!params) {
-      llvm::errs() << "failed to parse generic params in struct struct: "
-                   << params.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in struct struct",
+                      params.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     str.setGenericParams(params.getValue());
   }
@@ -346,10 +318,9 @@ Parser::parseStructStruct(std::span<OuterAttribute> outer,
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> where = parseWhereClause();
     if (!where) {
-      llvm::errs() << "failed to where clause in struct struct: "
-                   << where.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to where clause in struct struct",
+                      where.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     str.setWhereClause(where.getValue());
   }
@@ -357,31 +328,30 @@ Parser::parseStructStruct(std::span<OuterAttribute> outer,
   if (check(TokenKind::Semi)) {
     assert(eat(TokenKind::Semi));
     return StringResult<std::shared_ptr<ast::Item>>(
-        std::make_shared<class StructStruct>(str));
+        context->create<class StructStruct>(str));
   } else if (check(TokenKind::BraceOpen)) {
     assert(eat(TokenKind::BraceOpen));
     if (check(TokenKind::BraceClose)) {
       assert(eat(TokenKind::BraceClose));
       return StringResult<std::shared_ptr<ast::Item>>(
-          std::make_shared<class StructStruct>(str));
+          context->create<class StructStruct>(str));
     }
     StringResult<ast::StructFields> fields = parseStructFields();
     if (!fields) {
-      llvm::errs() << "failed to parse struct fields in struct struct: "
-                   << fields.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse struct fields in struct struct",
+                      fields.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     str.setFields(fields.getValue());
     if (!check(TokenKind::BraceClose))
       return StringResult<std::shared_ptr<ast::Item>>(
-          "failed to parse struct struct");
+          adt::Error("failed to parse struct struct", getLocation()));
     assert(eat(TokenKind::BraceClose));
     return StringResult<std::shared_ptr<ast::Item>>(
-        std::make_shared<class StructStruct>(str));
+        context->create<class StructStruct>(str));
   }
   return StringResult<std::shared_ptr<ast::Item>>(
-      "failed to parse struct struct");
+      adt::Error("failed to parse struct struct", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Expression>> Parser::parseStructExpression() {
@@ -392,10 +362,9 @@ StringResult<std::shared_ptr<ast::Expression>> Parser::parseStructExpression() {
     StringResult<std::shared_ptr<ast::Expression>> path =
         parsePathInExpression();
     if (!path) {
-      llvm::errs() << "failed to parse path in expession in struct expression: "
-                   << path.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse path in expession in struct expression",
+                      path.getError()};
+      return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     if (check(TokenKind::BraceOpen)) {
       recover(cp);
@@ -413,7 +382,7 @@ StringResult<std::shared_ptr<ast::Expression>> Parser::parseStructExpression() {
   }
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      "failed to parse struct expression");
+      adt::Error("failed to parse struct expression", getLocation()));
 }
 
 StringResult<ast::StructFields> Parser::parseStructFields() {
@@ -422,10 +391,9 @@ StringResult<ast::StructFields> Parser::parseStructFields() {
 
   StringResult<ast::StructField> sf = parseStructField();
   if (!sf) {
-    llvm::errs() << "failed to parse struct field in struct fields: "
-                 << sf.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse struct field in struct fields",
+                    sf.getError()};
+    return StringResult<ast::StructFields>(s);
   }
   sfs.addStructField(sf.getValue());
 
@@ -441,14 +409,14 @@ StringResult<ast::StructFields> Parser::parseStructFields() {
     } else if (check(TokenKind::Comma) && !check(TokenKind::BraceClose, 1)) {
       assert(eat(TokenKind::Comma));
     } else if (check(TokenKind::Eof)) {
-      return StringResult<ast::StructFields>("failed to parse struct fields");
+      return StringResult<ast::StructFields>(
+          adt::Error("failed to parse struct fields", getLocation()));
     }
     StringResult<ast::StructField> sf = parseStructField();
     if (!sf) {
-      llvm::errs() << "failed to parse struct field in struct fields: "
-                   << sf.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse struct field in struct fields",
+                      sf.getError()};
+      return StringResult<ast::StructFields>(s);
     }
     sfs.addStructField(sf.getValue());
   }
@@ -461,10 +429,9 @@ StringResult<ast::StructField> Parser::parseStructField() {
   StringResult<std::vector<ast::OuterAttribute>> outerAttributes =
       parseOuterAttributes();
   if (!outerAttributes) {
-    llvm::errs() << "failed to parse outer attributes in struct field: "
-                 << outerAttributes.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse outer attributes in struct field",
+                    outerAttributes.getError()};
+    return StringResult<ast::StructField>(s);
   }
   std::vector<ast::OuterAttribute> ot = outerAttributes.getValue();
   sf.setOuterAttributes(ot);
@@ -472,10 +439,9 @@ StringResult<ast::StructField> Parser::parseStructField() {
   if (checkKeyWord(KeyWordKind::KW_PUB)) {
     StringResult<ast::Visibility> visibility = parseVisibility();
     if (!visibility) {
-      llvm::errs() << "failed to parse visibility in struct field: "
-                   << visibility.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse visibility in struct field",
+                      visibility.getError()};
+      return StringResult<ast::StructField>(s);
     }
     sf.setVisibility(visibility.getValue());
   }
@@ -484,7 +450,8 @@ StringResult<ast::StructField> Parser::parseStructField() {
     llvm::errs() << getToken().getLocation().toString()
                  << " found: " << Token2String(getToken().getKind()) << "\n";
     return StringResult<ast::StructField>(
-        "failed to parse identifier token in struct field");
+        adt::Error("failed to parse identifier token in struct field",
+                   getLocation()));
   }
 
   Token tok = getToken();
@@ -494,17 +461,15 @@ StringResult<ast::StructField> Parser::parseStructField() {
 
   if (!check(TokenKind::Colon)) {
     return StringResult<ast::StructField>(
-        "failed to parse : token in struct field");
+        adt::Error("failed to parse : token in struct field", getLocation()));
   }
 
   assert(eat(TokenKind::Colon));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in struct field: " << type.getError()
-                 << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in struct field", type.getError()};
+    return StringResult<ast::StructField>(s);
   }
   sf.setType(type.getValue());
 
@@ -520,7 +485,9 @@ Parser::parseStructExpressionStructPratt(std::shared_ptr<ast::Expression> path,
   if (!check(TokenKind::BraceOpen)) {
     /// error
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse { token in parseStructExpressionStructPratt");
+        adt::Error(
+            "failed to parse { token in parseStructExpressionStructPratt",
+            getLocation()));
   }
   assert(eat(TokenKind::BraceOpen));
 
@@ -528,22 +495,19 @@ Parser::parseStructExpressionStructPratt(std::shared_ptr<ast::Expression> path,
     // done
     assert(eat(TokenKind::BraceClose));
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<StructExprStruct>(str));
+        context->create<StructExprStruct>(str));
   }
 
   if (check(TokenKind::DotDot)) {
     // StructBase
   }
 
-  Result<ast::StructExprFields, std::string> fields = parseStructExprFields();
+  StringResult<ast::StructExprFields> fields = parseStructExprFields();
   if (!fields) {
     // report error
-    std::string s =
-        llvm::formatv("{0} {1}",
-                      "failed to parse struct expr fields in struct "
-                      "expression struct pratt",
-                      fields.getError())
-            .str();
+    adt::Error s = {"failed to parse struct expr fields in struct "
+                    "expression struct pratt",
+                    fields.getError()};
     return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
@@ -552,12 +516,14 @@ Parser::parseStructExpressionStructPratt(std::shared_ptr<ast::Expression> path,
   if (!check(TokenKind::BraceClose)) {
     /// error
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse } token in parseStructExpressionStructPratt");
+        adt::Error(
+            "failed to parse } token in parseStructExpressionStructPratt",
+            getLocation()));
   }
   assert(eat(TokenKind::BraceClose));
 
   return StringResult<std::shared_ptr<ast::Expression>>(
-      std::make_shared<StructExprStruct>(str));
+      context->create<StructExprStruct>(str));
 }
 
 adt::StringResult<std::shared_ptr<ast::Expression>>
@@ -569,7 +535,9 @@ Parser::parseStructExpressionTuplePratt(std::shared_ptr<ast::Expression> path,
   if (!check(TokenKind::ParenOpen)) {
     // error
     return StringResult<std::shared_ptr<ast::Expression>>(
-        "failed to parse token ( in parse struct expression tuple pratt");
+        adt::Error(
+            "failed to parse token ( in parse struct expression tuple pratt",
+            getLocation()));
   }
   assert(eat(TokenKind::ParenOpen));
 
@@ -577,7 +545,7 @@ Parser::parseStructExpressionTuplePratt(std::shared_ptr<ast::Expression> path,
     // done: eat
     assert(eat(TokenKind::ParenClose));
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<StructExprTuple>(tuple));
+        context->create<StructExprTuple>(tuple));
   }
 
   Restrictions restrictions;
@@ -585,11 +553,8 @@ Parser::parseStructExpressionTuplePratt(std::shared_ptr<ast::Expression> path,
       parseExpression(outer, restrictions);
   if (!first) {
     // error
-    std::string s =
-        llvm::formatv("{0} {1}",
-                      "failed to parse first expression in struct expr tuple",
-                      first.getError())
-            .str();
+    adt::Error s = {"failed to parse first expression in struct expr tuple",
+                    first.getError()};
     return StringResult<std::shared_ptr<ast::Expression>>(s);
   }
 
@@ -599,14 +564,14 @@ Parser::parseStructExpressionTuplePratt(std::shared_ptr<ast::Expression> path,
     // done: eat
     assert(eat(TokenKind::ParenClose));
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<StructExprTuple>(tuple));
+        context->create<StructExprTuple>(tuple));
   } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
     // done: eat
     tuple.setTrailingComma();
     assert(eat(TokenKind::Comma));
     assert(eat(TokenKind::ParenClose));
     return StringResult<std::shared_ptr<ast::Expression>>(
-        std::make_shared<StructExprTuple>(tuple));
+        context->create<StructExprTuple>(tuple));
   } else if (check(TokenKind::Comma) && !check(TokenKind::ParenClose, 1)) {
     assert(eat(TokenKind::Comma));
   }
@@ -615,30 +580,27 @@ Parser::parseStructExpressionTuplePratt(std::shared_ptr<ast::Expression> path,
       // done eat
       assert(eat(TokenKind::ParenClose));
       return StringResult<std::shared_ptr<ast::Expression>>(
-          std::make_shared<StructExprTuple>(tuple));
+          context->create<StructExprTuple>(tuple));
     } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
       // done eat
       tuple.setTrailingComma();
       assert(eat(TokenKind::Comma));
       assert(eat(TokenKind::ParenClose));
       return StringResult<std::shared_ptr<ast::Expression>>(
-          std::make_shared<StructExprTuple>(tuple));
+          context->create<StructExprTuple>(tuple));
     } else if (check(TokenKind::Comma) && !check(TokenKind::ParenClose, 1)) {
       assert(eat(TokenKind::Comma));
     } else if (check(TokenKind::Eof)) {
       // error
-      std::string s = "failed to parse struct expr tuple: eof";
-      return StringResult<std::shared_ptr<ast::Expression>>(s);
+      return StringResult<std::shared_ptr<ast::Expression>>(
+          adt::Error("failed to parse struct expr tuple: eof", getLocation()));
     }
     StringResult<std::shared_ptr<ast::Expression>> next =
         parseExpression(outer, restrictions);
     if (!next) {
       // error
-      std::string s =
-          llvm::formatv("{0} {1}",
-                        "failed to parse next expression in struct expr tuple",
-                        next.getError())
-              .str();
+      adt::Error s = {"failed to parse next expression in struct expr tuple",
+                      next.getError()};
       return StringResult<std::shared_ptr<ast::Expression>>(s);
     }
     tuple.addExpression(next.getValue());
@@ -26,16 +26,9 @@ Parser::parseStructPatternFields() {
   StringResult<ast::patterns::StructPatternField> first =
       parseStructPatternField();
   if (!first) {
-    llvm::errs() << "failed to parse struct pattern field in "
-                    "parse struct pattern fields: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0}\n{1}",
-                      "failed to parse first struct pattern field in "
-                      "parse struct pattern fields: ",
-                      first.getError())
-            .str();
+    adt::Error s = {"failed to parse first struct pattern field in "
+                    "parse struct pattern fields",
+                    first.getError()};
     return StringResult<ast::patterns::StructPatternFields>(s);
   }
   fields.addPattern(first.getValue());
@@ -45,7 +38,8 @@ Parser::parseStructPatternFields() {
     //             << Token2String(getToken().getKind()) << "\n";
     if (check(TokenKind::Eof)) {
       return StringResult<ast::patterns::StructPatternFields>(
-          "failed to parse struct pattern fields: eof");
+          adt::Error("failed to parse struct pattern fields: eof",
+                     getLocation()));
     } else if (check(TokenKind::Comma) && check(TokenKind::BraceClose, 1)) {
       // done
       assert(eat((TokenKind::Comma)));
@@ -64,15 +58,9 @@ Parser::parseStructPatternFields() {
         StringResult<std::vector<ast::OuterAttribute>> outer =
             parseOuterAttributes();
         if (!outer) {
-          llvm::errs() << "failed to parse  outer attributes in "
-                          "parse struct pattern fields\n"
-                       << outer.getError() << "\n";
-          printFunctionStack();
-          std::string s = llvm::formatv("{0}\n{1}",
-                                        "failed to parse  outer attributes in "
-                                        "parse struct pattern fields: ",
-                                        outer.getError())
-                              .str();
+          adt::Error s = {"failed to parse  outer attributes in "
+                          "parse struct pattern fields",
+                          outer.getError()};
           return StringResult<ast::patterns::StructPatternFields>(s);
         }
       }
@@ -87,16 +75,9 @@ Parser::parseStructPatternFields() {
       StringResult<ast::patterns::StructPatternField> next =
           parseStructPatternField();
       if (!next) {
-        std::string s =
-            llvm::formatv("{0}\n{1}",
-                          "failed to parse next struct pattern field in "
-                          "parse struct pattern fields: ",
-                          next.getError())
-                .str();
-        llvm::errs() << "failed to parse next struct pattern field in "
-                        "parse struct pattern fields\n"
-                     << next.getError() << "\n";
-        printFunctionStack();
+        adt::Error s = {"failed to parse next struct pattern field in "
+                        "parse struct pattern fields",
+                        next.getError()};
         return StringResult<ast::patterns::StructPatternFields>(s);
       }
       fields.addPattern(next.getValue());
@@ -106,12 +87,12 @@ Parser::parseStructPatternFields() {
     } else {
       // error
       return StringResult<ast::patterns::StructPatternFields>(
-          "failed to parse struct pattern fields");
+          adt::Error("failed to parse struct pattern fields", getLocation()));
     }
   }
 
   return StringResult<ast::patterns::StructPatternFields>(
-      "failed to parse struct pattern fields");
+      adt::Error("failed to parse struct pattern fields", getLocation()));
 }
 
 StringResult<ast::patterns::StructPatternField>
@@ -130,15 +111,9 @@ Parser::parseStructPatternField() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse  outer attributes in "
-                      "parse struct pattern field\n"
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      std::string s = llvm::formatv("{0}\n{1}",
-                                    "failed to parse  outer attributes in "
-                                    "parse struct pattern field: ",
-                                    outer.getError())
-                          .str();
+      adt::Error s = {"failed to parse  outer attributes in "
+                      "parse struct pattern field",
+                      outer.getError()};
       return StringResult<ast::patterns::StructPatternField>(s);
     }
     std::vector<OuterAttribute> out = outer.getValue();
@@ -152,15 +127,9 @@ Parser::parseStructPatternField() {
     StringResult<std::shared_ptr<ast::patterns::Pattern>> patterns =
         parsePattern();
     if (!patterns) {
-      llvm::errs() << "failed to parse  pattern in "
-                      "parse struct pattern field\n"
-                   << patterns.getError() << "\n";
-      printFunctionStack();
-      std::string s = llvm::formatv("{0}\n{1}",
-                                    "failed to parse  pattern in "
-                                    "parse struct pattern field: ",
-                                    patterns.getError())
-                          .str();
+      adt::Error s = {"failed to parse  pattern in "
+                      "parse struct pattern field",
+                      patterns.getError()};
       return StringResult<ast::patterns::StructPatternField>(s);
     }
     field.setPattern(patterns.getValue());
@@ -173,15 +142,9 @@ Parser::parseStructPatternField() {
     StringResult<std::shared_ptr<ast::patterns::Pattern>> patterns =
         parsePattern();
     if (!patterns) {
-      llvm::errs() << "failed to parse  pattern in "
-                      "parse struct pattern field\n"
-                   << patterns.getError() << "\n";
-      printFunctionStack();
-      std::string s = llvm::formatv("{0}\n{1}",
-                                    "failed to parse  pattern in "
-                                    "parse struct pattern field: ",
-                                    patterns.getError())
-                          .str();
+      adt::Error s = {"failed to parse  pattern in "
+                      "parse struct pattern field",
+                      patterns.getError()};
       return StringResult<ast::patterns::StructPatternField>(s);
     }
     field.setPattern(patterns.getValue());
@@ -199,7 +162,8 @@ Parser::parseStructPatternField() {
     }
     if (!checkIdentifier())
       return StringResult<ast::patterns::StructPatternField>(
-          "failed to parse identifier token in struct pattern field");
+          adt::Error("failed to parse identifier token in struct pattern field",
+                     getLocation()));
     field.setIdentifier(getToken().getIdentifier());
     field.setKind(StructPatternFieldKind::RefMut);
     assert(eat(TokenKind::Identifier));
@@ -213,7 +177,7 @@ Parser::parseStructPatternField() {
                << Token2String(getToken().getKind()) << "\n";
 
   return StringResult<ast::patterns::StructPatternField>(
-      "failed to parse struct pattern field");
+      adt::Error("failed to parse struct pattern field", getLocation()));
 }
 
 StringResult<ast::patterns::StructPatternEtCetera>
@@ -226,15 +190,9 @@ Parser::parseStructPatternEtCetera() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in "
-                      "parse struct pattern etcetera  pattern\n"
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      std::string s = llvm::formatv("{0}\n{1}",
-                                    "failed to parse outer attributes in "
-                                    "parse struct pattern etcetera  pattern: ",
-                                    outer.getError())
-                          .str();
+      adt::Error s = {"failed to parse outer attributes in "
+                      "parse struct pattern etcetera  pattern",
+                      outer.getError()};
       return StringResult<ast::patterns::StructPatternEtCetera>(s);
     }
     std::vector<ast::OuterAttribute> out = outer.getValue();
@@ -243,7 +201,7 @@ Parser::parseStructPatternEtCetera() {
 
   if (!check(TokenKind::DotDot))
     return StringResult<ast::patterns::StructPatternEtCetera>(
-        "failed to parse struct pattern etcetera");
+        adt::Error("failed to parse struct pattern etcetera", getLocation()));
   assert(eat(TokenKind::DotDot));
 
   return StringResult<ast::patterns::StructPatternEtCetera>(et);
@@ -267,15 +225,9 @@ Parser::parseStructPatternElements() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in "
-                      "parse struct elements\n"
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      std::string s = llvm::formatv("{0}\n{1}",
-                                    "failed to parse outer attributes in "
-                                    "parse struct elements: ",
-                                    outer.getError())
-                          .str();
+      adt::Error s = {"failed to parse outer attributes in "
+                      "parse struct elements",
+                      outer.getError()};
       return StringResult<ast::patterns::StructPatternElements>(s);
     }
   }
@@ -286,16 +238,9 @@ Parser::parseStructPatternElements() {
     StringResult<ast::patterns::StructPatternEtCetera> etcetera =
         parseStructPatternEtCetera();
     if (!etcetera) {
-      llvm::errs() << "failed to parse struct pattern etcetera in "
-                      "parse struct elements\n"
-                   << etcetera.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0}\n{1}",
-                        "failed to parse struct pattern etcetera in "
-                        "parse struct elements: ",
-                        etcetera.getError())
-              .str();
+      adt::Error s = {"failed to parse struct pattern etcetera in "
+                      "parse struct elements",
+                      etcetera.getError()};
       return StringResult<ast::patterns::StructPatternElements>(s);
     }
     elements.setEtCetera(etcetera.getValue());
@@ -306,15 +251,9 @@ Parser::parseStructPatternElements() {
     StringResult<ast::patterns::StructPatternFields> fields =
         parseStructPatternFields();
     if (!fields) {
-      llvm::errs() << "failed to parse struct pattern fields in "
-                      "parse struct elements\n"
-                   << fields.getError() << "\n";
-      printFunctionStack();
-      std::string s = llvm::formatv("{0}\n{1}",
-                                    "failed to parse struct pattern fields in "
-                                    "parse struct elements: ",
-                                    fields.getError())
-                          .str();
+      adt::Error s = {"failed to parse struct pattern fields in "
+                      "parse struct elements",
+                      fields.getError()};
       return StringResult<ast::patterns::StructPatternElements>(s);
     }
     elements.setFields(fields.getValue());
@@ -329,16 +268,9 @@ Parser::parseStructPatternElements() {
     StringResult<ast::patterns::StructPatternEtCetera> etcetera =
         parseStructPatternEtCetera();
     if (!etcetera) {
-      llvm::errs() << "failed to parse struct pattern etcetera in "
-                      "parse struct elements\n"
-                   << etcetera.getError() << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0}\n{1}",
-                        "failed to parse struct pattern etcetera in "
-                        "parse struct elements: ",
-                        etcetera.getError())
-              .str();
+      adt::Error s = {"failed to parse struct pattern etcetera in "
+                      "parse struct elements",
+                      etcetera.getError()};
       return StringResult<ast::patterns::StructPatternElements>(s);
     }
     elements.setEtCetera(etcetera.getValue());
@@ -349,7 +281,7 @@ Parser::parseStructPatternElements() {
                << Token2String(getToken().getKind()) << "\n";
 
   return StringResult<ast::patterns::StructPatternElements>(
-      "failed to parse struct pattern elements");
+      adt::Error("failed to parse struct pattern elements", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
@@ -364,41 +296,29 @@ Parser::parseStructPattern() {
 
   StringResult<std::shared_ptr<ast::Expression>> path = parsePathInExpression();
   if (!path) {
-    llvm::errs() << "failed to parse path in expression in "
-                    "parse struct pattern\n"
-                 << path.getError() << "\n";
-    printFunctionStack();
-    std::string s = llvm::formatv("{0}\n{1}",
-                                  "failed to parse path in expression in "
-                                  "parse struct pattern: ",
-                                  path.getError())
-                        .str();
+    adt::Error s = {"failed to parse path in expression in "
+                    "parse struct pattern",
+                    path.getError()};
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   pat.setPath(path.getValue());
   if (!check(lexer::TokenKind::BraceOpen)) {
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse struct pattern");
+        adt::Error("failed to parse struct pattern", getLocation()));
   }
   assert(eat(TokenKind::BraceOpen));
 
   if (check(TokenKind::BraceClose)) {
     assert(eat(TokenKind::BraceClose));
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        std::make_shared<StructPattern>(pat));
+        context->create<StructPattern>(pat));
   }
 
   StringResult<StructPatternElements> pattern = parseStructPatternElements();
   if (!pattern) {
-    llvm::errs() << "failed to parse struct pattern elements in "
-                    "parse struct pattern\n"
-                 << pattern.getError() << "\n";
-    printFunctionStack();
-    std::string s = llvm::formatv("{0}\n{1}",
-                                  "failed to parse struct pattern elements in "
-                                  "parse struct pattern: ",
-                                  pattern.getError())
-                        .str();
+    adt::Error s = {"failed to parse struct pattern elements in "
+                    "parse struct pattern",
+                    pattern.getError()};
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
   }
   StructPatternElements el = pattern.getValue();
@@ -406,12 +326,12 @@ Parser::parseStructPattern() {
 
   if (!check(lexer::TokenKind::BraceClose)) {
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse struct pattern");
+        adt::Error("failed to parse struct pattern", getLocation()));
   }
   assert(eat(TokenKind::BraceClose));
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      std::make_shared<StructPattern>(pat));
+      context->create<StructPattern>(pat));
 }
 
 } // namespace rust_compiler::parser
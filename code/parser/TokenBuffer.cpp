@@ -0,0 +1,82 @@
+#include "Parser/TokenBuffer.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace rust_compiler::lexer;
+
+namespace rust_compiler::parser {
+
+CheckPoint::CheckPoint(TokenBuffer *buffer, size_t offset)
+    : buffer(buffer), offset(offset) {
+  buffer->pin(offset);
+}
+
+CheckPoint::CheckPoint(const CheckPoint &other)
+    : CheckPoint(other.buffer, other.offset) {}
+
+CheckPoint &CheckPoint::operator=(const CheckPoint &other) {
+  if (this == &other)
+    return *this;
+  other.buffer->pin(other.offset);
+  buffer->unpin(offset);
+  buffer = other.buffer;
+  offset = other.offset;
+  return *this;
+}
+
+CheckPoint::~CheckPoint() { buffer->unpin(offset); }
+
+TokenBuffer::TokenBuffer(TokenSource &source, size_t capacity)
+    : source(source) {
+  assert(capacity > 0 && (capacity & (capacity - 1)) == 0 &&
+         "the capacity must be a power of two");
+  ring.resize(capacity, Token(Location(), TokenKind::Eof));
+}
+
+void TokenBuffer::recover(const CheckPoint &cp) {
+  assert(cp.readOffset() >= begin && "checkpoint was discarded");
+  offset = cp.readOffset();
+}
+
+void TokenBuffer::skipTo(size_t at) {
+  assert(at >= offset && "cannot skip backwards");
+  if (at > end && pins.empty()) {
+    source.skip(at - end);
+    begin = end = at;
+  }
+  offset = at;
+}
+
+void TokenBuffer::unpin(size_t at) {
+  // CheckPoints are mostly released in reverse order
+  auto it = std::find(pins.rbegin(), pins.rend(), at);
+  assert(it != pins.rend() && "unknown checkpoint");
+  pins.erase(std::next(it).base());
+}
+
+void TokenBuffer::fill(size_t at) {
+  while (end <= at) {
+    if (end - begin == ring.size()) {
+      size_t horizon = std::min(offset, end);
+      for (size_t pin : pins)
+        horizon = std::min(horizon, pin);
+
+      // grow unless at least half of the ring can be reused
+      if (horizon - begin >= ring.size() / 2) {
+        begin = horizon;
+      } else {
+        std::vector<Token> larger(2 * ring.size(),
+                                  Token(Location(), TokenKind::Eof));
+        for (size_t i = begin; i < end; ++i)
+          larger[i & (larger.size() - 1)] = ring[i & (ring.size() - 1)];
+        ring = std::move(larger);
+      }
+    }
+
+    ring[end & (ring.size() - 1)] = source.next();
+    ++end;
+  }
+}
+
+} // namespace rust_compiler::parser
@@ -29,31 +29,25 @@ Parser::parseInherentImpl(std::optional<ast::Visibility> vis) {
 
   if (!checkKeyWord(KeyWordKind::KW_IMPL)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse impl keyword in inherent impl");
+        adt::Error("failed to parse impl keyword in inherent impl",
+                   getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_IMPL));
 
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> generic = parseGenericParams();
     if (!generic) {
-      llvm::errs() << "failed to parse generic params in inherent impl: "
-                   << generic.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in inherent impl",
+                      generic.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     impl.setGenericParams(generic.getValue());
   }
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in inherent impl: " << type.getError()
-                 << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv("{0} {1}", "failed to parse type in inherent impl: ",
-                      type.getError())
-            .str();
+    adt::Error s = {"failed to parse type in inherent impl", type.getError()};
     return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   impl.setType(type.getValue());
@@ -61,17 +55,16 @@ Parser::parseInherentImpl(std::optional<ast::Visibility> vis) {
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> where = parseWhereClause();
     if (!where) {
-      llvm::errs() << "failed to parse where clause in inherent impl: "
-                   << where.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse where clause in inherent impl",
+                      where.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     impl.setWhereClause(where.getValue());
   }
 
   if (!check(TokenKind::BraceOpen)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse { token in inherent impl");
+        adt::Error("failed to parse { token in inherent impl", getLocation()));
   }
   assert(eat(TokenKind::BraceOpen));
 
@@ -79,10 +72,9 @@ Parser::parseInherentImpl(std::optional<ast::Visibility> vis) {
     StringResult<std::vector<ast::InnerAttribute>> inner =
         parseInnerAttributes();
     if (!inner) {
-      llvm::errs() << "failed to parse inner attributes in inherent impl: "
-                   << inner.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse inner attributes in inherent impl",
+                      inner.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     std::vector<ast::InnerAttribute> in = inner.getValue();
     impl.setInnerAttributes(in);
@@ -92,29 +84,28 @@ Parser::parseInherentImpl(std::optional<ast::Visibility> vis) {
     if (check(TokenKind::Eof)) {
       // error
       return StringResult<std::shared_ptr<ast::Item>>(
-          "failed to parse inherent impl: eof");
+          adt::Error("failed to parse inherent impl: eof", getLocation()));
     } else if (check(TokenKind::BraceClose)) {
       // done
       assert(eat(TokenKind::BraceClose));
       return StringResult<std::shared_ptr<ast::Item>>(
-          std::make_shared<InherentImpl>(impl));
+          context->create<InherentImpl>(impl));
     } else if (!check(TokenKind::BraceClose)) {
       // asso without check
       StringResult<ast::AssociatedItem> asso = parseAssociatedItem();
       if (!asso) {
-        llvm::errs() << "failed to parse associated item in inherent impl: "
-                     << asso.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse associated item in inherent impl",
+                        asso.getError()};
+        return StringResult<std::shared_ptr<ast::Item>>(s);
       }
       impl.addAssociatedItem(asso.getValue());
     } else {
       return StringResult<std::shared_ptr<ast::Item>>(
-          "failed to parse inherent impl");
+          adt::Error("failed to parse inherent impl", getLocation()));
     }
   }
   return StringResult<std::shared_ptr<ast::Item>>(
-      "failed to parse inherent impl");
+      adt::Error("failed to parse inherent impl", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -129,17 +120,17 @@ Parser::parseTraitImpl(std::optional<ast::Visibility> vis) {
 
   if (!checkKeyWord(KeyWordKind::KW_IMPL)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse impl keyword in trait impl");
+        adt::Error("failed to parse impl keyword in trait impl",
+                   getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_IMPL));
 
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> generic = parseGenericParams();
     if (!generic) {
-      llvm::errs() << "failed to parse generic params item in trait impl: "
-                   << generic.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params item in trait impl",
+                      generic.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     impl.setGenericParams(generic.getValue());
   }
@@ -152,35 +143,31 @@ Parser::parseTraitImpl(std::optional<ast::Visibility> vis) {
   StringResult<std::shared_ptr<ast::types::TypeExpression>> typePath =
       parseTypePath();
   if (!typePath) {
-    llvm::errs() << "failed to parse type item in trait impl: "
-                 << typePath.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type item in trait impl",
+                    typePath.getError()};
+    return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   impl.setTypePath(typePath.getValue());
 
   if (!checkKeyWord(KeyWordKind::KW_FOR)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse for keyword in trait impl");
+        adt::Error("failed to parse for keyword in trait impl", getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_FOR));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in trait impl: " << type.getError()
-                 << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in trait impl", type.getError()};
+    return StringResult<std::shared_ptr<ast::Item>>(s);
   }
   impl.setType(type.getValue());
 
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> where = parseWhereClause();
     if (!where) {
-      llvm::errs() << "failed to parse where clause in trait impl: "
-                   << where.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse where clause in trait impl",
+                      where.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     impl.setWhereClause(where.getValue());
   }
@@ -190,7 +177,7 @@ Parser::parseTraitImpl(std::optional<ast::Visibility> vis) {
                  << "@ failed to parse { token in trait impl"
                  << "\n";
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse { token in trait impl");
+        adt::Error("failed to parse { token in trait impl", getLocation()));
   }
   assert(eat(TokenKind::BraceOpen));
 
@@ -198,10 +185,9 @@ Parser::parseTraitImpl(std::optional<ast::Visibility> vis) {
     StringResult<std::vector<ast::InnerAttribute>> inner =
         parseInnerAttributes();
     if (!inner) {
-      llvm::errs() << "failed to parse inner attribute in trait impl: "
-                   << inner.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse inner attribute in trait impl",
+                      inner.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     std::vector<ast::InnerAttribute> in = inner.getValue();
     impl.setInnerAttributes(in);
@@ -211,28 +197,28 @@ Parser::parseTraitImpl(std::optional<ast::Visibility> vis) {
     if (check(TokenKind::Eof)) {
       // error
       return StringResult<std::shared_ptr<ast::Item>>(
-          "failed to parse trait impl: eof");
+          adt::Error("failed to parse trait impl: eof", getLocation()));
     } else if (check(TokenKind::BraceClose)) {
       assert(eat(TokenKind::BraceClose));
       // done
       return StringResult<std::shared_ptr<ast::Item>>(
-          std::make_shared<TraitImpl>(impl));
+          context->create<TraitImpl>(impl));
     } else if (!check(TokenKind::BraceClose)) {
       // asso without check
       StringResult<ast::AssociatedItem> asso = parseAssociatedItem();
       if (!asso) {
-        llvm::errs() << "failed to parse associated item in trait impl: "
-                     << asso.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse associated item in trait impl",
+                        asso.getError()};
+        return StringResult<std::shared_ptr<ast::Item>>(s);
       }
       impl.addAssociatedItem(asso.getValue());
     } else {
       return StringResult<std::shared_ptr<ast::Item>>(
-          "failed to parse trait impl");
+          adt::Error("failed to parse trait impl", getLocation()));
     }
   }
-  return StringResult<std::shared_ptr<ast::Item>>("failed to parse trait impl");
+  return StringResult<std::shared_ptr<ast::Item>>(
+      adt::Error("failed to parse trait impl", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::Item>>
@@ -249,13 +235,13 @@ Parser::parseTrait(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_TRAIT)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse trait keyword in trait");
+        adt::Error("failed to parse trait keyword in trait", getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_TRAIT));
 
   if (!check(TokenKind::Identifier)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse identifier token in trait");
+        adt::Error("failed to parse identifier token in trait", getLocation()));
   }
   trait.setIdentifier(getToken().getIdentifier());
   assert(eat(TokenKind::Identifier));
@@ -263,10 +249,9 @@ Parser::parseTrait(std::span<OuterAttribute> outer,
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> params = parseGenericParams();
     if (!params) {
-      llvm::errs() << "failed to parse generic params in trait impl: "
-                   << params.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in trait impl",
+                      params.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     trait.setGenericParams(params.getValue());
   }
@@ -282,12 +267,9 @@ Parser::parseTrait(std::span<OuterAttribute> outer,
     assert(eat(TokenKind::Colon));
     StringResult<ast::types::TypeParamBounds> bounds = parseTypeParamBounds();
     if (!bounds) {
-      llvm::errs() << getToken().getLocation().toString()
-                   << " @ failed to parse type param bounds in trait impl: "
-                   << bounds.getError() << "\n";
-      llvm::errs() << Token2String(getToken().getKind()) << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type param bounds in trait",
+                      bounds.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     //assert(eat(TokenKind::BraceClose));
     trait.setBounds(bounds.getValue());
@@ -296,10 +278,9 @@ Parser::parseTrait(std::span<OuterAttribute> outer,
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> where = parseWhereClause();
     if (!where) {
-      llvm::errs() << "failed to parse where clause in trait impl: "
-                   << where.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse where clause in trait impl",
+                      where.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     trait.setWhere(where.getValue());
   }
@@ -309,7 +290,7 @@ Parser::parseTrait(std::span<OuterAttribute> outer,
                  << " @ failed to parse { token in trait"
                  << "\n";
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse { token in trait");
+        adt::Error("failed to parse { token in trait", getLocation()));
   }
   assert(eat(TokenKind::BraceOpen));
 
@@ -317,10 +298,9 @@ Parser::parseTrait(std::span<OuterAttribute> outer,
     StringResult<std::vector<ast::InnerAttribute>> inner =
         parseInnerAttributes();
     if (!inner) {
-      llvm::errs() << "failed to parse inner attribute in trait impl: "
-                   << inner.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse inner attribute in trait impl",
+                      inner.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     std::vector<ast::InnerAttribute> in = inner.getValue();
     trait.setInner(in);
@@ -333,19 +313,18 @@ Parser::parseTrait(std::span<OuterAttribute> outer,
     if (check(TokenKind::Eof)) {
       // abort
       return StringResult<std::shared_ptr<ast::Item>>(
-          "failed to parse trait: eof");
+          adt::Error("failed to parse trait: eof", getLocation()));
     } else if (check(TokenKind::BraceClose)) {
       // done
       assert(eat(TokenKind::BraceClose));
       return StringResult<std::shared_ptr<ast::Item>>(
-          std::make_shared<Trait>(trait));
+          context->create<Trait>(trait));
     } else {
       StringResult<ast::AssociatedItem> asso = parseAssociatedItem();
       if (!asso) {
-        llvm::errs() << "failed to parse associated item in trait impl: "
-                     << asso.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse associated item in trait impl",
+                        asso.getError()};
+        return StringResult<std::shared_ptr<ast::Item>>(s);
       }
       trait.addItem(asso.getValue());
     }
@@ -353,12 +332,12 @@ Parser::parseTrait(std::span<OuterAttribute> outer,
 
   if (!check(TokenKind::BraceClose)) {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse } token in trait");
+        adt::Error("failed to parse } token in trait", getLocation()));
   }
   assert(eat(TokenKind::BraceClose));
 
   return StringResult<std::shared_ptr<ast::Item>>(
-      std::make_shared<Trait>(trait));
+      context->create<Trait>(trait));
 }
 
 } // namespace rust_compiler::parser
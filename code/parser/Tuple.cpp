@@ -23,29 +23,30 @@ Parser::parseTupleStruct(std::span<OuterAttribute> outer,
 
   if (!checkKeyWord(KeyWordKind::KW_STRUCT))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse struct keyword in tuple struct");
+        adt::Error("failed to parse struct keyword in tuple struct",
+                   getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_STRUCT));
 
   if (!checkIdentifier())
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse struct keyword in tuple struct");
+        adt::Error("failed to parse struct keyword in tuple struct",
+                   getLocation()));
   stru.setIdentifier(getToken().getIdentifier());
   assert(eat(TokenKind::Identifier));
 
   if (check(TokenKind::Lt)) {
     StringResult<ast::GenericParams> generic = parseGenericParams();
     if (!generic) {
-      llvm::errs() << "failed to parse generic params in tuple struct: "
-                   << generic.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic params in tuple struct",
+                      generic.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     stru.setGenericParams(generic.getValue());
   }
 
   if (!check(TokenKind::ParenOpen))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse ( token in tuple struct");
+        adt::Error("failed to parse ( token in tuple struct", getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
@@ -53,37 +54,35 @@ Parser::parseTupleStruct(std::span<OuterAttribute> outer,
   } else if (!check(TokenKind::ParenClose)) {
     StringResult<ast::TupleFields> tupleFields = parseTupleFields();
     if (!tupleFields) {
-      llvm::errs() << "failed to parse tuple fields in tuple struct: "
-                   << tupleFields.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse tuple fields in tuple struct",
+                      tupleFields.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     stru.setTupleFields(tupleFields.getValue());
   }
 
   if (!check(TokenKind::ParenClose))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse ) token in tuple struct");
+        adt::Error("failed to parse ) token in tuple struct", getLocation()));
   assert(eat(TokenKind::ParenClose));
 
   if (checkKeyWord(KeyWordKind::KW_WHERE)) {
     StringResult<ast::WhereClause> where = parseWhereClause();
     if (!where) {
-      llvm::errs() << "failed to parse where clause in tuple struct: "
-                   << where.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse where clause in tuple struct",
+                      where.getError()};
+      return StringResult<std::shared_ptr<ast::Item>>(s);
     }
     stru.setWhereClause(where.getValue());
   }
 
   if (!check(TokenKind::Semi))
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse ; token in tuple struct");
+        adt::Error("failed to parse ; token in tuple struct", getLocation()));
   assert(eat(TokenKind::Semi));
 
   return StringResult<std::shared_ptr<ast::Item>>(
-      std::make_shared<class TupleStruct>(stru));
+      context->create<class TupleStruct>(stru));
 }
 
 StringResult<ast::TupleField> Parser::parseTupleField() {
@@ -94,10 +93,9 @@ StringResult<ast::TupleField> Parser::parseTupleField() {
     StringResult<std::vector<ast::OuterAttribute>> outer =
         parseOuterAttributes();
     if (!outer) {
-      llvm::errs() << "failed to parse outer attributes in tuple field: "
-                   << outer.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse outer attributes in tuple field",
+                      outer.getError()};
+      return StringResult<ast::TupleField>(s);
     }
     std::vector<ast::OuterAttribute> ot = outer.getValue();
     tuple.setOuterAttributes(ot);
@@ -106,20 +104,17 @@ StringResult<ast::TupleField> Parser::parseTupleField() {
   if (checkKeyWord(KeyWordKind::KW_PUB)) {
     StringResult<ast::Visibility> vis = parseVisibility();
     if (!vis) {
-      llvm::errs() << "failed to parse visibility in tuple field: "
-                   << vis.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse visibility in tuple field",
+                      vis.getError()};
+      return StringResult<ast::TupleField>(s);
     }
     tuple.setVisibility(vis.getValue());
   }
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in tuple field: " << type.getError()
-                 << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in tuple field", type.getError()};
+    return StringResult<ast::TupleField>(s);
   }
   tuple.setType(type.getValue());
 
@@ -132,17 +127,16 @@ StringResult<ast::TupleFields> Parser::parseTupleFields() {
 
   StringResult<ast::TupleField> first = parseTupleField();
   if (!first) {
-    llvm::errs() << "failed to parse tuple field in tuple fields: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse tuple field in tuple fields",
+                    first.getError()};
+    return StringResult<ast::TupleFields>(s);
   }
   tuple.addField(first.getValue());
 
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<ast::TupleFields>(
-          "failed to parse tuple fields: eof");
+          adt::Error("failed to parse tuple fields: eof", getLocation()));
     } else if (check(TokenKind::ParenClose)) {
       return StringResult<ast::TupleFields>(tuple);
     } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
@@ -152,17 +146,17 @@ StringResult<ast::TupleFields> Parser::parseTupleFields() {
       assert(eat(TokenKind::Comma));
       StringResult<ast::TupleField> next = parseTupleField();
       if (!next) {
-        llvm::errs() << "failed to parse tuple field in tuple fields: "
-                     << next.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse tuple field in tuple fields",
+                        next.getError()};
+        return StringResult<ast::TupleFields>(s);
       }
       tuple.addField(next.getValue());
     } else {
       return StringResult<ast::TupleFields>(tuple);
     }
   }
-  return StringResult<ast::TupleFields>("failed to parse tuple fields: eof");
+  return StringResult<ast::TupleFields>(
+      adt::Error("failed to parse tuple fields: eof", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>>
@@ -175,20 +169,18 @@ Parser::parseTupleType() {
     assert(eat(TokenKind::ParenOpen));
     assert(eat(TokenKind::ParenClose));
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<TupleType>(tuple));
+        context->create<TupleType>(tuple));
   } else if (!check(TokenKind::ParenOpen)) {
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse ( token in tuple type");
+        adt::Error("failed to parse ( token in tuple type", getLocation()));
   }
 
   assert(eat(TokenKind::ParenOpen));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> first = parseType();
   if (!first) {
-    llvm::errs() << "failed to parse type in tuple type: " << first.getError()
-                 << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in tuple type", first.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   tuple.addType(first.getValue());
 
@@ -196,25 +188,23 @@ Parser::parseTupleType() {
     assert(eat(TokenKind::Comma));
     assert(eat(TokenKind::ParenClose));
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<TupleType>(tuple));
+        context->create<TupleType>(tuple));
   } else if (check(TokenKind::ParenClose)) {
     assert(eat(TokenKind::ParenClose));
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<TupleType>(tuple));
+        context->create<TupleType>(tuple));
   }
 
   if (!check(TokenKind::Comma))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse , token in tuple type");
+        adt::Error("failed to parse , token in tuple type", getLocation()));
   assert(eat(TokenKind::Comma));
 
   while (true) {
     StringResult<std::shared_ptr<ast::types::TypeExpression>> typ = parseType();
     if (!typ) {
-      llvm::errs() << "failed to parse type in tuple type: " << typ.getError()
-                   << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type in tuple type", typ.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
     }
     tuple.addType(typ.getValue());
 
@@ -222,14 +212,14 @@ Parser::parseTupleType() {
       assert(eat(TokenKind::Comma));
       assert(eat(TokenKind::ParenClose));
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          std::make_shared<TupleType>(tuple));
+          context->create<TupleType>(tuple));
     } else if (check(TokenKind::Eof)) {
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          "failed to parse tuple type: eof");
+          adt::Error("failed to parse tuple type: eof", getLocation()));
     } else if (check(TokenKind::ParenClose)) {
       assert(eat(TokenKind::ParenClose));
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          std::make_shared<TupleType>(tuple));
+          context->create<TupleType>(tuple));
     } else if (check(TokenKind::Comma)) {
       assert(eat(TokenKind::Comma));
     }
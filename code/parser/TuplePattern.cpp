@@ -29,14 +29,8 @@ StringResult<TuplePatternItems> Parser::parseTuplePatternItems() {
 
   StringResult<std::shared_ptr<ast::patterns::Pattern>> first = parsePattern();
   if (!first) {
-    llvm::errs() << "failed to parse first pattern in tuple pattern items: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0} {1}",
-                      "failed to parse first pattern in tuple pattern items",
-                      first.getError())
-            .str();
+    adt::Error s = {"failed to parse first pattern in tuple pattern items",
+                    first.getError()};
     return StringResult<TuplePatternItems>(s);
     // exit(EXIT_FAILURE);
   }
@@ -55,7 +49,8 @@ StringResult<TuplePatternItems> Parser::parseTuplePatternItems() {
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<TuplePatternItems>(
-          "failed to parse tuple pattern items: eof");
+          adt::Error("failed to parse tuple pattern items: eof",
+                     getLocation()));
     } else if (check(TokenKind::Comma) && check(TokenKind::ParenClose, 1)) {
       assert(eat(TokenKind::Comma));
       return StringResult<TuplePatternItems>(items);
@@ -68,21 +63,16 @@ StringResult<TuplePatternItems> Parser::parseTuplePatternItems() {
           parsePattern();
 
       if (!next) {
-        llvm::errs() << "failed to parse next pattern in tuple pattern items: "
-                     << next.getError() << "\n";
-        printFunctionStack();
-        std::string s =
-            llvm::formatv("{0} {1}",
-                          "failed to parse next pattern in tuple pattern items",
-                          next.getError())
-                .str();
+        adt::Error s = {"failed to parse next pattern in tuple pattern items",
+                        next.getError()};
         return StringResult<TuplePatternItems>(s);
         // exit(EXIT_FAILURE);
       }
       items.addPattern(next.getValue());
     }
   }
-  return StringResult<TuplePatternItems>("failed to parse tuple pattern items");
+  return StringResult<TuplePatternItems>(
+      adt::Error("failed to parse tuple pattern items", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>
@@ -96,19 +86,13 @@ Parser::parseTuplePattern() {
 
   if (!check(TokenKind::ParenOpen))
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse ( token in tuple pattern");
+        adt::Error("failed to parse ( token in tuple pattern", getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   StringResult<TuplePatternItems> items = parseTuplePatternItems();
   if (!items) {
-    llvm::errs() << "failed to parse tuple pattern items in tuple pattern: "
-                 << items.getError() << "\n";
-    printFunctionStack();
-    std::string s =
-        llvm::formatv("{0} {1}",
-                      "failed to parse tuple pattern items in tuple pattern: ",
-                      items.getError())
-            .str();
+    adt::Error s = {"failed to parse tuple pattern items in tuple pattern",
+                    items.getError()};
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(s);
     // exit(EXIT_FAILURE);
   }
@@ -116,11 +100,11 @@ Parser::parseTuplePattern() {
 
   if (!check(TokenKind::ParenClose))
     return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-        "failed to parse ) token in tuple pattern");
+        adt::Error("failed to parse ) token in tuple pattern", getLocation()));
   assert(eat(TokenKind::ParenClose));
 
   return StringResult<std::shared_ptr<ast::patterns::PatternNoTopAlt>>(
-      std::make_shared<TuplePattern>(tuple));
+      context->create<TuplePattern>(tuple));
 }
 
 } // namespace rust_compiler::parser
@@ -39,18 +39,18 @@ bool Parser::checkPathExprSegment(uint8_t offset) {
   return true;
 }
 
-// Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+// StringResult<std::shared_ptr<ast::types::TypeExpression>>
 // Parser::parseArrayOrSliceType() {
 //   CheckPoint cp = getCheckPoint();
 //
 //   if (!check(TokenKind::SquareOpen)) {
 //     // report error
-//     return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(
+//     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
 //         "failed to parse array or slice type: missed [ token");
 //   }
 //   assert(eat(TokenKind::SquareOpen));
 //
-//   Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
+//   StringResult<std::shared_ptr<ast::types::TypeExpression>> type =
 //       parseType();
 //   if (!type) {
 //     // report error
@@ -79,7 +79,7 @@ bool Parser::checkPathExprSegment(uint8_t offset) {
 //           "failed to parse array or slice type");
 // }
 
-Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+StringResult<std::shared_ptr<ast::types::TypeExpression>>
 Parser::parseSliceType() {
   SliceType slice = {getLocation()};
 
@@ -88,65 +88,57 @@ Parser::parseSliceType() {
 
   if (!check(TokenKind::SquareOpen)) {
     // report error
-    return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(
-        "failed to parse slice type: missed [ token");
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
+        adt::Error("failed to parse slice type: missed [ token",
+                   getLocation()));
   }
   assert(eat(TokenKind::SquareOpen));
 
-  Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
-      parseType();
+  StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
     // report error
-    llvm::errs() << "failed to parse type in slice type: " << type.getError()
-                 << "\n";
-    std::string s =
-        llvm::formatv("{0}\n{1}", "failed to parse type in slice type",
-                      type.getError())
-            .str();
-    return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(s);
+    adt::Error s = {"failed to parse type in slice type", type.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   slice.setType(type.getValue());
 
   if (!check(TokenKind::SquareClose)) {
     // report error
-    return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(
-        "failed to parse slice type: missed ] token");
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
+        adt::Error("failed to parse slice type: missed ] token",
+                   getLocation()));
   }
   assert(eat(TokenKind::SquareClose));
 
-  return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(
-      std::make_shared<SliceType>(slice));
+  return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
+      context->create<SliceType>(slice));
 }
 
-Result<std::shared_ptr<ast::types::TypeExpression>, std::string>
+StringResult<std::shared_ptr<ast::types::TypeExpression>>
 Parser::parseArrayType() {
   ArrayType ar = {getLocation()};
 
   if (!check(TokenKind::SquareOpen)) {
     // report error
-    return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(
-        "failed to parse slice type: missed [ token");
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
+        adt::Error("failed to parse slice type: missed [ token",
+                   getLocation()));
   }
   assert(eat(TokenKind::SquareOpen));
 
-  Result<std::shared_ptr<ast::types::TypeExpression>, std::string> type =
-      parseType();
+  StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
     // report error
-    llvm::errs() << "failed to parse type in array type: " << type.getError()
-                 << "\n";
-    std::string s =
-        llvm::formatv("{0}\n{1}", "failed to parse type in array type",
-                      type.getError())
-            .str();
-    return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(s);
+    adt::Error s = {"failed to parse type in array type", type.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   ar.setType(type.getValue());
 
   if (!check(TokenKind::Semi)) {
     // report error
-    return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(
-        "failed to parse array type: missed ; token");
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
+        adt::Error("failed to parse array type: missed ; token",
+                   getLocation()));
   }
   assert(eat(TokenKind::Semi));
 
@@ -155,25 +147,22 @@ Parser::parseArrayType() {
       parseExpression({}, restrictions);
   if (!expr) {
     // report error
-    llvm::errs() << "failed to parse expression in array type: "
-                 << expr.getError() << "\n";
-    std::string s =
-        llvm::formatv("{0}\n{1}", "failed to parse expression in array type",
-                      expr.getError())
-            .str();
-    return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(s);
+    adt::Error s = {"failed to parse expression in array type",
+                    expr.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   ar.setExpression(expr.getValue());
 
   if (!check(TokenKind::SquareClose)) {
     // report error
-    return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(
-        "failed to parse array type: missed ] token");
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
+        adt::Error("failed to parse array type: missed ] token",
+                   getLocation()));
   }
   assert(eat(TokenKind::SquareClose));
 
-  return Result<std::shared_ptr<ast::types::TypeExpression>, std::string>(
-      std::make_shared<ArrayType>(ar));
+  return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
+      context->create<ArrayType>(ar));
 }
 
 StringResult<ast::GenericArgsConst> Parser::parseGenericArgsConst() {
@@ -185,10 +174,9 @@ StringResult<ast::GenericArgsConst> Parser::parseGenericArgsConst() {
     StringResult<std::shared_ptr<ast::Expression>> block =
         parseBlockExpression({});
     if (!block) {
-      llvm::errs() << "failed to parse block expression in generic args const: "
-                   << block.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse block expression in generic args const",
+                      block.getError()};
+      return StringResult<ast::GenericArgsConst>(s);
     }
     cons.setBlock(block.getValue());
     return StringResult<ast::GenericArgsConst>(cons);
@@ -197,16 +185,9 @@ StringResult<ast::GenericArgsConst> Parser::parseGenericArgsConst() {
     StringResult<std::shared_ptr<ast::Expression>> literal =
         parseLiteralExpression({});
     if (!literal) {
-      llvm::errs()
-          << "failed to parse literal expression in generic args const: "
-          << literal.getError() << "\n";
-      // printFunctionStack();
       return StringResult<ast::GenericArgsConst>(
-          llvm::formatv(
-              "{} {}",
-              "failed to parse literal expression in generic args const: ",
-              literal.getError())
-              .str());
+          adt::Error("failed to parse literal expression in generic args const",
+                     literal.getError()));
     }
     cons.setLiteral(literal.getValue());
     return StringResult<ast::GenericArgsConst>(cons);
@@ -217,11 +198,10 @@ StringResult<ast::GenericArgsConst> Parser::parseGenericArgsConst() {
     StringResult<std::shared_ptr<ast::Expression>> literal =
         parseLiteralExpression({});
     if (!literal) {
-      llvm::errs()
-          << "failed to parse literal expression in generic args const: "
-          << literal.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse literal expression in generic args "
+                      "const",
+                      literal.getError()};
+      return StringResult<ast::GenericArgsConst>(s);
     }
     cons.setLiteral(literal.getValue());
     return StringResult<ast::GenericArgsConst>(cons);
@@ -229,17 +209,16 @@ StringResult<ast::GenericArgsConst> Parser::parseGenericArgsConst() {
     // simple path segment
     StringResult<ast::SimplePathSegment> seg = parseSimplePathSegment();
     if (!seg) {
-      llvm::errs()
-          << "failed to parse simple path segment in generic args const: "
-          << seg.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse simple path segment in generic args "
+                      "const",
+                      seg.getError()};
+      return StringResult<ast::GenericArgsConst>(s);
     }
     cons.setSegment(seg.getValue());
     return StringResult<ast::GenericArgsConst>(cons);
   }
   return StringResult<ast::GenericArgsConst>(
-      "failed to parse generic args const");
+      adt::Error("failed to parse generic args const", getLocation()));
 }
 
 StringResult<ast::GenericArgsBinding> Parser::parseGenericArgsBinding() {
@@ -248,23 +227,23 @@ StringResult<ast::GenericArgsBinding> Parser::parseGenericArgsBinding() {
 
   if (!check(TokenKind::Identifier)) {
     return StringResult<ast::GenericArgsBinding>(
-        "failed to parse generic args binding: identifier");
+        adt::Error("failed to parse generic args binding: identifier",
+                   getLocation()));
   }
   binding.setIdentifier(getToken().getIdentifier());
   assert(eat(TokenKind::Identifier));
 
   if (!check(TokenKind::Eq)) {
     return StringResult<ast::GenericArgsBinding>(
-        "failed to parse generic args binding: =");
+        adt::Error("failed to parse generic args binding: =", getLocation()));
   }
   assert(eat(TokenKind::Eq));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in generic args binding: "
-                 << type.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in generic args binding",
+                    type.getError()};
+    return StringResult<ast::GenericArgsBinding>(s);
   }
 
   binding.setType(type.getValue());
@@ -286,11 +265,11 @@ Parser::parseLifetimeAsTypeParamBound() {
     lf.setLifetime(getToken().getStorage());
   } else {
     return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
-        "failed to parse lifetime");
+        adt::Error("failed to parse lifetime", getLocation()));
   }
 
   return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
-      std::make_shared<rust_compiler::ast::types::Lifetime>(lf));
+      context->create<rust_compiler::ast::types::Lifetime>(lf));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>>
@@ -300,20 +279,20 @@ Parser::parseImplTraitType() {
 
   if (!checkKeyWord(KeyWordKind::KW_IMPL))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse impl keyworkd in impl trait type");
+        adt::Error("failed to parse impl keyworkd in impl trait type",
+                   getLocation()));
   assert(eatKeyWord(KeyWordKind::KW_IMPL));
 
   StringResult<ast::types::TypeParamBounds> bounds = parseTypeParamBounds();
   if (!bounds) {
-    llvm::errs() << "failed to parse type param bounds in impl trait type: "
-                 << bounds.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type param bounds in impl trait type",
+                    bounds.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   trait.setBounds(bounds.getValue());
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      std::make_shared<ImplTraitType>(trait));
+      context->create<ImplTraitType>(trait));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>>
@@ -323,31 +302,29 @@ Parser::parseMacroInvocationType() {
 
   StringResult<ast::SimplePath> path = parseSimplePath();
   if (!path) {
-    llvm::errs() << "failed to parse simple path in macro invocation type: "
-                 << path.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse simple path in macro invocation type",
+                    path.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   macro.setPath(path.getValue());
 
   if (!check(TokenKind::Not))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse ! token in macro invocation type");
+        adt::Error("failed to parse ! token in macro invocation type",
+                   getLocation()));
   assert(eat(TokenKind::Not));
 
   StringResult<std::shared_ptr<ast::DelimTokenTree>> token =
       parseDelimTokenTree();
   if (!token) {
-    llvm::errs()
-        << "failed to parse delim token tree in macro invocation type: "
-        << token.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse delim token tree in macro invocation type",
+                    token.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   macro.setTree(token.getValue());
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      std::make_shared<MacroInvocationType>(macro));
+      context->create<MacroInvocationType>(macro));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>>
@@ -364,16 +341,15 @@ Parser::parseTraitObjectTypeOneBound() {
   StringResult<std::shared_ptr<ast::types::TypeParamBound>> traitBound =
       parseTraitBound();
   if (!traitBound) {
-    llvm::errs()
-        << "failed to parse trait bound in trait object type one bound: "
-        << traitBound.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse trait bound in trait object type one "
+                    "bound",
+                    traitBound.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   bound.setBound(traitBound.getValue());
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      std::make_shared<TraitObjectTypeOneBound>(bound));
+      context->create<TraitObjectTypeOneBound>(bound));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>>
@@ -383,25 +359,26 @@ Parser::parseParenthesizedType() {
 
   if (!check(TokenKind::ParenOpen))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse ( token in parenthesized type");
+        adt::Error("failed to parse ( token in parenthesized type",
+                   getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in parenthesized type: "
-                 << type.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in parenthesized type",
+                    type.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   parenType.setType(type.getValue());
 
   if (!check(TokenKind::ParenClose))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse ) token in parenthesized type");
+        adt::Error("failed to parse ) token in parenthesized type",
+                   getLocation()));
   assert(eat(TokenKind::ParenClose));
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      std::make_shared<ParenthesizedType>(parenType));
+      context->create<ParenthesizedType>(parenType));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>>
@@ -410,7 +387,8 @@ Parser::parseTupleOrParensType() {
 
   if (!check(TokenKind::ParenOpen))
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse ( token in tuple or parens type");
+        adt::Error("failed to parse ( token in tuple or parens type",
+                   getLocation()));
   assert(eat(TokenKind::ParenOpen));
 
   if (check(TokenKind::ParenClose)) {
@@ -421,10 +399,9 @@ Parser::parseTupleOrParensType() {
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in tuple or parenthesized type: "
-                 << type.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type in tuple or parenthesized type",
+                    type.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
 
   if (check(TokenKind::ParenClose)) {
@@ -444,22 +421,22 @@ Parser::parseImplTraitTypeOneBound() {
 
   if (!checkKeyWord(KeyWordKind::KW_IMPL)) {
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse impl keyword in impl trait type one bound");
+        adt::Error("failed to parse impl keyword in impl trait type one bound",
+                   getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_IMPL));
 
   StringResult<std::shared_ptr<ast::types::TypeParamBound>> bound =
       parseTraitBound();
   if (!bound) {
-    llvm::errs() << "failed to parse trait bound in impl trait type one bound: "
-                 << bound.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse trait bound in impl trait type one bound",
+                    bound.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
   one.setBound(bound.getValue());
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      std::make_shared<ImplTraitTypeOneBound>(one));
+      context->create<ImplTraitTypeOneBound>(one));
 }
 
 StringResult<ast::types::ForLifetimes> Parser::parseForLifetimes() {
@@ -469,16 +446,16 @@ StringResult<ast::types::ForLifetimes> Parser::parseForLifetimes() {
 
   if (!checkKeyWord(KeyWordKind::KW_FOR)) {
     return StringResult<ast::types::ForLifetimes>(
-        "failed to parse for keyword in for lifetimes");
+        adt::Error("failed to parse for keyword in for lifetimes",
+                   getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_FOR));
 
   StringResult<ast::GenericParams> genericParams = parseGenericParams();
   if (!genericParams) {
-    llvm::errs() << "failed to parse generic params in for lifetimes: "
-                 << genericParams.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse generic params in for lifetimes",
+                    genericParams.getError()};
+    return StringResult<ast::types::ForLifetimes>(s);
   }
   forL.setGenericParams(genericParams.getValue());
 
@@ -493,7 +470,8 @@ Parser::parseImplType() {
 
   if (!checkKeyWord(KeyWordKind::KW_IMPL)) {
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse impl keyword in impl trait");
+        adt::Error("failed to parse impl keyword in impl trait",
+                   getLocation()));
   }
   assert(eatKeyWord(KeyWordKind::KW_IMPL));
 
@@ -513,10 +491,9 @@ Parser::parseImplType() {
       StringResult<std::shared_ptr<ast::types::TypeParamBound>> bound =
           parseTraitBound();
       if (!bound) {
-        llvm::errs() << "failed to parse trait bound in impl type: "
-                     << bound.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse trait bound in impl type",
+                        bound.getError()};
+        return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
       }
       if (check(TokenKind::Plus)) {
         recover(cp);
@@ -555,10 +532,9 @@ Parser::parseTraitObjectType() {
       StringResult<std::shared_ptr<ast::types::TypeParamBound>> bound =
           parseTraitBound();
       if (!bound) {
-        llvm::errs() << "failed to parse trait bound in trait object type: "
-                     << bound.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse trait bound in trait object type",
+                        bound.getError()};
+        return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
       }
       if (check(TokenKind::Plus)) {
         recover(cp);
@@ -577,22 +553,16 @@ Parser::parseArrayOrSliceType() {
 
   if (!check(TokenKind::SquareOpen)) {
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        "failed to parse array or slice type");
+        adt::Error("failed to parse array or slice type", getLocation()));
   }
 
   assert(eat(TokenKind::SquareOpen));
 
   StringResult<std::shared_ptr<ast::types::TypeExpression>> type = parseType();
   if (!type) {
-    llvm::errs() << "failed to parse type in array or slice type: "
-                 << type.getError() << "\n";
-    printFunctionStack();
     // exit(EXIT_FAILURE);
-    std::string s =
-        llvm::formatv(
-            "{0}\n{1}",
-            "failed to parse type in array or slice type: ", type.getError())
-            .str();
+    adt::Error s = {"failed to parse type in array or slice type",
+                    type.getError()};
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
   }
 
@@ -603,7 +573,7 @@ Parser::parseArrayOrSliceType() {
     slice.setType(type.getValue());
 
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<SliceType>(slice));
+        context->create<SliceType>(slice));
   } else if (check(TokenKind::Semi)) {
     // array type
     ArrayType arr = {loc};
@@ -611,7 +581,8 @@ Parser::parseArrayOrSliceType() {
 
     if (!check(TokenKind::Semi)) {
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          "failed to parse ; token in array or slice type");
+          adt::Error("failed to parse ; token in array or slice type",
+                     getLocation()));
     }
     assert(eat(TokenKind::Semi));
 
@@ -619,30 +590,25 @@ Parser::parseArrayOrSliceType() {
     StringResult<std::shared_ptr<ast::Expression>> expr =
         parseExpression({}, restrictions);
     if (!expr) {
-      llvm::errs() << "failed to parse expression in array or slice type: "
-                   << expr.getError() << "\n";
-      printFunctionStack();
       // exit(EXIT_FAILURE);
-      std::string s =
-          llvm::formatv("{0}\n{1}",
-                        "failed to parse expression in array or slice type: ",
-                        expr.getError())
-              .str();
+      adt::Error s = {"failed to parse expression in array or slice type",
+                      expr.getError()};
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(s);
     }
     arr.setExpression(expr.getValue());
 
     if (!check(TokenKind::SquareClose)) {
       return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-          "failed to parse ] token in array or slice type");
+          adt::Error("failed to parse ] token in array or slice type",
+                     getLocation()));
     }
     assert(eat(TokenKind::SquareClose));
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<ArrayType>(arr));
+        context->create<ArrayType>(arr));
   }
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      "failed to parse array or slice type");
+      adt::Error("failed to parse array or slice type", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>>
@@ -654,11 +620,11 @@ Parser::parseInferredType() {
   if (check(TokenKind::Underscore)) {
     assert(eat(TokenKind::Underscore));
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<InferredType>(infer));
+        context->create<InferredType>(infer));
   }
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      "failed to parse inferred type");
+      adt::Error("failed to parse inferred type", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeExpression>>
@@ -670,11 +636,11 @@ Parser::parseNeverType() {
   if (check(TokenKind::Not)) {
     assert(eat(TokenKind::Not));
     return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-        std::make_shared<NeverType>(never));
+        context->create<NeverType>(never));
   }
 
   return StringResult<std::shared_ptr<ast::types::TypeExpression>>(
-      "failed to parse never type");
+      adt::Error("failed to parse never type", getLocation()));
 }
 
 StringResult<ast::GenericArgs> Parser::parseGenericArgs() {
@@ -683,7 +649,7 @@ StringResult<ast::GenericArgs> Parser::parseGenericArgs() {
 
   if (!check(TokenKind::Lt)) {
     return StringResult<ast::GenericArgs>(
-        "failed to parse < token in generic args");
+        adt::Error("failed to parse < token in generic args", getLocation()));
   }
   assert(eat(TokenKind::Lt));
 
@@ -697,7 +663,7 @@ StringResult<ast::GenericArgs> Parser::parseGenericArgs() {
   while (true) {
     if (check(TokenKind::Eof)) {
       return StringResult<ast::GenericArgs>(
-          "failed to parse generic args: eof");
+          adt::Error("failed to parse generic args: eof", getLocation()));
     } else if (check(TokenKind::Gt)) {
       assert(eat(TokenKind::Gt));
       return StringResult<ast::GenericArgs>(args);
@@ -712,22 +678,17 @@ StringResult<ast::GenericArgs> Parser::parseGenericArgs() {
     } else {
       StringResult<ast::GenericArg> arg = parseGenericArg(last);
       if (!arg) {
-        llvm::errs() << "failed to parse generic arg in generic args: "
-                     << arg.getError() << "\n";
-        printFunctionStack();
         // exit(EXIT_FAILURE);
-        std::string s =
-            llvm::formatv(
-                "{0} {1}",
-                "failed to parse generic arg in generic args: ", arg.getError())
-                .str();
+        adt::Error s = {"failed to parse generic arg in generic args",
+                        arg.getError()};
         return StringResult<ast::GenericArgs>(s);
       }
       args.addArg(arg.getValue());
       last = arg.getValue().getKind();
     }
   }
-  return StringResult<ast::GenericArgs>("failed to parse generic args");
+  return StringResult<ast::GenericArgs>(
+      adt::Error("failed to parse generic args", getLocation()));
 }
 
 StringResult<ast::GenericArg>
@@ -739,10 +700,9 @@ Parser::parseGenericArg(std::optional<GenericArgKind> last) {
     // lifetime
     StringResult<ast::Lifetime> life = parseLifetimeAsLifetime();
     if (!life) {
-      llvm::errs() << "failed to parse lifetime as lifetime in generic arg: "
-                   << life.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse lifetime as lifetime in generic arg",
+                      life.getError()};
+      return StringResult<ast::GenericArg>(s);
     }
     arg.setLifetime(life.getValue());
     return StringResult<ast::GenericArg>(arg);
@@ -750,40 +710,36 @@ Parser::parseGenericArg(std::optional<GenericArgKind> last) {
     // binding
     StringResult<ast::GenericArgsBinding> bind = parseGenericArgsBinding();
     if (!bind) {
-      llvm::errs() << "failed to parse generic args binding in generic arg: "
-                   << bind.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic args binding in generic arg",
+                      bind.getError()};
+      return StringResult<ast::GenericArg>(s);
     }
     arg.setArgsBinding(bind.getValue());
     return StringResult<ast::GenericArg>(arg);
   } else if (checkLiteral()) {
     StringResult<ast::GenericArgsConst> constArgs = parseGenericArgsConst();
     if (!constArgs) {
-      llvm::errs() << "failed to parse generic args const in generic arg: "
-                   << constArgs.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic args const in generic arg",
+                      constArgs.getError()};
+      return StringResult<ast::GenericArg>(s);
     }
     arg.setArgsConst(constArgs.getValue());
     return StringResult<ast::GenericArg>(arg);
   } else if (check(TokenKind::Minus) && checkLiteral(1)) {
     StringResult<ast::GenericArgsConst> constArgs = parseGenericArgsConst();
     if (!constArgs) {
-      llvm::errs() << "failed to parse generic args const in generic arg: "
-                   << constArgs.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic args const in generic arg",
+                      constArgs.getError()};
+      return StringResult<ast::GenericArg>(s);
     }
     arg.setArgsConst(constArgs.getValue());
     return StringResult<ast::GenericArg>(arg);
   } else if (check(TokenKind::BraceOpen)) {
     StringResult<ast::GenericArgsConst> constArgs = parseGenericArgsConst();
     if (!constArgs) {
-      llvm::errs() << "failed to parse generic args const in generic arg: "
-                   << constArgs.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic args const in generic arg",
+                      constArgs.getError()};
+      return StringResult<ast::GenericArg>(s);
     }
     arg.setArgsConst(constArgs.getValue());
     return StringResult<ast::GenericArg>(arg);
@@ -791,13 +747,7 @@ Parser::parseGenericArg(std::optional<GenericArgKind> last) {
     StringResult<std::shared_ptr<ast::types::TypeExpression>> type =
         parseType();
     if (!type) {
-      llvm::errs() << "failed to parse type in generic arg: " << type.getError()
-                   << "\n";
-      printFunctionStack();
-      std::string s =
-          llvm::formatv("{0} {1}", "failed to parse type in generic arg: ",
-                        type.getError())
-              .str();
+      adt::Error s = {"failed to parse type in generic arg", type.getError()};
       // exit(EXIT_FAILURE);
       return StringResult<ast::GenericArg>(s);
     }
@@ -806,25 +756,24 @@ Parser::parseGenericArg(std::optional<GenericArgKind> last) {
   } else if (checkSimplePathSegment() && check(TokenKind::Comma, 1)) {
     StringResult<ast::GenericArgsConst> constArgs = parseGenericArgsConst();
     if (!constArgs) {
-      llvm::errs() << "failed to parse generic args const in generic arg: "
-                   << constArgs.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic args const in generic arg",
+                      constArgs.getError()};
+      return StringResult<ast::GenericArg>(s);
     }
     arg.setArgsConst(constArgs.getValue());
     return StringResult<ast::GenericArg>(arg);
   } else if (checkSimplePathSegment() && check(TokenKind::Lt, 1)) {
     StringResult<ast::GenericArgsConst> constArgs = parseGenericArgsConst();
     if (!constArgs) {
-      llvm::errs() << "failed to parse generic args const in generic arg: "
-                   << constArgs.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse generic args const in generic arg",
+                      constArgs.getError()};
+      return StringResult<ast::GenericArg>(s);
     }
     arg.setArgsConst(constArgs.getValue());
     return StringResult<ast::GenericArg>(arg);
   }
-  return StringResult<ast::GenericArg>("failed to parse generic arg");
+  return StringResult<ast::GenericArg>(
+      adt::Error("failed to parse generic arg", getLocation()));
 }
 
 StringResult<std::shared_ptr<ast::types::TypeParamBound>>
@@ -838,10 +787,9 @@ Parser::parseTypeParamBound() {
     StringResult<std::shared_ptr<ast::types::TypeParamBound>> trait =
         parseTraitBound();
     if (!trait) {
-      llvm::errs() << "failed to parse trait bound in type param bound: "
-                   << trait.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse trait bound in type param bound",
+                      trait.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
     }
     return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
         trait.getValue());
@@ -849,10 +797,9 @@ Parser::parseTypeParamBound() {
     StringResult<std::shared_ptr<ast::types::TypeParamBound>> trait =
         parseTraitBound();
     if (!trait) {
-      llvm::errs() << "failed to parse trait bound in type param bound: "
-                   << trait.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse trait bound in type param bound",
+                      trait.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
     }
     return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
         trait.getValue());
@@ -860,10 +807,9 @@ Parser::parseTypeParamBound() {
     StringResult<std::shared_ptr<ast::types::TypeParamBound>> trait =
         parseTraitBound();
     if (!trait) {
-      llvm::errs() << "failed to parse trait bound in type param bound: "
-                   << trait.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse trait bound in type param bound",
+                      trait.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
     }
     return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
         trait.getValue());
@@ -871,10 +817,9 @@ Parser::parseTypeParamBound() {
     StringResult<std::shared_ptr<ast::types::TypeParamBound>> trait =
         parseTraitBound();
     if (!trait) {
-      llvm::errs() << "failed to parse trait bound in type param bound: "
-                   << trait.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse trait bound in type param bound",
+                      trait.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
     }
     return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
         trait.getValue());
@@ -882,10 +827,9 @@ Parser::parseTypeParamBound() {
     StringResult<std::shared_ptr<ast::types::TypeParamBound>> trait =
         parseTraitBound();
     if (!trait) {
-      llvm::errs() << "failed to parse trait bound in type param bound: "
-                   << trait.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse trait bound in type param bound",
+                      trait.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
     }
     return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
         trait.getValue());
@@ -894,11 +838,10 @@ Parser::parseTypeParamBound() {
   StringResult<std::shared_ptr<ast::types::TypeParamBound>> life =
       parseLifetimeAsTypeParamBound();
   if (!life) {
-    llvm::errs()
-        << "failed to parse lifetime as type param bound in type param bound: "
-        << life.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse lifetime as type param bound in type "
+                    "param bound",
+                    life.getError()};
+    return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
   }
   return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
       life.getValue());
@@ -915,10 +858,9 @@ StringResult<ast::types::TypeParamBounds> Parser::parseTypeParamBounds() {
   StringResult<std::shared_ptr<ast::types::TypeParamBound>> first =
       parseTypeParamBound();
   if (!first) {
-    llvm::errs() << "failed to parse type param bound in type param bounds: "
-                 << first.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse type param bound in type param bounds",
+                    first.getError()};
+    return StringResult<ast::types::TypeParamBounds>(s);
   }
   bounds.addTypeParamBound(first.getValue());
 
@@ -927,7 +869,7 @@ StringResult<ast::types::TypeParamBounds> Parser::parseTypeParamBounds() {
     if (check(TokenKind::Eof)) {
       // abort
       return StringResult<ast::types::TypeParamBounds>(
-          "failed to parse type param bounds: eof");
+          adt::Error("failed to parse type param bounds: eof", getLocation()));
     } else if (check(TokenKind::Semi) || check(TokenKind::Comma) ||
                check(TokenKind::BraceOpen) || check(TokenKind::Gt)) {
       return StringResult<ast::types::TypeParamBounds>(bounds);
@@ -946,11 +888,9 @@ StringResult<ast::types::TypeParamBounds> Parser::parseTypeParamBounds() {
       StringResult<std::shared_ptr<ast::types::TypeParamBound>> type =
           parseTypeParamBound();
       if (!type) {
-        llvm::errs()
-            << "failed to parse type param bound in type param bounds: "
-            << type.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse type param bound in type param bounds",
+                        type.getError()};
+        return StringResult<ast::types::TypeParamBounds>(s);
       }
       bounds.addTypeParamBound(type.getValue());
     } else {
@@ -959,11 +899,11 @@ StringResult<ast::types::TypeParamBounds> Parser::parseTypeParamBounds() {
                    << "\n";
       llvm::errs() << Token2String(getToken().getKind()) << "\n";
       return StringResult<ast::types::TypeParamBounds>(
-          "failed to parse type param bounds");
+          adt::Error("failed to parse type param bounds", getLocation()));
     }
   }
   return StringResult<ast::types::TypeParamBounds>(
-      "failed to parse type param bounds");
+      adt::Error("failed to parse type param bounds", getLocation()));
 }
 
 PathKind Parser::testTypePathOrSimplePath() {
@@ -1135,28 +1075,27 @@ Parser::parseTraitBound() {
     if (checkKeyWord(KeyWordKind::KW_FOR)) {
       StringResult<ast::types::ForLifetimes> forL = parseForLifetimes();
       if (!forL) {
-        llvm::errs() << "failed to parse for life times in trait bound: "
-                     << forL.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse for life times in trait bound",
+                        forL.getError()};
+        return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
       }
       tr.setForLifetimes(forL.getValue());
     }
     StringResult<std::shared_ptr<ast::types::TypeExpression>> path =
         parseTypePath();
     if (!path) {
-      llvm::errs() << "failed to parse type path in trait bound: "
-                   << path.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type path in trait bound",
+                      path.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
     }
     tr.setTypePath(path.getValue());
     if (!check(TokenKind::ParenClose))
       return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
-          "failed to parse trait bound ;missing ): ");
+          adt::Error("failed to parse trait bound ;missing ): ",
+                     getLocation()));
     assert(eat(TokenKind::ParenClose));
     return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
-        std::make_shared<TraitBound>(tr));
+        context->create<TraitBound>(tr));
   } else if (!check(TokenKind::ParenOpen)) {
     if (check(TokenKind::QMark)) {
       assert(eat(TokenKind::QMark));
@@ -1166,10 +1105,9 @@ Parser::parseTraitBound() {
     if (checkKeyWord(KeyWordKind::KW_FOR)) {
       StringResult<ast::types::ForLifetimes> forL = parseForLifetimes();
       if (!forL) {
-        llvm::errs() << "failed to parse for life times in trait bound: "
-                     << forL.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse for life times in trait bound",
+                        forL.getError()};
+        return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
       }
       tr.setForLifetimes(forL.getValue());
     }
@@ -1177,21 +1115,20 @@ Parser::parseTraitBound() {
     StringResult<std::shared_ptr<ast::types::TypeExpression>> path =
         parseTypePath();
     if (!path) {
-      llvm::errs() << "failed to parse type path in trait bound: "
-                   << path.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse type path in trait bound",
+                      path.getError()};
+      return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(s);
     }
     tr.setTypePath(path.getValue());
     return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
-        std::make_shared<TraitBound>(tr));
+        context->create<TraitBound>(tr));
   } else {
     return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
-        "failed to parse trait bound: ");
+        adt::Error("failed to parse trait bound: ", getLocation()));
   }
 
   return StringResult<std::shared_ptr<ast::types::TypeParamBound>>(
-      "failed to parse trait bound: ");
+      adt::Error("failed to parse trait bound: ", getLocation()));
 }
 
 } // namespace rust_compiler::parser
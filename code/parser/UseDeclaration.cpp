@@ -25,21 +25,21 @@ Parser::parseUseDeclaration(std::span<OuterAttribute> outer,
     assert(eatKeyWord(KeyWordKind::KW_USE));
   } else {
     return StringResult<std::shared_ptr<ast::Item>>(
-        "failed to parse use keyword in use declarion");
+        adt::Error("failed to parse use keyword in use declarion",
+                   getLocation()));
   }
 
   StringResult<ast::use_tree::UseTree> tree = parseUseTree();
   if (!tree) {
-    llvm::errs() << "failed to parse simple path in macro invocation item: "
-                 << tree.getError() << "\n";
-    printFunctionStack();
-    exit(EXIT_FAILURE);
+    adt::Error s = {"failed to parse simple path in macro invocation item",
+                    tree.getError()};
+    return StringResult<std::shared_ptr<ast::Item>>(s);
   }
 
   use.setTree(tree.getValue());
 
   return StringResult<std::shared_ptr<ast::Item>>(
-      std::make_shared<UseDeclaration>(use));
+      context->create<UseDeclaration>(use));
 }
 
 } // namespace rust_compiler::parser
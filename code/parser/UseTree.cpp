@@ -63,10 +63,9 @@ StringResult<ast::use_tree::UseTree> Parser::parseUseTree() {
     while (true) {
       StringResult<ast::use_tree::UseTree> useTree = parseUseTree();
       if (!useTree) {
-        llvm::errs() << "failed to parse use tree in use tree: "
-                     << useTree.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse use tree in use tree",
+                        useTree.getError()};
+        return StringResult<ast::use_tree::UseTree>(s);
       }
       tree.addTree(useTree.getValue());
 
@@ -88,7 +87,7 @@ StringResult<ast::use_tree::UseTree> Parser::parseUseTree() {
       } else if (check(TokenKind::Eof)) {
         // abort
         return StringResult<ast::use_tree::UseTree>(
-            "failed to parse use tree: eof");
+            adt::Error("failed to parse use tree: eof", getLocation()));
       }
     }
   } else if (check(TokenKind::BraceOpen) && check(TokenKind::BraceClose, 1)) {
@@ -105,10 +104,9 @@ StringResult<ast::use_tree::UseTree> Parser::parseUseTree() {
     while (true) {
       StringResult<ast::use_tree::UseTree> useTree = parseUseTree();
       if (!useTree) {
-        llvm::errs() << "failed to parse use tree in use tree: "
-                     << useTree.getError() << "\n";
-        printFunctionStack();
-        exit(EXIT_FAILURE);
+        adt::Error s = {"failed to parse use tree in use tree",
+                        useTree.getError()};
+        return StringResult<ast::use_tree::UseTree>(s);
       }
       if (check(TokenKind::BraceClose)) {
         assert(eat(TokenKind::BraceClose));
@@ -128,17 +126,16 @@ StringResult<ast::use_tree::UseTree> Parser::parseUseTree() {
       } else if (check(TokenKind::Eof)) {
         // abort
         return StringResult<ast::use_tree::UseTree>(
-            "failed to parse use tree: eof");
+            adt::Error("failed to parse use tree: eof", getLocation()));
       }
     }
   } else {
     // parse simplepath
     StringResult<ast::SimplePath> simple = parseSimplePath();
     if (!simple) {
-      llvm::errs() << "failed to parse simple block in use tree: "
-                   << simple.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
+      adt::Error s = {"failed to parse simple block in use tree",
+                      simple.getError()};
+      return StringResult<ast::use_tree::UseTree>(s);
     }
     tree.setPath(simple.getValue());
     // check next token
@@ -157,10 +154,9 @@ StringResult<ast::use_tree::UseTree> Parser::parseUseTree() {
       while (true) {
         StringResult<ast::use_tree::UseTree> useTree = parseUseTree();
         if (!useTree) {
-          llvm::errs() << "failed to parse use tree in use tree: "
-                       << simple.getError() << "\n";
-          printFunctionStack();
-          exit(EXIT_FAILURE);
+          adt::Error s = {"failed to parse use tree in use tree",
+                          simple.getError()};
+          return StringResult<ast::use_tree::UseTree>(s);
         }
         if (check(TokenKind::BraceClose)) {
           assert(eat(TokenKind::BraceClose));
@@ -181,7 +177,7 @@ StringResult<ast::use_tree::UseTree> Parser::parseUseTree() {
         } else if (check(TokenKind::Eof)) {
           // abort
           return StringResult<ast::use_tree::UseTree>(
-              "failed to parse use tree: eof");
+              adt::Error("failed to parse use tree: eof", getLocation()));
         }
       }
     } else if (checkKeyWord(KeyWordKind::KW_AS)) {
@@ -207,7 +203,8 @@ StringResult<ast::use_tree::UseTree> Parser::parseUseTree() {
       return StringResult<ast::use_tree::UseTree>(tree);
     }
   }
-  return StringResult<ast::use_tree::UseTree>("failed to parse use tree");
+  return StringResult<ast::use_tree::UseTree>(
+      adt::Error("failed to parse use tree", getLocation()));
 }
 
 } // namespace rust_compiler::parser
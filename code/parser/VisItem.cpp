@@ -12,16 +12,18 @@ using namespace llvm;
 namespace rust_compiler::parser {
 
 bool Parser::checkVisItem() {
-  if (checkKeyWord(KeyWordKind::KW_PUB)) {
-    StringResult<ast::Visibility> vis = parseVisibility();
-    if (!vis) {
-      llvm::errs() << "failed to parse visibility in check visitem: "
-                   << vis.getError() << "\n";
-      printFunctionStack();
-      exit(EXIT_FAILURE);
-    }
-  }
+  if (!checkKeyWord(KeyWordKind::KW_PUB))
+    return checkVisItemWithoutVisibility();
+
+  // look past the visibility; parseVisItem parses it again
+  CheckPoint cp = getCheckPoint();
+  StringResult<ast::Visibility> vis = parseVisibility();
+  bool isVisItem = vis && checkVisItemWithoutVisibility();
+  recover(cp);
+  return isVisItem;
+}
 
+bool Parser::checkVisItemWithoutVisibility() {
 //  llvm::errs() << "checkVisItem: "
 //               << KeyWord2String(getToken().getKeyWordKind()) << "\n";
 //  llvm::errs() << "checkVisItem: " << Token2String(getToken().getKind())
@@ -38,6 +38,9 @@ void AttributeChecker::checkItem(Item *item) {
   case ItemKind::MacroItem: {
     assert(false);
   }
+  case ItemKind::ErrorItem: {
+    break;
+  }
   }
 }
 
@@ -36,6 +36,9 @@ void Sema::analyzeStatements(ast::Statements stmts) {
           std::static_pointer_cast<MacroInvocationSemiStatement>(stmt));
       return;
     }
+    case StatementKind::ErrorStatement: {
+      return;
+    }
     }
   }
 }
@@ -124,6 +124,9 @@ static void runStatement(std::shared_ptr<ast::Statement> stmt,
         std::static_pointer_cast<Statement>(stmt));
     break;
   }
+  case StatementKind::ErrorStatement: {
+    break;
+  }
   }
 }
 
@@ -303,6 +303,9 @@ bool Sema::isConstantStatement(ast::Statement *stmt) {
   case StatementKind::MacroInvocationSemi: {
     assert(false);
   }
+  case StatementKind::ErrorStatement: {
+    return false;
+  }
   }
 }
 
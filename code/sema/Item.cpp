@@ -19,6 +19,9 @@ void Sema::walkItem(std::shared_ptr<ast::Item> item) {
   case ItemKind::MacroItem: {
     break;
   }
+  case ItemKind::ErrorItem: {
+    break;
+  }
   }
 }
 
@@ -79,6 +79,9 @@ void visitStatement(std::shared_ptr<ast::Statement> stmt,
   case StatementKind::MacroInvocationSemi: {
     break;
   }
+  case StatementKind::ErrorStatement: {
+    break;
+  }
   }
 }
 
@@ -202,6 +205,9 @@ void visitItem(std::shared_ptr<ast::Item> item, ItemVisitor *visitor) {
   case ItemKind::MacroItem: {
     break;
   }
+  case ItemKind::ErrorItem: {
+    break;
+  }
   }
 }
 
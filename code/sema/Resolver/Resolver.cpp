@@ -101,6 +101,9 @@ void Resolver::resolveItemNoRecurse(std::shared_ptr<ast::Item> item,
                               canonicalPrefix);
     break;
   }
+  case ItemKind::ErrorItem: {
+    break;
+  }
   }
 }
 
@@ -118,6 +121,9 @@ void Resolver::resolveItem(std::shared_ptr<ast::Item> item,
                      canonicalPrefix);
     break;
   }
+  case ItemKind::ErrorItem: {
+    break;
+  }
   }
 }
 
@@ -175,6 +181,9 @@ void Resolver::resolveCrate(std::shared_ptr<ast::Crate> crate) {
                        CanonicalPath::createEmpty(), cratePrefix);
       break;
     }
+    case ItemKind::ErrorItem: {
+      break;
+    }
     }
   }
 
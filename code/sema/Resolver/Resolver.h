@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ADT/CanonicalPath.h"
+#include "ADT/NodeIdMap.h"
 #include "AST/ArithmeticOrLogicalExpression.h"
 #include "AST/ArrayExpression.h"
 #include "AST/AssociatedItem.h"
@@ -717,8 +718,8 @@ private:
   std::map<basic::NodeId, std::set<basic::NodeId>> closureCaptureMappings;
 
   // resolved items: reference -> definition
-  std::map<basic::NodeId, basic::NodeId> resolvedNames;
-  std::map<basic::NodeId, basic::NodeId> resolvedTypes;
+  adt::NodeIdMap<basic::NodeId> resolvedNames;
+  adt::NodeIdMap<basic::NodeId> resolvedTypes;
   std::map<basic::NodeId, basic::NodeId> resolvedLabels;
   std::map<basic::NodeId, basic::NodeId> resolvedMacros;
   std::map<basic::NodeId, basic::NodeId> miscResolvedItems;
@@ -41,6 +41,9 @@ void Resolver::resolveStatement(std::shared_ptr<ast::Statement> stmt,
     assert(false && "to be handled later");
     break;
   }
+  case StatementKind::ErrorStatement: {
+    break;
+  }
   }
 }
 
@@ -373,6 +373,9 @@ void ReturnExpressionSearcher::visitStatement(ast::Statement *stmt) {
     assert(false);
     break;
   }
+  case StatementKind::ErrorStatement: {
+    break;
+  }
   }
 }
 
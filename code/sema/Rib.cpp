@@ -11,7 +11,7 @@ StringResult<NodeId> Rib::insert(std::string_view name,
   bool existed = !res.second;
 
   if (existed && !canShadow)
-    return StringResult<basic::NodeId>(std::string("shadowed insert"));
+    return StringResult<basic::NodeId>(adt::Error("shadowed insert"));
 
   return StringResult<NodeId>(insertedId);
 }
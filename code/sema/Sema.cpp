@@ -93,6 +93,9 @@ void Sema::analyze(std::shared_ptr<ast::Crate> &crate) {
       case ItemKind::MacroItem: {
         break;
       }
+      case ItemKind::ErrorItem: {
+        break;
+      }
       }
       }
     }
@@ -44,11 +44,14 @@ TypeResolver::checkMethodCallExpression(ast::MethodCallExpression *method) {
 
   methodCallReceiver = adt;
   methodCallFunQuery = method->getPath().getIdent().getIdentifier();
-  tcx->iterateAssociatedItems([&](NodeId id, ast::Implementation *item,
-                                  ast::AssociatedItem *impl) mutable -> bool {
-    collectMethodCallCandidates(id, item, impl);
-    return true;
-  });
+  tcx->iterateAssociatedItemsFor(
+      adt,
+      [&](ast::Implementation *impl) { return queryImplementationType(impl); },
+      [&](NodeId id, ast::Implementation *item,
+          ast::AssociatedItem *impl) mutable -> bool {
+        collectMethodCallCandidates(id, item, impl);
+        return true;
+      });
 
   llvm::errs() << "found candidates: " << methodCallCandidates.size() << "\n";
   for (auto &candi : methodCallCandidates) {
@@ -52,7 +52,7 @@ TyTy::BaseType *TypeResolver::checkClosureExpression(
   }
 
   NodeId implicitArgsId = basic::getNextNodeId();
-  TyTy::TupleType *closureArgs = new TyTy::TupleType(
+  TyTy::TupleType *closureArgs = tcx->create<TyTy::TupleType>(
       implicitArgsId, closure->getLocation(), parameterTypes);
 
   tcx->insertImplicitType(implicitArgsId, closureArgs);
@@ -78,7 +78,7 @@ TyTy::BaseType *TypeResolver::checkClosureExpression(
 
   std::set<NodeId> captures = tcx->getCaptures(closure->getNodeId());
 
-  TyTy::BaseType *result = new TyTy::ClosureType(
+  TyTy::BaseType *result = tcx->create<TyTy::ClosureType>(
       closure->getNodeId(), ident, closureArgs, resultType, substRfs, captures);
 
   // FIXME
@@ -97,9 +97,10 @@ TypeResolver::inferClosureParam(patterns::PatternNoTopAlt *noTop) {
       assert(false);
     }
     case PatternWithoutRangeKind::IdentifierPattern: {
-      return new TyTy::InferType(noTop->getNodeId(), TyTy::InferKind::General,
-                                 TyTy::TypeHint::unknown(),
-                                 noTop->getLocation());
+      return tcx->create<TyTy::InferType>(noTop->getNodeId(),
+                                          TyTy::InferKind::General,
+                                          TyTy::TypeHint::unknown(),
+                                          noTop->getLocation());
     }
     case PatternWithoutRangeKind::WildcardPattern: {
       assert(false);
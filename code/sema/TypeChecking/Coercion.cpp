@@ -20,7 +20,7 @@ CoercionResult Coercion::coercion(TyTy::BaseType *receiver,
   if (receiver->getKind() == TyTy::TypeKind::Never)
     success = coerceToNever(receiver, expected);
 
-  TyTy::BaseType *result = Unification::unifyWithSite(
+  TyTy::BaseType *result = Unification::tryUnifyWithSite(
       TyTy::WithLocation(expected), TyTy::WithLocation(receiver), loc, context);
   if (result->getKind() != TyTy::TypeKind::Error)
     return CoercionResult({}, result);
@@ -179,7 +179,7 @@ TyTy::BaseType *TypeResolver::checkExpressionWithoutBlock(
   }
   case ExpressionWithoutBlockKind::MacroInvocation: {
     // assert(false && "to be implemented");
-    return new TyTy::ErrorType(0);
+    return tcx->create<TyTy::ErrorType>(0);
   }
   }
 }
@@ -205,7 +205,7 @@ TyTy::BaseType *TypeResolver::checkBlockExpression(
       llvm::errs() << "failed to resolve type: " << s->getLocation().toString()
                    << "\n";
       // report error
-      return new TyTy::ErrorType(block->getNodeId());
+      return tcx->create<TyTy::ErrorType>(block->getNodeId());
     }
 
     // if (s->getKind() == StatementKind::ExpressionStatement) {
@@ -220,7 +220,7 @@ TyTy::BaseType *TypeResolver::checkBlockExpression(
   if (stmts.hasTrailing())
     return checkExpression(stmts.getTrailing());
   else if (containsReturnExpression(block.get()))
-    return new TyTy::NeverType(block->getNodeId());
+    return tcx->create<TyTy::NeverType>(block->getNodeId());
 
   // FIXME
   return TyTy::TupleType::getUnitType(block->getNodeId());
@@ -287,7 +287,7 @@ TyTy::BaseType *TypeResolver::checkArithmeticOrLogicalExpression(
     llvm::errs() << arith->getLocation().toString()
                  << "cannot apply this operator to the given types"
                  << "\n";
-    return new TyTy::ErrorType(arith->getNodeId());
+    return tcx->create<TyTy::ErrorType>(arith->getNodeId());
   }
 
   switch (arith->getKind()) {
@@ -324,7 +324,7 @@ TyTy::BaseType *TypeResolver::checkReturnExpression(
       TyTy::WithLocation(functionReturnTye), TyTy::WithLocation(ty, loc),
       ret->getLocation(), tcx);
 
-  return new TyTy::NeverType(ret->getNodeId());
+  return tcx->create<TyTy::NeverType>(ret->getNodeId());
 }
 
 bool TypeResolver::validateArithmeticType(
@@ -591,7 +591,7 @@ TyTy::BaseType *TypeResolver::checkCallExpression(TyTy::BaseType *functionType,
   case TyTy::TypeKind::Projection:
   case TyTy::TypeKind::Dynamic:
   case TyTy::TypeKind::Closure:
-    return new TyTy::ErrorType(0);
+    return tcx->create<TyTy::ErrorType>(0);
   }
   llvm_unreachable("unknown type kind");
 }
@@ -733,7 +733,8 @@ TypeResolver::checkFunctionTraitCall(CallExpression *expr,
       Location::getEmptyLocation()};
 
   TyTy::TupleType *tuple =
-      new TyTy::TupleType(implicitArgId, expr->getLocation(), callArgs);
+      tcx->create<TyTy::TupleType>(implicitArgId, expr->getLocation(),
+                                   callArgs);
   tcx->insertImplicitType(implicitArgId, tuple);
 
   std::vector<TyTy::Argument> args;
@@ -841,9 +842,9 @@ TypeResolver::checkArrayExpression(std::shared_ptr<ast::ArrayExpression> arr) {
       break;
     }
     }
-    return new TyTy::ArrayType(arr->getNodeId(), arr->getLocation(),
-                               capacityExpr,
-                               TyTy::TypeVariable(elementType->getReference()));
+    return tcx->create<TyTy::ArrayType>(
+        arr->getNodeId(), arr->getLocation(), capacityExpr,
+        TyTy::TypeVariable(elementType->getReference()));
   }
   assert(false);
 }
@@ -872,9 +873,9 @@ TyTy::BaseType *TypeResolver::checkBorrowExpression(
     }
   }
 
-  return new TyTy::ReferenceType(borrow->getNodeId(),
-                                 TyTy::TypeVariable(base->getReference()),
-                                 borrow->getMutability());
+  return tcx->create<TyTy::ReferenceType>(
+      borrow->getNodeId(), TyTy::TypeVariable(base->getReference()),
+      borrow->getMutability());
 }
 
 TyTy::BaseType *
@@ -1162,7 +1163,7 @@ TyTy::BaseType *TypeResolver::checkCompoundAssignmentExpression(
     return TyTy::TupleType::getUnitType(compound->getNodeId());
   }
 
-  return new TyTy::ErrorType(0);
+  return tcx->create<TyTy::ErrorType>(0);
 }
 
 bool TypeResolver::validateArithmeticType(
@@ -1381,7 +1382,8 @@ TyTy::BaseType *TypeResolver::checkTupleExpression(
     fields.push_back(TyTy::TypeVariable(fieldType->getReference()));
   }
 
-  return new TyTy::TupleType(tuple->getNodeId(), tuple->getLocation(), std::move(fields));
+  return tcx->create<TyTy::TupleType>(tuple->getNodeId(), tuple->getLocation(),
+                                      std::move(fields));
 }
 
 } // namespace rust_compiler::sema::type_checking
@@ -92,8 +92,8 @@ void TypeResolver::checkFunction(std::shared_ptr<ast::Function> f) {
   if (f->getQualifiers().hasExtern())
     flags |= FunctionType::FunctionTypeIsExtern;
   TyTy::FunctionType *funType =
-      new TyTy::FunctionType(f->getNodeId(), f->getName(), identity, flags,
-                             params, retType, substitutions);
+      tcx->create<TyTy::FunctionType>(f->getNodeId(), f->getName(), identity,
+                                      flags, params, retType, substitutions);
 
   tcx->insertType(f->getIdentity(), funType);
 
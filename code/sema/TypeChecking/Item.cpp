@@ -157,8 +157,9 @@ void TypeResolver::checkStructStruct(ast::StructStruct *s) {
 
   // parse #[repr(X)]
   TyTy::BaseType *type =
-      new TyTy::ADTType(s->getNodeId(), s->getIdentifier(), ident,
-                        TyTy::ADTKind::StructStruct, variants, substitutions);
+      tcx->create<TyTy::ADTType>(s->getNodeId(), s->getIdentifier(), ident,
+                                 TyTy::ADTKind::StructStruct, variants,
+                                 substitutions);
 
   tcx->insertType(s->getIdentity(), type);
 }
@@ -198,8 +199,9 @@ void TypeResolver::checkTupleStruct(ast::TupleStruct *s) {
   // parse #[rept(X)]
 
   TyTy::BaseType *type =
-      new TyTy::ADTType(s->getNodeId(), s->getName(), ident,
-                        TyTy::ADTKind::TupleStruct, variants, substitutions);
+      tcx->create<TyTy::ADTType>(s->getNodeId(), s->getName(), ident,
+                                 TyTy::ADTKind::TupleStruct, variants,
+                                 substitutions);
 
   tcx->insertType(s->getIdentity(), type);
 }
@@ -401,19 +403,19 @@ TyTy::BaseType *TypeResolver::resolveTraitImplSelf(TraitImpl *impl) {
 void TypeResolver::validateTraitImplBlock(
     TraitImpl *impl, TyTy::BaseType *self,
     std::vector<TyTy::SubstitutionParamMapping> &substitutions) {
-  assert(false);
+  TyTy::TraitReference *traitReference = resolveTraitPath(
+      std::static_pointer_cast<ast::types::TypePath>(impl->getTypePath()));
+  if (traitReference->isError())
+    return;
+
+  TyTy::TypeBoundPredicate specifiedBound =
+      getPredicateFromBound(impl->getTypePath(), impl->getType().get());
 
-  //  if (is_trait_impl_block) {
-  //    trait_reference->clear_associated_types();
-
-  //    AssociatedImplTrait associated(trait_reference, specified_bound,
-  //                                   &impl_block, self, context);
-  //    tcx->insertAssociatedTraitImpl(impl_block.get_mappings().get_hirid(),
-  //                                          std::move(associated));
-  //    tcx->insertAssociatedImplMapping(
-  //        trait_reference->get_mappings().get_hirid(), self,
-  //        impl_block.get_mappings().get_hirid());
-  //  }
+  tcx->insertAssociatedTraitImpl(
+      impl->getNodeId(),
+      AssociatedImplTrait(traitReference, specifiedBound, impl, self, tcx));
+  tcx->insertAssociatedImplMapping(traitReference->getNodeId(), self,
+                                   impl->getNodeId());
 }
 
 void TypeResolver::validateInherentImplBlock(
@@ -502,11 +504,11 @@ TyTy::BaseType *TypeResolver::checkImplementationFunction(
       if ((!hand->isMut() && !hand->isAnd()) || hand->isMut()) {
         selfType = self->clone();
       } else if (hand->isAnd() && !hand->isMut()) {
-        selfType = new TyTy::ReferenceType(
+        selfType = tcx->create<TyTy::ReferenceType>(
             selfParam.getNodeId(), TyTy::TypeVariable(self->getReference()),
             Mutability::Imm);
       } else if (hand->isAnd() && hand->isMut()) {
-        selfType = new TyTy::ReferenceType(
+        selfType = tcx->create<TyTy::ReferenceType>(
             selfParam.getNodeId(), TyTy::TypeVariable(self->getReference()),
             Mutability::Mut);
       }
@@ -545,7 +547,7 @@ TyTy::BaseType *TypeResolver::checkImplementationFunction(
 
   TypeIdentity ident = {*canon, fun->getLocation()};
 
-  TyTy::FunctionType *funType = new TyTy::FunctionType(
+  TyTy::FunctionType *funType = tcx->create<TyTy::FunctionType>(
       fun->getNodeId(), fun->getName(), ident,
       fun->isMethod() ? TyTy::FunctionType::FunctionTypeIsMethod
                       : TyTy::FunctionType::FunctionTypeDefaultFlags,
@@ -601,9 +603,10 @@ void TypeResolver::checkEnumeration(ast::Enumeration *enu) {
   TypeIdentity ident = {*path, enu->getLocation()};
 
   TyTy::BaseType *type =
-      new TyTy::ADTType(enu->getNodeId(), rust_compiler::basic::getNextNodeId(),
-                        enu->getName(), ident, TyTy::ADTKind::Enum,
-                        std::move(variants), std::move(substitutions));
+      tcx->create<TyTy::ADTType>(enu->getNodeId(),
+                                 rust_compiler::basic::getNextNodeId(),
+                                 enu->getName(), ident, TyTy::ADTKind::Enum,
+                                 std::move(variants), std::move(substitutions));
 
   tcx->insertType(enu->getIdentity(), type);
 }
@@ -724,7 +727,7 @@ TypeResolver::checkEnumItemDiscriminant(const EnumItemDiscriminant &enuItem,
   TyTy::BaseType *capacityType = checkExpression(enuItem.getExpression());
 
   TyTy::ISizeType *expectedType =
-      new TyTy::ISizeType(enuItem.getExpression()->getNodeId());
+      tcx->create<TyTy::ISizeType>(enuItem.getExpression()->getNodeId());
   tcx->insertType(enuItem.getExpression()->getIdentity(), expectedType);
 
   Unification::unifyWithSite(
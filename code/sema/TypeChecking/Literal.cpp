@@ -18,7 +18,7 @@ TypeResolver::checkLiteral(std::shared_ptr<ast::LiteralExpression> lit) {
   }
   case ast::LiteralExpressionKind::StringLiteral: {
     TyTy::BaseType *builtin = tcx->lookupBuiltin("str");
-    return new ReferenceType(
+    return tcx->create<TyTy::ReferenceType>(
         lit->getNodeId(),
         TyTy::TypeVariable(builtin->getReference()), basic::Mutability::Imm);
   }
@@ -36,8 +36,10 @@ TypeResolver::checkLiteral(std::shared_ptr<ast::LiteralExpression> lit) {
   }
   case ast::LiteralExpressionKind::IntegerLiteral: {
     /// need size and signess hints and integral
-    return new TyTy::InferType(lit->getNodeId(), TyTy::InferKind::Integral,
-                               TyTy::TypeHint::unknown(), lit->getLocation());
+    return tcx->create<TyTy::InferType>(lit->getNodeId(),
+                                        TyTy::InferKind::Integral,
+                                        TyTy::TypeHint::unknown(),
+                                        lit->getLocation());
   }
   case ast::LiteralExpressionKind::FloatLiteral: {
     assert(false && "to be implemented");
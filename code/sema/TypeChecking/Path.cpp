@@ -111,7 +111,7 @@ TyTy::BaseType *TypeResolver::resolveRootPathExpression(
     if (!lookup) {
       llvm::errs() << "failed to resolve root path3: "
                    << path->getLocation().toString() << "\n";
-      return new TyTy::ErrorType(path->getNodeId());
+      return tcx->create<TyTy::ErrorType>(path->getNodeId());
     }
     *offset = 1;
     return *lookup;
@@ -144,7 +144,7 @@ TyTy::BaseType *TypeResolver::resolveRootPathExpression(
       llvm::errs() << "failed to resolve root segment1: "
                    << seg.getLocation().toString() << "\n";
       llvm::errs() << seg.getNodeId() << "\n";
-      return new TyTy::ErrorType(path->getNodeId());
+      return tcx->create<TyTy::ErrorType>(path->getNodeId());
     }
 
     bool segmentIsModule = tcx->isModule(seg.getNodeId());
@@ -157,7 +157,7 @@ TyTy::BaseType *TypeResolver::resolveRootPathExpression(
       }
 
       llvm::errs() << "expected value:" << seg.getLocation().toString() << "\n";
-      return new TyTy::ErrorType(path->getNodeId());
+      return tcx->create<TyTy::ErrorType>(path->getNodeId());
     }
 
     std::optional<TyTy::BaseType *> lookup = queryType(seg.getNodeId());
@@ -165,7 +165,7 @@ TyTy::BaseType *TypeResolver::resolveRootPathExpression(
       if (isRoot) {
         llvm::errs() << "failed to resolve root segment2: "
                      << seg.getLocation().toString() << "\n";
-        return new TyTy::ErrorType(path->getNodeId());
+        return tcx->create<TyTy::ErrorType>(path->getNodeId());
       }
 
       return rootType;
@@ -294,13 +294,12 @@ TyTy::BaseType *TypeResolver::resolveSegmentsExpression(
           seg.getLocation(), tcx);
 
       if (prevSegment->getKind() == TyTy::TypeKind::Error)
-        return new TyTy::ErrorType(0);
+        return tcx->create<TyTy::ErrorType>(0);
 
       if (associated) {
         ast::types::TypeExpression *boundPath =
             (*associated)->getTraitImplementation()->getTypePath().get();
-        TraitResolver traitResolver;
-        TraitReference *traitRef = traitResolver.resolve(boundPath);
+        TraitReference *traitRef = TraitResolver::resolve(boundPath, this);
         assert(!traitRef->isError());
 
         TyTy::TypeBoundPredicate predicate =
@@ -363,7 +362,7 @@ TyTy::BaseType *TypeResolver::resolveImplBlockSelfWithInference(
       resolveImplBlockSubstitutions(impl, failedFlag);
 
   if (failedFlag)
-    return new TyTy::ErrorType(impl->getNodeId());
+    return tcx->create<TyTy::ErrorType>(impl->getNodeId());
 
   TyTy::BaseType *self = resolveImplBlockSelf(impl);
   if (substitutions.empty() || self->isConcrete())
@@ -466,8 +465,7 @@ TypeResolver::resolveImplBlockSubstitutions(ast::TraitImpl *impl,
 
   TraitReference *traitReference = &TraitReference::errorNode();
 
-  TraitResolver traitResolver;
-  traitReference = traitResolver.resolve(impl->getTypePath().get());
+  traitReference = TraitResolver::resolve(impl->getTypePath().get(), this);
   assert(!traitReference->isError());
 
   specifiedBounds =
@@ -76,7 +76,11 @@ void PathProbeType::processImplItemsForCandidates() {
 //  llvm::errs() << "processImplItemsForCandidates"
 //               << "\n";
 
-  context->iterateAssociatedItems(
+  context->iterateAssociatedItemsFor(
+      receiver,
+      [&](ast::Implementation *impl) {
+        return resolver->queryImplementationType(impl);
+      },
       [&](NodeId id, ast::Implementation *item,
           ast::AssociatedItem *impl) mutable -> bool {
         processImplItemCandidate(id, item, impl);
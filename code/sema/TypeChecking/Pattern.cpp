@@ -31,7 +31,7 @@ TypeResolver::checkPattern(std::shared_ptr<ast::patterns::Pattern> pat,
 
   llvm::errs() << "failed to check pattern declaration"
                << "\n";
-  return new TyTy::ErrorType(pat->getNodeId());
+  return tcx->create<TyTy::ErrorType>(pat->getNodeId());
 }
 
 TyTy::BaseType *
@@ -54,7 +54,7 @@ TypeResolver::checkPattern(std::shared_ptr<ast::patterns::PatternNoTopAlt> pat,
   if (infered == nullptr) {
     llvm::errs() << "failed to check pattern declaration"
                  << "\n";
-    return new TyTy::ErrorType(pat->getNodeId());
+    return tcx->create<TyTy::ErrorType>(pat->getNodeId());
   }
 
   tcx->insertType(pat->getIdentity(), infered);
@@ -36,6 +36,9 @@ TypeResolver::checkStatement(std::shared_ptr<ast::Statement> stmt) {
     assert(false && "to be implemented");
     break;
   }
+  case ast::StatementKind::ErrorStatement: {
+    return tcx->create<TyTy::ErrorType>(stmt->getNodeId());
+  }
   }
   assert(false);
 }
@@ -105,8 +108,10 @@ TypeResolver::checkLetStatement(std::shared_ptr<ast::LetStatement> let) {
     } else {
       // let x;
       TyTy::BaseType *inferType =
-          new TyTy::InferType(let->getNodeId(), TyTy::InferKind::General,
-                              TyTy::TypeHint::unknown(), let->getLocation());
+          tcx->create<TyTy::InferType>(let->getNodeId(),
+                                       TyTy::InferKind::General,
+                                       TyTy::TypeHint::unknown(),
+                                       let->getLocation());
       checkPattern(pattern, inferType);
     }
   }
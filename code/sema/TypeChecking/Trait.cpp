@@ -33,13 +33,14 @@ TyTy::BaseType *TypeResolver::checkTrait(ast::Trait *s) {
   TraitReference *ref = resolveTrait(s);
 
   if (ref->isError())
-    return new TyTy::ErrorType(s->getNodeId());
+    return tcx->create<TyTy::ErrorType>(s->getNodeId());
 
   TypeIdentity ident = {CanonicalPath::createEmpty(), s->getLocation()};
 
-  return new TyTy::DynamicObjectType(
+  return tcx->create<TyTy::DynamicObjectType>(
       s->getNodeId(), ident,
-      {TyTy::TypeBoundPredicate(*ref, s->getLocation())});
+      std::vector<TyTy::TypeBoundPredicate>{
+          TyTy::TypeBoundPredicate(*ref, s->getLocation())});
 }
 
 TraitReference *TypeResolver::resolveTrait(ast::Trait *trait) {
@@ -49,12 +50,13 @@ TraitReference *TypeResolver::resolveTrait(ast::Trait *trait) {
   if (ref)
     return *ref;
 
-  if (tcx->isTraitQueryInProgress(trait->getNodeId())) {
+  TraitQueryGuard guard = {trait->getNodeId(), tcx};
+  if (!guard.isStarted()) {
     // report error: cycle
     assert(false);
+    return &TraitReference::errorNode();
   }
 
-  TraitQueryGuard guard = {trait->getNodeId(), tcx};
   TyTy::BaseType *self = nullptr;
   std::vector<TyTy::SubstitutionParamMapping> substitutions;
 
@@ -183,8 +185,9 @@ TypeResolver::checkGenericParamTypeParam(const ast::TypeParam &tp) {
   TypeExpression *implicitSelfBound= nullptr;
   if (tp.hasTypeParamBounds()) {
     basic::NodeId implicitId = getNextNodeId();
-    TyTy::ParamType *p = new TyTy::ParamType(
-        tp.getIdentifier(), tp.getLocation(), implicitId, tp, {});
+    TyTy::ParamType *p = tcx->create<TyTy::ParamType>(
+        tp.getIdentifier(), tp.getLocation(), implicitId, tp,
+        std::vector<TyTy::TypeBoundPredicate>());
     tcx->insertImplicitType(implicitId, p);
 
     implicitSelfBound = new TypePath(Location::getEmptyLocation());
@@ -209,8 +212,8 @@ TypeResolver::checkGenericParamTypeParam(const ast::TypeParam &tp) {
     }
   }
 
-  return new TyTy::ParamType(tp.getIdentifier(), tp.getLocation(),
-                             tp.getNodeId(), tp, specifiedBounds);
+  return tcx->create<TyTy::ParamType>(tp.getIdentifier(), tp.getLocation(),
+                                      tp.getNodeId(), tp, specifiedBounds);
 }
 
 void TypeResolver::resolveFunctionItemInTrait(std::shared_ptr<Item> item,
@@ -1,10 +1,38 @@
 #include "TraitResolver.h"
 
+#include "AST/Trait.h"
+#include "AST/VisItem.h"
+#include "Session/Session.h"
+#include "TyCtx/TyCtx.h"
+#include "TypeChecking.h"
+
+using namespace rust_compiler::ast;
+using namespace rust_compiler::tyctx;
+
 namespace rust_compiler::sema::type_checking {
 
 tyctx::TyTy::TraitReference *
-TraitResolver::resolve(ast::types::TypeExpression *traitPath) {
-  assert(false);
+TraitResolver::resolve(ast::types::TypeExpression *traitPath,
+                       TypeResolver *resolver) {
+  TyCtx *tcx = rust_compiler::session::session->getTypeContext();
+
+  std::optional<basic::NodeId> id =
+      tcx->lookupResolvedType(traitPath->getNodeId());
+  if (!id)
+    return &TyTy::TraitReference::errorNode();
+
+  if (std::optional<TyTy::TraitReference *> ref =
+          tcx->lookupTraitReference(*id))
+    return *ref;
+
+  std::optional<Item *> item = tcx->lookupItem(*id);
+  if (!item || (*item)->getItemKind() != ItemKind::VisItem)
+    return &TyTy::TraitReference::errorNode();
+  VisItem *visItem = static_cast<VisItem *>(*item);
+  if (visItem->getKind() != VisItemKind::Trait)
+    return &TyTy::TraitReference::errorNode();
+
+  return resolver->resolveTrait(static_cast<Trait *>(visItem));
 }
 
 } // namespace rust_compiler::sema::type_checking
@@ -5,9 +5,14 @@
 
 namespace rust_compiler::sema::type_checking {
 
+class TypeResolver;
+
+/// Resolves the path of a trait bound or a trait impl to the memoized
+/// TraitReference of the trait.
 class TraitResolver {
 public:
-  static tyctx::TyTy::TraitReference *resolve(ast::types::TypeExpression *traitPath);
+  static tyctx::TyTy::TraitReference *
+  resolve(ast::types::TypeExpression *traitPath, TypeResolver *resolver);
 };
 
-} // namespace rust_compiler::sema::TypeChecking
+} // namespace rust_compiler::sema::type_checking
@@ -29,7 +29,11 @@ void TypeBoundsProbe::scan() {
   std::vector<std::pair<ast::types::TypeExpression *, ast::TraitImpl *>>
       possibleTraitPaths;
 
-  context->iterateImplementations(
+  context->iterateImplementationsFor(
+      receiver,
+      [&](ast::Implementation *impl) {
+        return resolver->queryImplementationType(impl);
+      },
       [&](NodeId id, ast::Implementation *impl) mutable -> bool {
         if (impl->getKind() == ast::ImplementationKind::InherentImpl)
           return true;
@@ -50,7 +54,8 @@ void TypeBoundsProbe::scan() {
 
   for (auto &path : possibleTraitPaths) {
     ast::types::TypeExpression *traitPath = path.first;
-    TyTy::TraitReference *traitRef = TraitResolver::resolve(traitPath);
+    TyTy::TraitReference *traitRef =
+        TraitResolver::resolve(traitPath, resolver);
 
     if (!traitRef->isError())
       traitReferences.push_back({traitRef, path.second});
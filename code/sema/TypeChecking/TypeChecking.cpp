@@ -1,6 +1,8 @@
 #include "TypeChecking.h"
 
+#include "AST/InherentImpl.h"
 #include "AST/MacroItem.h"
+#include "AST/TraitImpl.h"
 #include "Basic/Ids.h"
 #include "Session/Session.h"
 #include "TyCtx/NodeIdentity.h"
@@ -103,6 +105,19 @@ std::optional<TyTy::BaseType *> TypeResolver::queryType(basic::NodeId id) {
   return std::nullopt;
 }
 
+std::optional<TyTy::BaseType *>
+TypeResolver::queryImplementationType(ast::Implementation *impl) {
+  switch (impl->getKind()) {
+  case ImplementationKind::InherentImpl:
+    return queryType(
+        static_cast<ast::InherentImpl *>(impl)->getType()->getNodeId());
+  case ImplementationKind::TraitImpl:
+    return queryType(
+        static_cast<ast::TraitImpl *>(impl)->getType()->getNodeId());
+  }
+  return std::nullopt;
+}
+
 TypeResolver::TypeResolver(resolver::Resolver *r) {
   tcx = rust_compiler::session::session->getTypeContext();
   resolver = r;
@@ -118,6 +133,9 @@ void TypeResolver::checkCrate(std::shared_ptr<ast::Crate> crate) {
       checkMacroItem(std::static_pointer_cast<ast::MacroItem>(item));
       break;
     }
+    case ItemKind::ErrorItem: {
+      break;
+    }
     }
     }
   }
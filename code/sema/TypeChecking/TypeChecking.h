@@ -128,6 +128,12 @@ public:
   TyTy::BaseType *checkType(std::shared_ptr<ast::types::TypeExpression>);
 
   std::optional<TyTy::BaseType *> queryType(basic::NodeId id);
+  /// the self type of an inherent or trait impl
+  std::optional<TyTy::BaseType *>
+  queryImplementationType(ast::Implementation *impl);
+
+  /// the memoized TraitReference of trait
+  TyTy::TraitReference *resolveTrait(ast::Trait *trait);
 
 private:
   std::optional<TyTy::BaseType *>
@@ -354,7 +360,6 @@ private:
 
   bool checkGenericParamsAndArgs(const ast::GenericParams &,
                                  const ast::GenericArgs &);
-  TyTy::TraitReference *resolveTrait(ast::Trait *trait);
 
   TyTy::TraitItemReference resolveAssociatedItemInTraitToRef(
       AssociatedItem &, TyTy::BaseType *,
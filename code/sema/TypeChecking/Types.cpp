@@ -214,7 +214,7 @@ TypeResolver::checkTypePath(std::shared_ptr<ast::types::TypePath> tp) {
     llvm::errs() << "resolve root path type failed: "
                  << tp->getLocation().toString() << "\n";
     assert(false);
-    return new TyTy::ErrorType(tp->getNodeId());
+    return tcx->create<TyTy::ErrorType>(tp->getNodeId());
   }
 
   TyTy::BaseType *pathType = root->clone();
@@ -272,7 +272,7 @@ TypeResolver::resolveRootPathType(std::shared_ptr<ast::types::TypePath> path,
         llvm::errs() << "unknown reference for resolved name: "
                      << segs[i].getSegment().toString() << " @ "
                      << segs[i].getLocation().toString() << "\n";
-        return new TyTy::ErrorType(path->getNodeId());
+        return tcx->create<TyTy::ErrorType>(path->getNodeId());
       }
       return rootType;
     }
@@ -288,7 +288,7 @@ TypeResolver::resolveRootPathType(std::shared_ptr<ast::types::TypePath> path,
       // report error
       llvm::errs() << "expected value, but found crate or module "
                    << "\n";
-      return new TyTy::ErrorType(path->getNodeId());
+      return tcx->create<TyTy::ErrorType>(path->getNodeId());
     }
 
     std::optional<TyTy::BaseType *> result = queryType(refNodeId); // astNodeId
@@ -297,7 +297,7 @@ TypeResolver::resolveRootPathType(std::shared_ptr<ast::types::TypePath> path,
         // report error
         llvm::errs() << "queryType failed: failed to resolve root segment"
                      << "\n";
-        return new TyTy::ErrorType(path->getNodeId());
+        return tcx->create<TyTy::ErrorType>(path->getNodeId());
       }
       return rootType;
     }
@@ -329,7 +329,7 @@ TypeResolver::resolveRootPathType(std::shared_ptr<ast::types::TypePath> path,
       SubstitutionsMapper mapper;
       lookup = mapper.resolve(lookup, path->getLocation(), this, &args);
       if (lookup->getKind() == TyTy::TypeKind::Error)
-        return new TyTy::ErrorType(segs[i].getNodeId());
+        return tcx->create<TyTy::ErrorType>(segs[i].getNodeId());
     } else if (lookup->needsGenericSubstitutions()) {
       GenericArgs args = GenericArgs::empty();
       SubstitutionsMapper mapper;
@@ -376,13 +376,13 @@ TypeResolver::resolveSegmentsType(basic::NodeId rootResolvedNodeId,
 
       if (candidates.size() == 0) {
         // report error
-        return new TyTy::ErrorType(tp->getNodeId());
+        return tcx->create<TyTy::ErrorType>(tp->getNodeId());
       }
     }
 
     if (candidates.size() > 1) {
       // report error
-      return new TyTy::ErrorType(tp->getNodeId());
+      return tcx->create<TyTy::ErrorType>(tp->getNodeId());
     }
 
     // FIXME
@@ -466,8 +466,8 @@ TyTy::ParamType *TypeResolver::checkTypeParam(const TypeParam &type) {
     }
   }
 
-  return new TyTy::ParamType(type.getIdentifier(), type.getLocation(),
-                             type.getNodeId(), type, specifiedBounds);
+  return tcx->create<TyTy::ParamType>(type.getIdentifier(), type.getLocation(),
+                                      type.getNodeId(), type, specifiedBounds);
 
   assert(false);
 }
@@ -488,9 +488,9 @@ TypeResolver::checkArrayType(std::shared_ptr<ast::types::ArrayType> arr) {
 
   TyTy::BaseType *base = checkType(arr->getType());
 
-  return new TyTy::ArrayType(arr->getNodeId(), arr->getLocation(),
-                             arr->getExpression(),
-                             TyTy::TypeVariable(base->getReference()));
+  return tcx->create<TyTy::ArrayType>(arr->getNodeId(), arr->getLocation(),
+                                      arr->getExpression(),
+                                      TyTy::TypeVariable(base->getReference()));
 }
 
 TyTy::SubstitutionArgumentMappings
@@ -508,9 +508,9 @@ TypeResolver::getUsedSubstitutionArguments(TyTy::BaseType *type) {
 TyTy::BaseType *TypeResolver::checkReferenceType(
     std::shared_ptr<ast::types::ReferenceType> ref) {
   TyTy::BaseType *base = checkType(ref->getReferencedType());
-  return new TyTy::RawPointerType(ref->getNodeId(),
-                                  TyTy::TypeVariable(base->getReference()),
-                                  ref->getMut());
+  return tcx->create<TyTy::RawPointerType>(
+      ref->getNodeId(), TyTy::TypeVariable(base->getReference()),
+      ref->getMut());
 }
 
 TyTy::BaseType *TypeResolver::checkTypeTraitObjectTypeOneBound(
@@ -526,24 +526,24 @@ TyTy::BaseType *TypeResolver::checkTypeTraitObjectTypeOneBound(
 
   TypeIdentity ident = {adt::CanonicalPath::createEmpty(),
                         trait->getLocation()};
-  return new TyTy::DynamicObjectType(trait->getNodeId(), ident,
-                                     specifiedBounds);
+  return tcx->create<TyTy::DynamicObjectType>(trait->getNodeId(), ident,
+                                              specifiedBounds);
 }
 
 TyTy::BaseType *TypeResolver::checkRawPointerType(
     std::shared_ptr<ast::types::RawPointerType> raw) {
   TyTy::BaseType *base = checkType(raw->getType());
-  return new TyTy::RawPointerType(raw->getNodeId(),
-                                  TyTy::TypeVariable(base->getReference()),
-                                  raw->getMutability());
+  return tcx->create<TyTy::RawPointerType>(
+      raw->getNodeId(), TyTy::TypeVariable(base->getReference()),
+      raw->getMutability());
 }
 
 TyTy::BaseType *
 TypeResolver::checkSliceType(std::shared_ptr<ast::types::SliceType> slice) {
   TyTy::BaseType *base = checkType(slice->getType());
 
-  return new TyTy::SliceType(slice->getNodeId(), slice->getLocation(),
-                             TyTy::TypeVariable(base->getReference()));
+  return tcx->create<TyTy::SliceType>(slice->getNodeId(), slice->getLocation(),
+                                      TyTy::TypeVariable(base->getReference()));
 }
 
 } // namespace rust_compiler::sema::type_checking
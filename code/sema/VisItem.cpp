@@ -3,6 +3,7 @@
 #include "AST/Module.h"
 #include "Sema/Sema.h"
 
+#include <llvm/Support/raw_ostream.h>
 #include <memory>
 
 using namespace rust_compiler::ast;
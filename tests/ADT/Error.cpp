@@ -0,0 +1,26 @@
+#include "ADT/Result.h"
+
+#include "gtest/gtest.h"
+
+using namespace rust_compiler::adt;
+
+TEST(ErrorTest, CheckCause) {
+  StringResult<int> result = StringResult<int>(Error("expected ;"));
+
+  ASSERT_FALSE(result);
+  EXPECT_EQ(result.getError().toString(), "expected ;");
+};
+
+TEST(ErrorTest, CheckWrap) {
+  Error inner = {"expected ;"};
+  Error middle = {"failed to parse let statement", inner};
+  Error outer = {"failed to parse block expression", middle};
+
+  EXPECT_STREQ(outer.getCause(), "expected ;");
+  EXPECT_EQ(outer.toString(), "failed to parse block expression: expected ;");
+};
+
+TEST(ErrorTest, CheckCompact) {
+  EXPECT_LE(sizeof(Error), 3 * sizeof(void *));
+  EXPECT_TRUE(std::is_trivially_copyable_v<Error>);
+};
@@ -0,0 +1,74 @@
+#include "ADT/NodeIdMap.h"
+
+#include "gtest/gtest.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace rust_compiler::adt;
+using namespace rust_compiler::basic;
+
+TEST(NodeIdMapTest, CheckInsertAndFind) {
+  NodeIdMap<std::string> map;
+
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(8), map.end());
+
+  map[8] = "foo";
+  EXPECT_TRUE(map.insert({9, "bar"}).second);
+  EXPECT_FALSE(map.insert({9, "baz"}).second);
+  EXPECT_TRUE(map.emplace(100000, "qux").second);
+
+  EXPECT_EQ(map.size(), 3u);
+  EXPECT_EQ(map.find(8)->second, "foo");
+  EXPECT_EQ(map.find(9)->second, "bar");
+  EXPECT_EQ(map.at(100000), "qux");
+  EXPECT_EQ(map.count(10), 0u);
+  EXPECT_EQ(map.find(10), map.end());
+};
+
+TEST(NodeIdMapTest, CheckUnknownNodeId) {
+  NodeIdMap<int> map;
+
+  map[UNKNOWN_NODEID] = 1;
+  map[7] = 2;
+
+  EXPECT_TRUE(map.contains(UNKNOWN_NODEID));
+  EXPECT_EQ(map.find(UNKNOWN_NODEID)->second, 1);
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_EQ(map.erase(UNKNOWN_NODEID), 1u);
+  EXPECT_FALSE(map.contains(UNKNOWN_NODEID));
+};
+
+TEST(NodeIdMapTest, CheckIterationAndErase) {
+  NodeIdMap<std::vector<NodeId>> map;
+  std::map<NodeId, std::vector<NodeId>> reference;
+
+  for (NodeId id : {5000u, 3u, 70000u, UNKNOWN_NODEID - 1, 512u, 511u}) {
+    map[id].push_back(id);
+    reference[id].push_back(id);
+  }
+  map.erase(512);
+  reference.erase(512);
+
+  std::vector<NodeId> ids;
+  for (const auto &[id, values] : map) {
+    EXPECT_EQ(values, reference[id]);
+    ids.push_back(id);
+  }
+  std::vector<NodeId> expected;
+  for (const auto &entry : reference)
+    expected.push_back(entry.first);
+  EXPECT_EQ(ids, expected);
+
+  // references stay valid across inserts
+  std::vector<NodeId> *values = &map[3];
+  for (NodeId id = 10; id < 10000; ++id)
+    map[id];
+  EXPECT_EQ(values, &map.find(3)->second);
+
+  NodeIdMap<std::vector<NodeId>> copy = map;
+  EXPECT_EQ(copy.size(), map.size());
+  EXPECT_EQ(copy.at(70000), map.at(70000));
+};
@@ -0,0 +1,156 @@
+#include "CrateLoader/ModuleLexer.h"
+
+#include "gtest/gtest.h"
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <string>
+
+using namespace rust_compiler::crate_loader;
+using namespace rust_compiler::lexer;
+
+static void writeFile(llvm::StringRef dir, llvm::StringRef name,
+                      llvm::StringRef code) {
+  llvm::SmallString<128> path = dir;
+  llvm::sys::path::append(path, name);
+  ASSERT_FALSE(llvm::sys::fs::create_directories(
+      llvm::sys::path::parent_path(path)));
+  std::error_code ec;
+  llvm::raw_fd_ostream os(path, ec);
+  ASSERT_FALSE(ec);
+  os << code;
+}
+
+static std::string getPath(llvm::StringRef dir, llvm::StringRef name) {
+  llvm::SmallString<128> path = dir;
+  llvm::sys::path::append(path, name);
+  return std::string(path.str());
+}
+
+TEST(ModuleLexerTest, CheckModuleFiles) {
+  llvm::SmallString<128> dir;
+  ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("modules", dir));
+
+  writeFile(dir, "lib.rs", "");
+  writeFile(dir, "foo.rs", "");
+  writeFile(dir, "bar/mod.rs", "");
+
+  EXPECT_EQ(ModuleLexer::getModuleDirectory(getPath(dir, "lib.rs"), true),
+            std::string(dir.str()));
+  EXPECT_EQ(ModuleLexer::getModuleDirectory(getPath(dir, "foo.rs"), false),
+            getPath(dir, "foo"));
+  EXPECT_EQ(ModuleLexer::getModuleDirectory(getPath(dir, "bar/mod.rs"), false),
+            getPath(dir, "bar"));
+
+  EXPECT_EQ(ModuleLexer::getModuleFile(dir.str(), "foo"),
+            getPath(dir, "foo.rs"));
+  EXPECT_EQ(ModuleLexer::getModuleFile(dir.str(), "bar"),
+            getPath(dir, "bar/mod.rs"));
+  EXPECT_EQ(ModuleLexer::getModuleFile(dir.str(), "baz"),
+            getPath(dir, "baz.rs"));
+
+  llvm::sys::fs::remove_directories(dir);
+};
+
+TEST(ModuleLexerTest, CheckModuleTree) {
+  llvm::SmallString<128> dir;
+  ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("modules", dir));
+
+  writeFile(dir, "lib.rs", "mod foo;\nmod bar { mod baz; }\nfn main() {}\n");
+  writeFile(dir, "foo.rs", "mod qux;\nfn foo() {}\n");
+  writeFile(dir, "foo/qux.rs", "fn qux() {}\n");
+  writeFile(dir, "bar/baz/mod.rs", "fn baz() {}\n");
+
+  ModuleLexer lexer(llvm::hardware_concurrency(4));
+  lexer.lexRootModule(getPath(dir, "lib.rs"), "lib.rs");
+
+  const TokenStream &root =
+      llvm::cantFail(lexer.getTokenStream(getPath(dir, "lib.rs")));
+  EXPECT_EQ(root.getAt(0).getKeyWordKind(), KeyWordKind::KW_MOD);
+  EXPECT_EQ(root.getAt(0).getLocation().getFileName(), "lib.rs");
+
+  const TokenStream &foo =
+      llvm::cantFail(lexer.getTokenStream(getPath(dir, "foo.rs")));
+  EXPECT_EQ(foo.getAt(4).getSpelling(), "foo");
+
+  const TokenStream &qux =
+      llvm::cantFail(lexer.getTokenStream(getPath(dir, "foo/qux.rs")));
+  EXPECT_EQ(qux.getAt(1).getSpelling(), "qux");
+  EXPECT_EQ(qux.getAt(1).getLocation().getLineNumber(), 1u);
+
+  const TokenStream &baz =
+      llvm::cantFail(lexer.getTokenStream(getPath(dir, "bar/baz/mod.rs")));
+  EXPECT_EQ(baz.getAt(1).getSpelling(), "baz");
+  EXPECT_EQ(baz.getAt(baz.getLength() - 1).getKind(), TokenKind::Eof);
+
+  llvm::sys::fs::remove_directories(dir);
+};
+
+TEST(ModuleLexerTest, CheckUnbalancedBraces) {
+  llvm::SmallString<128> dir;
+  ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("modules", dir));
+
+  // the stray } must not shift the directories of later inline modules
+  writeFile(dir, "lib.rs", "}\nmod bar { mod baz; }\n");
+  writeFile(dir, "bar/baz.rs", "fn baz() {}\n");
+
+  ModuleLexer lexer(llvm::hardware_concurrency(4));
+  lexer.lexRootModule(getPath(dir, "lib.rs"), "lib.rs");
+  llvm::cantFail(lexer.getTokenStream(getPath(dir, "lib.rs")));
+
+  const TokenStream &baz =
+      llvm::cantFail(lexer.getTokenStream(getPath(dir, "bar/baz.rs")));
+  EXPECT_EQ(baz.getAt(1).getSpelling(), "baz");
+
+  llvm::sys::fs::remove_directories(dir);
+};
+
+TEST(ModuleLexerTest, CheckErrors) {
+  llvm::SmallString<128> dir;
+  ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("modules", dir));
+
+  writeFile(dir, "lib.rs", "mod foo;\nfn main() {}\n");
+  writeFile(dir, "foo.rs", "fn foo() { ` }\n");
+
+  ModuleLexer lexer(llvm::hardware_concurrency(4));
+  lexer.lexRootModule(getPath(dir, "lib.rs"), "lib.rs");
+  llvm::cantFail(lexer.getTokenStream(getPath(dir, "lib.rs")));
+
+  // the worker reports the unknown token instead of exiting
+  llvm::Expected<const TokenStream &> foo =
+      lexer.getTokenStream(getPath(dir, "foo.rs"));
+  ASSERT_FALSE(bool(foo));
+  EXPECT_NE(llvm::toString(foo.takeError()).find("unknown token"),
+            std::string::npos);
+
+  llvm::Expected<const TokenStream &> missing =
+      lexer.getTokenStream(getPath(dir, "missing.rs"));
+  ASSERT_FALSE(bool(missing));
+  llvm::consumeError(missing.takeError());
+
+  llvm::sys::fs::remove_directories(dir);
+};
+
+TEST(ModuleLexerTest, CheckStringErrors) {
+  llvm::SmallString<128> dir;
+  ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("modules", dir));
+
+  writeFile(dir, "lib.rs", "mod foo;\n");
+  writeFile(dir, "foo.rs", "fn foo() { \"abc\n}\n");
+
+  ModuleLexer lexer(llvm::hardware_concurrency(4));
+  lexer.lexRootModule(getPath(dir, "lib.rs"), "lib.rs");
+  llvm::cantFail(lexer.getTokenStream(getPath(dir, "lib.rs")));
+
+  // the unterminated string is reported through the error, not on stdout
+  llvm::Expected<const TokenStream &> foo =
+      lexer.getTokenStream(getPath(dir, "foo.rs"));
+  ASSERT_FALSE(bool(foo));
+  EXPECT_NE(llvm::toString(foo.takeError()).find("unknown string token"),
+            std::string::npos);
+
+  llvm::sys::fs::remove_directories(dir);
+};
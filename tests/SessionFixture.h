@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Session/Session.h"
+
+#include <gtest/gtest.h>
+
+/// Points session::session at a Session of its own for the lifetime of a
+/// test, and restores the previous Session afterwards, so that no test sees
+/// the Session, e.g., the NodeIds, of another one.
+class SessionTest : public ::testing::Test {
+  rust_compiler::session::Session *previous;
+  rust_compiler::session::Session testSession = {1, nullptr};
+
+protected:
+  SessionTest() : previous(rust_compiler::session::session) {
+    rust_compiler::session::session = &testSession;
+  }
+
+  ~SessionTest() override { rust_compiler::session::session = previous; }
+
+  rust_compiler::session::Session &getSession() { return testSession; }
+};
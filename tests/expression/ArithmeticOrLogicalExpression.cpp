@@ -23,7 +23,8 @@ TEST(ArithmeticOrLogicalExpressionTest, CheckOperatorExprSimple) {
 
   EXPECT_EQ(ts.getLength(), expectedLendth);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   rust_compiler::parser::Restrictions restrictions;
   StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
@@ -42,7 +43,8 @@ TEST(ArithmeticOrLogicalExpressionTest, CheckOperatorExprSimple2) {
 
   EXPECT_EQ(ts.getLength(), expectedLendth);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   rust_compiler::parser::Restrictions restrictions;
   StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
@@ -61,7 +63,8 @@ TEST(ArithmeticOrLogicalExpressionTest, CheckOperatorExprSimple3) {
 
   EXPECT_EQ(ts.getLength(), expectedLendth);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   rust_compiler::parser::Restrictions restrictions;
   StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
@@ -15,9 +15,10 @@ TEST(ArrayTest, CheckArray6) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
     parser.parseArrayExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -29,9 +30,10 @@ TEST(ArrayTest, CheckArray5) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
     parser.parseArrayExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -45,7 +47,7 @@ TEST(ArrayTest, CheckArray5) {
 //
 //  Parser parser = {ts};
 //
-//  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+//  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
 //    parser.parseArrayExpression({});
 //
 //  EXPECT_TRUE(result.isOk());
@@ -57,9 +59,10 @@ TEST(ArrayTest, CheckArray3) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
     parser.parseArrayExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -71,9 +74,10 @@ TEST(ArrayTest, CheckArray2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
     parser.parseArrayExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -85,9 +89,10 @@ TEST(ArrayTest, CheckArray1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
     parser.parseArrayExpression({});
 
   EXPECT_TRUE(result.isOk());
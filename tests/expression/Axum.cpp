@@ -14,10 +14,10 @@ TEST(AxumTest, CheckPattern2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseTupleStructPattern();
 
   EXPECT_TRUE(result.isOk());
@@ -28,10 +28,10 @@ TEST(AxumTest, CheckPattern1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseTupleStructPattern();
 
   EXPECT_TRUE(result.isOk());
@@ -42,10 +42,10 @@ TEST(AxumTest, CheckType1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::types::TypeExpression>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::types::TypeExpression>>
       result = parser.parseType();
 
   EXPECT_TRUE(result.isOk());
@@ -59,9 +59,10 @@ TEST(AxumTest, CheckFunctionParameters1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<rust_compiler::ast::FunctionParameters, std::string> result =
+  StringResult<rust_compiler::ast::FunctionParameters> result =
       parser.parseFunctionParameters();
 
   EXPECT_TRUE(result.isOk());
@@ -74,9 +75,10 @@ TEST(AxumTest, CheckFunction2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -89,9 +91,10 @@ TEST(AxumTest, CheckFunction1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseItem();
 
   EXPECT_TRUE(result.isOk());
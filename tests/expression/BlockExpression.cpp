@@ -15,9 +15,10 @@ TEST(BlockExpressionTest, CheckBlockExpr1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBlockExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -29,9 +30,10 @@ TEST(BlockExpressionTest, CheckBlockExpr2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBlockExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -43,9 +45,10 @@ TEST(BlockExpressionTest, CheckBlockExpr37) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBlockExpression({});
 
   if (!result)
@@ -60,9 +63,10 @@ TEST(BlockExpressionTest, CheckBlockExpr41) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBlockExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -74,9 +78,10 @@ TEST(BlockExpressionTest, CheckBlockExpr5) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBlockExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -88,9 +93,10 @@ TEST(BlockExpressionTest, CheckBlockExpr40) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBlockExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -14,9 +14,10 @@ TEST(BorrowExpressionTest, CheckBorrowExpr1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBorrowExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -28,9 +29,10 @@ TEST(BorrowExpressionTest, CheckBorrowExpr2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBorrowExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -42,9 +44,10 @@ TEST(BorrowExpressionTest, CheckBorrowExpr3) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBorrowExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -56,9 +59,10 @@ TEST(BorrowExpressionTest, CheckBorrowExpr4) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBorrowExpression({});
 
   EXPECT_TRUE(result.isOk());
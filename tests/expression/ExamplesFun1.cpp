@@ -15,9 +15,10 @@ TEST(ExamplesFun1Test, CheckFun5) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -29,9 +30,10 @@ TEST(ExamplesFun1Test, CheckFun4a) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -43,9 +45,10 @@ TEST(ExamplesFun1Test, CheckFun4) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -57,9 +60,10 @@ TEST(ExamplesFun1Test, CheckFun3a) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -71,9 +75,10 @@ TEST(ExamplesFun1Test, CheckFun3b) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -85,9 +90,10 @@ TEST(ExamplesFun1Test, CheckFun3c) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -99,9 +105,10 @@ TEST(ExamplesFun1Test, CheckFun1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -114,9 +121,10 @@ TEST(ExamplesFun1Test, CheckFun2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -129,9 +137,10 @@ TEST(ExamplesFun1Test, CheckModule1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Crate>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Crate>> result =
       parser.parseCrateModule("crateName", 5);
 
   EXPECT_TRUE(result.isOk());
@@ -19,9 +19,10 @@ TEST(ExamplesFun2Test, CheckFun1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseItem();
 
   if (result.isErr())
@@ -37,9 +38,10 @@ TEST(ExamplesFun2Test, CheckFun2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -51,9 +53,10 @@ TEST(ExamplesFun2Test, CheckFun3) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -65,9 +68,10 @@ TEST(ExamplesFun2Test, CheckFun4) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseReturnExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -79,9 +83,10 @@ TEST(ExamplesFun2Test, CheckFun5) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseReturnExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -93,9 +98,10 @@ TEST(ExamplesFun2Test, CheckFun6) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -107,9 +113,10 @@ TEST(ExamplesFun2Test, CheckFun7) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -121,9 +128,10 @@ TEST(ExamplesFun2Test, CheckFun8) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseReturnExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -135,9 +143,10 @@ TEST(ExamplesFun2Test, CheckFun9) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseIfExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -15,9 +15,10 @@ TEST(ExamplesFun3Test, CheckFun1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -29,9 +30,10 @@ TEST(ExamplesFun3Test, CheckFun2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -43,9 +45,10 @@ TEST(ExamplesFun3Test, CheckFun3) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -57,9 +60,10 @@ TEST(ExamplesFun3Test, CheckFun4) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -72,9 +76,10 @@ TEST(ExamplesFun3Test, CheckFun5) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -87,9 +92,10 @@ TEST(ExamplesFun3Test, CheckFun6) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -14,9 +14,10 @@ TEST(ExpressionTest, CheckLiteralExpr) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseLiteralExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -28,9 +29,10 @@ TEST(ExpressionTest, CheckNegationExpr1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseNegationExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -42,9 +44,10 @@ TEST(ExpressionTest, CheckNegationExpr2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseNegationExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -56,7 +59,8 @@ TEST(ExpressionTest, CheckExprSmaller) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   rust_compiler::parser::Restrictions restrictions;
   StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
@@ -15,10 +15,11 @@ TEST(ExpressionWithoutBlockTest, CheckLiteralBlock) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restrictions;
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseExpressionWithoutBlock({}, restrictions);
 
   EXPECT_TRUE(result.isOk());
@@ -30,10 +31,11 @@ TEST(ExpressionWithoutBlockTest, CheckPathBlock1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restrictions;
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseExpressionWithoutBlock({}, restrictions);
 
   EXPECT_TRUE(result.isOk());
@@ -45,10 +47,11 @@ TEST(ExpressionWithoutBlockTest, CheckPathBlock2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restrictions;
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseExpressionWithoutBlock({}, restrictions);
 
   EXPECT_TRUE(result.isOk());
@@ -60,10 +63,11 @@ TEST(ExpressionWithoutBlockTest, CheckOperatorBlock1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restrictions;
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseExpressionWithoutBlock({}, restrictions);
 
   EXPECT_TRUE(result.isOk());
@@ -75,10 +79,11 @@ TEST(ExpressionWithoutBlockTest, CheckOperatorBlock2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restrictions;
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseExpressionWithoutBlock({}, restrictions);
 
   EXPECT_TRUE(result.isOk());
@@ -17,7 +17,7 @@ using namespace rust_compiler::adt;
 //
 //  Parser parser = {ts};
 //
-//  Result<rust_compiler::ast::FunctionReturnType, std::string> result =
+//  StringResult<rust_compiler::ast::FunctionReturnType> result =
 //      parser.parseFunctionReturnType();
 //
 //  EXPECT_TRUE(result.isOk());
@@ -31,7 +31,7 @@ using namespace rust_compiler::adt;
 //
 //  Parser parser = {ts};
 //
-//  Result<rust_compiler::ast::FunctionReturnType, std::string> result =
+//  StringResult<rust_compiler::ast::FunctionReturnType> result =
 //      parser.parseFunctionReturnType();
 //
 //  EXPECT_TRUE(result.isOk());
@@ -43,9 +43,10 @@ TEST(FunctionTest, CheckFunctionQual1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<rust_compiler::ast::FunctionQualifiers, std::string> result =
+  StringResult<rust_compiler::ast::FunctionQualifiers> result =
       parser.parseFunctionQualifiers();
 
   EXPECT_TRUE(result.isOk());
@@ -59,7 +60,7 @@ TEST(FunctionTest, CheckFunctionQual1) {
 //
 //  Parser parser = {ts};
 //
-//  Result<rust_compiler::ast::FunctionParameters, std::string> result =
+//  StringResult<rust_compiler::ast::FunctionParameters> result =
 //      parser.parseFunctionParameters();
 //
 //  EXPECT_TRUE(result.isOk());
@@ -73,7 +74,7 @@ TEST(FunctionTest, CheckFunctionQual1) {
 //
 //  Parser parser = {ts};
 //
-//  Result<rust_compiler::ast::FunctionParameters, std::string> result =
+//  StringResult<rust_compiler::ast::FunctionParameters> result =
 //      parser.parseFunctionParameters();
 //
 //  EXPECT_TRUE(result.isOk());
@@ -85,9 +86,10 @@ TEST(FunctionTest, CheckFunctionBody1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBlockExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -99,9 +101,10 @@ TEST(FunctionTest, CheckFunctionBody2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseBlockExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -113,9 +116,10 @@ TEST(FunctionTest, CheckFunction1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Item>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Item>> result =
       parser.parseFunction(std::nullopt);
 
   EXPECT_TRUE(result.isOk());
@@ -17,9 +17,10 @@ TEST(FunctionParameterExpressionTest, CheckFunctionParameter) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<rust_compiler::ast::FunctionParam, std::string> result =
+  StringResult<rust_compiler::ast::FunctionParam> result =
       parser.parseFunctionParam();
 
   if (result.isErr())
@@ -34,9 +35,10 @@ TEST(FunctionParameterExpressionTest, CheckFunctionParameters) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<rust_compiler::ast::FunctionParameters, std::string> result =
+  StringResult<rust_compiler::ast::FunctionParameters> result =
       parser.parseFunctionParameters();
 
   if (result.isErr())
@@ -15,10 +15,11 @@ TEST(LetStatementTest, CheckLetStatement1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -30,10 +31,11 @@ TEST(LetStatementTest, CheckLetStatement122) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -45,10 +47,11 @@ TEST(LetStatementTest, CheckLetStatement3) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -60,10 +63,11 @@ TEST(LetStatementTest, CheckLetStatement4) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -74,10 +78,11 @@ TEST(LetStatementTest, CheckLetStatement5) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -14,9 +14,10 @@ TEST(LoopExpressionTest, CheckLoopExpr1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
     parser.parsePredicateLoopExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -30,7 +31,7 @@ TEST(LoopExpressionTest, CheckLoopExpr1) {
 //
 //  Parser parser = {ts};
 //
-//  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+//  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
 //    parser.parsePredicateLoopExpression({});
 //
 //  EXPECT_TRUE(result.isOk());
@@ -22,7 +22,8 @@ TEST(OperatorExpressionTest, CheckOperatorExprSimple9) {
 
   EXPECT_EQ(ts.getLength(), expectedLendth);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   rust_compiler::parser::Restrictions restrictions;
   StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
@@ -44,7 +45,8 @@ TEST(OperatorExpressionTest, CheckOperatorExprSimple2) {
 
   EXPECT_EQ(ts.getLength(), expectedLendth);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   rust_compiler::parser::Restrictions restrictions;
   StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
@@ -66,7 +68,8 @@ TEST(OperatorExpressionTest, CheckOperatorExprSimple3) {
 
   EXPECT_EQ(ts.getLength(), expectedLendth);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   rust_compiler::parser::Restrictions restrictions;
   StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
@@ -14,7 +14,8 @@ TEST(SimplePathTest, CheckSimplePath4) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   StringResult<rust_compiler::ast::SimplePath> result =
       parser.parseSimplePath();
@@ -28,7 +29,8 @@ TEST(SimplePathTest, CheckSimplePath3) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   StringResult<rust_compiler::ast::SimplePath> result =
       parser.parseSimplePath();
@@ -42,7 +44,8 @@ TEST(SimplePathTest, CheckSimplePath2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   StringResult<rust_compiler::ast::SimplePath> result =
       parser.parseSimplePath();
@@ -56,7 +59,8 @@ TEST(SimplePathTest, CheckSimplePath1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   StringResult<rust_compiler::ast::SimplePath> result =
       parser.parseSimplePath();
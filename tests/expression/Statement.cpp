@@ -17,10 +17,11 @@ TEST(StatementTest, CheckReturnStatement) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -32,10 +33,11 @@ TEST(StatementTest, CheckStatement) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -47,10 +49,11 @@ TEST(StatementTest, CheckExpressionStatement) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -62,10 +65,11 @@ TEST(StatementTest, CheckExpressionWithoutBlock) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -77,9 +81,10 @@ TEST(StatementTest, CheckReturnExpression) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
     parser.parseReturnExpression({});
 
   EXPECT_TRUE(result.isOk());
@@ -91,10 +96,11 @@ TEST(StatementTest, CheckLetStatement) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -106,10 +112,11 @@ TEST(StatementTest, CheckLetStatement1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -121,10 +128,11 @@ TEST(StatementTest, CheckLetStatement2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
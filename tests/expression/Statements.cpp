@@ -40,10 +40,11 @@ TEST(StatementsTest, CheckFun0a) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -55,10 +56,11 @@ TEST(StatementsTest, CheckFun0c) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -70,10 +72,11 @@ TEST(StatementsTest, CheckFun0d) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restrictions;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseLetStatement({}, restrictions);
 
   EXPECT_TRUE(result.isOk());
@@ -85,10 +88,11 @@ TEST(StatementsTest, CheckFun1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restrictions;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseLetStatement({}, restrictions);
 
   EXPECT_TRUE(result.isOk());
@@ -100,10 +104,11 @@ TEST(StatementsTest, CheckFun2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restriction;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseStatement(restriction);
 
   EXPECT_TRUE(result.isOk());
@@ -115,10 +120,11 @@ TEST(StatementsTest, CheckFun3) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   Restrictions restrictions;
-  Result<std::shared_ptr<rust_compiler::ast::Statement>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Statement>> result =
       parser.parseLetStatement({}, restrictions);
 
   EXPECT_TRUE(result.isOk());
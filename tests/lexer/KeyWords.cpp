@@ -0,0 +1,35 @@
+#include "Lexer/KeyWords.h"
+
+#include "gtest/gtest.h"
+
+using namespace rust_compiler::lexer;
+
+TEST(KeyWordsTest, CheckRoundTrip) {
+  for (unsigned i = 0; i <= static_cast<unsigned>(KeyWordKind::KW_MACRO_RULES);
+       ++i) {
+    KeyWordKind kind = static_cast<KeyWordKind>(i);
+    if (std::optional<std::string> spelling = KeyWord2String(kind)) {
+      std::optional<KeyWordKind> result = isKeyWord(*spelling);
+      ASSERT_TRUE(result.has_value()) << *spelling;
+      EXPECT_EQ(*result, kind) << *spelling;
+    }
+  }
+};
+
+TEST(KeyWordsTest, CheckNonKeyWords) {
+  for (std::string_view identifier :
+       {"", "a", "x", "_", "As", "wherE", "whilf", "stat", "statics",
+        "structs", "selff", "SELF", "continues", "abstracts", "typeo",
+        "macro_rules", "fn_", "r#fn", "'staticx", "main", "String"})
+    EXPECT_FALSE(isKeyWord(identifier).has_value()) << identifier;
+};
+
+TEST(KeyWordsTest, CheckKeyWords) {
+  EXPECT_EQ(isKeyWord("where"), KeyWordKind::KW_WHERE);
+  EXPECT_EQ(isKeyWord("while"), KeyWordKind::KW_WHILE);
+  EXPECT_EQ(isKeyWord("static"), KeyWordKind::KW_STATIC);
+  EXPECT_EQ(isKeyWord("struct"), KeyWordKind::KW_STRUCT);
+  EXPECT_EQ(isKeyWord("self"), KeyWordKind::KW_SELFVALUE);
+  EXPECT_EQ(isKeyWord("Self"), KeyWordKind::KW_SELFTYPE);
+  EXPECT_EQ(isKeyWord("'static"), KeyWordKind::KW_STATICLIFETIME);
+};
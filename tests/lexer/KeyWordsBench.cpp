@@ -0,0 +1,92 @@
+#include "Lexer/KeyWords.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/raw_ostream.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Micro-benchmark for keyword recognition. It compares the perfect hash in
+/// isKeyWord with the linear scan over all keywords that it replaced on a
+/// keyword-heavy corpus of identifiers.
+
+using namespace rust_compiler::lexer;
+
+namespace {
+
+constexpr unsigned Repetitions = 20;
+
+/// the former linear scan, with the spellings taken from KeyWord2String
+class LinearScan {
+  std::vector<std::pair<KeyWordKind, std::string>> keyWords;
+
+public:
+  LinearScan() {
+    for (unsigned i = 0;
+         i <= static_cast<unsigned>(KeyWordKind::KW_MACRO_RULES); ++i) {
+      KeyWordKind kind = static_cast<KeyWordKind>(i);
+      if (std::optional<std::string> spelling = KeyWord2String(kind))
+        keyWords.push_back({kind, *spelling});
+    }
+  }
+
+  std::optional<KeyWordKind> operator()(std::string_view identifier) const {
+    for (auto &p : keyWords)
+      if (p.second == identifier)
+        return p.first;
+    return std::nullopt;
+  }
+};
+
+/// Roughly two thirds of the identifiers of typical Rust code are keywords
+/// or short names that share a length with keywords.
+std::vector<std::string> buildCorpus(size_t size) {
+  static const char *Words[] = {
+      "fn",     "let",   "mut",    "self",    "x",      "pub",   "impl",
+      "struct", "value", "return", "if",      "else",   "match", "Some",
+      "None",   "for",   "in",     "i32",     "usize",  "while", "where",
+      "T",      "use",   "crate",  "String",  "Vec",    "new",   "len",
+      "static", "const", "Self",   "trait",   "await",  "async", "loop",
+      "break",  "true",  "false",  "counter", "result", "ref",   "as"};
+  std::vector<std::string> corpus;
+  for (size_t i = 0; i < size; ++i)
+    corpus.push_back(Words[(i * 7 + i / 3) % std::size(Words)]);
+  return corpus;
+}
+
+template <typename Lookup>
+void run(std::string_view name, Lookup lookup,
+         const std::vector<std::string> &corpus) {
+  size_t keyWords = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < Repetitions; ++i)
+    for (const std::string &identifier : corpus)
+      if (lookup(identifier))
+        ++keyWords;
+  auto stop = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(stop - start).count();
+  size_t lookups = corpus.size() * Repetitions;
+  llvm::outs() << name << ": "
+               << llvm::format("%.1f", lookups / seconds / 1e6)
+               << " M lookups/s (" << keyWords / Repetitions << " of "
+               << corpus.size() << " are keywords)\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  size_t size = 1024 * 1024;
+  if (argc > 1)
+    size = std::strtoull(argv[1], nullptr, 10);
+
+  std::vector<std::string> corpus = buildCorpus(size);
+
+  run("linear scan", LinearScan(), corpus);
+  run("perfect hash", isKeyWord, corpus);
+
+  return 0;
+}
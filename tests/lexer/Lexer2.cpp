@@ -0,0 +1,298 @@
+#include "Lexer/Lexer.h"
+
+#include "SyntheticCorpus.h"
+#include "gtest/gtest.h"
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+
+using namespace rust_compiler::lexer;
+
+static std::string writeTemporaryFile(std::string_view code) {
+  llvm::SmallString<128> path;
+  int fd;
+  EXPECT_FALSE(llvm::sys::fs::createTemporaryFile("lexer2", "rs", fd, path));
+  llvm::raw_fd_ostream os(fd, /*shouldClose=*/true);
+  os << code;
+  return std::string(path.str());
+}
+
+TEST(Lexer2Test, CheckTokens) {
+  std::string path =
+      writeTemporaryFile("fn main() { // comment\n  let x = a::b(1.5, 0x1F, "
+                         "\"s\\\"\") >= 'c'; /* */ x..=y }");
+
+  for (LexerMode mode : {LexerMode::MemoryMappedUtf8, LexerMode::Utf32}) {
+    TokenStream ts = Lexer().lex(path, mode);
+
+    std::vector<TokenKind> kinds;
+    for (Token &tk : ts.getAsView())
+      kinds.push_back(tk.getKind());
+
+    std::vector<TokenKind> expected = {
+        TokenKind::Keyword,        TokenKind::Identifier,
+        TokenKind::ParenOpen,      TokenKind::ParenClose,
+        TokenKind::BraceOpen,      TokenKind::Keyword,
+        TokenKind::Identifier,     TokenKind::Eq,
+        TokenKind::Identifier,     TokenKind::PathSep,
+        TokenKind::Identifier,     TokenKind::ParenOpen,
+        TokenKind::FLOAT_LITERAL,  TokenKind::Comma,
+        TokenKind::INTEGER_LITERAL, TokenKind::Comma,
+        TokenKind::STRING_LITERAL, TokenKind::ParenClose,
+        TokenKind::Ge,             TokenKind::CHAR_LITERAL,
+        TokenKind::Semi,           TokenKind::Identifier,
+        TokenKind::DotDotEq,       TokenKind::Identifier,
+        TokenKind::BraceClose,     TokenKind::Eof};
+    EXPECT_EQ(kinds, expected);
+
+    EXPECT_EQ(ts.getAt(6).getSpelling(), "x");
+    EXPECT_EQ(ts.getAt(6).getLocation().getLineNumber(), 2u);
+    EXPECT_EQ(ts.getAt(12).getSpelling(), "1.5");
+  }
+
+  llvm::sys::fs::remove(path);
+};
+
+TEST(Lexer2Test, CheckLiterals) {
+  std::string path = writeTemporaryFile(
+      "1_000u64 0b1010 0o17 0xff_u8 2.5e3f32 \"x\\ty\" 'z' '\\n' b'a' "
+      "b\"\\x00\" r#\"raw \"q\" \"# br\"\\b\" \"é\\u{e9}\"");
+
+  for (LexerMode mode : {LexerMode::MemoryMappedUtf8, LexerMode::Utf32}) {
+    TokenStream ts = Lexer().lex(path, mode);
+    ASSERT_EQ(ts.getLength(), 14u);
+
+    // the spellings are the source text without the type hints
+    EXPECT_EQ(ts.getAt(0).getSpelling(), "1_000");
+    EXPECT_EQ(ts.getAt(0).getIntegerValue(), uint128_t(1000));
+    EXPECT_EQ(ts.getAt(0).getTypeHint(), TypeHint::u64);
+    EXPECT_EQ(ts.getAt(1).getIntegerValue(), uint128_t(10));
+    EXPECT_EQ(ts.getAt(2).getIntegerValue(), uint128_t(15));
+    EXPECT_EQ(ts.getAt(3).getSpelling(), "0xff_");
+    EXPECT_EQ(ts.getAt(3).getIntegerValue(), uint128_t(255));
+    EXPECT_EQ(ts.getAt(4).getKind(), TokenKind::FLOAT_LITERAL);
+    EXPECT_EQ(ts.getAt(4).getFloatValue(), 2500.0);
+
+    EXPECT_EQ(ts.getAt(5).getSpelling(), "\"x\\ty\"");
+    EXPECT_EQ(ts.getAt(5).getStringValue(), "x\ty");
+    EXPECT_EQ(ts.getAt(6).getStringValue(), "z");
+    EXPECT_EQ(ts.getAt(7).getStringValue(), "\n");
+    EXPECT_EQ(ts.getAt(8).getKind(), TokenKind::BYTE_LITERAL);
+    EXPECT_EQ(ts.getAt(8).getStringValue(), "a");
+    EXPECT_EQ(ts.getAt(9).getKind(), TokenKind::BYTE_STRING_LITERAL);
+    EXPECT_EQ(ts.getAt(9).getStringValue(), std::string_view("\0", 1));
+    EXPECT_EQ(ts.getAt(10).getKind(), TokenKind::RAW_STRING_LITERAL);
+    EXPECT_EQ(ts.getAt(10).getStringValue(), "raw \"q\" ");
+    EXPECT_EQ(ts.getAt(11).getKind(), TokenKind::RAW_BYTE_STRING_LITERAL);
+    EXPECT_EQ(ts.getAt(11).getStringValue(), "\\b");
+    EXPECT_EQ(ts.getAt(12).getStringValue(), "éé");
+  }
+
+  llvm::sys::fs::remove(path);
+};
+
+TEST(Lexer2Test, CheckUtf32Locations) {
+  std::string path = writeTemporaryFile("\"é\"\n  x");
+
+  // both modes point into the same loaded file, in bytes
+  TokenStream utf8 = Lexer().lex(path, LexerMode::MemoryMappedUtf8);
+  TokenStream utf32 = Lexer().lex(path, LexerMode::Utf32);
+  ASSERT_EQ(utf32.getLength(), 3u);
+  EXPECT_EQ(utf32.getAt(1).getSpelling(), "x");
+  EXPECT_EQ(utf32.getAt(1).getOffset(), utf8.getAt(1).getOffset());
+  EXPECT_EQ(utf32.getAt(1).getLocation().getFileName(), path);
+  EXPECT_EQ(utf32.getAt(1).getLocation().getLineNumber(), 2u);
+  EXPECT_EQ(utf32.getAt(1).getLocation().getColumnNumber(), 2u);
+
+  llvm::sys::fs::remove(path);
+};
+
+TEST(Lexer2Test, CheckStreaming) {
+  std::string path =
+      writeTemporaryFile(generateCorpus(CorpusMix::Literal, 4 * 1024));
+
+  TokenStream ts = Lexer().lex(path);
+
+  Lexer lexer;
+  lexer.open(path);
+  for (const Token &expected : ts.getAsView()) {
+    Token tk = lexer.next();
+    EXPECT_EQ(tk.getKind(), expected.getKind());
+    EXPECT_EQ(tk.getSpelling(), expected.getSpelling());
+    EXPECT_EQ(tk.getOffset(), expected.getOffset());
+  }
+  EXPECT_EQ(lexer.next().getKind(), TokenKind::Eof);
+
+  llvm::sys::fs::remove(path);
+};
+
+static std::vector<TokenKind> getKinds(TokenStream &ts) {
+  std::vector<TokenKind> kinds;
+  for (Token &tk : ts.getAsView())
+    kinds.push_back(tk.getKind());
+  return kinds;
+}
+
+TEST(Lexer2Test, CheckPunctuation) {
+  std::string path = writeTemporaryFile(
+      "... ..= <<= >>= :: -> => == != <= >= && || += -= *= /= %= ^= &= |= "
+      "<< >> .. ; , . ( ) { } [ ] @ # ~ ? : $ = ! < > - & | + * / ^ % _ "
+      "a<<=b&&&c");
+
+  for (LexerMode mode : {LexerMode::MemoryMappedUtf8, LexerMode::Utf32}) {
+    std::vector<TokenKind> expected = {
+        TokenKind::DotDotDot,   TokenKind::DotDotEq,   TokenKind::ShlEq,
+        TokenKind::ShrEq,       TokenKind::PathSep,    TokenKind::RArrow,
+        TokenKind::FatArrow,    TokenKind::EqEq,       TokenKind::Ne,
+        TokenKind::Le,          TokenKind::Ge,         TokenKind::AndAnd,
+        TokenKind::OrOr,        TokenKind::PlusEq,     TokenKind::MinusEq,
+        TokenKind::StarEq,      TokenKind::SlashEq,    TokenKind::PercentEq,
+        TokenKind::CaretEq,     TokenKind::AndEq,      TokenKind::OrEq,
+        TokenKind::Shl,         TokenKind::Shr,        TokenKind::DotDot,
+        TokenKind::Semi,        TokenKind::Comma,      TokenKind::Dot,
+        TokenKind::ParenOpen,   TokenKind::ParenClose, TokenKind::BraceOpen,
+        TokenKind::BraceClose,  TokenKind::SquareOpen, TokenKind::SquareClose,
+        TokenKind::At,          TokenKind::Hash,       TokenKind::Tilde,
+        TokenKind::QMark,       TokenKind::Colon,      TokenKind::Dollar,
+        TokenKind::Eq,          TokenKind::Not,        TokenKind::Lt,
+        TokenKind::Gt,          TokenKind::Minus,      TokenKind::And,
+        TokenKind::Or,          TokenKind::Plus,       TokenKind::Star,
+        TokenKind::Slash,       TokenKind::Caret,      TokenKind::Percent,
+        TokenKind::Underscore,
+        // maximal munch
+        TokenKind::Identifier,  TokenKind::ShlEq,      TokenKind::Identifier,
+        TokenKind::AndAnd,      TokenKind::And,        TokenKind::Identifier,
+        TokenKind::Eof};
+    TokenStream ts = Lexer().lex(path, mode);
+    EXPECT_EQ(getKinds(ts), expected);
+  }
+
+  llvm::sys::fs::remove(path);
+};
+
+TEST(Lexer2Test, CheckNumericLiterals) {
+  std::string path =
+      writeTemporaryFile("0b1010 0o17 0xfF 1_000 1.5 1e5 2.5E-3 1..2 1.max "
+                         "7usize 3i8 0b1u8 0o7i64 0x1Fu16 2.0f32 1e3f64");
+
+  for (LexerMode mode : {LexerMode::MemoryMappedUtf8, LexerMode::Utf32}) {
+    TokenStream ts = Lexer().lex(path, mode);
+
+    std::vector<TokenKind> expected = {
+        TokenKind::INTEGER_LITERAL, TokenKind::INTEGER_LITERAL,
+        TokenKind::INTEGER_LITERAL, TokenKind::INTEGER_LITERAL,
+        TokenKind::FLOAT_LITERAL,   TokenKind::FLOAT_LITERAL,
+        TokenKind::FLOAT_LITERAL,
+        // a range and a method call, not floats
+        TokenKind::INTEGER_LITERAL, TokenKind::DotDot,
+        TokenKind::INTEGER_LITERAL, TokenKind::INTEGER_LITERAL,
+        TokenKind::Dot,             TokenKind::Identifier,
+        // type hints
+        TokenKind::INTEGER_LITERAL, TokenKind::INTEGER_LITERAL,
+        TokenKind::INTEGER_LITERAL, TokenKind::INTEGER_LITERAL,
+        TokenKind::INTEGER_LITERAL, TokenKind::FLOAT_LITERAL,
+        TokenKind::FLOAT_LITERAL,   TokenKind::Eof};
+    ASSERT_EQ(getKinds(ts), expected);
+
+    for (size_t i = 0; i < 13; ++i)
+      EXPECT_EQ(ts.getAt(i).getTypeHint(), std::nullopt);
+    EXPECT_EQ(ts.getAt(13).getTypeHint(), TypeHint::usize);
+    EXPECT_EQ(ts.getAt(14).getTypeHint(), TypeHint::i8);
+    EXPECT_EQ(ts.getAt(15).getTypeHint(), TypeHint::u8);
+    EXPECT_EQ(ts.getAt(16).getTypeHint(), TypeHint::i64);
+    EXPECT_EQ(ts.getAt(17).getTypeHint(), TypeHint::u16);
+    EXPECT_EQ(ts.getAt(18).getTypeHint(), TypeHint::f32);
+    EXPECT_EQ(ts.getAt(19).getTypeHint(), TypeHint::f64);
+  }
+
+  llvm::sys::fs::remove(path);
+};
+
+TEST(Lexer2Test, CheckEscapes) {
+  std::string path = writeTemporaryFile(
+      "'a' '\\n' '\\'' '\\\\' '\\x41' '\\u{1F600}' 'é' 'a 'static\n"
+      "\"a\\\"b\" \"\\\\\" \"\\u{e9}\\t\" \"two\nlines\" \"a\\\n  b\" b'\\'' "
+      "b\"\\x7f\\\"\" x");
+
+  for (LexerMode mode : {LexerMode::MemoryMappedUtf8, LexerMode::Utf32}) {
+    TokenStream ts = Lexer().lex(path, mode);
+
+    std::vector<TokenKind> expected = {
+        TokenKind::CHAR_LITERAL,        TokenKind::CHAR_LITERAL,
+        TokenKind::CHAR_LITERAL,        TokenKind::CHAR_LITERAL,
+        TokenKind::CHAR_LITERAL,        TokenKind::CHAR_LITERAL,
+        TokenKind::CHAR_LITERAL,        TokenKind::LIFETIME_OR_LABEL,
+        TokenKind::LIFETIME_TOKEN,      TokenKind::STRING_LITERAL,
+        TokenKind::STRING_LITERAL,      TokenKind::STRING_LITERAL,
+        TokenKind::STRING_LITERAL,      TokenKind::STRING_LITERAL,
+        TokenKind::BYTE_LITERAL,        TokenKind::BYTE_STRING_LITERAL,
+        TokenKind::Identifier,          TokenKind::Eof};
+    ASSERT_EQ(getKinds(ts), expected);
+
+    // the newlines inside strings are counted
+    EXPECT_EQ(ts.getAt(9).getLocation().getLineNumber(), 2u);
+    EXPECT_EQ(ts.getAt(16).getLocation().getLineNumber(), 4u);
+    EXPECT_EQ(ts.getAt(16).getSpelling(), "x");
+  }
+
+  llvm::sys::fs::remove(path);
+};
+
+TEST(Lexer2Test, CheckRawIdentifiers) {
+  // the file ends inside a multi-byte code point's identifier
+  std::string path = writeTemporaryFile("r#match r#foo_bar naïvé");
+
+  for (LexerMode mode : {LexerMode::MemoryMappedUtf8, LexerMode::Utf32}) {
+    TokenStream ts = Lexer().lex(path, mode);
+
+    ASSERT_EQ(getKinds(ts),
+              std::vector<TokenKind>({TokenKind::Identifier,
+                                      TokenKind::Identifier,
+                                      TokenKind::Identifier, TokenKind::Eof}));
+    EXPECT_EQ(ts.getAt(0).getSpelling(), "match");
+    EXPECT_EQ(ts.getAt(0).getLocation().getColumnNumber(), 0u);
+    EXPECT_EQ(ts.getAt(1).getSpelling(), "foo_bar");
+    EXPECT_EQ(ts.getAt(2).getSpelling(), "naïvé");
+  }
+
+  llvm::sys::fs::remove(path);
+};
+
+TEST(Lexer2Test, CheckIdentifiers) {
+  std::string path = writeTemporaryFile("_x fn fné crate self_ _é");
+
+  for (LexerMode mode : {LexerMode::MemoryMappedUtf8, LexerMode::Utf32}) {
+    TokenStream ts = Lexer().lex(path, mode);
+
+    ASSERT_EQ(getKinds(ts),
+              std::vector<TokenKind>(
+                  {TokenKind::Identifier, TokenKind::Keyword,
+                   TokenKind::Identifier, TokenKind::Keyword,
+                   TokenKind::Identifier, TokenKind::Identifier,
+                   TokenKind::Eof}));
+    EXPECT_EQ(ts.getAt(0).getSpelling(), "_x");
+    EXPECT_EQ(ts.getAt(1).getKeyWordKind(), KeyWordKind::KW_FN);
+    EXPECT_EQ(ts.getAt(2).getSpelling(), "fné");
+    EXPECT_EQ(ts.getAt(3).getKeyWordKind(), KeyWordKind::KW_CRATE);
+    EXPECT_EQ(ts.getAt(4).getSpelling(), "self_");
+    EXPECT_EQ(ts.getAt(5).getSpelling(), "_é");
+  }
+
+  llvm::sys::fs::remove(path);
+};
+
+TEST(Lexer2Test, CheckSyntheticCorpus) {
+  for (CorpusMix mix : {CorpusMix::Identifier, CorpusMix::Literal,
+                        CorpusMix::Comment, CorpusMix::Unicode}) {
+    std::string corpus = generateCorpus(mix, 16 * 1024);
+    EXPECT_EQ(corpus, generateCorpus(mix, 16 * 1024));
+
+    std::string path = writeTemporaryFile(corpus);
+    TokenStream utf8 = Lexer().lex(path, LexerMode::MemoryMappedUtf8);
+    TokenStream utf32 = Lexer().lex(path, LexerMode::Utf32);
+    EXPECT_GT(utf8.getLength(), 1000u);
+    EXPECT_EQ(utf8.getLength(), utf32.getLength());
+    llvm::sys::fs::remove(path);
+  }
+};
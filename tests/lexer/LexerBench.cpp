@@ -0,0 +1,196 @@
+#include "Basic/SourceManager.h"
+#include "Lexer/Lexer.h"
+#include "SyntheticCorpus.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fcntl.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/raw_ostream.h>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+/// Throughput benchmark for the legacy lexer::lex and for Lexer::lex in both
+/// modes on synthetic corpora. For every lexer and corpus it reports the
+/// tokens/s, MB/s, and peak RSS. Every run is a forked child: the peak RSS
+/// is not polluted by earlier runs, and a lexer that rejects a corpus
+/// (e.g., the legacy lexer on Unicode) exits without ending the benchmark.
+
+using namespace rust_compiler;
+using namespace rust_compiler::lexer;
+
+namespace {
+
+llvm::cl::opt<unsigned> SizeMB("size", llvm::cl::desc("corpus size in MB"),
+                               llvm::cl::init(8));
+
+llvm::cl::list<std::string>
+    Mixes("mix",
+          llvm::cl::desc("identifier, literal, comment, or unicode "
+                         "(default: all)"),
+          llvm::cl::CommaSeparated);
+
+llvm::cl::opt<unsigned>
+    Repetitions("repetitions",
+                llvm::cl::desc("runs per lexer and corpus; the fastest one "
+                               "is reported"),
+                llvm::cl::init(3));
+
+llvm::cl::opt<unsigned> Seed("seed", llvm::cl::desc("corpus seed"),
+                             llvm::cl::init(1));
+
+enum class LexerKind { Legacy, MemoryMappedUtf8, Utf32 };
+
+std::string_view LexerKind2String(LexerKind kind) {
+  switch (kind) {
+  case LexerKind::Legacy:
+    return "lexer::lex";
+  case LexerKind::MemoryMappedUtf8:
+    return "Lexer::lex (utf8)";
+  case LexerKind::Utf32:
+    return "Lexer::lex (utf32)";
+  }
+  return "unknown";
+}
+
+struct RunResult {
+  uint64_t tokens;
+  double seconds;
+  /// in KB
+  long peakRSS;
+};
+
+TokenStream runLexer(LexerKind kind, const std::string &path) {
+  switch (kind) {
+  case LexerKind::Legacy:
+    return lex(basic::getSourceManager().loadFile(path));
+  case LexerKind::MemoryMappedUtf8:
+    return Lexer().lex(path, LexerMode::MemoryMappedUtf8);
+  case LexerKind::Utf32:
+    return Lexer().lex(path, LexerMode::Utf32);
+  }
+  return TokenStream();
+}
+
+/// lexes path in a child process; nullopt if the lexer failed
+std::optional<RunResult> runChild(LexerKind kind, const std::string &path) {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    llvm::errs() << "pipe failed"
+                 << "\n";
+    exit(EXIT_FAILURE);
+  }
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    // the legacy lexer reports progress on stdout
+    int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, STDOUT_FILENO);
+
+    auto start = std::chrono::steady_clock::now();
+    TokenStream ts = runLexer(kind, path);
+    auto stop = std::chrono::steady_clock::now();
+
+    RunResult result = {ts.getLength(),
+                        std::chrono::duration<double>(stop - start).count(),
+                        0};
+    if (write(fds[1], &result, sizeof(result)) != sizeof(result))
+      _exit(EXIT_FAILURE);
+    _exit(EXIT_SUCCESS);
+  }
+
+  close(fds[1]);
+  RunResult result;
+  ssize_t bytes = read(fds[0], &result, sizeof(result));
+  close(fds[0]);
+
+  int status;
+  struct rusage usage;
+  wait4(pid, &status, 0, &usage);
+  if (bytes != sizeof(result) || !WIFEXITED(status) ||
+      WEXITSTATUS(status) != EXIT_SUCCESS)
+    return std::nullopt;
+
+  result.peakRSS = usage.ru_maxrss;
+#ifdef __APPLE__
+  result.peakRSS /= 1024; // bytes
+#endif
+  return result;
+}
+
+void run(CorpusMix mix) {
+  std::string corpus = generateCorpus(mix, size_t(SizeMB) << 20, Seed);
+
+  llvm::SmallString<128> path;
+  int fd;
+  if (llvm::sys::fs::createTemporaryFile("lexer-bench", "rs", fd, path)) {
+    llvm::errs() << "failed to create the corpus file"
+                 << "\n";
+    exit(EXIT_FAILURE);
+  }
+  {
+    llvm::raw_fd_ostream os(fd, /*shouldClose=*/true);
+    os << corpus;
+  }
+
+  for (LexerKind kind :
+       {LexerKind::Legacy, LexerKind::MemoryMappedUtf8, LexerKind::Utf32}) {
+    std::optional<RunResult> best;
+    for (unsigned i = 0; i < Repetitions; ++i) {
+      std::optional<RunResult> result = runChild(kind, std::string(path));
+      if (!result) {
+        best = std::nullopt;
+        break;
+      }
+      if (!best || result->seconds < best->seconds)
+        best = result;
+    }
+
+    llvm::outs() << CorpusMix2String(mix) << " " << LexerKind2String(kind)
+                 << ": ";
+    if (!best) {
+      llvm::outs() << "failed\n";
+      continue;
+    }
+    llvm::outs() << best->tokens << " tokens, "
+                 << llvm::format("%.2f", best->tokens / best->seconds / 1e6)
+                 << " Mtokens/s, "
+                 << llvm::format("%.1f", corpus.size() / best->seconds / 1e6)
+                 << " MB/s, " << best->peakRSS / 1024 << " MB peak RSS\n";
+  }
+
+  llvm::sys::fs::remove(path);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  llvm::cl::ParseCommandLineOptions(argc, argv, "lexer benchmark\n");
+
+  std::vector<CorpusMix> mixes;
+  for (const std::string &mix : Mixes) {
+    if (std::optional<CorpusMix> m = String2CorpusMix(mix)) {
+      mixes.push_back(*m);
+    } else {
+      llvm::errs() << "unknown mix: " << mix << "\n";
+      return EXIT_FAILURE;
+    }
+  }
+  if (mixes.empty())
+    mixes = {CorpusMix::Identifier, CorpusMix::Literal, CorpusMix::Comment,
+             CorpusMix::Unicode};
+
+  llvm::outs() << "corpus: " << SizeMB << " MB, seed " << Seed << "\n";
+  for (CorpusMix mix : mixes)
+    run(mix);
+
+  return 0;
+}
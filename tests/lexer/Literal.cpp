@@ -0,0 +1,85 @@
+#include "Lexer/Literal.h"
+
+#include "Lexer/Interner.h"
+#include "gtest/gtest.h"
+
+#include <limits>
+
+using namespace rust_compiler::lexer;
+
+TEST(LiteralTest, CheckIntegers) {
+  EXPECT_EQ(parseIntegerLiteral("0"), uint128_t(0));
+  EXPECT_EQ(parseIntegerLiteral("1_000_000"), uint128_t(1000000));
+  EXPECT_EQ(parseIntegerLiteral("0xff"), uint128_t(255));
+  EXPECT_EQ(parseIntegerLiteral("0xFF_FF"), uint128_t(65535));
+  EXPECT_EQ(parseIntegerLiteral("0o777"), uint128_t(511));
+  EXPECT_EQ(parseIntegerLiteral("0b1010"), uint128_t(10));
+
+  EXPECT_EQ(parseIntegerLiteral("0xffff_ffff_ffff_ffff_ffff_ffff_ffff_ffff"),
+            std::numeric_limits<uint128_t>::max());
+  EXPECT_EQ(parseIntegerLiteral("340282366920938463463374607431768211455"),
+            std::numeric_limits<uint128_t>::max());
+  EXPECT_EQ(parseIntegerLiteral("340282366920938463463374607431768211456"),
+            std::nullopt);
+
+  EXPECT_EQ(parseIntegerLiteral("0x"), std::nullopt);
+  EXPECT_EQ(parseIntegerLiteral("0b12"), std::nullopt);
+  EXPECT_EQ(parseIntegerLiteral("12a"), std::nullopt);
+};
+
+TEST(LiteralTest, CheckFloats) {
+  EXPECT_EQ(parseFloatLiteral("1.5"), 1.5);
+  EXPECT_EQ(parseFloatLiteral("1_000.25"), 1000.25);
+  EXPECT_EQ(parseFloatLiteral("2e3"), 2000.0);
+  EXPECT_EQ(parseFloatLiteral("25E-1"), 2.5);
+  EXPECT_EQ(parseFloatLiteral("1.x"), std::nullopt);
+};
+
+TEST(LiteralTest, CheckStrings) {
+  EXPECT_EQ(decodeStringLiteral("\"text\""), "text");
+  EXPECT_EQ(decodeStringLiteral("\"a\\nb\\t\\\\\\\"\""), "a\nb\t\\\"");
+  EXPECT_EQ(decodeStringLiteral("\"\\x41\\u{1F600}\\u{e9}\""),
+            "A\xF0\x9F\x98\x80\xC3\xA9");
+  EXPECT_EQ(decodeStringLiteral("\"a\\\n    b\""), "ab");
+  EXPECT_EQ(decodeStringLiteral("\"suffix\"foo"), "suffix");
+  EXPECT_EQ(decodeStringLiteral("'\\''"), "'");
+  EXPECT_EQ(decodeStringLiteral("'x'"), "x");
+  EXPECT_EQ(decodeStringLiteral("b'\\xff'"), "\xff");
+  EXPECT_EQ(decodeStringLiteral("b\"\\0\\xFE\""), std::string("\0\xFE", 2));
+  EXPECT_EQ(decodeStringLiteral("r\"\\n\""), "\\n");
+  EXPECT_EQ(decodeStringLiteral("r##\"a \"# b\"##"), "a \"# b");
+  EXPECT_EQ(decodeStringLiteral("br#\"\\x\"#"), "\\x");
+
+  EXPECT_EQ(decodeStringLiteral("\"\\xff\""), std::nullopt);
+  EXPECT_EQ(decodeStringLiteral("\"\\q\""), std::nullopt);
+  EXPECT_EQ(decodeStringLiteral("\"\\u{110000}\""), std::nullopt);
+  EXPECT_EQ(decodeStringLiteral("b\"\\u{41}\""), std::nullopt);
+};
+
+TEST(LiteralTest, CheckDecodedStringsAreCached) {
+  uint32_t plain = getInterner().intern("\"plain\"");
+  std::optional<std::string_view> text = getDecodedStringLiteral(plain);
+  ASSERT_TRUE(text);
+  EXPECT_EQ(*text, "plain");
+  // returned in place
+  EXPECT_EQ(text->data(), getInterner().lookup(plain).data() + 1);
+
+  uint32_t escaped = getInterner().intern("\"tab\\t\"");
+  std::optional<std::string_view> first = getDecodedStringLiteral(escaped);
+  std::optional<std::string_view> second = getDecodedStringLiteral(escaped);
+  ASSERT_TRUE(first && second);
+  EXPECT_EQ(*first, "tab\t");
+  EXPECT_EQ(first->data(), second->data());
+};
+
+TEST(LiteralTest, CheckDecodedIntegers) {
+  uint32_t hex = getInterner().intern("0xff_ff");
+  EXPECT_EQ(getDecodedIntegerLiteral(hex), uint128_t(65535));
+  // from the cache
+  EXPECT_EQ(getDecodedIntegerLiteral(hex), uint128_t(65535));
+
+  uint32_t overflow =
+      getInterner().intern("340282366920938463463374607431768211456");
+  EXPECT_EQ(getDecodedIntegerLiteral(overflow), std::nullopt);
+  EXPECT_EQ(getDecodedIntegerLiteral(overflow), std::nullopt);
+};
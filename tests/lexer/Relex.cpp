@@ -0,0 +1,137 @@
+#include "Basic/SourceManager.h"
+#include "Lexer/Lexer.h"
+#include "Lexer/Token.h"
+#include "Lexer/TokenStream.h"
+#include "SyntheticCorpus.h"
+
+#include "gtest/gtest.h"
+
+#include <cctype>
+#include <set>
+#include <string>
+
+using namespace rust_compiler;
+using namespace rust_compiler::lexer;
+
+namespace {
+
+/// Applies the edit to code, relexes, and compares with lexing the edited
+/// code from scratch.
+void checkRelex(std::string code, TextEdit edit, std::string_view text) {
+  ASSERT_EQ(edit.inserted, text.size());
+  basic::SourceManager &sm = basic::getSourceManager();
+
+  TokenStream previous = lex(sm.addBuffer("old.rs", code));
+
+  code.replace(edit.offset, edit.removed, text);
+  basic::FileId file = sm.addBuffer("new.rs", code);
+
+  TokenStream expected = lex(file);
+  TokenStream relexed = relex(previous, edit, file);
+
+  ASSERT_EQ(relexed.getLength(), expected.getLength());
+  for (size_t i = 0; i < expected.getLength(); ++i) {
+    Token e = expected.getAt(i);
+    Token r = relexed.getAt(i);
+    EXPECT_EQ(r.getKind(), e.getKind()) << i;
+    EXPECT_EQ(r.getSpelling(), e.getSpelling()) << i;
+    EXPECT_EQ(r.getLength(), e.getLength()) << i;
+    EXPECT_EQ(r.getLocation(), e.getLocation()) << i;
+    EXPECT_EQ(sm.getFileId(r.getLocation()), file) << i;
+  }
+}
+
+constexpr std::string_view Code = "fn main() {\n"
+                                  "    let foo = 5 + bar;\n"
+                                  "    // a comment\n"
+                                  "    baz(foo, \"text\");\n"
+                                  "}\n";
+
+} // namespace
+
+TEST(RelexTest, CheckReplaceIdentifier) {
+  // foo -> quux
+  checkRelex(std::string(Code), {20, 3, 4}, "quux");
+};
+
+TEST(RelexTest, CheckExtendToken) {
+  // 5 -> 57, and bar -> barbaz
+  checkRelex(std::string(Code), {27, 0, 1}, "7");
+  checkRelex(std::string(Code), {34, 0, 3}, "baz");
+};
+
+TEST(RelexTest, CheckSplitAndJoinTokens) {
+  checkRelex(std::string(Code), {32, 0, 1}, " ");
+  checkRelex(std::string(Code), {19, 1, 0}, "");
+};
+
+TEST(RelexTest, CheckOpenAndCloseComment) {
+  // comment out the let statement
+  checkRelex(std::string(Code), {16, 0, 2}, "//");
+  // end the comment early
+  checkRelex(std::string(Code), {48, 0, 1}, "\n");
+  // uncomment
+  checkRelex(std::string(Code), {39, 2, 0}, "");
+};
+
+TEST(RelexTest, CheckSplitString) {
+  // "text" -> "te", x, "xt"
+  checkRelex(std::string(Code), {67, 0, 7}, "\", x, \"");
+};
+
+TEST(RelexTest, CheckEditAtEnds) {
+  checkRelex(std::string(Code), {0, 0, 10}, "struct S;\n");
+  checkRelex(std::string(Code), {Code.size(), 0, 10}, "struct S;\n");
+  checkRelex(std::string(Code), {0, Code.size(), 3}, "fn ");
+};
+
+TEST(RelexTest, CheckSyntheticCorpus) {
+  std::string code = generateCorpus(CorpusMix::Comment, 16 * 1024);
+  for (uint32_t offset = 7; offset < code.size(); offset += 997) {
+    // keep the quotes of strings balanced
+    while (!isalnum(code[offset]))
+      ++offset;
+    checkRelex(code, {offset, 1, 2}, "xy");
+  }
+};
+
+TEST(RelexTest, CheckRepeatedEdits) {
+  basic::SourceManager &sm = basic::getSourceManager();
+  std::string code(Code);
+  basic::FileId file = sm.addBuffer("edited.rs", code);
+  TokenStream ts = lex(file);
+
+  // the first insertion moves the file to a larger range, which the
+  // remaining edits reuse
+  std::set<basic::FileId> files;
+  for (unsigned i = 0; i < 10000; ++i) {
+    TextEdit edit = i % 2 == 0 ? TextEdit{27, 0, 1} : TextEdit{27, 1, 0};
+    if (i % 2 == 0)
+      code.insert(27, "7");
+    else
+      code.erase(27, 1);
+    file = sm.replaceBuffer(file, code);
+    ts = relex(ts, edit, file);
+    files.insert(file);
+  }
+  EXPECT_EQ(files.size(), 1u);
+
+  // appending grows the range geometrically
+  files.clear();
+  for (unsigned i = 0; i < 1000; ++i) {
+    TextEdit edit = {uint32_t(code.size()), 0, 3};
+    code.append("x;\n");
+    file = sm.replaceBuffer(file, code);
+    ts = relex(ts, edit, file);
+    files.insert(file);
+  }
+  EXPECT_LE(files.size(), 8u);
+
+  TokenStream expected = lex(file);
+  ASSERT_EQ(ts.getLength(), expected.getLength());
+  for (size_t i = 0; i < expected.getLength(); ++i) {
+    EXPECT_EQ(ts.getAt(i).getKind(), expected.getAt(i).getKind()) << i;
+    EXPECT_EQ(ts.getAt(i).getLocation(), expected.getAt(i).getLocation())
+        << i;
+  }
+};
@@ -0,0 +1,90 @@
+#include "Lexer/ScanKernels.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace rust_compiler::lexer;
+
+namespace {
+
+using ScanKernel = const char *(*)(const char *, const char *);
+
+const ScanKernelISA ISAs[] = {ScanKernelISA::Scalar, ScanKernelISA::SSE2,
+                              ScanKernelISA::AVX2};
+
+/// Runs kernel on every suffix of text with every supported instruction set
+/// and compares the results against the scalar kernel.
+void checkAgainstScalar(ScanKernel kernel, const std::string &text) {
+  ScanKernelISA saved = getScanKernelISA();
+  const char *begin = text.data();
+  const char *end = text.data() + text.size();
+
+  std::vector<const char *> expected;
+  ASSERT_TRUE(setScanKernelISA(ScanKernelISA::Scalar));
+  for (const char *it = begin; it <= end; ++it)
+    expected.push_back(kernel(it, end));
+
+  for (ScanKernelISA isa : ISAs) {
+    if (!setScanKernelISA(isa))
+      continue;
+    for (const char *it = begin; it <= end; ++it)
+      EXPECT_EQ(kernel(it, end), expected[it - begin])
+          << ScanKernelISA2String(isa) << " at offset " << (it - begin);
+  }
+
+  setScanKernelISA(saved);
+}
+
+std::string repeat(std::string_view text, size_t count) {
+  std::string result;
+  for (size_t i = 0; i < count; ++i)
+    result += text;
+  return result;
+}
+
+} // namespace
+
+TEST(ScanKernelsTest, CheckWhiteSpace) {
+  std::string text = repeat(" \t\r\n\v\f", 13) + "x" + repeat("  ", 40) +
+                     "\xc3\xa9" + repeat("\n", 33);
+
+  checkAgainstScalar(scanWhiteSpace, text);
+
+  setScanKernelISA(ScanKernelISA::Scalar);
+  EXPECT_EQ(scanWhiteSpace(text.data(), text.data() + text.size()),
+            text.data() + 13 * 6);
+};
+
+TEST(ScanKernelsTest, CheckLineComment) {
+  std::string text = repeat("let x = 5; /* */ ", 5) + "\n" +
+                     repeat("abc", 20) + "\xe6\x9d\xb1" + repeat("d", 47);
+
+  checkAgainstScalar(scanLineComment, text);
+};
+
+TEST(ScanKernelsTest, CheckBlockComment) {
+  std::string text = repeat("fn main() {} ", 7) + "*" + repeat("x", 40) +
+                     "/" + repeat("y", 70) + "\xc3\xa9" + repeat("z", 5);
+
+  checkAgainstScalar(scanBlockComment, text);
+};
+
+TEST(ScanKernelsTest, CheckIdentifierContinue) {
+  std::string text = repeat("abcXYZ_019", 9) + "@" + repeat("a", 31) + "[" +
+                     repeat("Z", 32) + "`{/:" + repeat("_", 65) + "\xc3\xa9";
+
+  checkAgainstScalar(scanIdentifierContinue, text);
+};
+
+TEST(ScanKernelsTest, CheckAllBytes) {
+  std::string text;
+  for (unsigned i = 1; i < 256; ++i)
+    text += repeat(std::string(1, static_cast<char>(i)), 3) + "a_9 ";
+
+  checkAgainstScalar(scanWhiteSpace, text);
+  checkAgainstScalar(scanLineComment, text);
+  checkAgainstScalar(scanBlockComment, text);
+  checkAgainstScalar(scanIdentifierContinue, text);
+};
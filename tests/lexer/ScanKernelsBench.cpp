@@ -0,0 +1,124 @@
+#include "Lexer/ScanKernels.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/raw_ostream.h>
+#include <string>
+#include <unicode/uchar.h>
+#include <unicode/utf8.h>
+
+/// Micro-benchmark for the scanning kernels of the Lexer. It reports the
+/// throughput in MB/s of the per-code-point ICU loops that the Lexer used
+/// before and of the kernels for every supported instruction set.
+
+using namespace rust_compiler::lexer;
+
+namespace {
+
+using ScanKernel = const char *(*)(const char *, const char *);
+
+constexpr unsigned Repetitions = 50;
+
+/// the old loops: decode a code point and query ICU for each byte
+const char *scanWhiteSpaceICU(const char *begin, const char *end) {
+  int32_t offset = 0;
+  int32_t length = end - begin;
+  while (offset < length) {
+    int32_t next = offset;
+    UChar32 c;
+    U8_NEXT(begin, next, length, c);
+    if (!u_hasBinaryProperty(c, UCHAR_PATTERN_WHITE_SPACE))
+      break;
+    offset = next;
+  }
+  return begin + offset;
+}
+
+const char *scanIdentifierContinueICU(const char *begin, const char *end) {
+  int32_t offset = 0;
+  int32_t length = end - begin;
+  while (offset < length) {
+    int32_t next = offset;
+    UChar32 c;
+    U8_NEXT(begin, next, length, c);
+    if (!u_hasBinaryProperty(c, UCHAR_XID_CONTINUE))
+      break;
+    offset = next;
+  }
+  return begin + offset;
+}
+
+const char *scanLineCommentICU(const char *begin, const char *end) {
+  int32_t offset = 0;
+  int32_t length = end - begin;
+  while (offset < length) {
+    int32_t next = offset;
+    UChar32 c;
+    U8_NEXT(begin, next, length, c);
+    if (c == '\n')
+      break;
+    offset = next;
+  }
+  return begin + offset;
+}
+
+void run(std::string_view name, std::string_view isa, ScanKernel kernel,
+         const std::string &input) {
+  const char *end = input.data() + input.size();
+  size_t bytes = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < Repetitions; ++i)
+    bytes += kernel(input.data(), end) - input.data();
+  auto stop = std::chrono::steady_clock::now();
+
+  if (bytes != input.size() * Repetitions) {
+    llvm::errs() << name << " (" << isa << "): stopped early"
+                 << "\n";
+    exit(EXIT_FAILURE);
+  }
+
+  double seconds = std::chrono::duration<double>(stop - start).count();
+  llvm::outs() << name << " (" << isa << "): "
+               << llvm::format("%.1f", bytes / seconds / 1e6) << " MB/s\n";
+}
+
+void runAll(std::string_view name, ScanKernel before, ScanKernel after,
+            const std::string &input) {
+  run(name, "icu", before, input);
+
+  ScanKernelISA saved = getScanKernelISA();
+  for (ScanKernelISA isa : {ScanKernelISA::Scalar, ScanKernelISA::SSE2,
+                            ScanKernelISA::AVX2}) {
+    if (setScanKernelISA(isa))
+      run(name, ScanKernelISA2String(isa), after, input);
+  }
+  setScanKernelISA(saved);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  size_t size = 16 * 1024 * 1024;
+  if (argc > 1)
+    size = std::strtoull(argv[1], nullptr, 10);
+
+  std::string whiteSpace;
+  std::string identifier;
+  std::string comment;
+  const std::string_view pattern = "let x = foo(bar, 42); /* */ ";
+  for (size_t i = 0; i < size; ++i) {
+    whiteSpace += " \t\n"[i % 3];
+    identifier += "abcdefghijklmnopqrstuvwxyz_0123456789ABCDEF"[i % 43];
+    comment += pattern[i % pattern.size()];
+  }
+
+  runAll("whitespace", scanWhiteSpaceICU, scanWhiteSpace, whiteSpace);
+  runAll("line comment", scanLineCommentICU, scanLineComment, comment);
+  runAll("identifier", scanIdentifierContinueICU, scanIdentifierContinue,
+         identifier);
+
+  return 0;
+}
@@ -0,0 +1,78 @@
+#include "Basic/SourceManager.h"
+
+#include "Location.h"
+#include "gtest/gtest.h"
+
+using namespace rust_compiler;
+using namespace rust_compiler::basic;
+
+TEST(SourceManagerTest, CheckLineAndColumn) {
+  SourceManager &sm = getSourceManager();
+
+  FileId file = sm.addBuffer("main.rs", "fn main() {\n\n  foo();\n}");
+
+  Location loc = sm.getLocation(file, 15);
+  EXPECT_EQ(loc.getFileName(), "main.rs");
+  EXPECT_EQ(loc.getLineNumber(), 3u);
+  EXPECT_EQ(loc.getColumnNumber(), 2u);
+  EXPECT_EQ(sm.getFileId(loc), file);
+  EXPECT_EQ(sm.getFileOffset(loc), 15u);
+
+  Location start = sm.getLocation(file, 0);
+  EXPECT_EQ(start.getLineNumber(), 1u);
+  EXPECT_EQ(start.getColumnNumber(), 0u);
+
+  // the end of the file
+  Location end = sm.getLocation(file, 23);
+  EXPECT_EQ(end.getLineNumber(), 4u);
+  EXPECT_EQ(end.getColumnNumber(), 1u);
+};
+
+TEST(SourceManagerTest, CheckMultipleFiles) {
+  SourceManager &sm = getSourceManager();
+
+  FileId a = sm.addBuffer("a.rs", "struct A;\n");
+  FileId b = sm.addBuffer("b.rs", "\nstruct B;\n");
+
+  EXPECT_NE(a, b);
+  EXPECT_EQ(sm.getBuffer(b), "\nstruct B;\n");
+  EXPECT_EQ(sm.getLocation(a, 3).getFileName(), "a.rs");
+  EXPECT_EQ(sm.getLocation(b, 3).getFileName(), "b.rs");
+  EXPECT_EQ(sm.getLocation(b, 3).getLineNumber(), 2u);
+  EXPECT_LT(sm.getLocation(a, 3), sm.getLocation(b, 0));
+};
+
+TEST(SourceManagerTest, CheckExplicitLocations) {
+  Location loc = Location("macro.rs", 12, 4);
+  EXPECT_EQ(loc.getFileName(), "macro.rs");
+  EXPECT_EQ(loc.getLineNumber(), 12u);
+  EXPECT_EQ(loc.getColumnNumber(), 4u);
+
+  // equal explicit locations share their offset
+  EXPECT_EQ(Location("macro.rs", 12, 4), loc);
+  EXPECT_NE(Location("macro.rs", 12, 5), loc);
+
+  EXPECT_EQ(Location::getBuiltinLocation().getFileName(), "builtins.cpp");
+  EXPECT_EQ(Location::getEmptyLocation().getFileName(), "empty.cpp");
+  EXPECT_EQ(Location().getFileName(), "default.constructor.rs");
+  EXPECT_NE(Location::getBuiltinLocation(), Location::getEmptyLocation());
+};
+
+TEST(SourceManagerTest, CheckReplaceBuffer) {
+  SourceManager &sm = getSourceManager();
+
+  FileId file = sm.addBuffer("edit.rs", "fn f() {}\n");
+  Location start = sm.getLocation(file, 0);
+
+  // grows into a new range, which shorter contents reuse
+  FileId grown = sm.replaceBuffer(file, "fn f() {\n  g();\n}\n");
+  EXPECT_NE(grown, file);
+  EXPECT_EQ(sm.getFileName(grown), "edit.rs");
+  EXPECT_NE(sm.getLocation(grown, 0), start);
+
+  EXPECT_EQ(sm.replaceBuffer(grown, "fn f() {\n}\n"), grown);
+  EXPECT_EQ(sm.getBuffer(grown), "fn f() {\n}\n");
+  // the line table follows the new contents
+  EXPECT_EQ(sm.getLocation(grown, 9).getLineNumber(), 2u);
+  EXPECT_EQ(sm.getLocation(grown, 9).getColumnNumber(), 0u);
+};
@@ -0,0 +1,217 @@
+#include "SyntheticCorpus.h"
+
+#include <random>
+
+namespace rust_compiler::lexer {
+
+namespace {
+
+constexpr std::string_view Words[] = {
+    "foo",    "bar",   "baz",    "data",  "index", "buffer", "count",
+    "value",  "node",  "parser", "token", "result", "state", "context",
+    "offset", "entry", "scope",  "item",  "config", "handle"};
+
+constexpr std::string_view UnicodeWords[] = {
+    "größe", "naïve", "café",  "переменная", "значение", "名前",
+    "変数",  "δέλτα", "λάμδα", "ünïcödé",    "œuvre",    "façade"};
+
+constexpr std::string_view Types[] = {"u32", "u64", "usize", "i32",
+                                      "bool", "String", "Vec"};
+
+class CorpusGenerator {
+  CorpusMix mix;
+  std::mt19937 rng;
+  std::string out;
+
+public:
+  CorpusGenerator(CorpusMix mix, unsigned seed) : mix(mix), rng(seed) {}
+
+  std::string generate(size_t size) {
+    out.reserve(size + 1024);
+    while (out.size() < size)
+      function();
+    return std::move(out);
+  }
+
+private:
+  unsigned random(unsigned n) { return rng() % n; }
+  bool percent(unsigned p) { return random(100) < p; }
+
+  template <size_t N> std::string_view pick(const std::string_view (&a)[N]) {
+    return a[random(N)];
+  }
+
+  void identifier() {
+    if (mix == CorpusMix::Unicode && percent(50)) {
+      out += pick(UnicodeWords);
+    } else {
+      out += pick(Words);
+    }
+    if (mix == CorpusMix::Identifier) {
+      out += '_';
+      out += pick(Words);
+    }
+    if (percent(30)) {
+      out += '_';
+      out += std::to_string(random(1000));
+    }
+  }
+
+  void words(unsigned count) {
+    for (unsigned i = 0; i < count; ++i) {
+      if (i > 0)
+        out += ' ';
+      out += mix == CorpusMix::Unicode && percent(50) ? pick(UnicodeWords)
+                                                      : pick(Words);
+    }
+  }
+
+  void literal() {
+    switch (random(mix == CorpusMix::Literal ? 3 : 2)) {
+    case 0:
+      // the legacy lexer only accepts up to four digits
+      out += std::to_string(random(10000));
+      break;
+    case 1:
+      out += '"';
+      words(1 + random(6));
+      out += '"';
+      break;
+    case 2:
+      out += std::to_string(random(1000));
+      out += '.';
+      out += std::to_string(random(1000));
+      break;
+    }
+  }
+
+  void comment() {
+    out += "    //";
+    if (percent(30))
+      out += '/';
+    out += ' ';
+    words(3 + random(10));
+    out += '\n';
+  }
+
+  void expression() {
+    unsigned n = mix == CorpusMix::Literal ? 1 : 4;
+    if (random(n + 1) == 0) {
+      literal();
+    } else if (mix == CorpusMix::Identifier && percent(50)) {
+      // a::b::c(x, y.z)
+      identifier();
+      out += "::";
+      identifier();
+      out += '(';
+      identifier();
+      out += ", ";
+      identifier();
+      out += '.';
+      identifier();
+      out += ')';
+    } else {
+      identifier();
+    }
+  }
+
+  void statement() {
+    if (mix == CorpusMix::Comment ? percent(60) : percent(5))
+      comment();
+
+    out += "    ";
+    switch (random(mix == CorpusMix::Literal ? 4 : 3)) {
+    case 0:
+      out += "let ";
+      identifier();
+      out += " = ";
+      expression();
+      out += " + ";
+      expression();
+      out += ";\n";
+      break;
+    case 1:
+      identifier();
+      out += '.';
+      identifier();
+      out += '(';
+      expression();
+      out += ");\n";
+      break;
+    case 2:
+      out += "if ";
+      identifier();
+      out += " > ";
+      expression();
+      out += " {\n        return ";
+      expression();
+      out += ";\n    }\n";
+      break;
+    case 3:
+      out += "let ";
+      identifier();
+      out += " = [";
+      for (unsigned i = 0, e = 2 + random(6); i < e; ++i) {
+        if (i > 0)
+          out += ", ";
+        literal();
+      }
+      out += "];\n";
+      break;
+    }
+  }
+
+  void function() {
+    if (mix == CorpusMix::Comment)
+      comment();
+
+    out += "fn ";
+    identifier();
+    out += '(';
+    for (unsigned i = 0, e = random(4); i < e; ++i) {
+      if (i > 0)
+        out += ", ";
+      identifier();
+      out += ": ";
+      out += pick(Types);
+    }
+    out += ") -> ";
+    out += pick(Types);
+    out += " {\n";
+    for (unsigned i = 0, e = 2 + random(8); i < e; ++i)
+      statement();
+    out += "    ";
+    expression();
+    out += "\n}\n\n";
+  }
+};
+
+} // namespace
+
+std::string generateCorpus(CorpusMix mix, size_t size, unsigned seed) {
+  return CorpusGenerator(mix, seed).generate(size);
+}
+
+std::string_view CorpusMix2String(CorpusMix mix) {
+  switch (mix) {
+  case CorpusMix::Identifier:
+    return "identifier";
+  case CorpusMix::Literal:
+    return "literal";
+  case CorpusMix::Comment:
+    return "comment";
+  case CorpusMix::Unicode:
+    return "unicode";
+  }
+  return "unknown";
+}
+
+std::optional<CorpusMix> String2CorpusMix(std::string_view mix) {
+  for (CorpusMix m : {CorpusMix::Identifier, CorpusMix::Literal,
+                      CorpusMix::Comment, CorpusMix::Unicode})
+    if (CorpusMix2String(m) == mix)
+      return m;
+  return std::nullopt;
+}
+
+} // namespace rust_compiler::lexer
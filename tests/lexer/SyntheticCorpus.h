@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/// Generator for synthetic Rust sources with a configurable size and token
+/// mix, for benchmarking the lexer and the parser. The output is
+/// deterministic for a given seed.
+///
+/// The ASCII mixes only use constructs that the legacy lexer::lex accepts:
+/// line and doc comments, decimal integers, and strings without escapes.
+namespace rust_compiler::lexer {
+
+enum class CorpusMix {
+  /// long identifiers, paths, and method calls
+  Identifier,
+  /// integer, float, and string literals
+  Literal,
+  /// line and doc comments between the statements
+  Comment,
+  /// non-ASCII identifiers, strings, and comments
+  Unicode
+};
+
+/// Returns a sequence of functions of at least size bytes.
+std::string generateCorpus(CorpusMix mix, size_t size, unsigned seed = 1);
+
+std::string_view CorpusMix2String(CorpusMix mix);
+std::optional<CorpusMix> String2CorpusMix(std::string_view mix);
+
+} // namespace rust_compiler::lexer
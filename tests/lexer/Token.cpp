@@ -0,0 +1,155 @@
+#include "Lexer/Token.h"
+
+#include "Lexer/Lexer.h"
+#include "Lexer/TokenStream.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rust_compiler::lexer;
+
+TEST(TokenTest, CheckLocation) {
+
+  std::string text = "fn main() {\n  let x = 5;\n}\n";
+
+  TokenStream ts = lex(text, "lib.rs");
+
+  Token let = ts.getAt(5);
+  ASSERT_TRUE(let.isKeyWord());
+  EXPECT_EQ(let.getKeyWordKind(), KeyWordKind::KW_LET);
+  EXPECT_EQ(let.getLocation().getFileName(), "lib.rs");
+  EXPECT_EQ(let.getLocation().getLineNumber(), 2u);
+  EXPECT_EQ(let.getLocation().getColumnNumber(), 2u);
+  EXPECT_EQ(let.getOffset(), 14u);
+  EXPECT_EQ(let.getLength(), 3u);
+
+  Token brace = ts.getAt(ts.getLength() - 2);
+  EXPECT_EQ(brace.getKind(), TokenKind::BraceClose);
+  EXPECT_EQ(brace.getLocation().getLineNumber(), 3u);
+  EXPECT_EQ(brace.getLocation().getColumnNumber(), 0u);
+};
+
+TEST(TokenTest, CheckSpelling) {
+
+  std::string text = "let foo = foo + 42;\n";
+
+  TokenStream ts = lex(text, "lib.rs");
+
+  EXPECT_EQ(ts.getAt(1).getSpelling(), "foo");
+  EXPECT_EQ(ts.getAt(1).getIdentifier().toString(), "foo");
+  EXPECT_EQ(ts.getAt(5).getLiteral(), "42");
+  EXPECT_EQ(ts.getAt(2).getSpelling(), "");
+  // interned spellings share their storage
+  EXPECT_EQ(ts.getAt(1).getSpelling().data(),
+            ts.getAt(3).getSpelling().data());
+};
+
+TEST(TokenTest, CheckSynthesized) {
+  rust_compiler::Location loc("macro.rs", 7, 3);
+
+  Token tk = Token(loc, TokenKind::Identifier, "bar");
+
+  EXPECT_EQ(tk.getSpelling(), "bar");
+  EXPECT_EQ(tk.getLocation().getFileName(), "macro.rs");
+  EXPECT_EQ(tk.getLocation().getLineNumber(), 7u);
+  EXPECT_EQ(tk.getLocation().getColumnNumber(), 3u);
+};
+
+TEST(TokenTest, CheckInstalledInterner) {
+  Interner &process = getInterner();
+  size_t processSize = process.getSize();
+
+  {
+    Interner interner;
+    interner.install();
+    ASSERT_EQ(&getInterner(), &interner);
+
+    // the spellings span several chunks; earlier views stay valid
+    std::vector<std::string_view> spellings;
+    for (unsigned i = 0; i < 5000; ++i) {
+      Token tk = Token(rust_compiler::Location("lib.rs", 1, 0),
+                       TokenKind::Identifier, "id" + std::to_string(i));
+      spellings.push_back(tk.getSpelling());
+    }
+    EXPECT_EQ(interner.getSize(), 5001u);
+    for (unsigned i = 0; i < 5000; ++i) {
+      EXPECT_EQ(spellings[i], "id" + std::to_string(i));
+      EXPECT_EQ(interner.lookup(i + 1).data(), spellings[i].data());
+    }
+
+    // concurrent lookups while interning
+    std::vector<std::thread> readers;
+    for (unsigned t = 0; t < 4; ++t)
+      readers.emplace_back([&] {
+        for (unsigned i = 0; i < 5000; ++i)
+          EXPECT_EQ(interner.lookup(i + 1), spellings[i]);
+      });
+    for (unsigned i = 5000; i < 10000; ++i)
+      interner.intern("id" + std::to_string(i));
+    for (std::thread &reader : readers)
+      reader.join();
+
+    interner.uninstall();
+  }
+
+  EXPECT_EQ(&getInterner(), &process);
+  EXPECT_EQ(process.getSize(), processSize);
+};
+
+TEST(TokenTest, CheckSlice) {
+
+  std::string text = "a b c d\n";
+
+  TokenStream ts = lex(text, "lib.rs");
+  TokenStream slice = ts.slice(1, 3);
+
+  ASSERT_EQ(slice.getLength(), 2u);
+  EXPECT_EQ(slice.getAt(0).getSpelling(), "b");
+  EXPECT_EQ(slice.getAt(1).getSpelling(), "c");
+};
+
+TEST(TokenTest, CheckMatchingDelimiters) {
+
+  std::string text = "f(a[0], { b }) { ( }";
+
+  TokenStream ts = lex(text, "lib.rs");
+
+  // f ( a [ 0 ] , { b } ) { ( } Eof
+  EXPECT_EQ(ts.getMatchingDelimiter(1), 10u);
+  EXPECT_EQ(ts.getMatchingDelimiter(10), 1u);
+  EXPECT_EQ(ts.getMatchingDelimiter(3), 5u);
+  EXPECT_EQ(ts.getMatchingDelimiter(7), 9u);
+  EXPECT_EQ(ts.getMatchingDelimiter(0), std::nullopt);
+  // the ( is unbalanced, the { still matches its }
+  EXPECT_EQ(ts.getMatchingDelimiter(11), 13u);
+  EXPECT_EQ(ts.getMatchingDelimiter(12), std::nullopt);
+
+  // the offsets of a slice are its own
+  TokenStream args = ts.slice(2, 10);
+  EXPECT_EQ(args.getMatchingDelimiter(1), 3u);
+  EXPECT_EQ(args.getMatchingDelimiter(5), 7u);
+};
+
+TEST(TokenTest, CheckUnbalancedDelimiters) {
+
+  // many closers without an opener of their kind
+  std::string text = "{ ( " + std::string(10000, ']') + " ) }";
+
+  TokenStream ts = lex(text, "lib.rs");
+
+  // { ( ] ... ] ) } Eof
+  ASSERT_EQ(ts.getLength(), 10005u);
+  EXPECT_EQ(ts.getMatchingDelimiter(0), 10003u);
+  EXPECT_EQ(ts.getMatchingDelimiter(1), 10002u);
+  EXPECT_EQ(ts.getMatchingDelimiter(2), std::nullopt);
+  EXPECT_EQ(ts.getMatchingDelimiter(10001), std::nullopt);
+
+  // a closer pops the unmatched openers above its opener
+  TokenStream popped = lex("{ ( [ } )", "lib.rs");
+  EXPECT_EQ(popped.getMatchingDelimiter(0), 3u);
+  EXPECT_EQ(popped.getMatchingDelimiter(1), std::nullopt);
+  EXPECT_EQ(popped.getMatchingDelimiter(2), std::nullopt);
+  EXPECT_EQ(popped.getMatchingDelimiter(4), std::nullopt);
+};
@@ -0,0 +1,53 @@
+#include "AST/ASTContext.h"
+
+#include "Lexer/Lexer.h"
+#include "Parser/Parser.h"
+#include "../SessionFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace rust_compiler::lexer;
+using namespace rust_compiler::parser;
+using namespace rust_compiler::ast;
+using namespace rust_compiler::adt;
+
+using ASTContextTest = SessionTest;
+
+TEST_F(ASTContextTest, CheckArena) {
+  std::string text = "fn foo() -> u32 { 1 }\nfn bar() -> u32 { 2 }";
+
+  TokenStream ts = lex(text, "lib.rs");
+
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+
+  ASSERT_TRUE(crate.isOk());
+  EXPECT_GT(context->getBytesAllocated(), 0u);
+  EXPECT_EQ(crate.getValue()->getASTContext(), context);
+
+  // the edges are non-owning
+  ASSERT_EQ(crate.getValue()->getItems().size(), 2u);
+  EXPECT_EQ(crate.getValue()->getItems()[0].use_count(), 0);
+};
+
+TEST_F(ASTContextTest, CheckLifetime) {
+  std::shared_ptr<Crate> crate;
+  {
+    std::string text = "fn foo() -> u32 { 1 }";
+    TokenStream ts = lex(text, "lib.rs");
+    Parser parser = {ts, std::make_shared<ASTContext>()};
+    StringResult<std::shared_ptr<Crate>> result =
+        parser.parseCrateModule("crate", 0);
+    ASSERT_TRUE(result.isOk());
+    crate = result.getValue();
+  }
+
+  // the crate keeps the arena alive
+  ASSERT_EQ(crate->getItems().size(), 1u);
+  EXPECT_EQ(crate->getItems()[0]->getItemKind(), ItemKind::VisItem);
+};
@@ -0,0 +1,83 @@
+#include "AST/BlockExpression.h"
+#include "AST/Function.h"
+#include "Lexer/Lexer.h"
+#include "Parser/Parser.h"
+#include "../SessionFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace rust_compiler::lexer;
+using namespace rust_compiler::parser;
+using namespace rust_compiler::ast;
+using namespace rust_compiler::adt;
+
+using DeferredBodiesTest = SessionTest;
+
+namespace {
+
+/// the node ids of the bodies, relative to the first one
+std::vector<uint32_t> parseBodies(const std::string &text, unsigned threads) {
+  TokenStream ts = lex(text, "lib.rs");
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+  parser.setDeferFunctionBodies(true);
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+  EXPECT_TRUE(crate.isOk());
+
+  std::vector<std::shared_ptr<Function>> functions =
+      parser.takeDeferredFunctions();
+  for (const std::shared_ptr<Function> &fun : functions)
+    EXPECT_TRUE(fun->hasDeferredBody());
+
+  StringResult<size_t> parsed = Parser::parseDeferredBodies(
+      *parser.getASTContext(), functions, llvm::hardware_concurrency(threads));
+  EXPECT_TRUE(parsed.isOk());
+  EXPECT_EQ(parsed.getValue(), functions.size());
+
+  std::vector<uint32_t> ids;
+  for (const std::shared_ptr<Function> &fun : functions) {
+    EXPECT_FALSE(fun->hasDeferredBody());
+    EXPECT_EQ(fun->getBody()->getExpressionKind(),
+              ExpressionKind::ExpressionWithBlock);
+    ids.push_back(fun->getBody()->getNodeId() -
+                  functions[0]->getBody()->getNodeId());
+  }
+  return ids;
+}
+
+} // namespace
+
+TEST_F(DeferredBodiesTest, CheckDeterministic) {
+  std::string text;
+  for (unsigned i = 0; i < 100; ++i)
+    text += "fn f" + std::to_string(i) +
+            "(x: u32) -> u32 { let y = x + 1; if y { return y; } y }\n";
+
+  std::vector<uint32_t> sequential = parseBodies(text, 1);
+  std::vector<uint32_t> parallel = parseBodies(text, 4);
+
+  ASSERT_EQ(sequential.size(), 100u);
+  EXPECT_EQ(sequential, parallel);
+};
+
+TEST_F(DeferredBodiesTest, CheckExhaustedBudget) {
+  // statements of one path expression need more ids than the budget
+  std::string text;
+  for (unsigned i = 0; i < 40; ++i) {
+    text += "fn f" + std::to_string(i) + "(x: u32) -> u32 {";
+    for (unsigned j = 0; j < (i % 2 ? 200u : 1u); ++j)
+      text += " x;";
+    text += " x }\n";
+  }
+
+  std::vector<uint32_t> sequential = parseBodies(text, 1);
+  std::vector<uint32_t> parallel = parseBodies(text, 4);
+
+  ASSERT_EQ(sequential.size(), 40u);
+  EXPECT_EQ(sequential, parallel);
+};
@@ -0,0 +1,55 @@
+#include "Basic/Ids.h"
+#include "Session/Session.h"
+
+#include <gtest/gtest.h>
+
+#include <llvm/Support/ThreadPool.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace rust_compiler::basic;
+using namespace rust_compiler::session;
+
+TEST(NodeIdsTest, CheckSessionAllocator) {
+  NodeId first;
+  {
+    Session session = {1, nullptr};
+    EXPECT_EQ(&getNodeIdAllocator(), &session.getNodeIdAllocator());
+    first = getNextNodeId();
+    EXPECT_EQ(getNextNodeId(), first + 1);
+  }
+
+  // every crate starts afresh
+  Session session = {2, nullptr};
+  EXPECT_EQ(getNextNodeId(), first);
+};
+
+TEST(NodeIdsTest, CheckConcurrent) {
+  Session session = {1, nullptr};
+
+  constexpr unsigned Tasks = 8;
+  constexpr unsigned PerTask = 1000;
+  std::vector<std::vector<NodeId>> ids(Tasks);
+  std::vector<NodeId> ranges(Tasks);
+  {
+    llvm::ThreadPool pool(llvm::hardware_concurrency(4));
+    for (unsigned t = 0; t < Tasks; ++t)
+      pool.async([&ids, &ranges, t] {
+        for (unsigned i = 0; i < PerTask; ++i)
+          ids[t].push_back(getNextNodeId());
+        ranges[t] = reserveNodeIds(PerTask);
+      });
+    pool.wait();
+  }
+
+  std::vector<NodeId> all;
+  for (unsigned t = 0; t < Tasks; ++t) {
+    all.insert(all.end(), ids[t].begin(), ids[t].end());
+    for (unsigned i = 0; i < PerTask; ++i)
+      all.push_back(ranges[t] + i);
+  }
+  std::sort(all.begin(), all.end());
+  EXPECT_EQ(std::adjacent_find(all.begin(), all.end()), all.end());
+  EXPECT_EQ(all.size(), 2u * Tasks * PerTask);
+};
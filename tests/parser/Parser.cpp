@@ -1,6 +1,8 @@
 #include "Parser/Parser.h"
 
+#include "AST/ArithmeticOrLogicalExpression.h"
 #include "Lexer/Lexer.h"
+#include "../SessionFixture.h"
 
 #include <gtest/gtest.h>
 
@@ -12,18 +14,46 @@ using namespace rust_compiler::ast;
 using namespace rust_compiler::adt;
 using namespace llvm;
 
-TEST(ParserTest, CheckModuleDecl) {
+using ParserTest = SessionTest;
+
+TEST_F(ParserTest, CheckModuleDecl) {
 
   std::string text = "Option::Some(3)";
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   ts.print(10);
   
-  Result<std::shared_ptr<rust_compiler::ast::Expression>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
       parser.parseStructExprTuple();
 
   EXPECT_TRUE(result.isOk());
 };
+
+TEST_F(ParserTest, CheckPrecedence) {
+  std::string text = "a - b * c - d";
+
+  TokenStream ts = lex(text, "lib.rs");
+
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+
+  StringResult<std::shared_ptr<rust_compiler::ast::Expression>> result =
+      parser.parseExpression({}, Restrictions());
+
+  ASSERT_TRUE(result.isOk());
+
+  // (a - (b * c)) - d
+  auto top = std::static_pointer_cast<ArithmeticOrLogicalExpression>(
+      result.getValue());
+  EXPECT_EQ(top->getKind(), ArithmeticOrLogicalExpressionKind::Subtraction);
+  auto left =
+      std::static_pointer_cast<ArithmeticOrLogicalExpression>(top->getLHS());
+  EXPECT_EQ(left->getKind(), ArithmeticOrLogicalExpressionKind::Subtraction);
+  auto mul =
+      std::static_pointer_cast<ArithmeticOrLogicalExpression>(left->getRHS());
+  EXPECT_EQ(mul->getKind(), ArithmeticOrLogicalExpressionKind::Multiplication);
+};
@@ -0,0 +1,388 @@
+#include "AST/Crate.h"
+#include "AST/Function.h"
+#include "Lexer/Lexer.h"
+#include "Parser/Parser.h"
+#include "Session/Session.h"
+#include "../lexer/SyntheticCorpus.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fcntl.h>
+#include <llvm/ADT/STLFunctionalExtras.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/TimeProfiler.h>
+#include <llvm/Support/raw_ostream.h>
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+/// Throughput benchmark for the Parser on a synthetic crate. It parses a
+/// pre-lexed TokenStream, which measures the Parser and its token access
+/// alone, and it parses while pulling the tokens from a Lexer. For every
+/// corpus and input it reports the tokens/s, MB/s, items, and peak RSS.
+/// Every run is a forked child, as in LexerBench. With --defer-bodies, the
+/// function bodies are skipped and then parsed on a thread pool.
+///
+/// With --inputs, it parses the .rs files of the given files and
+/// directories instead, e.g., the testsuite, --iterations times. There,
+/// --profile writes the per-rule ParserProfile as JSON and --time-trace
+/// writes the rules as a Chrome trace.
+
+using namespace rust_compiler;
+using namespace rust_compiler::lexer;
+
+namespace {
+
+llvm::cl::opt<unsigned> SizeMB("size", llvm::cl::desc("corpus size in MB"),
+                               llvm::cl::init(4));
+
+llvm::cl::list<std::string>
+    Mixes("mix",
+          llvm::cl::desc("identifier, literal, comment, or unicode "
+                         "(default: identifier, literal, comment)"),
+          llvm::cl::CommaSeparated);
+
+llvm::cl::opt<unsigned>
+    Repetitions("repetitions",
+                llvm::cl::desc("runs per input and corpus; the fastest one "
+                               "is reported"),
+                llvm::cl::init(3));
+
+llvm::cl::opt<unsigned> Seed("seed", llvm::cl::desc("corpus seed"),
+                             llvm::cl::init(1));
+
+llvm::cl::opt<bool>
+    DeferBodies("defer-bodies",
+                llvm::cl::desc("skip the function bodies, then parse them on "
+                               "a thread pool"),
+                llvm::cl::init(false));
+
+llvm::cl::opt<unsigned>
+    Threads("body-threads",
+            llvm::cl::desc("threads for --defer-bodies (default: all)"),
+            llvm::cl::init(0));
+
+llvm::cl::list<std::string>
+    Inputs("inputs",
+           llvm::cl::desc("parse the .rs files of these files and "
+                          "directories instead of a synthetic corpus"),
+           llvm::cl::CommaSeparated);
+
+llvm::cl::opt<unsigned>
+    Iterations("iterations",
+               llvm::cl::desc("parses of the --inputs per run"),
+               llvm::cl::init(100));
+
+llvm::cl::opt<std::string>
+    ProfileFile("profile",
+                llvm::cl::desc("write the per-rule profile of the --inputs "
+                               "as JSON to this file"));
+
+llvm::cl::opt<std::string>
+    TimeTraceFile("time-trace",
+                  llvm::cl::desc("write the rules of the --inputs as a "
+                                 "Chrome trace to this file"));
+
+enum class InputKind { TokenStream, Lexer };
+
+std::string_view InputKind2String(InputKind kind) {
+  switch (kind) {
+  case InputKind::TokenStream:
+    return "Parser(TokenStream)";
+  case InputKind::Lexer:
+    return "Parser(Lexer)";
+  }
+  return "unknown";
+}
+
+struct RunResult {
+  uint64_t tokens;
+  uint64_t items;
+  /// the inputs the Parser rejected
+  uint64_t failures;
+  double seconds;
+  /// in KB
+  long peakRSS;
+};
+
+std::optional<RunResult> runParser(InputKind kind, const std::string &path) {
+  session::Session session = {1, nullptr};
+  session::session = &session;
+
+  RunResult result = {0, 0, 0, 0, 0};
+  // the token count of the TokenStream run, lexed outside of the clock
+  TokenStream ts = Lexer().lex(path);
+  result.tokens = ts.getLength();
+
+  auto start = std::chrono::steady_clock::now();
+  std::optional<adt::StringResult<std::shared_ptr<ast::Crate>>> crate;
+  std::vector<std::shared_ptr<ast::Function>> functions;
+  if (kind == InputKind::TokenStream) {
+    parser::Parser parser(ts, std::make_shared<ast::ASTContext>());
+    parser.setDeferFunctionBodies(DeferBodies);
+    crate.emplace(parser.parseCrateModule("bench", 1));
+    functions = parser.takeDeferredFunctions();
+  } else {
+    Lexer lexer;
+    lexer.open(path);
+    parser::Parser parser(lexer, std::make_shared<ast::ASTContext>());
+    parser.setDeferFunctionBodies(DeferBodies);
+    crate.emplace(parser.parseCrateModule("bench", 1));
+    functions = parser.takeDeferredFunctions();
+  }
+  if (!*crate)
+    return std::nullopt;
+  if (!functions.empty() &&
+      !parser::Parser::parseDeferredBodies(
+          *crate->getValue()->getASTContext(), functions,
+          llvm::hardware_concurrency(Threads)))
+    return std::nullopt;
+  auto stop = std::chrono::steady_clock::now();
+
+  result.items = crate->getValue()->getItems().size();
+  result.seconds = std::chrono::duration<double>(stop - start).count();
+  return result;
+}
+
+/// Parses the TokenStreams Iterations times. The rejected ones are counted
+/// once and not parsed again.
+std::optional<RunResult> parseInputs(std::vector<TokenStream> &streams) {
+  session::Session session = {1, nullptr};
+  session::session = &session;
+
+  std::optional<parser::ParserProfile> profile;
+  if (!ProfileFile.empty() || !TimeTraceFile.empty())
+    profile.emplace();
+  if (!TimeTraceFile.empty())
+    llvm::timeTraceProfilerInitialize(/*TimeTraceGranularity=*/0,
+                                      "parser-bench");
+
+  RunResult result = {0, 0, 0, 0, 0};
+  std::vector<bool> rejected(streams.size(), false);
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < Iterations; ++i) {
+    for (size_t s = 0; s < streams.size(); ++s) {
+      if (rejected[s])
+        continue;
+      parser::Parser parser(streams[s], std::make_shared<ast::ASTContext>());
+      parser.setProfile(profile ? &*profile : nullptr);
+      adt::StringResult<std::shared_ptr<ast::Crate>> crate =
+          parser.parseCrateModule("bench", 1);
+      if (!crate) {
+        rejected[s] = true;
+        ++result.failures;
+        continue;
+      }
+      result.tokens += streams[s].getLength();
+      result.items += crate.getValue()->getItems().size();
+    }
+  }
+  auto stop = std::chrono::steady_clock::now();
+  result.seconds = std::chrono::duration<double>(stop - start).count();
+
+  if (!ProfileFile.empty()) {
+    std::error_code ec;
+    llvm::raw_fd_ostream os(ProfileFile, ec);
+    if (ec)
+      return std::nullopt;
+    profile->printJSON(os);
+  }
+  if (!TimeTraceFile.empty()) {
+    if (llvm::Error e = llvm::timeTraceProfilerWrite(TimeTraceFile, "")) {
+      llvm::consumeError(std::move(e));
+      return std::nullopt;
+    }
+    llvm::timeTraceProfilerCleanup();
+  }
+  return result;
+}
+
+/// runs the benchmark in a child process; nullopt if the Parser failed
+std::optional<RunResult>
+runChild(llvm::function_ref<std::optional<RunResult>()> benchmark) {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    llvm::errs() << "pipe failed"
+                 << "\n";
+    exit(EXIT_FAILURE);
+  }
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    // the Parser traces its progress on stderr
+    int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, STDOUT_FILENO);
+    dup2(devNull, STDERR_FILENO);
+
+    std::optional<RunResult> result = benchmark();
+    if (!result ||
+        write(fds[1], &*result, sizeof(*result)) != sizeof(*result))
+      _exit(EXIT_FAILURE);
+    _exit(EXIT_SUCCESS);
+  }
+
+  close(fds[1]);
+  RunResult result;
+  ssize_t bytes = read(fds[0], &result, sizeof(result));
+  close(fds[0]);
+
+  int status;
+  struct rusage usage;
+  wait4(pid, &status, 0, &usage);
+  if (bytes != sizeof(result) || !WIFEXITED(status) ||
+      WEXITSTATUS(status) != EXIT_SUCCESS)
+    return std::nullopt;
+
+  result.peakRSS = usage.ru_maxrss;
+#ifdef __APPLE__
+  result.peakRSS /= 1024; // bytes
+#endif
+  return result;
+}
+
+void run(CorpusMix mix) {
+  std::string corpus = generateCorpus(mix, size_t(SizeMB) << 20, Seed);
+
+  llvm::SmallString<128> path;
+  int fd;
+  if (llvm::sys::fs::createTemporaryFile("parser-bench", "rs", fd, path)) {
+    llvm::errs() << "failed to create the corpus file"
+                 << "\n";
+    exit(EXIT_FAILURE);
+  }
+  {
+    llvm::raw_fd_ostream os(fd, /*shouldClose=*/true);
+    os << corpus;
+  }
+
+  for (InputKind kind : {InputKind::TokenStream, InputKind::Lexer}) {
+    std::optional<RunResult> best;
+    for (unsigned i = 0; i < Repetitions; ++i) {
+      std::optional<RunResult> result =
+          runChild([&] { return runParser(kind, std::string(path)); });
+      if (!result) {
+        best = std::nullopt;
+        break;
+      }
+      if (!best || result->seconds < best->seconds)
+        best = result;
+    }
+
+    llvm::outs() << CorpusMix2String(mix) << " " << InputKind2String(kind)
+                 << ": ";
+    if (!best) {
+      llvm::outs() << "failed\n";
+      continue;
+    }
+    llvm::outs() << best->items << " items, " << best->tokens << " tokens, "
+                 << llvm::format("%.2f", best->tokens / best->seconds / 1e6)
+                 << " Mtokens/s, "
+                 << llvm::format("%.1f", corpus.size() / best->seconds / 1e6)
+                 << " MB/s, " << best->peakRSS / 1024 << " MB peak RSS\n";
+  }
+
+  llvm::sys::fs::remove(path);
+}
+
+/// the .rs files of Inputs, sorted
+std::vector<std::string> collectInputs() {
+  std::vector<std::string> files;
+  for (const std::string &input : Inputs) {
+    if (!llvm::sys::fs::is_directory(input)) {
+      files.push_back(input);
+      continue;
+    }
+    std::error_code ec;
+    for (llvm::sys::fs::recursive_directory_iterator it(input, ec), end;
+         it != end && !ec; it.increment(ec))
+      if (llvm::sys::path::extension(it->path()) == ".rs")
+        files.push_back(it->path());
+  }
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+/// Parses the TokenStream once in a child process. False if the Parser
+/// crashed or did not finish within a few seconds.
+bool isParseable(TokenStream &stream) {
+  return runChild([&]() -> std::optional<RunResult> {
+           session::Session session = {1, nullptr};
+           session::session = &session;
+           alarm(10);
+           parser::Parser parser(stream, std::make_shared<ast::ASTContext>());
+           (void)parser.parseCrateModule("bench", 1);
+           return RunResult{0, 0, 0, 0, 0};
+         })
+      .has_value();
+}
+
+void runInputs() {
+  std::vector<std::string> files = collectInputs();
+  std::vector<TokenStream> streams;
+  for (const std::string &file : files) {
+    TokenStream stream = Lexer().lex(file);
+    // one crashing file must not fail the whole run
+    if (!isParseable(stream)) {
+      llvm::outs() << "skipped, the Parser crashed: " << file << "\n";
+      continue;
+    }
+    streams.push_back(stream);
+  }
+
+  llvm::outs() << "inputs: " << streams.size() << " files, " << Iterations
+               << " iterations\n";
+  std::optional<RunResult> result =
+      runChild([&] { return parseInputs(streams); });
+  if (!result) {
+    llvm::outs() << "failed\n";
+    return;
+  }
+  llvm::outs() << result->failures << " files rejected, "
+               << result->items / Iterations << " items, "
+               << result->tokens / Iterations << " tokens, "
+               << llvm::format("%.2f", result->tokens / result->seconds / 1e6)
+               << " Mtokens/s, " << result->peakRSS / 1024
+               << " MB peak RSS\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  llvm::cl::ParseCommandLineOptions(argc, argv, "parser benchmark\n");
+
+  if (!Inputs.empty()) {
+    runInputs();
+    return 0;
+  }
+
+  std::vector<CorpusMix> mixes;
+  for (const std::string &mix : Mixes) {
+    if (std::optional<CorpusMix> m = String2CorpusMix(mix)) {
+      mixes.push_back(*m);
+    } else {
+      llvm::errs() << "unknown mix: " << mix << "\n";
+      return EXIT_FAILURE;
+    }
+  }
+  if (mixes.empty())
+    mixes = {CorpusMix::Identifier, CorpusMix::Literal, CorpusMix::Comment};
+
+  llvm::outs() << "corpus: " << SizeMB << " MB, seed " << Seed;
+  if (DeferBodies)
+    llvm::outs() << ", deferred bodies";
+  llvm::outs() << "\n";
+  for (CorpusMix mix : mixes)
+    run(mix);
+
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include "Lexer/Lexer.h"
+#include "Parser/Parser.h"
+#include "Parser/Profile.h"
+#include "../SessionFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <llvm/Support/JSON.h>
+
+#include <chrono>
+#include <string>
+
+using namespace rust_compiler::lexer;
+using namespace rust_compiler::parser;
+using namespace rust_compiler::ast;
+using namespace rust_compiler::adt;
+
+using ProfileTest = SessionTest;
+
+TEST_F(ProfileTest, CheckRules) {
+  std::string text = "fn a() -> u32 { 1 }\n"
+                     "fn b(x: u32) -> u32 { let y = x; y }";
+
+  TokenStream ts = lex(text, "lib.rs");
+  ParserProfile profile;
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+  parser.setProfile(&profile);
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+  ASSERT_TRUE(crate.isOk());
+
+  std::string str;
+  llvm::raw_string_ostream os(str);
+  profile.printJSON(os);
+
+  llvm::Expected<llvm::json::Value> json = llvm::json::parse(os.str());
+  ASSERT_TRUE(bool(json));
+  const llvm::json::Array *rules = json->getAsObject()->getArray("rules");
+  ASSERT_NE(rules, nullptr);
+
+  int64_t functions = 0;
+  for (const llvm::json::Value &rule : *rules) {
+    const llvm::json::Object *stats = rule.getAsObject();
+    if (stats->getString("name").value_or("") == "parseFunction")
+      functions = stats->getInteger("invocations").value_or(0);
+  }
+  EXPECT_EQ(functions, 2);
+  EXPECT_NE(json->getAsObject()->getArray("backtracks"), nullptr);
+};
+
+TEST_F(ProfileTest, CheckRecursiveRules) {
+  // parseExpression is on the stack once per parenthesis
+  std::string text = "fn a() -> u32 { " + std::string(12, '(') + "1" +
+                     std::string(12, ')') + " }";
+
+  TokenStream ts = lex(text, "lib.rs");
+  ParserProfile profile;
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+  parser.setProfile(&profile);
+
+  ParserProfile::Clock::time_point start = ParserProfile::Clock::now();
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+  ParserProfile::Clock::duration elapsed = ParserProfile::Clock::now() - start;
+  ASSERT_TRUE(crate.isOk());
+
+  std::string str;
+  llvm::raw_string_ostream os(str);
+  profile.printJSON(os);
+
+  llvm::Expected<llvm::json::Value> json = llvm::json::parse(os.str());
+  ASSERT_TRUE(bool(json));
+  const llvm::json::Array *rules = json->getAsObject()->getArray("rules");
+  ASSERT_NE(rules, nullptr);
+
+  // no rule, however deep its recursion, takes longer than the parse
+  int64_t parseNs =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  for (const llvm::json::Value &rule : *rules) {
+    const llvm::json::Object *stats = rule.getAsObject();
+    int64_t inclusive = stats->getInteger("inclusiveNs").value_or(0);
+    EXPECT_LE(inclusive, parseNs);
+    EXPECT_LE(stats->getInteger("selfNs").value_or(0), inclusive);
+  }
+};
@@ -0,0 +1,187 @@
+#include "AST/BlockExpression.h"
+#include "AST/Function.h"
+#include "AST/Statements.h"
+#include "AST/VisItem.h"
+#include "AST/Visiblity.h"
+#include "Lexer/Lexer.h"
+#include "Parser/Parser.h"
+#include "../SessionFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace rust_compiler::lexer;
+using namespace rust_compiler::parser;
+using namespace rust_compiler::ast;
+using namespace rust_compiler::adt;
+
+using RecoveryTest = SessionTest;
+
+TEST_F(RecoveryTest, CheckItems) {
+  std::string text = "fn a() -> u32 { 1 }\n"
+                     "fn b( -> u32 { 2 }\n"
+                     "struct S { x: }\n"
+                     "fn c() -> u32 { 3 }";
+
+  TokenStream ts = lex(text, "lib.rs");
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+  parser.setRecoverFromErrors(true);
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+
+  ASSERT_TRUE(crate.isOk());
+  EXPECT_EQ(parser.getErrors().size(), 2u);
+
+  std::vector<std::shared_ptr<Item>> items = crate.getValue()->getItems();
+  ASSERT_EQ(items.size(), 4u);
+  EXPECT_EQ(items[0]->getItemKind(), ItemKind::VisItem);
+  EXPECT_EQ(items[1]->getItemKind(), ItemKind::ErrorItem);
+  EXPECT_EQ(items[2]->getItemKind(), ItemKind::ErrorItem);
+  EXPECT_EQ(items[3]->getItemKind(), ItemKind::VisItem);
+};
+
+TEST_F(RecoveryTest, CheckStatements) {
+  std::string text = "fn a() -> u32 { let x = ; let y = 1; y }";
+
+  TokenStream ts = lex(text, "lib.rs");
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+  parser.setRecoverFromErrors(true);
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+
+  ASSERT_TRUE(crate.isOk());
+  EXPECT_EQ(parser.getErrors().size(), 1u);
+
+  std::vector<std::shared_ptr<Item>> items = crate.getValue()->getItems();
+  ASSERT_EQ(items.size(), 1u);
+  ASSERT_EQ(items[0]->getItemKind(), ItemKind::VisItem);
+  std::shared_ptr<Function> fun = std::static_pointer_cast<Function>(items[0]);
+  std::shared_ptr<BlockExpression> body =
+      std::static_pointer_cast<BlockExpression>(fun->getBody());
+  std::vector<std::shared_ptr<Statement>> stmts =
+      body->getExpressions().getStmts();
+  ASSERT_EQ(stmts.size(), 2u);
+  EXPECT_EQ(stmts[0]->getKind(), StatementKind::ErrorStatement);
+  EXPECT_EQ(stmts[1]->getKind(), StatementKind::LetStatement);
+};
+
+TEST_F(RecoveryTest, CheckDisabled) {
+  std::string text = "fn a() -> u32 { let x = ; x }";
+
+  TokenStream ts = lex(text, "lib.rs");
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+
+  EXPECT_FALSE(crate.isOk());
+  EXPECT_TRUE(parser.getErrors().empty());
+};
+
+TEST_F(RecoveryTest, CheckStrayBraceClose) {
+  std::string text = "fn f() {}\n"
+                     "}\n"
+                     "fn g() {}";
+
+  TokenStream ts = lex(text, "lib.rs");
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+  parser.setRecoverFromErrors(true);
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+
+  ASSERT_TRUE(crate.isOk());
+  EXPECT_EQ(parser.getErrors().size(), 1u);
+
+  std::vector<std::shared_ptr<Item>> items = crate.getValue()->getItems();
+  ASSERT_EQ(items.size(), 3u);
+  EXPECT_EQ(items[0]->getItemKind(), ItemKind::VisItem);
+  EXPECT_EQ(items[1]->getItemKind(), ItemKind::ErrorItem);
+  EXPECT_EQ(items[2]->getItemKind(), ItemKind::VisItem);
+};
+
+TEST_F(RecoveryTest, CheckStrayParenClose) {
+  std::string text = "fn f() {}\n"
+                     ")\n"
+                     "fn g() {}";
+
+  TokenStream ts = lex(text, "lib.rs");
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+  parser.setRecoverFromErrors(true);
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+
+  ASSERT_TRUE(crate.isOk());
+  EXPECT_EQ(parser.getErrors().size(), 1u);
+
+  std::vector<std::shared_ptr<Item>> items = crate.getValue()->getItems();
+  ASSERT_EQ(items.size(), 3u);
+  EXPECT_EQ(items[0]->getItemKind(), ItemKind::VisItem);
+  EXPECT_EQ(items[1]->getItemKind(), ItemKind::ErrorItem);
+  EXPECT_EQ(items[2]->getItemKind(), ItemKind::VisItem);
+};
+
+TEST_F(RecoveryTest, CheckQualifiedItems) {
+  // the visibility and the qualifiers start the next item
+  std::string text = "struct S x: u8\n"
+                     "pub fn c() {}\n"
+                     "struct T y: u8\n"
+                     "const X: u8 = 0;\n"
+                     "fn d() {}";
+
+  TokenStream ts = lex(text, "lib.rs");
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+  parser.setRecoverFromErrors(true);
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+
+  ASSERT_TRUE(crate.isOk());
+  EXPECT_EQ(parser.getErrors().size(), 2u);
+
+  std::vector<std::shared_ptr<Item>> items = crate.getValue()->getItems();
+  ASSERT_EQ(items.size(), 5u);
+  EXPECT_EQ(items[0]->getItemKind(), ItemKind::ErrorItem);
+  ASSERT_EQ(items[1]->getItemKind(), ItemKind::VisItem);
+  std::shared_ptr<VisItem> c = std::static_pointer_cast<VisItem>(items[1]);
+  EXPECT_EQ(c->getKind(), VisItemKind::Function);
+  ASSERT_TRUE(c->getVisibility().has_value());
+  EXPECT_EQ(c->getVisibility()->getKind(), VisibilityKind::Public);
+  EXPECT_EQ(items[2]->getItemKind(), ItemKind::ErrorItem);
+  ASSERT_EQ(items[3]->getItemKind(), ItemKind::VisItem);
+  EXPECT_EQ(std::static_pointer_cast<VisItem>(items[3])->getKind(),
+            VisItemKind::ConstantItem);
+  EXPECT_EQ(items[4]->getItemKind(), ItemKind::VisItem);
+};
+
+TEST_F(RecoveryTest, CheckQualifierRun) {
+  // the qualifiers of a broken item are skipped with it
+  std::string text = "pub(crate) unsafe extern \"C\" fn b( -> u32 { 2 }\n"
+                     "fn c() {}";
+
+  TokenStream ts = lex(text, "lib.rs");
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
+  parser.setRecoverFromErrors(true);
+
+  StringResult<std::shared_ptr<Crate>> crate =
+      parser.parseCrateModule("crate", 0);
+
+  ASSERT_TRUE(crate.isOk());
+  EXPECT_EQ(parser.getErrors().size(), 1u);
+
+  std::vector<std::shared_ptr<Item>> items = crate.getValue()->getItems();
+  ASSERT_EQ(items.size(), 2u);
+  EXPECT_EQ(items[0]->getItemKind(), ItemKind::ErrorItem);
+  EXPECT_EQ(items[1]->getItemKind(), ItemKind::VisItem);
+};
@@ -0,0 +1,110 @@
+#include "Parser/TokenBuffer.h"
+
+#include "Lexer/TokenSource.h"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+using namespace rust_compiler;
+using namespace rust_compiler::lexer;
+using namespace rust_compiler::parser;
+
+namespace {
+
+/// count identifiers x0, x1, ..., then Eof
+class CountingSource : public TokenSource {
+  size_t count;
+
+public:
+  size_t pulled = 0;
+
+  explicit CountingSource(size_t count) : count(count) {}
+
+  Token next() override {
+    if (pulled == count)
+      return Token(Location(), TokenKind::Eof);
+    return Token(Location(), TokenKind::Identifier,
+                 "x" + std::to_string(pulled++));
+  }
+};
+
+} // namespace
+
+TEST(TokenBufferTest, CheckLookahead) {
+  CountingSource source(1000);
+  TokenBuffer tokens(source, 8);
+
+  EXPECT_EQ(tokens.peek(3).getSpelling(), "x3");
+  EXPECT_EQ(source.pulled, 4u);
+
+  for (size_t i = 0; i < 1000; ++i) {
+    EXPECT_EQ(tokens.peek().getSpelling(), "x" + std::to_string(i));
+    tokens.advance();
+  }
+  EXPECT_EQ(tokens.peek().getKind(), TokenKind::Eof);
+  EXPECT_EQ(tokens.peek(5).getKind(), TokenKind::Eof);
+
+  // nothing was retained
+  EXPECT_EQ(tokens.getCapacity(), 8u);
+};
+
+TEST(TokenBufferTest, CheckBacktracking) {
+  CountingSource source(1000);
+  TokenBuffer tokens(source, 8);
+
+  tokens.advance();
+  {
+    CheckPoint cp = tokens.getCheckPoint();
+    for (size_t i = 0; i < 100; ++i)
+      tokens.advance();
+    EXPECT_EQ(tokens.peek().getSpelling(), "x101");
+
+    CheckPoint copy = cp;
+    tokens.recover(copy);
+    EXPECT_EQ(tokens.peek().getSpelling(), "x1");
+    EXPECT_EQ(tokens.peek(100).getSpelling(), "x101");
+  }
+  EXPECT_EQ(source.pulled, 102u);
+  size_t capacity = tokens.getCapacity();
+  EXPECT_GE(capacity, 128u);
+
+  // without checkpoints, the ring is reused
+  for (size_t i = 0; i < 800; ++i)
+    tokens.advance();
+  EXPECT_EQ(tokens.peek().getSpelling(), "x801");
+  EXPECT_EQ(tokens.getCapacity(), capacity);
+};
+
+TEST(TokenBufferTest, CheckSkipTokenTree) {
+  // f(a, (b), [c]) + g
+  TokenStream ts;
+  for (TokenKind kind :
+       {TokenKind::Identifier, TokenKind::ParenOpen, TokenKind::Identifier,
+        TokenKind::Comma, TokenKind::ParenOpen, TokenKind::Identifier,
+        TokenKind::ParenClose, TokenKind::Comma, TokenKind::SquareOpen,
+        TokenKind::Identifier, TokenKind::SquareClose, TokenKind::ParenClose,
+        TokenKind::Plus})
+    ts.append(Token(Location(), kind));
+  ts.append(Token(Location(), TokenKind::Identifier, "g"));
+  ts.append(Token(Location(), TokenKind::Eof));
+  TokenStreamSource source(ts);
+  TokenBuffer tokens(source, 8);
+
+  tokens.advance();
+  std::optional<size_t> close = tokens.getMatchingDelimiter();
+  ASSERT_TRUE(close.has_value());
+  EXPECT_EQ(ts.getAt(*close).getKind(), TokenKind::ParenClose);
+
+  // the tokens of the tree are never pulled into the ring
+  tokens.skipTo(*close + 1);
+  EXPECT_EQ(tokens.peek().getKind(), TokenKind::Plus);
+  EXPECT_EQ(tokens.peek(1).getSpelling(), "g");
+  EXPECT_EQ(tokens.getMatchingDelimiter(), std::nullopt);
+
+  // a Lexer or another source has no table
+  CountingSource counting(10);
+  TokenBuffer pulled(counting, 8);
+  EXPECT_EQ(pulled.getMatchingDelimiter(), std::nullopt);
+};
@@ -15,9 +15,10 @@ TEST(PatternTest, CheckIdentifierPattern1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>, std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseIdentifierPattern();
 
 
@@ -30,9 +31,10 @@ TEST(PatternTest, CheckIdentifierPattern2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>, std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseIdentifierPattern();
 
 
@@ -45,9 +47,10 @@ TEST(PatternTest, CheckIdentifierPattern3) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>, std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseIdentifierPattern();
 
   EXPECT_TRUE(result.isOk());
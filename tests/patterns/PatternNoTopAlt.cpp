@@ -15,11 +15,12 @@ TEST(PatternNoTopAltTest, CheckIdentifierPattern12) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   ts.print(10);
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::Pattern>, std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::Pattern>>
       result = parser.parsePattern();
 
   if (result.isErr())
@@ -34,12 +35,12 @@ TEST(PatternNoTopAltTest, CheckIdentifierPattern11) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   ts.print(10);
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseTupleOrGroupedPattern();
 
   if (result.isErr())
@@ -54,12 +55,12 @@ TEST(PatternNoTopAltTest, CheckIdentifierPattern10) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   ts.print(10);
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseGroupedPattern();
 
   if (result.isErr())
@@ -74,12 +75,12 @@ TEST(PatternNoTopAltTest, CheckIdentifierPattern9) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   ts.print(10);
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseTupleOrGroupedPattern();
 
   if (result.isErr())
@@ -94,12 +95,12 @@ TEST(PatternNoTopAltTest, CheckIdentifierPattern8) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   ts.print(10);
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseTuplePattern();
 
   if (result.isErr())
@@ -194,7 +195,7 @@ TEST(PatternNoTopAltTest, CheckIdentifierPattern8) {
 //
 //  ts.print(10);
 //
-//  Result<std::shared_ptr<rust_compiler::ast::patterns::Pattern>, std::string>
+//  StringResult<std::shared_ptr<rust_compiler::ast::patterns::Pattern>>
 //      result = parser.parsePattern();
 //
 //  EXPECT_TRUE(result.isOk());
@@ -210,7 +211,7 @@ TEST(PatternNoTopAltTest, CheckIdentifierPattern8) {
 //
 //  ts.print(10);
 //
-//  Result<std::shared_ptr<rust_compiler::ast::patterns::Pattern>, std::string>
+//  StringResult<std::shared_ptr<rust_compiler::ast::patterns::Pattern>>
 //      result = parser.parsePattern();
 //
 //  EXPECT_TRUE(result.isOk());
@@ -222,12 +223,12 @@ TEST(PatternNoTopAltTest, CheckIdentifierPattern1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   ts.print(10);
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseTupleOrGroupedPattern();
 
   if (result.isErr())
@@ -242,12 +243,12 @@ TEST(PatternNoTopAltTest, CheckIdentifierPattern0) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
   ts.print(10);
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parsePatternNoTopAlt();
 
   if (result.isErr())
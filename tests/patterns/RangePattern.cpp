@@ -16,10 +16,10 @@ TEST(RangePatternTest, CheckRangePattern5) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseRangePattern();
 
   if (!result)
@@ -35,10 +35,10 @@ TEST(RangePatternTest, CheckRangePattern4) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseRangePattern();
 
   EXPECT_TRUE(result.isOk());
@@ -51,10 +51,10 @@ TEST(RangePatternTest, CheckRangePattern3) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseRangePattern();
 
   EXPECT_TRUE(result.isOk());
@@ -67,10 +67,10 @@ TEST(RangePatternTest, CheckRangePattern2) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseRangePattern();
 
   EXPECT_TRUE(result.isOk());
@@ -83,10 +83,10 @@ TEST(RangePatternTest, CheckRangePattern1) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseRangePattern();
 
   EXPECT_TRUE(result.isOk());
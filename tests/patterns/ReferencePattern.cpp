@@ -14,10 +14,10 @@ TEST(ReferencePatternTest, CheckReferencePattern1) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseReferencePattern();
 
   EXPECT_TRUE(result.isOk());
@@ -20,9 +20,10 @@ fn foo(a: &[u32]) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Crate>, std::string> crate = parser.
+  StringResult<std::shared_ptr<rust_compiler::ast::Crate>> crate = parser.
       parseCrateModule("crateName", 5);
 
   EXPECT_TRUE(crate.isOk());
@@ -40,9 +41,10 @@ fn foo(a: &[u32]) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Crate>, std::string> crate = parser.
+  StringResult<std::shared_ptr<rust_compiler::ast::Crate>> crate = parser.
       parseCrateModule("crateName", 5);
 
   EXPECT_TRUE(crate.isOk());
@@ -61,9 +63,10 @@ fn foo(a: &[u32]) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Crate>, std::string> crate = parser.
+  StringResult<std::shared_ptr<rust_compiler::ast::Crate>> crate = parser.
       parseCrateModule("crateName", 5);
 
   EXPECT_TRUE(crate.isOk());
@@ -85,9 +88,10 @@ fn foo() {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Crate>, std::string> crate = parser.
+  StringResult<std::shared_ptr<rust_compiler::ast::Crate>> crate = parser.
       parseCrateModule("crateName", 5);
 
   EXPECT_TRUE(crate.isOk());
@@ -100,10 +104,10 @@ TEST(SlicePatternTest, CheckSlicePattern3) {
 
   // ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseSlicePattern();
 
   EXPECT_TRUE(result.isOk());
@@ -116,10 +120,10 @@ TEST(SlicePatternTest, CheckSlicePattern2) {
 
   // ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseSlicePattern();
 
   if (result.isErr())
@@ -135,10 +139,10 @@ TEST(SlicePatternTest, CheckSlicePattern1) {
 
   // ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseSlicePattern();
 
   EXPECT_TRUE(result.isOk());
@@ -17,10 +17,10 @@ TEST(StructPatternTest, CheckStructPattern5) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseStructPattern();
 
   EXPECT_TRUE(result.isOk());
@@ -34,10 +34,10 @@ TEST(StructPatternTest, CheckStructPattern4) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseStructPattern();
 
   EXPECT_TRUE(result.isOk());
@@ -51,10 +51,10 @@ TEST(StructPatternTest, CheckStructPattern3) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseStructPattern();
 
   EXPECT_TRUE(result.isOk());
@@ -68,10 +68,10 @@ TEST(StructPatternTest, CheckStructPattern2) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseStructPattern();
 
   EXPECT_TRUE(result.isOk());
@@ -85,10 +85,10 @@ TEST(StructPatternTest, CheckStructPattern1) {
 
   //ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>,
-         std::string>
+  StringResult<std::shared_ptr<rust_compiler::ast::patterns::PatternNoTopAlt>>
       result = parser.parseStructPattern();
 
   EXPECT_TRUE(result.isOk());
@@ -17,9 +17,10 @@ TEST(PatternTupleItemsTest, CheckTuplePatternItems1) {
 
   ts.print(10);
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<rust_compiler::ast::patterns::TuplePatternItems, std::string> result =
+  StringResult<rust_compiler::ast::patterns::TuplePatternItems> result =
       parser.parseTuplePatternItems();
 
   if (result.isErr())
@@ -34,9 +35,10 @@ TEST(PatternTupleItemsTest, CheckTuplePatternItems2) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<rust_compiler::ast::patterns::TuplePatternItems, std::string> result =
+  StringResult<rust_compiler::ast::patterns::TuplePatternItems> result =
       parser.parseTuplePatternItems();
 
   EXPECT_TRUE(result.isOk());
@@ -48,9 +50,10 @@ TEST(PatternTupleItemsTest, CheckTuplePatternItems3) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<rust_compiler::ast::patterns::TuplePatternItems, std::string> result =
+  StringResult<rust_compiler::ast::patterns::TuplePatternItems> result =
       parser.parseTuplePatternItems();
 
   EXPECT_TRUE(result.isOk());
@@ -62,9 +65,10 @@ TEST(PatternTupleItemsTest, CheckTuplePatternItems4) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<rust_compiler::ast::patterns::TuplePatternItems, std::string> result =
+  StringResult<rust_compiler::ast::patterns::TuplePatternItems> result =
       parser.parseTuplePatternItems();
 
   EXPECT_TRUE(result.isOk());
@@ -76,9 +80,10 @@ TEST(PatternTupleItemsTest, CheckTuplePatternItems5) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<rust_compiler::ast::patterns::TuplePatternItems, std::string> result =
+  StringResult<rust_compiler::ast::patterns::TuplePatternItems> result =
       parser.parseTuplePatternItems();
 
   EXPECT_TRUE(result.isOk());
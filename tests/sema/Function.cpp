@@ -21,9 +21,10 @@ fn foo(a: i32, b: i32) -> i32 {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Crate>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Crate>> result =
     parser.parseCrateModule("crate", 5);
 
   if (!result)
@@ -46,9 +47,10 @@ fn foo(a: i32, b: i32) -> i32 {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::Crate>, std::string> result =
+  StringResult<std::shared_ptr<rust_compiler::ast::Crate>> result =
     parser.parseCrateModule("crate", 5);
 
   if (!result)
@@ -0,0 +1,68 @@
+#include "AST/InherentImpl.h"
+#include "AST/TypeParam.h"
+#include "Basic/Ids.h"
+#include "Location.h"
+#include "TyCtx/TyCtx.h"
+#include "TyCtx/TyTy.h"
+#include "TyCtxFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <vector>
+
+using namespace rust_compiler;
+using namespace rust_compiler::basic;
+using namespace rust_compiler::tyctx;
+
+using ImplIndexTest = TyCtxTest;
+
+TEST_F(ImplIndexTest, CheckCandidates) {
+  TyCtx &tcx = getTyCtx();
+
+  TyTy::BaseType *i32 = tcx.lookupBuiltin("i32");
+  TyTy::BaseType *u32 = tcx.lookupBuiltin("u32");
+  ast::TypeParam param = {Location::getEmptyLocation()};
+  TyTy::BaseType *t = tcx.create<TyTy::ParamType>(
+      lexer::Identifier("T"), Location::getEmptyLocation(), getNextNodeId(),
+      param, std::vector<TyTy::TypeBoundPredicate>());
+
+  // impl i32, impl u32, impl<T> T, and an impl whose type is unknown
+  std::vector<ast::InherentImpl> impls;
+  for (int i = 0; i < 4; ++i)
+    impls.emplace_back(Location::getEmptyLocation(), std::nullopt);
+  std::map<ast::Implementation *, TyTy::BaseType *> selfTypes = {
+      {&impls[0], i32}, {&impls[1], u32}, {&impls[2], t}};
+  for (ast::InherentImpl &impl : impls)
+    tcx.insertImplementation(impl.getNodeId(), &impl);
+
+  auto selfType =
+      [&](ast::Implementation *impl) -> std::optional<TyTy::BaseType *> {
+    auto it = selfTypes.find(impl);
+    if (it == selfTypes.end())
+      return std::nullopt;
+    return it->second;
+  };
+  auto candidates = [&](TyTy::BaseType *receiver) {
+    std::vector<ast::Implementation *> result;
+    tcx.iterateImplementationsFor(receiver, selfType,
+                                  [&](NodeId, ast::Implementation *impl) {
+                                    result.push_back(impl);
+                                    return true;
+                                  });
+    return result;
+  };
+
+  std::vector<ast::Implementation *> expected = {&impls[0], &impls[2],
+                                                 &impls[3]};
+  EXPECT_EQ(candidates(i32), expected);
+  expected = {&impls[1], &impls[2], &impls[3]};
+  EXPECT_EQ(candidates(u32->clone()), expected);
+
+  // a receiver without a head may equal every impl
+  TyTy::BaseType *infer = tcx.create<TyTy::InferType>(
+      getNextNodeId(), TyTy::InferKind::General, TyTy::TypeHint::unknown(),
+      Location::getEmptyLocation());
+  EXPECT_EQ(candidates(infer).size(), impls.size());
+};
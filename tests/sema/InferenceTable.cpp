@@ -0,0 +1,94 @@
+#include "Basic/Ids.h"
+#include "Location.h"
+#include "TyCtx/InferenceTable.h"
+#include "TyCtx/TyCtx.h"
+#include "TyCtx/TyTy.h"
+#include "TyCtx/Unification.h"
+#include "TyCtxFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+using namespace rust_compiler;
+using namespace rust_compiler::basic;
+using namespace rust_compiler::tyctx;
+
+using InferenceTableTest = TyCtxTest;
+
+namespace {
+TyTy::InferType *createInferType(TyCtx &tcx, TyTy::InferKind kind) {
+  return tcx.create<TyTy::InferType>(getNextNodeId(), kind,
+                                     TyTy::TypeHint::unknown(),
+                                     Location::getEmptyLocation());
+}
+} // namespace
+
+TEST_F(InferenceTableTest, CheckUnionFind) {
+  TyTy::InferenceTable table;
+  NodeId a = getNextNodeId();
+  NodeId b = getNextNodeId();
+  NodeId c = getNextNodeId();
+
+  EXPECT_EQ(table.find(a), a);
+  table.unite(a, b);
+  table.unite(b, c);
+  EXPECT_EQ(table.find(a), table.find(c));
+  EXPECT_EQ(table.probe(c), std::nullopt);
+
+  TyCtx &tcx = getTyCtx();
+  TyTy::BaseType *i32 = tcx.lookupBuiltin("i32");
+  table.bind(a, i32);
+  EXPECT_EQ(table.probe(b), i32);
+  EXPECT_EQ(table.probe(c), i32);
+};
+
+TEST_F(InferenceTableTest, CheckRollback) {
+  TyCtx &tcx = getTyCtx();
+
+  TyTy::InferenceTable &table = tcx.getInferenceTable();
+  TyTy::InferType *infer = createInferType(tcx, TyTy::InferKind::General);
+  NodeId other = getNextNodeId();
+  size_t variables = table.getNumberOfVariables();
+
+  TyTy::InferenceTable::Snapshot snapshot = table.snapshot();
+  table.unite(infer->getVariable(), other);
+  table.bind(other, tcx.lookupBuiltin("u8"));
+  infer->applyScalarTypeHint(*tcx.lookupBuiltin("u8"));
+  EXPECT_EQ(infer->getInferredKind(), TyTy::InferKind::Integral);
+  table.rollbackTo(snapshot);
+
+  EXPECT_EQ(table.probe(infer->getVariable()), std::nullopt);
+  EXPECT_NE(table.find(infer->getVariable()), table.find(other));
+  EXPECT_EQ(table.getNumberOfVariables(), variables);
+  EXPECT_EQ(infer->getInferredKind(), TyTy::InferKind::General);
+};
+
+TEST_F(InferenceTableTest, CheckUnification) {
+  TyCtx &tcx = getTyCtx();
+
+  TyTy::InferType *infer = createInferType(tcx, TyTy::InferKind::General);
+  tcx.insertImplicitType(infer->getReference(), infer);
+  // a clone shares the variable under its own reference
+  TyTy::BaseType *clone = infer->clone();
+  ASSERT_EQ(clone->getKind(), TyTy::TypeKind::Inferred);
+  EXPECT_EQ(static_cast<TyTy::InferType *>(clone)->getVariable(),
+            infer->getVariable());
+
+  // a failed speculative unification leaves no binding behind
+  TyTy::InferType *floating = createInferType(tcx, TyTy::InferKind::Float);
+  TyTy::BaseType *result = Unification::tryUnifyWithSite(
+      TyTy::WithLocation(floating),
+      TyTy::WithLocation(tcx.lookupBuiltin("i32")),
+      Location::getEmptyLocation(), &tcx);
+  EXPECT_EQ(result->getKind(), TyTy::TypeKind::Error);
+  EXPECT_EQ(tcx.getInferenceTable().probe(floating->getVariable()),
+            std::nullopt);
+
+  result = Unification::unifyWithSite(
+      TyTy::WithLocation(infer), TyTy::WithLocation(tcx.lookupBuiltin("i32")),
+      Location::getEmptyLocation(), &tcx);
+  ASSERT_EQ(result->getKind(), TyTy::TypeKind::Int);
+  EXPECT_EQ(*tcx.lookupType(infer->getReference()), result);
+  EXPECT_EQ(*tcx.lookupType(clone->getReference()), result);
+};
@@ -0,0 +1,208 @@
+#include "ADT/NodeIdMap.h"
+#include "Basic/Ids.h"
+
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <random>
+#include <string_view>
+#include <vector>
+
+/// Micro-benchmark for the NodeId-keyed side tables of the TyCtx and the
+/// Resolver, e.g., resolved and resolvedNames. It fills a std::map and a
+/// NodeIdMap the way the type checker does, i.e., a fraction of a dense
+/// range of NodeIds, and then looks the NodeIds up in AST order, as a
+/// walk of the crate, and in a random order, as the unifier. It reports
+/// the ns per insert and per lookup, the heap bytes per entry, and the
+/// speedup of the NodeIdMap.
+
+using namespace rust_compiler;
+using namespace rust_compiler::basic;
+
+namespace {
+
+/// the bytes allocated with operator new and not yet released
+size_t LiveBytes = 0;
+
+/// operator new stores the size of an allocation in front of it
+constexpr size_t Header = alignof(std::max_align_t);
+
+} // namespace
+
+void *operator new(size_t size) {
+  void *block = std::malloc(size + Header);
+  if (!block)
+    throw std::bad_alloc();
+  *static_cast<size_t *>(block) = size;
+  LiveBytes += size;
+  return static_cast<char *>(block) + Header;
+}
+
+void operator delete(void *pointer) noexcept {
+  if (!pointer)
+    return;
+  void *block = static_cast<char *>(pointer) - Header;
+  LiveBytes -= *static_cast<size_t *>(block);
+  std::free(block);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+  operator delete(pointer);
+}
+
+namespace {
+
+llvm::cl::opt<unsigned> Nodes("nodes",
+                              llvm::cl::desc("NodeIds of the synthetic crate"),
+                              llvm::cl::init(1 << 20));
+
+llvm::cl::opt<unsigned>
+    Density("density",
+            llvm::cl::desc("percentage of the NodeIds in the tables"),
+            llvm::cl::init(50));
+
+llvm::cl::opt<unsigned> Lookups("lookups",
+                                llvm::cl::desc("lookups per order"),
+                                llvm::cl::init(1 << 24));
+
+llvm::cl::opt<unsigned>
+    Repetitions("repetitions",
+                llvm::cl::desc("runs per table; the fastest one is reported"),
+                llvm::cl::init(3));
+
+llvm::cl::opt<unsigned> Seed("seed", llvm::cl::desc("NodeId seed"),
+                             llvm::cl::init(1));
+
+struct Workload {
+  /// the NodeIds in the tables, ascending
+  std::vector<NodeId> inserts;
+  /// hits and misses in AST order
+  std::vector<NodeId> sequential;
+  /// hits and misses in a random order
+  std::vector<NodeId> random;
+};
+
+Workload generateWorkload() {
+  std::mt19937 rng(Seed);
+  std::uniform_int_distribution<unsigned> percent(0, 99);
+
+  Workload workload;
+  // the first NodeId of NodeIdAllocator
+  NodeId first = 8;
+  for (NodeId id = first; id < first + Nodes; ++id)
+    if (percent(rng) < Density)
+      workload.inserts.push_back(id);
+
+  workload.sequential.reserve(Lookups);
+  for (unsigned i = 0; i < Lookups; ++i)
+    workload.sequential.push_back(first + i % Nodes);
+
+  std::uniform_int_distribution<NodeId> ids(first, first + Nodes - 1);
+  workload.random.reserve(Lookups);
+  for (unsigned i = 0; i < Lookups; ++i)
+    workload.random.push_back(ids(rng));
+  return workload;
+}
+
+struct Timings {
+  double insertNs;
+  double sequentialNs;
+  double randomNs;
+  /// the heap bytes of the filled table per entry
+  double bytesPerEntry;
+  /// to keep the lookups alive
+  uint64_t checksum;
+};
+
+template <typename Map>
+uint64_t lookup(const Map &map, const std::vector<NodeId> &ids) {
+  uint64_t checksum = 0;
+  for (NodeId id : ids) {
+    auto it = map.find(id);
+    if (it != map.end())
+      checksum += it->second;
+  }
+  return checksum;
+}
+
+template <typename Map> Timings measure(const Workload &workload) {
+  using Clock = std::chrono::steady_clock;
+  auto ns = [](Clock::time_point start, Clock::time_point stop, size_t n) {
+    return std::chrono::duration<double, std::nano>(stop - start).count() / n;
+  };
+
+  Timings best = {0, 0, 0, 0, 0};
+  for (unsigned r = 0; r < Repetitions; ++r) {
+    size_t liveBytes = LiveBytes;
+    Map map;
+    auto start = Clock::now();
+    // resolvedNames: reference -> definition
+    for (NodeId id : workload.inserts)
+      map[id] = id / 2;
+    auto inserted = Clock::now();
+    double bytesPerEntry =
+        double(LiveBytes - liveBytes) / std::max<size_t>(map.size(), 1);
+    uint64_t checksum = lookup(map, workload.sequential);
+    auto sequential = Clock::now();
+    checksum += lookup(map, workload.random);
+    auto random = Clock::now();
+
+    Timings timings = {ns(start, inserted, workload.inserts.size()),
+                       ns(inserted, sequential, workload.sequential.size()),
+                       ns(sequential, random, workload.random.size()),
+                       bytesPerEntry, checksum};
+    if (r == 0) {
+      best = timings;
+      continue;
+    }
+    best.insertNs = std::min(best.insertNs, timings.insertNs);
+    best.sequentialNs = std::min(best.sequentialNs, timings.sequentialNs);
+    best.randomNs = std::min(best.randomNs, timings.randomNs);
+  }
+  return best;
+}
+
+void print(std::string_view name, const Timings &timings) {
+  llvm::outs() << name << ": "
+               << llvm::format("%.1f", timings.insertNs) << " ns/insert, "
+               << llvm::format("%.1f", timings.sequentialNs)
+               << " ns/lookup in AST order, "
+               << llvm::format("%.1f", timings.randomNs)
+               << " ns/lookup in random order, "
+               << llvm::format("%.1f", timings.bytesPerEntry)
+               << " bytes/entry\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  llvm::cl::ParseCommandLineOptions(argc, argv, "sema benchmark\n");
+
+  Workload workload = generateWorkload();
+  llvm::outs() << "nodes: " << Nodes << ", " << workload.inserts.size()
+               << " in the tables, " << Lookups << " lookups per order\n";
+
+  Timings map = measure<std::map<NodeId, NodeId>>(workload);
+  Timings nodeIdMap = measure<adt::NodeIdMap<NodeId>>(workload);
+  if (map.checksum != nodeIdMap.checksum) {
+    llvm::errs() << "the tables disagree\n";
+    return EXIT_FAILURE;
+  }
+
+  print("std::map", map);
+  print("NodeIdMap", nodeIdMap);
+  llvm::outs() << "speedup: "
+               << llvm::format("%.1f",
+                               map.sequentialNs / nodeIdMap.sequentialNs)
+               << "x in AST order, "
+               << llvm::format("%.1f", map.randomNs / nodeIdMap.randomNs)
+               << "x in random order\n";
+  return 0;
+}
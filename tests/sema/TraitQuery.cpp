@@ -0,0 +1,159 @@
+#include "AST/TypeParam.h"
+#include "Basic/Ids.h"
+#include "Location.h"
+#include "TyCtx/TraitQueryCache.h"
+#include "TyCtx/TraitQueryGuard.h"
+#include "TyCtx/TyCtx.h"
+#include "TyCtx/TyTy.h"
+#include "TyCtxFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+using namespace rust_compiler;
+using namespace rust_compiler::basic;
+using namespace rust_compiler::tyctx;
+
+using TraitQueryTest = TyCtxTest;
+
+TEST_F(TraitQueryTest, CheckImplMappings) {
+  TyCtx &tcx = getTyCtx();
+
+  TyTy::BaseType *i32 = tcx.lookupBuiltin("i32");
+  TyTy::BaseType *u32 = tcx.lookupBuiltin("u32");
+  NodeId trait = getNextNodeId();
+  NodeId i32Impl = getNextNodeId();
+  NodeId u32Impl = getNextNodeId();
+
+  tcx.insertAssociatedImplMapping(trait, i32, i32Impl);
+  EXPECT_EQ(tcx.lookupAssociatedImplMappingForSelf(trait, i32->clone()),
+            i32Impl);
+  EXPECT_EQ(tcx.lookupAssociatedImplMappingForSelf(trait, u32), std::nullopt);
+
+  // a new impl invalidates the negative answer
+  tcx.insertAssociatedImplMapping(trait, u32, u32Impl);
+  EXPECT_EQ(tcx.lookupAssociatedImplMappingForSelf(trait, u32), u32Impl);
+};
+
+TEST_F(TraitQueryTest, CheckCycles) {
+  TyCtx &tcx = getTyCtx();
+
+  TyTy::TypeInterner &interner = tcx.getTypeInterner();
+  NodeId trait = getNextNodeId();
+  TraitQueryKey outer =
+      TraitQueryKey::get(trait, tcx.lookupBuiltin("i32"), {}, interner);
+  TraitQueryKey inner =
+      TraitQueryKey::get(trait, tcx.lookupBuiltin("u32"), {}, interner);
+
+  TraitQueryCache cache;
+  EXPECT_TRUE(cache.start(outer));
+  EXPECT_TRUE(cache.start(inner));
+  EXPECT_FALSE(cache.start(outer));
+  EXPECT_TRUE(cache.isInProgress(inner));
+
+  // inner assumed that outer has no impl
+  cache.complete(inner, {1, {}});
+  EXPECT_EQ(cache.lookup(inner), std::nullopt);
+  cache.complete(outer, {2, {}});
+  ASSERT_TRUE(cache.lookup(outer).has_value());
+  EXPECT_EQ((*cache.lookup(outer))->implementation, 2u);
+  EXPECT_FALSE(cache.isInProgress(outer));
+};
+
+TEST_F(TraitQueryTest, CheckTraitQueryGuard) {
+  TyCtx &tcx = getTyCtx();
+
+  NodeId trait = getNextNodeId();
+  {
+    TraitQueryGuard outer = {trait, &tcx};
+    EXPECT_TRUE(outer.isStarted());
+    EXPECT_TRUE(tcx.isTraitQueryInProgress(trait));
+    {
+      // the cyclic query leaves the outer one in progress
+      TraitQueryGuard inner = {trait, &tcx};
+      EXPECT_FALSE(inner.isStarted());
+    }
+    EXPECT_TRUE(tcx.isTraitQueryInProgress(trait));
+  }
+  EXPECT_FALSE(tcx.isTraitQueryInProgress(trait));
+};
+
+TEST_F(TraitQueryTest, CheckSubstitutions) {
+  TyCtx &tcx = getTyCtx();
+
+  TyTy::TypeInterner &interner = tcx.getTypeInterner();
+  ast::TypeParam param = {Location::getEmptyLocation()};
+  TyTy::BaseType *t = tcx.create<TyTy::ParamType>(
+      lexer::Identifier("T"), Location::getEmptyLocation(), getNextNodeId(),
+      param, std::vector<TyTy::TypeBoundPredicate>());
+  tcx.insertImplicitType(t->getReference(), t);
+  TyTy::BaseType *infer = tcx.create<TyTy::InferType>(
+      getNextNodeId(), TyTy::InferKind::General, TyTy::TypeHint::unknown(),
+      Location::getEmptyLocation());
+
+  NodeId trait = getNextNodeId();
+  TraitQueryKey ground =
+      TraitQueryKey::get(trait, tcx.lookupBuiltin("bool"), {}, interner);
+  TraitQueryKey generic = TraitQueryKey::get(trait, t, {}, interner);
+  TraitQueryKey inferred = TraitQueryKey::get(trait, infer, {}, interner);
+  EXPECT_TRUE(ground.isStable());
+  EXPECT_FALSE(generic.isStable());
+  EXPECT_FALSE(inferred.isCacheable());
+
+  TraitQueryCache cache;
+  for (const TraitQueryKey &key : {ground, generic, inferred}) {
+    ASSERT_TRUE(cache.start(key));
+    cache.complete(key, {std::nullopt, {}});
+  }
+  EXPECT_TRUE(cache.lookup(ground).has_value());
+  EXPECT_TRUE(cache.lookup(generic).has_value());
+  EXPECT_FALSE(cache.lookup(inferred).has_value());
+
+  cache.onSubstitution();
+  EXPECT_TRUE(cache.lookup(ground).has_value());
+  EXPECT_FALSE(cache.lookup(generic).has_value());
+};
+
+TEST_F(TraitQueryTest, CheckADTs) {
+  TyCtx &tcx = getTyCtx();
+
+  TyTy::TypeInterner &interner = tcx.getTypeInterner();
+  ast::TypeParam param = {Location::getEmptyLocation()};
+  TyTy::ParamType *t = tcx.create<TyTy::ParamType>(
+      lexer::Identifier("T"), Location::getEmptyLocation(), getNextNodeId(),
+      param, std::vector<TyTy::TypeBoundPredicate>());
+  tcx.insertImplicitType(t->getReference(), t);
+  TyTy::SubstitutionParamMapping mapping = {param, t};
+
+  // S<i32> and S<T>
+  auto createADT = [&](TyTy::BaseType *argument) {
+    return tcx.create<TyTy::ADTType>(
+        getNextNodeId(), lexer::Identifier("S"), TypeIdentity::empty(),
+        TyTy::ADTKind::StructStruct, std::vector<TyTy::VariantDef *>(),
+        std::vector<TyTy::SubstitutionParamMapping>{mapping},
+        TyTy::SubstitutionArgumentMappings(
+            {TyTy::SubstitutionArg(&mapping, argument)}, {},
+            Location::getEmptyLocation()));
+  };
+
+  NodeId trait = getNextNodeId();
+  TraitQueryKey ground = TraitQueryKey::get(
+      trait, createADT(tcx.lookupBuiltin("i32")), {}, interner);
+  TraitQueryKey generic = TraitQueryKey::get(trait, createADT(t), {}, interner);
+  EXPECT_TRUE(ground.isCacheable());
+  EXPECT_TRUE(ground.isStable());
+  EXPECT_FALSE(generic.isStable());
+
+  TraitQueryCache cache;
+  for (const TraitQueryKey &key : {ground, generic}) {
+    ASSERT_TRUE(cache.start(key));
+    cache.complete(key, {std::nullopt, {}});
+  }
+
+  // an unrelated substitution
+  cache.onSubstitution();
+  EXPECT_TRUE(cache.lookup(ground).has_value());
+  EXPECT_FALSE(cache.lookup(generic).has_value());
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../SessionFixture.h"
+#include "TyCtx/TyCtx.h"
+
+#include <optional>
+
+/// A SessionTest whose Session has a TyCtx of its own.
+class TyCtxTest : public SessionTest {
+  std::optional<rust_compiler::tyctx::TyCtx> tcx;
+
+protected:
+  TyCtxTest() {
+    tcx.emplace();
+    getSession().setTypeContext(&*tcx);
+  }
+
+  ~TyCtxTest() override {
+    getSession().setTypeContext(nullptr);
+    tcx.reset();
+  }
+
+  rust_compiler::tyctx::TyCtx &getTyCtx() { return *tcx; }
+};
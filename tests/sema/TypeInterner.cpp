@@ -0,0 +1,65 @@
+#include "TyCtx/TypeInterner.h"
+
+#include "Basic/Ids.h"
+#include "Basic/Mutability.h"
+#include "Location.h"
+#include "TyCtx/InferenceTable.h"
+#include "TyCtx/TyCtx.h"
+#include "TyCtx/TyTy.h"
+#include "TyCtxFixture.h"
+
+#include <gtest/gtest.h>
+
+using namespace rust_compiler;
+using namespace rust_compiler::basic;
+using namespace rust_compiler::tyctx;
+
+using TypeInternerTest = TyCtxTest;
+
+TEST_F(TypeInternerTest, CheckGroundTypes) {
+  TyCtx &tcx = getTyCtx();
+  TyTy::TypeInterner &interner = tcx.getTypeInterner();
+
+  TyTy::BaseType *i32 = tcx.lookupBuiltin("i32");
+  TyTy::BaseType *u32 = tcx.lookupBuiltin("u32");
+  ASSERT_NE(i32, nullptr);
+  ASSERT_NE(u32, nullptr);
+
+  EXPECT_NE(interner.intern(i32), nullptr);
+  EXPECT_EQ(interner.intern(i32), interner.intern(i32->clone()));
+  EXPECT_NE(interner.intern(i32), interner.intern(u32));
+
+  auto tuple = [&](TyTy::BaseType *first, TyTy::BaseType *second) {
+    return tcx.create<TyTy::TupleType>(
+        getNextNodeId(), Location::getEmptyLocation(),
+        std::vector<TyTy::TypeVariable>{
+            TyTy::TypeVariable(first->getReference()),
+            TyTy::TypeVariable(second->getReference())});
+  };
+  TyTy::TupleType *left = tuple(i32, u32);
+  TyTy::TupleType *right = tuple(i32, u32);
+  EXPECT_EQ(interner.intern(left), interner.intern(right));
+  EXPECT_NE(interner.intern(left), interner.intern(tuple(u32, i32)));
+  EXPECT_TRUE(left->canEqual(right, false));
+
+  auto reference = [&](Mutability mut) {
+    return tcx.create<TyTy::ReferenceType>(
+        getNextNodeId(), TyTy::TypeVariable(i32->getReference()), mut);
+  };
+  EXPECT_EQ(interner.intern(reference(Mutability::Imm)),
+            interner.intern(reference(Mutability::Imm)));
+  EXPECT_NE(interner.intern(reference(Mutability::Imm)),
+            interner.intern(reference(Mutability::Mut)));
+
+  TyTy::InferType *infer = tcx.create<TyTy::InferType>(
+      getNextNodeId(), TyTy::InferKind::General, TyTy::TypeHint::unknown(),
+      Location::getEmptyLocation());
+  EXPECT_EQ(interner.intern(infer), nullptr);
+
+  // a binding of an inference variable may be rolled back
+  tcx.insertImplicitType(infer->getReference(), infer);
+  tcx.getInferenceTable().bind(infer->getVariable(), u32);
+  TyTy::TupleType *bound = tuple(i32, infer);
+  EXPECT_EQ(bound->getField(1), u32);
+  EXPECT_EQ(interner.intern(bound), nullptr);
+};
@@ -14,9 +14,10 @@ TEST(TypesTest, Checki128) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::types::TypeExpression>, std::string> type =
+  StringResult<std::shared_ptr<rust_compiler::ast::types::TypeExpression>> type =
       parser.parseType();
 
   EXPECT_TRUE(type.isOk());
@@ -28,9 +29,10 @@ TEST(TypesTest, Checkf64) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::types::TypeExpression>, std::string> type =
+  StringResult<std::shared_ptr<rust_compiler::ast::types::TypeExpression>> type =
       parser.parseType();
 
   EXPECT_TRUE(type.isOk());
@@ -42,9 +44,10 @@ TEST(TypesTest, Checkisize) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::types::TypeExpression>, std::string> type =
+  StringResult<std::shared_ptr<rust_compiler::ast::types::TypeExpression>> type =
       parser.parseType();
 
   EXPECT_TRUE(type.isOk());
@@ -56,9 +59,10 @@ TEST(TypesTest, CheckBool) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::types::TypeExpression>, std::string> type =
+  StringResult<std::shared_ptr<rust_compiler::ast::types::TypeExpression>> type =
       parser.parseType();
 
   EXPECT_TRUE(type.isOk());
@@ -70,9 +74,10 @@ TEST(TypesTest, CheckBoolAsType) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::types::TypeExpression>, std::string> type =
+  StringResult<std::shared_ptr<rust_compiler::ast::types::TypeExpression>> type =
       parser.parseType();
 
   EXPECT_TRUE(type.isOk());
@@ -84,9 +89,10 @@ TEST(TypesTest, CheckI128AsType) {
 
   TokenStream ts = lex(text, "lib.rs");
 
-  Parser parser = {ts};
+  std::shared_ptr<ASTContext> context = std::make_shared<ASTContext>();
+  Parser parser = {ts, context};
 
-  Result<std::shared_ptr<rust_compiler::ast::types::TypeExpression>, std::string> type =
+  StringResult<std::shared_ptr<rust_compiler::ast::types::TypeExpression>> type =
       parser.parseType();
 
   EXPECT_TRUE(type.isOk());
@@ -5,6 +5,7 @@
 #include "Frontend/CompilerInvocation.h"
 #include "Frontend/FrontendActions.h"
 #include "Frontend/FrontendOptions.h"
+#include "Parser/ErrorStack.h"
 #include "Toml/Toml.h"
 
 #include <fstream>
@@ -14,6 +15,7 @@
 #include <llvm/Support/InitLLVM.h>
 #include <llvm/Support/Path.h>
 #include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/Threading.h>
 #include <llvm/Support/raw_ostream.h>
 #include <sstream>
 #include <string>
@@ -102,6 +104,19 @@ int main(int argc, char **argv) {
 
   llvm::errs() << "crateName: " << crateName << "\n";
 
+  llvm::ThreadPoolStrategy strategy = llvm::hardware_concurrency();
+  if (const llvm::opt::Arg *A = Args.getLastArg(OPT_threads_EQ)) {
+    if (auto threads = llvm::get_threadpool_strategy(A->getValue())) {
+      strategy = *threads;
+    } else {
+      errs() << "invalid --threads value: " << A->getValue() << "\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  if (Args.hasArg(OPT_trace_parser))
+    parser::ParserErrorStack::setTracing(true);
+
   std::string remarksOutput;
   llvm::SmallVector<char, 128> libFile{path.begin(), path.end()};
   llvm::sys::path::replace_extension(libFile, ".yaml");
@@ -116,6 +131,7 @@ int main(int argc, char **argv) {
     action.setInstance(&instance);
     action.setCurrentInput(input);
     action.setEdition(basic::Edition::Edition2024);
+    action.setThreadPoolStrategy(strategy);
 
     (void)action.execute();
 
@@ -125,6 +141,7 @@ int main(int argc, char **argv) {
     action.setInstance(&instance);
     action.setCurrentInput(input);
     action.setEdition(basic::Edition::Edition2024);
+    action.setThreadPoolStrategy(strategy);
 
     (void)action.execute();
   } else if (const llvm::opt::Arg *A = Args.getLastArg(OPT_compile)) {
@@ -133,6 +150,7 @@ int main(int argc, char **argv) {
     action.setInstance(&instance);
     action.setCurrentInput(input);
     action.setEdition(basic::Edition::Edition2024);
+    action.setThreadPoolStrategy(strategy);
 
     (void)action.execute();
   } else {